@@ -1,10 +1,26 @@
 #include "BigNumber_p.hpp"
 #include "BigNumber.hpp"
 
+#include <QDebug>
+#include <QHash>
+#include <QMutex>
+#include <QThreadStorage>
+
 namespace Telegram {
 
 namespace Utils {
 
+static QThreadStorage<SslBigNumberContext *> s_threadContext;
+
+// The BN_CTX is a scratch space which is reused by all calculations in the thread
+static BN_CTX *threadBigNumberContext()
+{
+    if (!s_threadContext.hasLocalData()) {
+        s_threadContext.setLocalData(new SslBigNumberContext());
+    }
+    return s_threadContext.localData()->context();
+}
+
 BigNumber::BigNumber()
 {
     BIGNUM *&own = getBigNum(d);
@@ -63,14 +79,105 @@ QByteArray BigNumber::toByteArray() const
 BigNumber BigNumber::mod_exp(const BigNumber &exponent, const BigNumber &modulus) const
 {
     BigNumber result;
-    SslBigNumberContext context;
 
     BIGNUM *&resultBN = getBigNum(result.d);
     const BIGNUM *argumentBN = getBigNum(d);
     const BIGNUM *exponentBN = getBigNum(exponent.d);
     const BIGNUM *modulusBN = getBigNum(modulus.d);
 
-    BN_mod_exp(resultBN, argumentBN, exponentBN, modulusBN, context.context());
+    BN_mod_exp(resultBN, argumentBN, exponentBN, modulusBN, threadBigNumberContext());
+    return result;
+}
+
+struct BigNumberModulusCache
+{
+    enum { MaximumSize = 8 };
+
+    QMutex mutex;
+    QHash<QByteArray, QSharedPointer<const BigNumberModulus>> moduli;
+};
+
+Q_GLOBAL_STATIC(BigNumberModulusCache, s_modulusCache)
+
+static BN_MONT_CTX *&getMontgomeryContext(void *&pointer)
+{
+    return reinterpret_cast<BN_MONT_CTX*&>(pointer);
+}
+
+static const BN_MONT_CTX *getMontgomeryContext(const void *pointer)
+{
+    return reinterpret_cast<const BN_MONT_CTX*>(pointer);
+}
+
+BigNumberModulus::BigNumberModulus(const QByteArray &modulus) :
+    m_modulus(modulus)
+{
+    // The Montgomery reduction requires an odd (and so non-zero) modulus
+    if (modulus.isEmpty() || !(modulus.at(modulus.size() - 1) & 1)) {
+        qWarning() << Q_FUNC_INFO << "Invalid modulus: the modulus must be odd and non-zero";
+        return;
+    }
+    BIGNUM *&own = getBigNum(d);
+    own = BN_bin2bn(reinterpret_cast<const uchar *>(modulus.constData()), modulus.size(), nullptr);
+    if (!own) {
+        return;
+    }
+    BN_MONT_CTX *&montgomeryContext = getMontgomeryContext(m_montgomeryContext);
+    montgomeryContext = BN_MONT_CTX_new();
+    if (!BN_MONT_CTX_set(montgomeryContext, own, threadBigNumberContext())) {
+        BN_MONT_CTX_free(montgomeryContext);
+        montgomeryContext = nullptr;
+    }
+}
+
+BigNumberModulus::~BigNumberModulus()
+{
+    BN_MONT_CTX_free(getMontgomeryContext(m_montgomeryContext));
+    BN_free(getBigNum(d));
+}
+
+bool BigNumberModulus::isValid() const
+{
+    return m_montgomeryContext;
+}
+
+QByteArray BigNumberModulus::modExp(const QByteArray &base, const QByteArray &exponent) const
+{
+    if (!isValid()) {
+        return QByteArray();
+    }
+    BN_CTX *context = threadBigNumberContext();
+    BN_CTX_start(context);
+    BIGNUM *baseBN = BN_CTX_get(context);
+    BIGNUM *exponentBN = BN_CTX_get(context);
+    BIGNUM *resultBN = BN_CTX_get(context);
+    QByteArray result;
+    if (resultBN
+            && BN_bin2bn(reinterpret_cast<const uchar *>(base.constData()), base.size(), baseBN)
+            && BN_bin2bn(reinterpret_cast<const uchar *>(exponent.constData()), exponent.size(), exponentBN)) {
+        BN_set_flags(exponentBN, BN_FLG_CONSTTIME);
+        // The Montgomery context is only read, so it is safe to share it between threads
+        if (BN_mod_exp_mont(resultBN, baseBN, exponentBN, getBigNum(d), context,
+                            const_cast<BN_MONT_CTX *>(getMontgomeryContext(m_montgomeryContext)))) {
+            result = bignumToByteArray(resultBN);
+        }
+    }
+    BN_CTX_end(context);
+    return result;
+}
+
+QSharedPointer<const BigNumberModulus> BigNumberModulus::get(const QByteArray &modulus)
+{
+    BigNumberModulusCache *cache = s_modulusCache();
+    QMutexLocker locker(&cache->mutex);
+    QSharedPointer<const BigNumberModulus> result = cache->moduli.value(modulus);
+    if (!result) {
+        if (cache->moduli.count() >= BigNumberModulusCache::MaximumSize) {
+            cache->moduli.clear();
+        }
+        result = QSharedPointer<const BigNumberModulus>(new BigNumberModulus(modulus));
+        cache->moduli.insert(modulus, result);
+    }
     return result;
 }
 
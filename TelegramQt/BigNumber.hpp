@@ -1,7 +1,10 @@
 #ifndef TELEGRAMQT_BIG_NUMBER_HPP
 #define TELEGRAMQT_BIG_NUMBER_HPP
 
+#include "telegramqt_global.h"
+
 #include <QByteArray>
+#include <QSharedPointer>
 
 namespace Telegram {
 
@@ -27,6 +30,31 @@ private:
     void *d = nullptr;
 };
 
+// An odd modulus (such as a DH prime) with the cached Montgomery context.
+// The exponentiation is thread-safe and uses a per-thread BN_CTX.
+class TELEGRAMQT_INTERNAL_EXPORT BigNumberModulus
+{
+public:
+    explicit BigNumberModulus(const QByteArray &modulus);
+    ~BigNumberModulus();
+
+    bool isValid() const;
+    QByteArray modulus() const { return m_modulus; }
+
+    // Returns base ^ exponent mod modulus. The exponent is treated as a secret.
+    QByteArray modExp(const QByteArray &base, const QByteArray &exponent) const;
+
+    // Returns a shared instance for the modulus, so the context is prepared only once per process
+    static QSharedPointer<const BigNumberModulus> get(const QByteArray &modulus);
+
+private:
+    Q_DISABLE_COPY(BigNumberModulus)
+
+    QByteArray m_modulus;
+    void *d = nullptr;
+    void *m_montgomeryContext = nullptr;
+};
+
 } // Utils namespace
 
 } // Telegram namespace
@@ -36,7 +36,7 @@ Q_LOGGING_CATEGORY(c_loggingTranport, "telegram.client.transport", QtWarningMsg)
 
 static const quint8 c_abridgedVersionByte = 0xef;
 static const quint32 c_intermediateVersionBytes = 0xeeeeeeeeu;
-static const quint32 c_obfucsatedProcotolIdentifier = 0xefefefefu;
+static const quint32 c_paddedIntermediateVersionBytes = 0xddddddddu;
 
 TcpTransport::TcpTransport(QObject *parent) :
     BaseTcpTransport(parent),
@@ -78,12 +78,24 @@ void TcpTransport::setPreferedSessionType(const BaseTcpTransport::SessionType se
     m_preferedSessionType = sessionType;
 }
 
+bool TcpTransport::setPreferedObfuscatedFraming(const BaseTcpTransport::SessionType framing)
+{
+    if (!protocolIdentifier(framing)) {
+        qCWarning(c_loggingTranport) << CALL_INFO << "The framing" << framing
+                                     << "can not be used for an obfuscated session";
+        return false;
+    }
+    m_preferedObfuscatedFraming = framing;
+    return true;
+}
+
 void TcpTransport::startObfuscatedSession()
 {
     qCDebug(c_loggingTranport) << CALL_INFO << "Start the session in Obfuscated format";
     // prepare random part
     const QVector<quint32> headerFirstWordBlackList = {
         0x44414548u, 0x54534f50u, 0x20544547u, 0x20544547u, c_intermediateVersionBytes,
+        c_paddedIntermediateVersionBytes,
     };
     const QVector<quint32> headerSecondWordBlackList = {
         0x0,
@@ -109,6 +121,7 @@ void TcpTransport::startObfuscatedSession()
     // first, next,       AES (key + Ivec),     protocol id, random 4 bytes; 64 bytes in total
     //      4      8                          56            60    64
     // xxxx | xxxx | xxxx ... xxxx (48 bytes) | 0xefefefefU | xxxx |
+    // The protocol id is 0xeeeeeeeeU or 0xddddddddU for (padded) intermediate framing.
     const quint32 trailingRandom = RandomGenerator::instance()->generate<quint32>();
 
     RawStream raw(RawStream::WriteOnly);
@@ -116,11 +129,13 @@ void TcpTransport::startObfuscatedSession()
     raw << next4Bytes;
     raw << aesSourceData;
     m_socket->write(raw.getData());
-    raw << c_obfucsatedProcotolIdentifier;
+    raw << protocolIdentifier(m_preferedObfuscatedFraming);
     raw << trailingRandom;
-    QByteArray encrypted = m_writeAesContext->crypt(raw.getData());
-    m_socket->write(encrypted.mid(56, 8));
+    QByteArray encrypted = raw.getData();
+    m_writeAesContext->crypt(encrypted.data(), encrypted.size());
+    m_socket->write(encrypted.constData() + 56, 8);
     setSessionType(Obfuscated);
+    setFraming(m_preferedObfuscatedFraming);
 }
 
 void TcpTransport::startAbridgedSession()
@@ -130,6 +145,23 @@ void TcpTransport::startAbridgedSession()
     setSessionType(Abridged);
 }
 
+void TcpTransport::startIntermediateSession(SessionType framing)
+{
+    qCDebug(c_loggingTranport) << "Start the session in" << framing << "format";
+    const quint32 versionBytes = framing == PaddedIntermediate
+            ? c_paddedIntermediateVersionBytes
+            : c_intermediateVersionBytes;
+    m_socket->write(reinterpret_cast<const char *>(&versionBytes), sizeof(versionBytes));
+    setSessionType(framing);
+}
+
+void TcpTransport::startFullSizeSession()
+{
+    // The full size session has no header; the server recognizes it by the zero packet number
+    qCDebug(c_loggingTranport) << "Start the session in FullSize format";
+    setSessionType(FullSize);
+}
+
 bool TcpTransport::setProxy(const QNetworkProxy &proxy)
 {
     if (m_socket->isOpen()) {
@@ -180,6 +212,13 @@ void TcpTransport::writeEvent()
     case Abridged:
         startAbridgedSession();
         break;
+    case Intermediate:
+    case PaddedIntermediate:
+        startIntermediateSession(m_preferedSessionType);
+        break;
+    case FullSize:
+        startFullSizeSession();
+        break;
     default:
         qCCritical(c_loggingTranport) << CALL_INFO
                                       << "The selected session type"
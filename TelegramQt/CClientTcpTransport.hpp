@@ -38,8 +38,14 @@ public:
     SessionType preferredSessionType() const { return m_preferedSessionType; }
     void setPreferedSessionType(const SessionType sessionType);
 
+    // The packet format of obfuscated sessions (Abridged, Intermediate or PaddedIntermediate)
+    SessionType preferredObfuscatedFraming() const { return m_preferedObfuscatedFraming; }
+    bool setPreferedObfuscatedFraming(const SessionType framing);
+
     void startObfuscatedSession();
     void startAbridgedSession();
+    void startIntermediateSession(SessionType framing);
+    void startFullSizeSession();
     bool setProxy(const QNetworkProxy &proxy);
 
 protected:
@@ -50,6 +56,7 @@ protected:
 
     QTimer *m_timeoutTimer = nullptr;
     SessionType m_preferedSessionType = Default;
+    SessionType m_preferedObfuscatedFraming = Abridged;
 };
 
 } // Client namespace
@@ -18,9 +18,12 @@
 #include "Crypto/AesCtr.hpp"
 #include "CTcpTransport.hpp"
 #include "Debug_p.hpp"
+#include "RandomGenerator.hpp"
 #include "RawStream.hpp"
+#include "Utils.hpp"
 
 #include <QHostAddress>
+#include <QtEndian>
 
 #include <QLoggingCategory>
 
@@ -31,9 +34,119 @@
 Q_LOGGING_CATEGORY(c_loggingTcpTransport, "telegram.transport.tcp", QtWarningMsg)
 
 static const quint32 c_defaultConnectionTimeout = 15 * 1000;
+static const int c_maxRetainedBufferCapacity = 64 * 1024;
+static const quint32 c_maxPacketSize = 0xffffffu * 4; // The biggest abridged packet
+
+static const quint32 c_abridgedProtocolIdentifier = 0xefefefefu;
+static const quint32 c_intermediateProtocolIdentifier = 0xeeeeeeeeu;
+static const quint32 c_paddedIntermediateProtocolIdentifier = 0xddddddddu;
 
 namespace Telegram {
 
+namespace {
+
+struct FrameInfo
+{
+    int headerSize = 0;
+    int payloadSize = 0;
+    int trailerSize = 0;
+
+    int size() const { return headerSize + payloadSize + trailerSize; }
+};
+
+enum class FrameParseResult {
+    Ok,
+    NeedMoreData,
+    Invalid,
+};
+
+FrameParseResult parseFrameHeader(BaseTcpTransport::SessionType framing,
+                                  const uchar *data, int available, FrameInfo *frame)
+{
+    switch (framing) {
+    case BaseTcpTransport::Intermediate:
+    case BaseTcpTransport::PaddedIntermediate:
+    {
+        // quint32 length, payload (and random padding)
+        frame->headerSize = 4;
+        if (available < frame->headerSize) {
+            return FrameParseResult::NeedMoreData;
+        }
+        const quint32 length = qFromLittleEndian<quint32>(data);
+        if (length > c_maxPacketSize) {
+            return FrameParseResult::Invalid;
+        }
+        frame->payloadSize = static_cast<int>(length);
+    }
+        return FrameParseResult::Ok;
+    case BaseTcpTransport::FullSize:
+    {
+        // quint32 length (the whole packet), quint32 packet number, payload, quint32 crc32
+        frame->headerSize = 8;
+        frame->trailerSize = 4;
+        if (available < 4) {
+            return FrameParseResult::NeedMoreData;
+        }
+        const quint32 length = qFromLittleEndian<quint32>(data);
+        if ((length < 12) || (length > c_maxPacketSize) || (length % 4)) {
+            return FrameParseResult::Invalid;
+        }
+        frame->payloadSize = static_cast<int>(length) - 12;
+    }
+        return FrameParseResult::Ok;
+    default:
+    {
+        // Abridged
+        const quint8 length_t1 = data[0];
+        if (length_t1 < 0x7fu) {
+            frame->headerSize = 1;
+            frame->payloadSize = length_t1 * 4;
+        } else if (length_t1 == 0x7fu) {
+            frame->headerSize = 4;
+            if (available < frame->headerSize) {
+                return FrameParseResult::NeedMoreData;
+            }
+            frame->payloadSize = (data[1] + data[2] * 256 + data[3] * 256 * 256) * 4;
+        } else {
+            return FrameParseResult::Invalid;
+        }
+    }
+        return FrameParseResult::Ok;
+    }
+}
+
+// The padded intermediate framing has no dedicated padding length field,
+// so the actual MTProto message size is deduced from the message itself.
+int unpaddedMessageSize(const uchar *data, int size)
+{
+    if (size < 8) {
+        return size; // Error code
+    }
+    const quint64 authKeyId = qFromLittleEndian<quint64>(data);
+    if (authKeyId) {
+        // quint64 authKeyId, quint128 messageKey, encrypted data (divisible by 16)
+        if (size < 24) {
+            return size;
+        }
+        return 24 + (size - 24) / 16 * 16;
+    }
+    // quint64 authKeyId (zero), quint64 messageId, quint32 messageLength, message
+    if (size < 20) {
+        return size;
+    }
+    const quint32 messageLength = qFromLittleEndian<quint32>(data + 16);
+    return static_cast<int>(qMin<quint32>(static_cast<quint32>(size), 20 + messageLength));
+}
+
+void appendLittleEndian(QByteArray *buffer, quint32 value)
+{
+    uchar bytes[4];
+    qToLittleEndian(value, bytes);
+    buffer->append(reinterpret_cast<const char *>(bytes), 4);
+}
+
+} // anonymous namespace
+
 BaseTcpTransport::BaseTcpTransport(QObject *parent) :
     BaseTransport(parent),
     m_socket(nullptr)
@@ -44,6 +157,7 @@ BaseTcpTransport::~BaseTcpTransport()
 {
     if (m_socket && m_socket->isWritable() && m_socket->isOpen()
             && m_socket->state() != QAbstractSocket::UnconnectedState) {
+        flushWrites();
         m_socket->waitForBytesWritten(100);
         qCDebug(c_loggingTcpTransport) << CALL_INFO << "close socket" << m_socket;
         m_socket->disconnectFromHost();
@@ -67,17 +181,27 @@ QString BaseTcpTransport::remoteAddress() const
     return m_socket ? m_socket->peerAddress().toString() : QString();
 }
 
+qint64 BaseTcpTransport::bufferedBytes() const
+{
+    const qint64 socketBytes = m_socket ? m_socket->bytesToWrite() : 0;
+    return m_writeBuffer.size() + socketBytes;
+}
+
 void BaseTcpTransport::disconnectFromHost()
 {
     qCDebug(c_loggingTcpTransport) << CALL_INFO;
+    flushWrites();
+    m_writeBuffer.clear();
     if (m_socket) {
         qCDebug(c_loggingTcpTransport) << CALL_INFO << "close socket" << m_socket;
         m_socket->disconnectFromHost();
     }
     m_readBuffer.clear();
+    m_readOffset = 0;
     m_packetNumber = 0;
-    m_expectedLength = 0;
+    m_readPacketNumber = 0;
     m_sessionType = Unknown;
+    m_framing = Unknown;
 }
 
 BaseTcpTransport::SessionType BaseTcpTransport::sessionType() const
@@ -89,11 +213,12 @@ void BaseTcpTransport::sendPacketImplementation(const QByteArray &payload)
 {
     qCDebug(c_loggingTcpTransport) << CALL_INFO << payload.size();
 
+    // Full size version:
     // quint32 length (included length itself + packet number
     //                 + crc32 + payload (MUST be divisible by 4)
     // quint32 packet number
-    // quint32 CRC32 (length, quint32 packet number, payload)
     // Payload
+    // quint32 CRC32 (length, quint32 packet number, payload)
 
     // Abridged version:
     // quint8: 0xef
@@ -102,33 +227,135 @@ void BaseTcpTransport::sendPacketImplementation(const QByteArray &payload)
     //      (quint8: 0x7f, quint24: Packet length / 4)
     // Payload
 
+    // Intermediate version:
+    // quint32: 0xeeeeeeee
+    // quint32: Packet length
+    // Payload
+
+    // Padded intermediate version:
+    // quint32: 0xdddddddd
+    // quint32: Packet length (including the padding)
+    // Payload
+    // 0-15 random bytes of padding
+
     if (payload.length() % 4) {
         qCCritical(c_loggingTcpTransport) << CALL_INFO
                                           << "Invalid outgoing packet! "
                                              "The payload size is not divisible by four!";
     }
 
-    QByteArray packet;
-    packet.reserve(payload.size() + 4);
-    const quint32 length = payload.length() / 4;
-    if (length < 0x7f) {
-        packet.append(char(length));
-    } else {
-        packet.append(char(0x7f));
-        packet.append(reinterpret_cast<const char *>(&length), 3);
+    int paddingSize = 0;
+    if ((m_framing == PaddedIntermediate) && (payload.size() >= 8)) {
+        // Error codes are never padded to keep them distinguishable
+        paddingSize = RandomGenerator::instance()->generate<quint8>() % 16;
+    }
+
+    // The packet is framed and encrypted right in the write buffer.
+    // The buffer keeps its capacity and may hold several packets if the write coalescing is enabled.
+    const int packetOffset = m_writeBuffer.size();
+    const int requiredCapacity = packetOffset + payload.size() + paddingSize + 12;
+    if (m_writeBuffer.capacity() < requiredCapacity) {
+        m_writeBuffer.reserve(qMax(requiredCapacity, m_writeBuffer.capacity() * 2));
+    }
+    switch (m_framing) {
+    case Intermediate:
+    case PaddedIntermediate:
+        appendLittleEndian(&m_writeBuffer, static_cast<quint32>(payload.size() + paddingSize));
+        break;
+    case FullSize:
+        appendLittleEndian(&m_writeBuffer, static_cast<quint32>(payload.size() + 12));
+        appendLittleEndian(&m_writeBuffer, m_packetNumber++);
+        break;
+    default:
+    {
+        const quint32 length = payload.length() / 4;
+        if (length < 0x7f) {
+            m_writeBuffer.append(char(length));
+        } else {
+            m_writeBuffer.append(char(0x7f));
+            m_writeBuffer.append(reinterpret_cast<const char *>(&length), 3);
+        }
+    }
+        break;
+    }
+    m_writeBuffer.append(payload);
+
+    if (paddingSize) {
+        const int paddingOffset = m_writeBuffer.size();
+        m_writeBuffer.resize(paddingOffset + paddingSize);
+        RandomGenerator::instance()->generate(m_writeBuffer.data() + paddingOffset, paddingSize);
+    } else if (m_framing == FullSize) {
+        const quint32 crc = Utils::crc32(m_writeBuffer.constData() + packetOffset,
+                                         m_writeBuffer.size() - packetOffset);
+        appendLittleEndian(&m_writeBuffer, crc);
     }
-    packet.append(payload);
 
+    const int packetSize = m_writeBuffer.size() - packetOffset;
     if (m_writeAesContext && m_writeAesContext->hasKey()) {
-        packet = m_writeAesContext->crypt(packet);
+        m_writeAesContext->crypt(m_writeBuffer.data() + packetOffset, packetSize);
     }
 
-    m_socket->write(packet);
+    if (isWriteCoalescingEnabled()) {
+        addPendingWrite(packetSize);
+        return;
+    }
+    flushWritesImplementation();
+}
+
+void BaseTcpTransport::flushWritesImplementation()
+{
+    if (m_writeBuffer.isEmpty()) {
+        return;
+    }
+    m_socket->write(m_writeBuffer);
+    if (m_writeBuffer.capacity() > c_maxRetainedBufferCapacity) {
+        // Do not keep a huge buffer after a big packet (e.g. a file part)
+        m_writeBuffer.clear();
+    } else {
+        // resize() keeps the reserved capacity
+        m_writeBuffer.resize(0);
+    }
 }
 
 void BaseTcpTransport::setSessionType(BaseTcpTransport::SessionType sessionType)
 {
     m_sessionType = sessionType;
+    if (sessionType != Obfuscated) {
+        m_framing = sessionType;
+    }
+}
+
+void BaseTcpTransport::setFraming(BaseTcpTransport::SessionType framing)
+{
+    m_framing = framing;
+}
+
+quint32 BaseTcpTransport::protocolIdentifier(BaseTcpTransport::SessionType framing)
+{
+    switch (framing) {
+    case Abridged:
+        return c_abridgedProtocolIdentifier;
+    case Intermediate:
+        return c_intermediateProtocolIdentifier;
+    case PaddedIntermediate:
+        return c_paddedIntermediateProtocolIdentifier;
+    default:
+        return 0;
+    }
+}
+
+BaseTcpTransport::SessionType BaseTcpTransport::framingFromProtocolIdentifier(quint32 identifier)
+{
+    switch (identifier) {
+    case c_abridgedProtocolIdentifier:
+        return Abridged;
+    case c_intermediateProtocolIdentifier:
+        return Intermediate;
+    case c_paddedIntermediateProtocolIdentifier:
+        return PaddedIntermediate;
+    default:
+        return Unknown;
+    }
 }
 
 void BaseTcpTransport::resetCryptoKeys()
@@ -182,9 +409,14 @@ void BaseTcpTransport::setState(QAbstractSocket::SocketState newState)
 {
     qCDebug(c_loggingTcpTransport) << CALL_INFO << newState;
     if (newState == QAbstractSocket::ConnectedState) {
-        m_expectedLength = 0;
+        m_packetNumber = 0;
+        m_readPacketNumber = 0;
         setSessionType(Unknown);
     }
+    if (newState == QAbstractSocket::UnconnectedState) {
+        // The data is encrypted for the closed session and can not be written anymore
+        m_writeBuffer.clear();
+    }
     BaseTransport::setState(newState);
 }
 
@@ -193,48 +425,97 @@ void BaseTcpTransport::onReadyRead()
     qCDebug(c_loggingTcpTransport) << CALL_INFO << m_socket->bytesAvailable();
     readEvent();
     if (m_sessionType == Unknown) {
-        qCCritical(c_loggingTcpTransport) << this << "Unknown session type!";
+        // The session header is not complete yet (an invalid header is reported by readEvent())
         return;
     }
-    if (m_socket->bytesAvailable() > 0) {
-        QByteArray allData = m_socket->readAll();
-        if (m_readAesContext) {
-            allData = m_readAesContext->crypt(allData);
+    const qint64 bytesAvailable = m_socket->bytesAvailable();
+    if (bytesAvailable > 0) {
+        // Read the data right into the tail of the buffer (no intermediate readAll() copy)
+        const int previousSize = m_readBuffer.size();
+        if (m_readBuffer.capacity() < previousSize + bytesAvailable) {
+            m_readBuffer.reserve(previousSize + static_cast<int>(bytesAvailable));
+        }
+        m_readBuffer.resize(previousSize + static_cast<int>(bytesAvailable));
+        const qint64 bytesRead = m_socket->read(m_readBuffer.data() + previousSize, bytesAvailable);
+        m_readBuffer.resize(previousSize + static_cast<int>(qMax<qint64>(bytesRead, 0)));
+        if (m_readAesContext && (m_readBuffer.size() > previousSize)) {
+            m_readAesContext->crypt(m_readBuffer.data() + previousSize, m_readBuffer.size() - previousSize);
+        }
+    }
+
+    // The buffer is parsed in place: m_readOffset points to the first unprocessed byte and
+    // the consumed data is dropped only once per read, instead of once per frame.
+    while (m_readOffset < m_readBuffer.size()) {
+        const uchar *data = reinterpret_cast<const uchar*>(m_readBuffer.constData()) + m_readOffset;
+        const int available = m_readBuffer.size() - m_readOffset;
+        FrameInfo frame;
+        const FrameParseResult parseResult = parseFrameHeader(m_framing, data, available, &frame);
+        if (parseResult == FrameParseResult::Invalid) {
+            qCWarning(c_loggingTcpTransport) << CALL_INFO << "Invalid packet header"
+                                             << QByteArray(reinterpret_cast<const char *>(data), qMin(available, 4)).toHex();
+            setError(QAbstractSocket::UnknownSocketError, QLatin1String("Invalid read operation"));
+            disconnectFromHost();
+            return;
+        }
+        if ((parseResult == FrameParseResult::NeedMoreData) || (available < frame.size())) {
+            qCDebug(c_loggingTcpTransport) << CALL_INFO << "Ready read, but only "
+                                           << available << "bytes available ("
+                                           << frame.size() << "bytes expected)";
+            break;
         }
-        m_readBuffer.append(allData);
-    }
-    while (m_readBuffer.size() >= 4) {
-        if (m_expectedLength == 0) {
-            const quint8 *data = reinterpret_cast<const quint8*>(m_readBuffer.constData());
-            quint8 length_t1 = data[0];
-            if (length_t1 < 0x7fu) {
-                m_expectedLength = length_t1 * 4;
-                m_readBuffer = m_readBuffer.mid(1);
-            } else if (length_t1 == 0x7fu) {
-                m_expectedLength = data[1] + data[2] * 256 + data[3] * 256 * 256;
-                m_expectedLength *= 4;
-                m_readBuffer = m_readBuffer.mid(4);
-            } else {
-                qCWarning(c_loggingTcpTransport) << CALL_INFO << "Invalid packet size byte"
-                                                 << hex << showbase << length_t1;
-                setError(QAbstractSocket::UnknownSocketError, QLatin1String("Invalid read operation"));
+        const uchar *payloadData = data + frame.headerSize;
+        int payloadSize = frame.payloadSize;
+        if (m_framing == FullSize) {
+            const quint32 packetNumber = qFromLittleEndian<quint32>(data + 4);
+            const quint32 crc = qFromLittleEndian<quint32>(payloadData + payloadSize);
+            if (crc != Utils::crc32(reinterpret_cast<const char *>(data), frame.headerSize + payloadSize)) {
+                qCWarning(c_loggingTcpTransport) << CALL_INFO << "CRC32 mismatch for packet" << packetNumber;
+                setError(QAbstractSocket::UnknownSocketError, QLatin1String("Invalid packet checksum"));
                 disconnectFromHost();
                 return;
             }
+            if (packetNumber != m_readPacketNumber) {
+                qCWarning(c_loggingTcpTransport) << CALL_INFO << "Unexpected packet number"
+                                                 << packetNumber << "(expected" << m_readPacketNumber << ")";
+                setError(QAbstractSocket::UnknownSocketError, QLatin1String("Invalid packet number"));
+                disconnectFromHost();
+                return;
+            }
+            ++m_readPacketNumber;
+        } else if (m_framing == PaddedIntermediate) {
+            payloadSize = unpaddedMessageSize(payloadData, payloadSize);
         }
-        if (m_readBuffer.size() < static_cast<int>(m_expectedLength)) {
-            qCDebug(c_loggingTcpTransport) << CALL_INFO << "Ready read, but only "
-                                           << m_readBuffer.size() << "bytes available ("
-                                           << m_expectedLength << "bytes expected)";
-            return;
-        }
-        const QByteArray payload = m_readBuffer.left(static_cast<int>(m_expectedLength));
-        m_readBuffer = m_readBuffer.mid(static_cast<int>(m_expectedLength));
-        m_expectedLength = 0;
+
+        // The payload is the only copy made per frame; receivers own it as before.
+        const QByteArray payload(reinterpret_cast<const char *>(payloadData), payloadSize);
+        m_readOffset += frame.size();
         qCDebug(c_loggingTcpTransport) << CALL_INFO
                                        << "Received a packet (" << payload.size() << " bytes)";
         emit packetReceived(payload);
+        if (m_readBuffer.isEmpty()) {
+            // A receiver disconnected the transport
+            return;
+        }
+    }
+    compactReadBuffer();
+}
+
+void BaseTcpTransport::compactReadBuffer()
+{
+    if (m_readOffset == 0) {
+        return;
+    }
+    const int unprocessedSize = m_readBuffer.size() - m_readOffset;
+    if (unprocessedSize > 0) {
+        memmove(m_readBuffer.data(), m_readBuffer.constData() + m_readOffset, unprocessedSize);
+    }
+    if ((unprocessedSize == 0) && (m_readBuffer.capacity() > c_maxRetainedBufferCapacity)) {
+        m_readBuffer.clear();
+    } else {
+        // resize() keeps the reserved capacity, so the next read does not reallocate
+        m_readBuffer.resize(unprocessedSize);
     }
+    m_readOffset = 0;
 }
 
 void BaseTcpTransport::onSocketErrorOccurred(QAbstractSocket::SocketError error)
@@ -252,6 +533,7 @@ void BaseTcpTransport::setSocket(QAbstractSocket *socket)
     connect(m_socket, SIGNAL(error(QAbstractSocket::SocketError)),
             SLOT(onSocketErrorOccurred(QAbstractSocket::SocketError)));
     connect(m_socket, &QIODevice::readyRead, this, &BaseTcpTransport::onReadyRead);
+    connect(m_socket, &QIODevice::bytesWritten, this, &BaseTcpTransport::updateWriteBufferState);
 }
 
 } // Telegram namespace
@@ -37,6 +37,8 @@ public:
         Abridged, // char(0xef)
         FullSize,
         Obfuscated,
+        Intermediate, // 0xeeeeeeee
+        PaddedIntermediate, // 0xdddddddd
         Default = Unknown,
     };
     Q_ENUM(SessionType)
@@ -51,10 +53,16 @@ public:
     static int connectionTimeout();
 
     QString remoteAddress() const override;
+    qint64 bufferedBytes() const override;
 
     void disconnectFromHost() override;
 
     SessionType sessionType() const;
+    // The packet format; the same as the session type for not obfuscated sessions
+    SessionType framing() const { return m_framing; }
+
+    static quint32 protocolIdentifier(SessionType framing);
+    static SessionType framingFromProtocolIdentifier(quint32 identifier);
 
 protected slots:
     void setState(QAbstractSocket::SocketState newState) override;
@@ -65,17 +73,23 @@ protected slots:
 protected:
     void setSocket(QAbstractSocket *socket);
     void sendPacketImplementation(const QByteArray &payload) override;
+    void flushWritesImplementation() override;
 
     void setSessionType(SessionType sessionType);
+    void setFraming(SessionType framing);
+    void compactReadBuffer();
     void resetCryptoKeys();
     void setCryptoKeysSourceData(const QByteArray &source, SourceRevertion revertion);
 
     quint32 m_packetNumber = 0;
-    quint32 m_expectedLength = 0;
+    quint32 m_readPacketNumber = 0;
     SessionType m_sessionType = Unknown;
+    SessionType m_framing = Unknown;
 
     QAbstractSocket *m_socket = nullptr;
     QByteArray m_readBuffer;
+    int m_readOffset = 0;
+    QByteArray m_writeBuffer;
     Telegram::Crypto::AesCtrContext *m_readAesContext = nullptr;
     Telegram::Crypto::AesCtrContext *m_writeAesContext = nullptr;
 
@@ -16,6 +16,8 @@
 
 #include "CTelegramTransport.hpp"
 
+#include <QTimer>
+
 namespace Telegram {
 
 BaseTransport::BaseTransport(QObject *parent) :
@@ -52,6 +54,89 @@ void BaseTransport::sendPacket(const QByteArray &payload)
     writeEvent();
     sendPacketImplementation(payload);
     emit packetSent(payload);
+    updateWriteBufferState();
+}
+
+void BaseTransport::setWriteCoalescingEnabled(bool enabled)
+{
+    if (m_writeCoalescingEnabled == enabled) {
+        return;
+    }
+    if (!enabled) {
+        flushWrites();
+    }
+    m_writeCoalescingEnabled = enabled;
+    if (enabled && !m_flushTimer) {
+        m_flushTimer = new QTimer(this);
+        m_flushTimer->setSingleShot(true);
+        m_flushTimer->setInterval(m_writeCoalescingMaxDelay);
+        connect(m_flushTimer, &QTimer::timeout, this, &BaseTransport::flushWrites);
+    }
+}
+
+void BaseTransport::setWriteCoalescingLimits(int maxBytes, int maxDelay)
+{
+    m_writeCoalescingMaxBytes = maxBytes;
+    m_writeCoalescingMaxDelay = maxDelay;
+    if (m_flushTimer) {
+        m_flushTimer->setInterval(maxDelay);
+    }
+}
+
+void BaseTransport::flushWrites()
+{
+    if (m_flushTimer) {
+        m_flushTimer->stop();
+    }
+    if (!m_pendingWritePackets) {
+        return;
+    }
+    flushWritesImplementation();
+
+    m_writeCoalescingStats.flushes++;
+    m_writeCoalescingStats.packets += m_pendingWritePackets;
+    m_writeCoalescingStats.bytes += m_pendingWriteBytes;
+    m_writeCoalescingStats.lastFlushPackets = m_pendingWritePackets;
+    m_writeCoalescingStats.maxFlushPackets = qMax(m_writeCoalescingStats.maxFlushPackets,
+                                                  m_pendingWritePackets);
+    m_pendingWritePackets = 0;
+    m_pendingWriteBytes = 0;
+    updateWriteBufferState();
+}
+
+void BaseTransport::setWriteWatermarks(qint64 high, qint64 low)
+{
+    m_highWatermark = high;
+    m_lowWatermark = qMin(low, high);
+    updateWriteBufferState();
+}
+
+void BaseTransport::updateWriteBufferState()
+{
+    const qint64 buffered = bufferedBytes();
+    m_maxBufferedBytes = qMax(m_maxBufferedBytes, buffered);
+    if (m_writeBufferFull) {
+        if (buffered <= m_lowWatermark || !m_highWatermark) {
+            m_writeBufferFull = false;
+            emit writeBufferDrained();
+        }
+    } else if (m_highWatermark && (buffered >= m_highWatermark)) {
+        m_writeBufferFull = true;
+        emit writeBufferFull();
+    }
+}
+
+void BaseTransport::addPendingWrite(int bytes)
+{
+    ++m_pendingWritePackets;
+    m_pendingWriteBytes += bytes;
+    if (m_pendingWriteBytes >= m_writeCoalescingMaxBytes) {
+        flushWrites();
+        return;
+    }
+    if (!m_flushTimer->isActive()) {
+        m_flushTimer->start();
+    }
 }
 
 void BaseTransport::setError(QAbstractSocket::SocketError e, const QString &text)
@@ -63,8 +148,19 @@ void BaseTransport::setError(QAbstractSocket::SocketError e, const QString &text
 
 void BaseTransport::setState(QAbstractSocket::SocketState s)
 {
+    if (s == QAbstractSocket::UnconnectedState) {
+        // Pending writes (if any) are dropped by the implementation
+        if (m_flushTimer) {
+            m_flushTimer->stop();
+        }
+        m_pendingWritePackets = 0;
+        m_pendingWriteBytes = 0;
+    }
     m_state = s;
     emit stateChanged(s);
+    if (s == QAbstractSocket::UnconnectedState) {
+        updateWriteBufferState();
+    }
 }
 
 } // Telegram namespace
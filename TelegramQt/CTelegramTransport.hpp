@@ -25,12 +25,23 @@
 #include <QByteArray>
 #include <QAbstractSocket>
 
+QT_FORWARD_DECLARE_CLASS(QTimer)
+
 namespace Telegram {
 
 class TELEGRAMQT_INTERNAL_EXPORT BaseTransport : public QObject
 {
     Q_OBJECT
 public:
+    struct WriteCoalescingStats
+    {
+        quint64 flushes = 0; // Number of the socket writes made on flush
+        quint64 packets = 0; // Number of the packets written by all flushes
+        quint64 bytes = 0; // Number of the bytes written by all flushes
+        int lastFlushPackets = 0; // Number of the packets merged by the last flush
+        int maxFlushPackets = 0; // The maximum number of the packets merged by a single flush
+    };
+
     explicit BaseTransport(QObject *parent = nullptr);
     virtual void connectToHost(const QString &ipAddress, quint16 port) = 0;
     virtual void disconnectFromHost() = 0;
@@ -41,6 +52,28 @@ public:
     QAbstractSocket::SocketError error() const { return m_error; }
     QAbstractSocket::SocketState state() const { return m_state; }
 
+    // Write coalescing (corking): the packets sent within one event loop iteration
+    // are gathered and written to the device at once.
+    bool isWriteCoalescingEnabled() const { return m_writeCoalescingEnabled; }
+    void setWriteCoalescingEnabled(bool enabled);
+    int writeCoalescingMaxBytes() const { return m_writeCoalescingMaxBytes; }
+    int writeCoalescingMaxDelay() const { return m_writeCoalescingMaxDelay; }
+    void setWriteCoalescingLimits(int maxBytes, int maxDelay);
+    WriteCoalescingStats writeCoalescingStats() const { return m_writeCoalescingStats; }
+
+    // Send-side backpressure: the number of bytes accepted by sendPacket() but not yet
+    // handed over to the peer (coalesced packets and the device write buffer).
+    virtual qint64 bufferedBytes() const { return m_pendingWriteBytes; }
+    qint64 maxBufferedBytes() const { return m_maxBufferedBytes; }
+
+    // writeBufferFull() is emitted once bufferedBytes() reaches the high watermark;
+    // writeBufferDrained() is emitted once it falls to the low watermark.
+    // The high watermark 0 disables the signalling.
+    qint64 highWatermark() const { return m_highWatermark; }
+    qint64 lowWatermark() const { return m_lowWatermark; }
+    void setWriteWatermarks(qint64 high, qint64 low);
+    bool isWriteBufferFull() const { return m_writeBufferFull; }
+
 signals:
     void errorOccurred(QAbstractSocket::SocketError error, const QString &text);
     void stateChanged(QAbstractSocket::SocketState state);
@@ -50,8 +83,12 @@ signals:
     void packetReceived(const QByteArray &payload);
     void packetSent(const QByteArray &payload);
 
+    void writeBufferFull();
+    void writeBufferDrained();
+
 public slots:
     void sendPacket(const QByteArray &payload);
+    void flushWrites();
 
 protected slots:
     void setError(QAbstractSocket::SocketError error, const QString &text);
@@ -62,12 +99,31 @@ protected:
     virtual void readEvent() {}
     virtual void writeEvent() {}
 
+    // Implementations call this instead of the immediate write if the write coalescing is enabled
+    void addPendingWrite(int bytes);
+    virtual void flushWritesImplementation() {}
+
+    // Implementations call this once the buffered data is (partially) written
+    void updateWriteBufferState();
+
 private:
     QAbstractSocket::SocketError m_error;
     QAbstractSocket::SocketState m_state;
     quint64 m_lastMessageId = 0;
     QString m_errorText;
 
+    QTimer *m_flushTimer = nullptr;
+    WriteCoalescingStats m_writeCoalescingStats;
+    int m_writeCoalescingMaxBytes = 64 * 1024;
+    int m_writeCoalescingMaxDelay = 0; // ms; 0 means "at the end of the event loop iteration"
+    int m_pendingWritePackets = 0;
+    int m_pendingWriteBytes = 0;
+    bool m_writeCoalescingEnabled = false;
+
+    qint64 m_highWatermark = 0;
+    qint64 m_lowWatermark = 0;
+    qint64 m_maxBufferedBytes = 0;
+    bool m_writeBufferFull = false;
 };
 
 } // Telegram namespace
@@ -42,7 +42,7 @@ public:
 
     void sendPacket(const QByteArray &package) override
     {
-        return m_connection->transport()->sendPacket(package);
+        m_connection->sendPacket(package);
     }
 };
 
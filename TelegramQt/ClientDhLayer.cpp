@@ -18,6 +18,7 @@
 #include "ClientDhLayer.hpp"
 
 #include "MTProto/Stream.hpp"
+#include "BigNumber.hpp"
 #include "CTelegramTransport.hpp"
 #include "PendingRpcOperation.hpp"
 #include "RandomGenerator.hpp"
@@ -325,6 +326,11 @@ bool DhLayer::processServerDHParamsOK(const QByteArray &encryptedAnswer)
         return false;
     }
 
+    if (!Utils::BigNumberModulus::get(m_dhPrime)->isValid()) {
+        qCWarning(c_clientDhLayerCategory) << "Error: Received dhPrime is not a valid modulus.";
+        return false;
+    }
+
     qCDebug(c_clientDhLayerCategory) << "dhPrime size:" << m_dhPrime.size() << m_dhPrime.toHex();
     qCDebug(c_clientDhLayerCategory) << "gA size:" << m_gA.size() << m_gA.toHex();
 
@@ -370,7 +376,7 @@ PendingRpcOperation *DhLayer::requestDhGenerationResult()
         QByteArray binNumber;
         binNumber.resize(sizeof(m_g));
         qToBigEndian(m_g, (uchar *) binNumber.data());
-        binNumber = Utils::binaryNumberModExp(binNumber, m_dhPrime, m_b);
+        binNumber = Utils::BigNumberModulus::get(m_dhPrime)->modExp(binNumber, m_b);
         encryptedStream << binNumber;
 
         const QByteArray innerData = encryptedStream.getData();
@@ -424,7 +430,11 @@ bool DhLayer::processServerDhAnswer(const QByteArray &payload)
     TLNumber128 newNonceHashLower128;
     inputStream >> newNonceHashLower128;
     const QByteArray readedHashPart(newNonceHashLower128.data, newNonceHashLower128.size());
-    const QByteArray newAuthKey = Utils::binaryNumberModExp(m_gA, m_dhPrime, m_b);
+    const QByteArray newAuthKey = Utils::BigNumberModulus::get(m_dhPrime)->modExp(m_gA, m_b);
+    if (newAuthKey.isEmpty()) {
+        qCWarning(c_clientDhLayerCategory) << "Error: Unable to compute the auth key.";
+        return false;
+    }
     const QByteArray newAuthKeySha = Utils::sha1(newAuthKey);
     QByteArray expectedHashData(m_newNonce.data, m_newNonce.size());
     expectedHashData.append(newAuthKeySha.left(8));
@@ -17,6 +17,7 @@
 
 #include "ClientRpcLayer.hpp"
 #include "ClientRpcUpdatesLayer.hpp"
+#include "Connection.hpp"
 #include "IgnoredMessageNotification.hpp"
 #include "SendPackageHelper.hpp"
 #include "Debug_p.hpp"
@@ -147,7 +148,15 @@ bool RpcLayer::processRpcResult(const MTProto::Message &message)
                                             << hex << showbase << messageId;
         return false;
     }
-    op->setFinishedWithReplyData(stream.readAll());
+    forgetContainer(messageId);
+    const QByteArray replyData = stream.readAll();
+    if (TLValue::firstFromArray(replyData) == TLValue::GzipPacked) {
+        // The reply is unpacked by the RPC layer extension
+        if (ConnectionCounters *counters = m_sendHelper->counters()) {
+            counters->addReceivedGzipPackedMessage();
+        }
+    }
+    op->setFinishedWithReplyData(replyData);
 #define DUMP_CLIENT_RPC_PACKETS
 #ifdef DUMP_CLIENT_RPC_PACKETS
     qCDebug(c_clientRpcLayerCategory) << "Client: Answer for message"
@@ -177,6 +186,9 @@ bool RpcLayer::processMessageAck(const MTProto::Message &message)
     TLVector<quint64> idsVector;
     stream >> idsVector;
     qCDebug(c_clientRpcLayerCategory) << "processMessageAck():" << idsVector;
+    for (const quint64 messageId : idsVector) {
+        forgetContainer(messageId);
+    }
 
     return true;
 }
@@ -210,6 +222,20 @@ bool RpcLayer::processIgnoredMessageNotification(const MTProto::Message &message
     MTProto::IgnoredMessageNotification notification(tlNotification);
     qCDebug(c_clientRpcLayerCategory) << CALL_INFO << notification.toString();
 
+    if (m_containers.contains(notification.messageId)) {
+        // The whole container is ignored, so process each of the contained messages
+        const QVector<quint64> messageIds = m_containers.take(notification.messageId);
+        bool result = true;
+        for (const quint64 messageId : messageIds) {
+            m_messageContainers.remove(messageId);
+            MTProto::Message *m = m_messages.value(messageId);
+            if (m) {
+                result = processIgnoredMessage(notification, m) && result;
+            }
+        }
+        return result;
+    }
+
     MTProto::Message *m = m_messages.value(notification.messageId);
     if (!m) {
         qCWarning(c_clientRpcLayerCategory) << CALL_INFO
@@ -217,14 +243,24 @@ bool RpcLayer::processIgnoredMessageNotification(const MTProto::Message &message
                                             << hex << showbase << notification.messageId;
         return false;
     }
+    return processIgnoredMessage(notification, m);
+}
+
+bool RpcLayer::processIgnoredMessage(const MTProto::IgnoredMessageNotification &notification,
+                                     MTProto::Message *m)
+{
+    if (!m_operations.contains(m->messageId) && (m->firstValue() == TLValue::MsgsAck)) {
+        // There is no operation to resend, so just acknowledge the messages once again
+        return requeueAcknowledgements(m->messageId);
+    }
 
     switch (notification.errorCode) {
     case MTProto::IgnoredMessageNotification::IncorrectServerSalt:
         // We sync local serverSalt value in processDecryptedMessageHeader().
         // Resend message will automatically apply the new salt
-        return resendIgnoredMessage(notification.messageId);
+        return resendIgnoredMessage(m->messageId);
     case MTProto::IgnoredMessageNotification::MessageIdTooOld:
-        return resendIgnoredMessage(notification.messageId);
+        return resendIgnoredMessage(m->messageId);
     case MTProto::IgnoredMessageNotification::SequenceNumberTooHigh:
         qCDebug(c_clientRpcLayerCategory) << "processIgnoredMessageNotification(SequenceNumberTooHigh):"
                                              " reduce seq num"
@@ -232,7 +268,7 @@ bool RpcLayer::processIgnoredMessageNotification(const MTProto::Message &message
                                           << " from" << m->sequenceNumber
                                           << " to" << (m->sequenceNumber - 2);
         m->sequenceNumber -= 2;
-        return resendIgnoredMessage(notification.messageId);
+        return resendIgnoredMessage(m->messageId);
     case MTProto::IgnoredMessageNotification::SequenceNumberTooLow:
         qCDebug(c_clientRpcLayerCategory) << "processIgnoredMessageNotification(SequenceNumberTooLow):"
                                              " increase seq num"
@@ -246,12 +282,12 @@ bool RpcLayer::processIgnoredMessageNotification(const MTProto::Message &message
             m_contentRelatedMessages = messageContentNumber + 1;
         }
     }
-        return resendIgnoredMessage(notification.messageId);
+        return resendIgnoredMessage(m->messageId);
     case MTProto::IgnoredMessageNotification::IncorrectTwoLowerOrderMessageIdBits:
         qCCritical(c_clientRpcLayerCategory) << "How we ever managed to mess with"
                                                 " the lower messageId bytes?!";
         // Just resend the message. We regenerate message id, so it can help.
-        return resendIgnoredMessage(notification.messageId);
+        return resendIgnoredMessage(m->messageId);
     default:
         break;
     }
@@ -278,16 +314,6 @@ bool RpcLayer::processMessageHeader(const MTProto::FullMessageHeader &header)
     return true;
 }
 
-QByteArray RpcLayer::getEncryptionKeyPart() const
-{
-    return m_sendHelper->getClientKeyPart();
-}
-
-QByteArray RpcLayer::getVerificationKeyPart() const
-{
-    return m_sendHelper->getServerKeyPart();
-}
-
 quint64 RpcLayer::sendRpc(PendingRpcOperation *operation)
 {
     operation->setConnection(m_sendHelper->getConnection());
@@ -314,7 +340,7 @@ quint64 RpcLayer::sendRpc(PendingRpcOperation *operation)
     }
     m_operations.insert(message->messageId, operation);
     m_messages.insert(message->messageId, message);
-    sendPacket(*message);
+    queueMessage(message);
     return message->messageId;
 }
 
@@ -335,26 +361,61 @@ bool RpcLayer::resendIgnoredMessage(quint64 messageId)
     message->messageId = m_sendHelper->newMessageId(SendMode::Client);
     m_operations.insert(message->messageId, operation);
     m_messages.insert(message->messageId, message);
-    sendPacket(*message);
+    queueMessage(message);
     emit operation->resent(messageId, message->messageId);
     return message->messageId;
 }
 
-void RpcLayer::acknowledgeMessages()
+void RpcLayer::sendQueuedMessages()
 {
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
-    TLVector<quint64> idsVector = m_messagesToAck;
-    m_messagesToAck.clear();
-    outputStream << TLValue::MsgsAck;
-    outputStream << idsVector;
+    m_sendingScheduled = false;
+
+    QVector<const MTProto::Message *> messages;
+    messages.reserve(m_messagesToSend.count() + 1);
+    for (const quint64 messageId : m_messagesToSend) {
+        // The queued messages are dropped on the connection lost
+        const MTProto::Message *message = m_messages.value(messageId);
+        if (message) {
+            messages.append(message);
+        }
+    }
+    m_messagesToSend.clear();
+    if (!m_messagesToAck.isEmpty()) {
+        // The acks message goes last to have the highest message id among the contained ones
+        messages.append(createAcknowledgeMessage());
+    }
 
-    MTProto::Message *message = new MTProto::Message();
-    message->messageId = m_sendHelper->newMessageId(SendMode::Client);
-    message->sequenceNumber = m_contentRelatedMessages * 2;
-    message->setData(outputStream.getData());
+    int first = 0;
+    while (first < messages.count()) {
+        int last = first + 1;
+        int containerSize = containedMessageSize(*messages.at(first));
+        while ((last < messages.count()) && (last - first < MaxContainerMessages)) {
+            const int messageSize = containedMessageSize(*messages.at(last));
+            if (containerSize + messageSize > MaxContainerSize) {
+                break;
+            }
+            containerSize += messageSize;
+            ++last;
+        }
 
-    m_messages.insert(message->messageId, message);
-    sendPacket(*message);
+        if (last - first == 1) {
+            // There is no point to wrap a single (or a too big) message
+            sendPacket(*messages.at(first));
+        } else {
+            const QVector<const MTProto::Message *> containerMessages = messages.mid(first, last - first);
+            const quint64 containerId = sendContainer(containerMessages, SendMode::Client);
+            if (containerId) {
+                QVector<quint64> messageIds;
+                messageIds.reserve(containerMessages.count());
+                for (const MTProto::Message *message : containerMessages) {
+                    messageIds.append(message->messageId);
+                    m_messageContainers.insert(message->messageId, containerId);
+                }
+                m_containers.insert(containerId, messageIds);
+            }
+        }
+        first = last;
+    }
 }
 
 void RpcLayer::onConnectionLost(const QVariantHash &details)
@@ -367,6 +428,9 @@ void RpcLayer::onConnectionLost(const QVariantHash &details)
     m_operations.clear();
     qDeleteAll(m_messages);
     m_messages.clear();
+    m_containers.clear();
+    m_messageContainers.clear();
+    m_messagesToSend.clear();
 }
 
 QByteArray RpcLayer::getInitConnection() const
@@ -390,16 +454,86 @@ QByteArray RpcLayer::getInitConnection() const
     return outputStream.getData();
 }
 
-void RpcLayer::addMessageToAck(quint64 messageId)
+void RpcLayer::queueMessage(const MTProto::Message *message)
+{
+    m_messagesToSend.append(message->messageId);
+    scheduleSending();
+}
+
+void RpcLayer::scheduleSending()
 {
-    if (m_messagesToAck.isEmpty()) {
+    if (m_sendingScheduled) {
+        return;
+    }
+    m_sendingScheduled = true;
 #if QT_VERSION >= QT_VERSION_CHECK(5, 10, 0)
-        QMetaObject::invokeMethod(this, &RpcLayer::acknowledgeMessages, Qt::QueuedConnection);
+    QMetaObject::invokeMethod(this, &RpcLayer::sendQueuedMessages, Qt::QueuedConnection);
 #else
-        QMetaObject::invokeMethod(this, "acknowledgeMessages", Qt::QueuedConnection);
+    QMetaObject::invokeMethod(this, "sendQueuedMessages", Qt::QueuedConnection);
 #endif
+}
+
+MTProto::Message *RpcLayer::createAcknowledgeMessage()
+{
+    TLVector<quint64> idsVector = m_messagesToAck;
+    m_messagesToAck.clear();
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly,
+                                 MTProto::serializedSize(TLValue::MsgsAck) + MTProto::serializedSize(idsVector));
+    outputStream << TLValue::MsgsAck;
+    outputStream << idsVector;
+
+    MTProto::Message *message = new MTProto::Message();
+    message->messageId = m_sendHelper->newMessageId(SendMode::Client);
+    message->sequenceNumber = m_contentRelatedMessages * 2;
+    message->setData(outputStream.getData());
+
+    m_messages.insert(message->messageId, message);
+    return message;
+}
+
+void RpcLayer::forgetContainer(quint64 messageId)
+{
+    // The message id is either the container id or the id of a contained message
+    const quint64 containerId = m_containers.contains(messageId) ? messageId : m_messageContainers.value(messageId);
+    if (!containerId) {
+        return;
     }
+    // The container is received by the server, so it can not be ignored anymore
+    const QVector<quint64> messageIds = m_containers.take(containerId);
+    for (const quint64 id : messageIds) {
+        m_messageContainers.remove(id);
+        if (!m_operations.contains(id)) {
+            // The answered RPC or the msgs_ack
+            delete m_messages.take(id);
+        }
+    }
+}
+
+bool RpcLayer::requeueAcknowledgements(quint64 messageId)
+{
+    MTProto::Message *message = m_messages.take(messageId);
+    if (!message) {
+        return false;
+    }
+    MTProto::Stream stream(message->skipTLValue().data);
+    TLVector<quint64> idsVector;
+    stream >> idsVector;
+    delete message;
+    if (stream.error()) {
+        qCWarning(c_clientRpcLayerCategory) << CALL_INFO << "Unable to read the acknowledged ids of"
+                                            << hex << showbase << messageId;
+        return false;
+    }
+    for (const quint64 id : idsVector) {
+        addMessageToAck(id);
+    }
+    return true;
+}
+
+void RpcLayer::addMessageToAck(quint64 messageId)
+{
     m_messagesToAck.append(messageId);
+    scheduleSending();
 }
 
 } // Client namespace
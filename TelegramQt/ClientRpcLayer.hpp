@@ -29,6 +29,7 @@ namespace Telegram {
 
 namespace MTProto {
 
+struct IgnoredMessageNotification;
 struct Message;
 
 } // MTProto namespace
@@ -40,7 +41,7 @@ class AuthOperation;
 class PendingRpcOperation;
 class UpdatesInternalApi;
 
-class RpcLayer : public Telegram::BaseRpcLayer
+class TELEGRAMQT_INTERNAL_EXPORT RpcLayer : public Telegram::BaseRpcLayer
 {
     Q_OBJECT
 public:
@@ -73,18 +74,23 @@ public:
     void onConnectionLost(const QVariantHash &details) override;
 
 protected Q_SLOTS:
-    void acknowledgeMessages();
+    void sendQueuedMessages();
 
 protected:
     bool processMessageHeader(const MTProto::FullMessageHeader &header) override;
-    Crypto::AesKey getDecryptionAesKey(const QByteArray &messageKey) const final { return generateServerToClientAesKey(messageKey); }
-    Crypto::AesKey getEncryptionAesKey(const QByteArray &messageKey) const final { return generateClientToServerAesKey(messageKey); }
-
-    QByteArray getEncryptionKeyPart() const final;
-    QByteArray getVerificationKeyPart() const final;
+    KeyPart encryptionKeyPart() const final { return ClientKeyPart; }
+    bool processIgnoredMessage(const MTProto::IgnoredMessageNotification &notification, MTProto::Message *message);
 
     QByteArray getInitConnection() const;
 
+    // The messages queued in the same event loop iteration are sent together in a msg_container
+    void queueMessage(const MTProto::Message *message);
+    void scheduleSending();
+    MTProto::Message *createAcknowledgeMessage();
+    // Drops the container bookkeeping once the server received the container
+    void forgetContainer(quint64 messageId);
+    bool requeueAcknowledgements(quint64 messageId);
+
     void addMessageToAck(quint64 messageId);
 
     AppInformation *m_appInfo = nullptr;
@@ -92,9 +98,13 @@ protected:
     AuthOperation *m_pendingAuthOperation = nullptr;
     QHash<quint64, PendingRpcOperation*> m_operations; // request message id, operation
     QHash<quint64, MTProto::Message*> m_messages; // request message id to MTProto::Message
+    QHash<quint64, QVector<quint64>> m_containers; // container message id, contained message ids
+    QHash<quint64, quint64> m_messageContainers; // contained message id, container message id
+    QVector<quint64> m_messagesToSend;
     quint64 m_sessionId = 0;
     quint64 m_serverSalt = 0;
     QVector<quint64> m_messagesToAck;
+    bool m_sendingScheduled = false;
 };
 
 } // Client namespace
@@ -20,7 +20,13 @@ public:
     enum class SessionType {
         None,
         Abridged,
-        Obfuscated,
+        Obfuscated, // Obfuscated Abridged
+        Intermediate,
+        PaddedIntermediate,
+        FullSize,
+        ObfuscatedIntermediate,
+        ObfuscatedPaddedIntermediate,
+        Loopback, // In-process connection to a server in the same application (see Server::setLoopbackTransportEnabled())
     };
     Q_ENUM(SessionType)
 
@@ -74,6 +74,12 @@ void BaseConnection::setTransport(BaseTransport *newTransport)
     connect(m_dhLayer, &BaseDhLayer::stateChanged, this, &BaseConnection::onDhStateChanged);
 }
 
+void BaseConnection::sendPacket(const QByteArray &payload)
+{
+    m_counters.addSentPacket(payload.size());
+    m_transport->sendPacket(payload);
+}
+
 void BaseConnection::setStatus(BaseConnection::Status status, BaseConnection::StatusReason reason)
 {
     if (m_status == status) {
@@ -136,6 +142,8 @@ void BaseConnection::onTransportStateChanged()
 void BaseConnection::onTransportPacketReceived(const QByteArray &payload)
 {
     qCDebug(c_baseConnectionCategory) << CALL_INFO << payload.size();
+    m_counters.addReceivedPacket(payload.size());
+    const ConnectionCounters::ProcessingTimeRecorder processingTimeRecorder(&m_counters);
     if (payload.size() == ConnectionError::packetSize()) {
         const ConnectionError e(payload.constData());
         qCWarning(c_baseConnectionCategory) << CALL_INFO << "Error:" << e.description();
@@ -3,6 +3,7 @@
 
 #include "telegramqt_global.h"
 
+#include "ConnectionCounters.hpp"
 #include "RsaKey.hpp"
 
 #include <QObject>
@@ -54,6 +55,10 @@ public:
 
     BaseTransport *transport() const { return m_transport; }
     void setTransport(BaseTransport *newTransport);
+    void sendPacket(const QByteArray &payload);
+
+    ConnectionCounters *counters() { return &m_counters; }
+    ConnectionStatistics statistics() const { return m_counters.statistics(); }
 
     Status status() const { return m_status; }
     void setStatus(Status status, StatusReason reason);
@@ -77,7 +82,7 @@ protected:
     quint64 m_authId = 0;
     RsaKey m_rsaKey;
     Status m_status = Status::Disconnected;
-
+    ConnectionCounters m_counters;
 };
 
 } // Telegram namespace
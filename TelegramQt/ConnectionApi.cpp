@@ -6,6 +6,7 @@
 #include "ClientRpcLayer.hpp"
 #include "ClientSettings.hpp"
 #include "CClientTcpTransport.hpp"
+#include "LoopbackTransport.hpp"
 #include "ConnectionError.hpp"
 #include "DataStorage.hpp"
 #include "Debug_p.hpp"
@@ -434,10 +435,30 @@ Connection *ConnectionApiPrivate::createConnection(const DcOption &dcOption)
 
     Settings *settings = backend()->m_settings;
     connection->setServerRsaKey(settings->serverRsaKey());
-    TcpTransport *transport = new TcpTransport(connection);
+    if (settings->preferedSessionType() == Settings::SessionType::Loopback) {
+        connection->setTransport(new LoopbackTransport(connection));
+    } else {
+        connection->setTransport(createTcpTransport(connection));
+    }
+
+    connect(connection, &BaseConnection::statusChanged,
+            this, [this, connection] (BaseConnection::Status status, BaseConnection::StatusReason reason) {
+        this->onConnectionStatusChanged(connection, status, reason);
+    });
+    connect(connection, &BaseConnection::errorOccured,
+            this, &ConnectionApiPrivate::onConnectionError);
+
+    return connection;
+}
+
+TcpTransport *ConnectionApiPrivate::createTcpTransport(QObject *parent)
+{
+    Settings *settings = backend()->m_settings;
+    TcpTransport *transport = new TcpTransport(parent);
     transport->setProxy(settings->proxy());
 
     switch (settings->preferedSessionType()) {
+    case Settings::SessionType::Loopback: // Not a TCP session type
     case Settings::SessionType::None:
         qCWarning(c_connectionApiLoggingCategory) << CALL_INFO
                                                   << "Session type is not set. Use fallback.";
@@ -449,17 +470,25 @@ Connection *ConnectionApiPrivate::createConnection(const DcOption &dcOption)
     case Settings::SessionType::Obfuscated:
         transport->setPreferedSessionType(TcpTransport::Obfuscated);
         break;
+    case Settings::SessionType::Intermediate:
+        transport->setPreferedSessionType(TcpTransport::Intermediate);
+        break;
+    case Settings::SessionType::PaddedIntermediate:
+        transport->setPreferedSessionType(TcpTransport::PaddedIntermediate);
+        break;
+    case Settings::SessionType::FullSize:
+        transport->setPreferedSessionType(TcpTransport::FullSize);
+        break;
+    case Settings::SessionType::ObfuscatedIntermediate:
+        transport->setPreferedSessionType(TcpTransport::Obfuscated);
+        transport->setPreferedObfuscatedFraming(TcpTransport::Intermediate);
+        break;
+    case Settings::SessionType::ObfuscatedPaddedIntermediate:
+        transport->setPreferedSessionType(TcpTransport::Obfuscated);
+        transport->setPreferedObfuscatedFraming(TcpTransport::PaddedIntermediate);
+        break;
     }
-    connection->setTransport(transport);
-
-    connect(connection, &BaseConnection::statusChanged,
-            this, [this, connection] (BaseConnection::Status status, BaseConnection::StatusReason reason) {
-        this->onConnectionStatusChanged(connection, status, reason);
-    });
-    connect(connection, &BaseConnection::errorOccured,
-            this, &ConnectionApiPrivate::onConnectionError);
-
-    return connection;
+    return transport;
 }
 
 /*!
@@ -930,6 +959,13 @@ ConnectionApi::Status ConnectionApi::status() const
     return d->status();
 }
 
+ConnectionStatistics ConnectionApi::statistics() const
+{
+    Q_D(const ConnectionApi);
+    const Connection *connection = d->m_mainConnection;
+    return connection ? connection->statistics() : ConnectionStatistics();
+}
+
 int ConnectionApi::remainingTimeToConnect() const
 {
     Q_D(const ConnectionApi);
@@ -60,6 +60,9 @@ public:
 
     Q_INVOKABLE int remainingTimeToConnect() const;
 
+    // Traffic and processing time counters of the main connection
+    ConnectionStatistics statistics() const;
+
     AuthOperation *startAuthentication();
     AuthOperation *checkIn();
 
@@ -36,6 +36,7 @@ class Connection;
 class ConnectOperation;
 class PingOperation;
 class BasePendingRpcResult;
+class TcpTransport;
 
 class TELEGRAMQT_INTERNAL_EXPORT ConnectionApiPrivate : public ClientApiPrivate
 {
@@ -68,6 +69,7 @@ public:
     ConnectOperation *connectToExtraDc(const ConnectionSpec &connectionSpec);
 
     Connection *createConnection(const DcOption &dcOption);
+    TcpTransport *createTcpTransport(QObject *parent);
     Connection *ensureConnection(const ConnectionSpec &connectionSpec);
 //    Connection *ensureConnection2(const ConnectionSpec &connectionSpec);
     void ensureConnected(Connection *connection);
@@ -0,0 +1,110 @@
+/*
+   Copyright (C) 2019 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+#ifndef TELEGRAM_CONNECTION_COUNTERS_HPP
+#define TELEGRAM_CONNECTION_COUNTERS_HPP
+
+#include "TelegramNamespace.hpp"
+
+#include <QAtomicInteger>
+#include <QElapsedTimer>
+
+namespace Telegram {
+
+// The hot path counters of a connection.
+// The counters are updated with relaxed atomic increments and can be read from any thread.
+class ConnectionCounters
+{
+public:
+    // Records the processing time of a received packet on the scope exit,
+    // so every processed packet lands in the histogram whichever way it leaves
+    class ProcessingTimeRecorder
+    {
+    public:
+        explicit ProcessingTimeRecorder(ConnectionCounters *counters) :
+            m_counters(counters)
+        {
+            m_timer.start();
+        }
+        ~ProcessingTimeRecorder()
+        {
+            m_counters->addProcessingTime(m_timer.nsecsElapsed());
+        }
+
+    private:
+        Q_DISABLE_COPY(ProcessingTimeRecorder)
+        ConnectionCounters *m_counters;
+        QElapsedTimer m_timer;
+    };
+
+    void addReceivedPacket(int bytes)
+    {
+        m_receivedBytes.fetchAndAddRelaxed(bytes);
+        m_receivedPackets.fetchAndAddRelaxed(1);
+    }
+    void addSentPacket(int bytes)
+    {
+        m_sentBytes.fetchAndAddRelaxed(bytes);
+        m_sentPackets.fetchAndAddRelaxed(1);
+    }
+    void addReceivedGzipPackedMessage() { m_receivedGzipPackedMessages.fetchAndAddRelaxed(1); }
+    void addSentGzipPackedMessage() { m_sentGzipPackedMessages.fetchAndAddRelaxed(1); }
+    void addDecryptionFailure() { m_decryptionFailures.fetchAndAddRelaxed(1); }
+    void addProcessingTime(qint64 nsecs)
+    {
+        const quint64 usecs = static_cast<quint64>(nsecs) / 1000;
+        int bucket = 0;
+        while ((bucket < ConnectionStatistics::ProcessingTimeBuckets - 1)
+               && (usecs >= ConnectionStatistics::processingTimeBucketLimit(bucket))) {
+            ++bucket;
+        }
+        m_processingTime.fetchAndAddRelaxed(usecs);
+        m_processingTimeHistogram[bucket].fetchAndAddRelaxed(1);
+    }
+
+    ConnectionStatistics statistics() const
+    {
+        ConnectionStatistics result;
+        result.receivedBytes = m_receivedBytes.load();
+        result.receivedPackets = m_receivedPackets.load();
+        result.sentBytes = m_sentBytes.load();
+        result.sentPackets = m_sentPackets.load();
+        result.receivedGzipPackedMessages = m_receivedGzipPackedMessages.load();
+        result.sentGzipPackedMessages = m_sentGzipPackedMessages.load();
+        result.decryptionFailures = m_decryptionFailures.load();
+        result.processingTime = m_processingTime.load();
+        for (int i = 0; i < ConnectionStatistics::ProcessingTimeBuckets; ++i) {
+            result.processingTimeHistogram[i] = m_processingTimeHistogram[i].load();
+        }
+        return result;
+    }
+
+protected:
+    QAtomicInteger<quint64> m_receivedBytes;
+    QAtomicInteger<quint64> m_receivedPackets;
+    QAtomicInteger<quint64> m_sentBytes;
+    QAtomicInteger<quint64> m_sentPackets;
+    QAtomicInteger<quint64> m_receivedGzipPackedMessages;
+    QAtomicInteger<quint64> m_sentGzipPackedMessages;
+    QAtomicInteger<quint64> m_decryptionFailures;
+    QAtomicInteger<quint64> m_processingTime;
+    QAtomicInteger<quint64> m_processingTimeHistogram[ConnectionStatistics::ProcessingTimeBuckets];
+};
+
+} // Telegram namespace
+
+#endif // TELEGRAM_CONNECTION_COUNTERS_HPP
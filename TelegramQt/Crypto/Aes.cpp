@@ -2,40 +2,182 @@
 
 #include <openssl/aes.h>
 
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define TELEGRAMQT_AES_NI
+#include <immintrin.h>
+#endif
+
 #include <QLoggingCategory>
 
 namespace Telegram {
 
 namespace Crypto {
 
-QByteArray aesDecrypt(const QByteArray &data, const AesKey &key)
+#ifdef TELEGRAMQT_AES_NI
+// AES-256 IGE with AES-NI. IGE chains both the previous ciphertext and the previous plaintext into
+// the block cipher input, so the blocks are processed sequentially in both directions; the gain
+// comes from the hardware rounds and from folding the chaining XORs into the first and the last
+// round keys, which leaves only the rounds and a single XOR on the dependency chain.
+namespace AesNi {
+
+enum {
+    Rounds = 14,
+};
+
+__attribute__((target("sse2,aes")))
+static inline __m128i expandKeyA(__m128i key, __m128i assist)
+{
+    assist = _mm_shuffle_epi32(assist, 0xff);
+    key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+    key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+    key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+    return _mm_xor_si128(key, assist);
+}
+
+__attribute__((target("sse2,aes")))
+static inline __m128i expandKeyB(__m128i keyA, __m128i keyB)
+{
+    const __m128i assist = _mm_shuffle_epi32(_mm_aeskeygenassist_si128(keyA, 0x00), 0xaa);
+    keyB = _mm_xor_si128(keyB, _mm_slli_si128(keyB, 4));
+    keyB = _mm_xor_si128(keyB, _mm_slli_si128(keyB, 4));
+    keyB = _mm_xor_si128(keyB, _mm_slli_si128(keyB, 4));
+    return _mm_xor_si128(keyB, assist);
+}
+
+#define TELEGRAMQT_AES_EXPAND_256(i, rcon) \
+    keyA = expandKeyA(keyA, _mm_aeskeygenassist_si128(keyB, rcon)); \
+    schedule[i] = keyA; \
+    keyB = expandKeyB(keyA, keyB); \
+    schedule[i + 1] = keyB;
+
+__attribute__((target("sse2,aes")))
+static void setEncryptKey(const uchar *key, __m128i *schedule)
+{
+    __m128i keyA = _mm_loadu_si128(reinterpret_cast<const __m128i *>(key));
+    __m128i keyB = _mm_loadu_si128(reinterpret_cast<const __m128i *>(key + 16));
+    schedule[0] = keyA;
+    schedule[1] = keyB;
+    TELEGRAMQT_AES_EXPAND_256(2, 0x01)
+    TELEGRAMQT_AES_EXPAND_256(4, 0x02)
+    TELEGRAMQT_AES_EXPAND_256(6, 0x04)
+    TELEGRAMQT_AES_EXPAND_256(8, 0x08)
+    TELEGRAMQT_AES_EXPAND_256(10, 0x10)
+    TELEGRAMQT_AES_EXPAND_256(12, 0x20)
+    schedule[14] = expandKeyA(keyA, _mm_aeskeygenassist_si128(keyB, 0x40));
+}
+
+#undef TELEGRAMQT_AES_EXPAND_256
+
+__attribute__((target("sse2,aes")))
+static void setDecryptKey(const uchar *key, __m128i *schedule)
+{
+    __m128i encryptSchedule[Rounds + 1];
+    setEncryptKey(key, encryptSchedule);
+    schedule[0] = encryptSchedule[Rounds];
+    for (int i = 1; i < Rounds; ++i) {
+        schedule[i] = _mm_aesimc_si128(encryptSchedule[Rounds - i]);
+    }
+    schedule[Rounds] = encryptSchedule[0];
+}
+
+// out_i = E(in_i ^ out_{i-1}) ^ in_{i-1}, where E is the block decryption for AES_DECRYPT.
+// The in and out can be the same buffer.
+template <int direction>
+__attribute__((target("sse2,aes")))
+static void igeCrypt(const uchar *in, uchar *out, int size, const uchar *key, uchar *iv)
+{
+    __m128i schedule[Rounds + 1];
+    if (direction == AES_ENCRYPT) {
+        setEncryptKey(key, schedule);
+    } else {
+        setDecryptKey(key, schedule);
+    }
+    // The encryption is chained with the ciphertext first, the decryption with the plaintext first
+    __m128i previousOutput = _mm_loadu_si128(reinterpret_cast<const __m128i *>(direction == AES_ENCRYPT ? iv : iv + 16));
+    __m128i previousInput = _mm_loadu_si128(reinterpret_cast<const __m128i *>(direction == AES_ENCRYPT ? iv + 16 : iv));
+
+    for (int offset = 0; offset < size; offset += AES_BLOCK_SIZE) {
+        const __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + offset));
+        // Off the dependency chain: the input whitening and the output chaining are merged with the round keys
+        const __m128i lastRoundKey = _mm_xor_si128(schedule[Rounds], previousInput);
+        __m128i state = _mm_xor_si128(_mm_xor_si128(input, schedule[0]), previousOutput);
+        for (int i = 1; i < Rounds; ++i) {
+            state = direction == AES_ENCRYPT ? _mm_aesenc_si128(state, schedule[i]) : _mm_aesdec_si128(state, schedule[i]);
+        }
+        state = direction == AES_ENCRYPT ? _mm_aesenclast_si128(state, lastRoundKey) : _mm_aesdeclast_si128(state, lastRoundKey);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + offset), state);
+        previousOutput = state;
+        previousInput = input;
+    }
+    // Update the IV the same way as AES_ige_encrypt() does to let the caller continue the chain
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(direction == AES_ENCRYPT ? iv : iv + 16), previousOutput);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(direction == AES_ENCRYPT ? iv + 16 : iv), previousInput);
+}
+
+static bool isSupported()
 {
-    if (data.length() % AES_BLOCK_SIZE) {
+    static const bool hasAesNi = __builtin_cpu_supports("sse2") && __builtin_cpu_supports("aes");
+    return hasAesNi;
+}
+
+} // AesNi
+#endif
+
+static bool aesIgeCrypt(const char *in, char *out, int size, AesKey *key, int direction)
+{
+    if (size % AES_BLOCK_SIZE) {
         qCritical() << __func__ << "Data is not padded (size %" << AES_BLOCK_SIZE << "!= 0)";
+        return false;
+    }
+    const uchar *input = reinterpret_cast<const uchar *>(in);
+    uchar *output = reinterpret_cast<uchar *>(out);
+#ifdef TELEGRAMQT_AES_NI
+    if (AesNi::isSupported()) {
+        if (direction == AES_ENCRYPT) {
+            AesNi::igeCrypt<AES_ENCRYPT>(input, output, size, key->key, key->iv);
+        } else {
+            AesNi::igeCrypt<AES_DECRYPT>(input, output, size, key->key, key->iv);
+        }
+        return true;
+    }
+#endif
+    AES_KEY aesKey;
+    if (direction == AES_ENCRYPT) {
+        AES_set_encrypt_key(key->key, AesKey::KeySize * 8, &aesKey);
+    } else {
+        AES_set_decrypt_key(key->key, AesKey::KeySize * 8, &aesKey);
+    }
+    AES_ige_encrypt(input, output, static_cast<size_t>(size), &aesKey, key->iv, direction);
+    return true;
+}
+
+bool aesDecrypt(const char *in, char *out, int size, AesKey *key)
+{
+    return aesIgeCrypt(in, out, size, key, AES_DECRYPT);
+}
+
+bool aesEncrypt(const char *in, char *out, int size, AesKey *key)
+{
+    return aesIgeCrypt(in, out, size, key, AES_ENCRYPT);
+}
+
+QByteArray aesDecrypt(const QByteArray &data, const AesKey &key)
+{
+    QByteArray result(data.size(), Qt::Uninitialized);
+    AesKey streamKey = key;
+    if (!aesDecrypt(data.constData(), result.data(), data.size(), &streamKey)) {
         return QByteArray();
     }
-    QByteArray result = data;
-    QByteArray initVector = key.iv;
-    AES_KEY dec_key;
-    AES_set_decrypt_key((const uchar *) key.key.constData(), key.key.length() * 8, &dec_key);
-    AES_ige_encrypt((const uchar *) data.constData(), (uchar *) result.data(), data.length(),
-                    &dec_key, (uchar *) initVector.data(), AES_DECRYPT);
     return result;
 }
 
 QByteArray aesEncrypt(const QByteArray &data, const AesKey &key)
 {
-    if (data.length() % AES_BLOCK_SIZE) {
-        qCritical() << __func__ << "Data is not padded "
-                                   "(the size %" << AES_BLOCK_SIZE << " is not zero)";
+    QByteArray result(data.size(), Qt::Uninitialized);
+    AesKey streamKey = key;
+    if (!aesEncrypt(data.constData(), result.data(), data.size(), &streamKey)) {
         return QByteArray();
     }
-    QByteArray result = data;
-    QByteArray initVector = key.iv;
-    AES_KEY enc_key;
-    AES_set_encrypt_key((const uchar *) key.key.constData(), key.key.length() * 8, &enc_key);
-    AES_ige_encrypt((const uchar *) data.constData(), (uchar *) result.data(), data.length(),
-                    &enc_key, (uchar *) initVector.data(), AES_ENCRYPT);
     return result;
 }
 
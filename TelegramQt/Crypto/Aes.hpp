@@ -22,30 +22,37 @@
 
 #include <QByteArray>
 
+#include <cstring>
+
 namespace Telegram {
 
 namespace Crypto {
 
 // Internal class
 struct TELEGRAMQT_INTERNAL_EXPORT AesKey {
-    QByteArray key;
-    QByteArray iv;
+    enum {
+        KeySize = 32,
+        IvSize = 32,
+    };
+    uchar key[KeySize] = { };
+    uchar iv[IvSize] = { };
 
     AesKey() = default;
-    AesKey(const QByteArray &initialKey, const QByteArray &initialIV) :
-        key(initialKey), iv(initialIV) { }
-
-    AesKey &operator=(const AesKey &anotherKey)
+    AesKey(const QByteArray &initialKey, const QByteArray &initialIV)
     {
-        key = anotherKey.key;
-        iv  = anotherKey.iv;
-        return *this;
+        memcpy(key, initialKey.constData(), static_cast<size_t>(qMin<int>(initialKey.size(), KeySize)));
+        memcpy(iv, initialIV.constData(), static_cast<size_t>(qMin<int>(initialIV.size(), IvSize)));
     }
 };
 
 TELEGRAMQT_INTERNAL_EXPORT QByteArray aesDecrypt(const QByteArray &data, const AesKey &key);
 TELEGRAMQT_INTERNAL_EXPORT QByteArray aesEncrypt(const QByteArray &data, const AesKey &key);
 
+// Process the size bytes from the in to the out (can be the same buffer) and advance the key IV,
+// so a message can be processed in several consecutive parts.
+TELEGRAMQT_INTERNAL_EXPORT bool aesDecrypt(const char *in, char *out, int size, AesKey *key);
+TELEGRAMQT_INTERNAL_EXPORT bool aesEncrypt(const char *in, char *out, int size, AesKey *key);
+
 } // Crypto namespace
 
 } // Telegram namespace
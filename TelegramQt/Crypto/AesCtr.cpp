@@ -30,6 +30,8 @@ namespace Telegram {
 
 namespace Crypto {
 
+static_assert(sizeof(AES_KEY) <= AesCtrContext::KeyScheduleSize, "The key schedule storage is too small");
+
 AesCtrContext::AesCtrContext()
 {
     m_ecount = QByteArray(EcountSize, char(0));
@@ -42,6 +44,9 @@ bool AesCtrContext::setKey(const QByteArray &key)
         return false;
     }
     m_key = key;
+    // Expand the key once; the schedule is reused for the context life time
+    AES_set_encrypt_key(reinterpret_cast<const unsigned char*>(m_key.constData()), KeySize * 8,
+                        reinterpret_cast<AES_KEY*>(m_keySchedule));
     return true;
 }
 
@@ -67,6 +72,27 @@ QByteArray AesCtrContext::crypt(const QByteArray &in)
 bool AesCtrContext::crypt(const QByteArray &in, QByteArray *out)
 {
     out->resize(in.size());
+    if (!crypt(in.constData(), out->data(), in.size())) {
+        return false;
+    }
+#ifdef TELEGRAM_DEBUG_CRYPTO
+    qCDebug(c_categoryCryptoAesCtr) << "in:" << in.toHex();
+    qCDebug(c_categoryCryptoAesCtr) << "out:" << out->toHex();
+#endif
+    return true;
+}
+
+bool AesCtrContext::crypt(char *data, int size)
+{
+    return crypt(data, data, size);
+}
+
+bool AesCtrContext::crypt(const char *in, char *out, int size)
+{
+    if (!hasKey()) {
+        qCCritical(c_categoryCryptoAesCtr) << "AesCtrContext::crypt(): The key is not set!";
+        return false;
+    }
     union {
         char *ivecData;
         unsigned char *ivecSsl[16];
@@ -79,16 +105,11 @@ bool AesCtrContext::crypt(const QByteArray &in, QByteArray *out)
     ecountData = m_ecount.data();
 
 #ifdef TELEGRAM_DEBUG_CRYPTO
-    qCDebug(c_categoryCryptoAesCtr).noquote() << QStringLiteral("Crypt 0x%1 (%2) bytes on ").arg(in.size(), 4, 16, QLatin1Char('0')).arg(in.size()) << m_description << "context" << this;
+    qCDebug(c_categoryCryptoAesCtr).noquote() << QStringLiteral("Crypt 0x%1 (%2) bytes on ").arg(size, 4, 16, QLatin1Char('0')).arg(size) << m_description << "context" << this;
     qCDebug(c_categoryCryptoAesCtr) << "Key:" << m_key.toHex() << "Ivec:" << m_ivec.toHex() << "Ecount:" << m_ecount.toHex();
 #endif // TELEGRAM_DEBUG_CRYPTO
-    AES_KEY aes;
-    AES_set_encrypt_key(reinterpret_cast<const unsigned char*>(m_key.constData()), 256, &aes);
-    CRYPTO_ctr128_encrypt(reinterpret_cast<const uchar*>(in.constData()), reinterpret_cast<uchar*>(out->data()), in.size(), &aes, *ivecSsl, *ecountSsl, &m_num, (block128_f) AES_encrypt);
-#ifdef TELEGRAM_DEBUG_CRYPTO
-    qCDebug(c_categoryCryptoAesCtr) << "in:" << in.toHex();
-    qCDebug(c_categoryCryptoAesCtr) << "out:" << out->toHex();
-#endif
+    const AES_KEY *aes = reinterpret_cast<const AES_KEY*>(m_keySchedule);
+    CRYPTO_ctr128_encrypt(reinterpret_cast<const uchar*>(in), reinterpret_cast<uchar*>(out), size, aes, *ivecSsl, *ecountSsl, &m_num, (block128_f) AES_encrypt);
     return true;
 }
 
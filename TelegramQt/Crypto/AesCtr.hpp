@@ -33,6 +33,7 @@ public:
     static constexpr int KeySize = 32;
     static constexpr int IvecSize = 16;
     static constexpr int EcountSize = 16;
+    static constexpr int KeyScheduleSize = 256; // Enough for the expanded AES-256 key (AES_KEY)
 
     QByteArray key() const { return m_key; }
     bool setKey(const QByteArray &key);
@@ -47,15 +48,19 @@ public:
 
     QByteArray crypt(const QByteArray &in);
     bool crypt(const QByteArray &in, QByteArray *out);
+    bool crypt(char *data, int size); // In-place
 
     // The context description is needed only for debug
     void setDescription(const QByteArray &desc) { m_description = desc; }
 protected:
+    bool crypt(const char *in, char *out, int size);
+
     QByteArray m_key;
     QByteArray m_ivec;
     QByteArray m_ecount;
     quint32 m_num = 0;
     QByteArray m_description;
+    alignas(16) unsigned char m_keySchedule[KeyScheduleSize] = { };
 };
 
 } // Crypto
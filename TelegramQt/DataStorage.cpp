@@ -416,6 +416,35 @@ void DataInternalApi::processData(const TLAuthAuthorization &authorization)
     processData(authorization.user);
 }
 
+void DataInternalApi::processData(const TLDialog &tlDialog)
+{
+    Peer peer = Utils::toPublicPeer(tlDialog.peer);
+    UserDialog *dialog = ensureDialog(peer);
+
+    bool wasPinned = m_pinnedDialogs.contains(peer);
+    if (tlDialog.pinned() != wasPinned) {
+        if (tlDialog.pinned()) {
+            m_pinnedDialogs.append(peer);
+        } else {
+            m_pinnedDialogs.removeOne(peer);
+        }
+    }
+
+    dialog->readInboxMaxId = tlDialog.readInboxMaxId;
+    dialog->readOutboxMaxId = tlDialog.readOutboxMaxId;
+    dialog->unreadCount = tlDialog.unreadCount;
+    dialog->unreadMentionsCount = tlDialog.unreadMentionsCount;
+    dialog->pts = tlDialog.pts;
+    dialog->draftText = tlDialog.draft.message;
+    dialog->flags = tlDialog.flags;
+
+    const TLMessage *message = getMessage(peer, tlDialog.topMessage);
+    if (message) {
+        dialog->topMessage = message->id;
+        dialog->date = message->date;
+    }
+}
+
 void DataInternalApi::processData(const TLMessagesDialogs &dialogs)
 {
     if (m_dialogs.isEmpty()) {
@@ -427,32 +456,50 @@ void DataInternalApi::processData(const TLMessagesDialogs &dialogs)
         processData(message);
     }
     for (const TLDialog &tlDialog : dialogs.dialogs) {
-        Peer peer = Utils::toPublicPeer(tlDialog.peer);
-        UserDialog *dialog = ensureDialog(peer);
+        processData(tlDialog);
+    }
+    updateDialogsOrder();
+}
 
-        bool wasPinned = m_pinnedDialogs.contains(peer);
-        if (tlDialog.pinned() != wasPinned) {
-            if (tlDialog.pinned()) {
-                m_pinnedDialogs.append(peer);
-            } else {
-                m_pinnedDialogs.removeOne(peer);
-            }
-        }
+MTProto::Stream &operator>>(MTProto::Stream &stream, LazyMessagesDialogs &dialogs)
+{
+    dialogs = LazyMessagesDialogs();
+    stream >> dialogs.tlType;
+
+    if (dialogs.tlType == TLValue::MessagesDialogsSlice) {
+        stream >> dialogs.count;
+    } else if (dialogs.tlType != TLValue::MessagesDialogs) {
+        return stream;
+    }
+    stream >> dialogs.dialogs;
+    stream >> dialogs.messages;
+    stream >> dialogs.chats;
+    stream >> dialogs.users;
+    return stream;
+}
 
-        dialog->readInboxMaxId = tlDialog.readInboxMaxId;
-        dialog->readOutboxMaxId = tlDialog.readOutboxMaxId;
-        dialog->unreadCount = tlDialog.unreadCount;
-        dialog->unreadMentionsCount = tlDialog.unreadMentionsCount;
-        dialog->pts = tlDialog.pts;
-        dialog->draftText = tlDialog.draft.message;
-        dialog->flags = tlDialog.flags;
-
-        const TLMessage *message = getMessage(peer, tlDialog.topMessage);
-        if (message) {
-            dialog->topMessage = message->id;
-            dialog->date = message->date;
+template <typename T>
+void DataInternalApi::processData(const MTProto::LazyVector<T> &vector)
+{
+    T value;
+    for (int i = 0; i < vector.count(); ++i) {
+        if (vector.read(i, &value)) {
+            processData(value);
         }
     }
+}
+
+void DataInternalApi::processData(const LazyMessagesDialogs &dialogs)
+{
+    if (m_dialogs.isEmpty()) {
+        m_dialogs.reserve(dialogs.count);
+    }
+    processData(dialogs.users);
+    processData(dialogs.chats);
+    processData(dialogs.messages);
+    for (const TLDialog &tlDialog : dialogs.dialogs) {
+        processData(tlDialog);
+    }
     updateDialogsOrder();
 }
 
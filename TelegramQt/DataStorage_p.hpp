@@ -20,6 +20,7 @@
 
 #include "DataStorage.hpp"
 
+#include "MTProto/LazyVector.hpp"
 #include "MTProto/TLTypes.hpp"
 #include "TelegramNamespace_p.hpp"
 
@@ -32,6 +33,19 @@ namespace Client {
 
 class DataInternalApi;
 
+// The messages.Dialogs reply with the messages, chats and users decoded on demand
+struct LazyMessagesDialogs
+{
+    TLValue tlType = TLValue::MessagesDialogs;
+    quint32 count = 0;
+    TLVector<TLDialog> dialogs;
+    MTProto::LazyVector<TLMessage> messages;
+    MTProto::LazyVector<TLChat> chats;
+    MTProto::LazyVector<TLUser> users;
+};
+
+MTProto::Stream &operator>>(MTProto::Stream &stream, LazyMessagesDialogs &dialogs);
+
 class DialogState {
 public:
     bool isValid() const { return syncedMessageId || !pendingIds.isEmpty() || synced; }
@@ -84,7 +98,9 @@ public:
     void processData(const TLVector<TLUser> &users);
     void processData(const TLUser &user);
     void processData(const TLAuthAuthorization &authorization);
+    void processData(const TLDialog &tlDialog);
     void processData(const TLMessagesDialogs &dialogs);
+    void processData(const LazyMessagesDialogs &dialogs);
     void processData(const TLMessagesMessages &messages);
 
     void setContactList(const TLVector<TLContact> &contacts);
@@ -124,6 +140,10 @@ public:
     const DialogState getDialogState(const Peer peer) const;
 
 protected:
+    // Decodes and processes the elements one by one
+    template <typename T>
+    void processData(const MTProto::LazyVector<T> &vector);
+
     void updateDialogsOrder();
 
     QHash<Telegram::Peer, DialogState> m_dialogStates;
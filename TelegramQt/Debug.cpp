@@ -85,7 +85,11 @@ QByteArray printBytes(const QByteArray &bytes)
 
 QDebug operator<<(QDebug d, const TLValue &v)
 {
-    d << v.toString();
+    if (const char *name = v.name()) {
+        d << QLatin1String(name);
+    } else {
+        d << v.toString();
+    }
     return d;
 }
 
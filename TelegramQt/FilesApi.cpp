@@ -7,6 +7,7 @@
 #include "ConnectionApi_p.hpp"
 #include "DataStorage_p.hpp"
 #include "Debug_p.hpp"
+#include "MTProto/Stream.hpp"
 #include "Operations/ConnectionOperation.hpp"
 #include "Operations/FileOperation_p.hpp"
 #include "RpcLayers/ClientRpcUploadLayer.hpp"
@@ -211,7 +212,6 @@ void FilesApiPrivate::processFileRequestForConnection(FileOperation *operation,
 void FilesApiPrivate::onGetFileResult(FileOperation *operation, UploadRpcLayer::PendingUploadFile *rpcOperation)
 {
     qCDebug(lcFilesApi) << __func__ << operation;
-    TLUploadFile result;
     if (rpcOperation->isFailed()) {
         qCWarning(lcFilesApi) << __func__ << "failed" << rpcOperation->errorDetails();
         if (rpcOperation->errorDetails().contains(Connection::c_statusKey())) {
@@ -229,7 +229,18 @@ void FilesApiPrivate::onGetFileResult(FileOperation *operation, UploadRpcLayer::
         operation->setFinishedWithError(rpcOperation->errorDetails());
         return;
     }
-    rpcOperation->getResult(&result);
+    // The result bytes reference the reply data (kept by the stream) instead of a copy of the chunk,
+    // so the stream is declared first to outlive the result
+    MTProto::Stream replyStream;
+    TLUploadFile result;
+    uploadLayer()->prepareReplyStream(&replyStream, rpcOperation);
+    replyStream.setBytesReferenceData(true);
+    replyStream >> result;
+    if (replyStream.error()) {
+        qCWarning(lcFilesApi) << __func__ << "Unable to read the file chunk of" << operation;
+        operation->setFinishedWithError({{PendingOperation::c_text(), QStringLiteral("Invalid file chunk reply")}});
+        return;
+    }
 
     FileOperationPrivate *privOperation = FileOperationPrivate::get(operation);
     static const QVector<TLValue> badTypes = {
@@ -0,0 +1,251 @@
+/*
+   Copyright (C) 2019 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+#include "LoopbackTransport.hpp"
+
+#include "Debug_p.hpp"
+
+#include <QHash>
+#include <QLoggingCategory>
+
+Q_LOGGING_CATEGORY(c_loggingLoopbackTransport, "telegram.transport.loopback", QtWarningMsg)
+
+namespace Telegram {
+
+using LoopbackListenerHash = QHash<QString, LoopbackListener*>;
+Q_GLOBAL_STATIC(LoopbackListenerHash, s_loopbackListeners)
+
+static QString listenerKey(const QString &address, quint16 port)
+{
+    return address + QLatin1Char(':') + QString::number(port);
+}
+
+LoopbackTransport::LoopbackTransport(QObject *parent) :
+    BaseTransport(parent)
+{
+}
+
+LoopbackTransport::~LoopbackTransport()
+{
+    if (m_peer) {
+        m_peer->onPeerDisconnected();
+    }
+}
+
+void LoopbackTransport::connectToHost(const QString &ipAddress, quint16 port)
+{
+    qCDebug(c_loggingLoopbackTransport) << CALL_INFO << ipAddress << port;
+    if (m_peer) {
+        qCWarning(c_loggingLoopbackTransport) << CALL_INFO << "The transport is already connected";
+        return;
+    }
+    setState(QAbstractSocket::ConnectingState);
+    // Connect asynchronously, like a socket does
+    QMetaObject::invokeMethod(this, "finishConnection", Qt::QueuedConnection,
+                              Q_ARG(QString, ipAddress), Q_ARG(quint16, port));
+}
+
+void LoopbackTransport::finishConnection(const QString &ipAddress, quint16 port)
+{
+    if (state() != QAbstractSocket::ConnectingState) {
+        // The connection is aborted
+        return;
+    }
+    LoopbackListener *listener = LoopbackListener::findListener(ipAddress, port);
+    if (!listener) {
+        qCDebug(c_loggingLoopbackTransport) << CALL_INFO << "No listener for" << ipAddress << port;
+        setError(QAbstractSocket::ConnectionRefusedError, QLatin1String("Connection refused"));
+        setState(QAbstractSocket::UnconnectedState);
+        return;
+    }
+    m_remoteAddress = ipAddress;
+    setPeer(listener->acceptConnection(this));
+    setState(QAbstractSocket::ConnectedState);
+}
+
+void LoopbackTransport::disconnectFromHost()
+{
+    qCDebug(c_loggingLoopbackTransport) << CALL_INFO;
+    if (state() == QAbstractSocket::UnconnectedState) {
+        return;
+    }
+    flushWrites();
+    LoopbackTransport *peer = m_peer;
+    m_peer = nullptr;
+    m_pendingWrites.clear();
+    m_queuedWriteBytes = 0;
+    m_incomingPackets.clear();
+    m_incomingBytes = 0;
+    m_peerDisconnected = false;
+    if (peer) {
+        peer->onPeerDisconnected();
+    }
+    setState(QAbstractSocket::UnconnectedState);
+}
+
+QString LoopbackTransport::remoteAddress() const
+{
+    return m_remoteAddress;
+}
+
+qint64 LoopbackTransport::bufferedBytes() const
+{
+    const qint64 peerBytes = m_peer ? m_peer->m_incomingBytes : 0;
+    return m_queuedWriteBytes + peerBytes;
+}
+
+void LoopbackTransport::setPeer(LoopbackTransport *peer)
+{
+    m_peer = peer;
+}
+
+void LoopbackTransport::sendPacketImplementation(const QByteArray &payload)
+{
+    if (!m_peer) {
+        qCWarning(c_loggingLoopbackTransport) << CALL_INFO << "Unable to send a packet: not connected";
+        return;
+    }
+    m_pendingWrites.append(payload);
+    m_queuedWriteBytes += payload.size();
+    if (isWriteCoalescingEnabled()) {
+        addPendingWrite(payload.size());
+        return;
+    }
+    flushWritesImplementation();
+}
+
+void LoopbackTransport::flushWritesImplementation()
+{
+    if (m_pendingWrites.isEmpty()) {
+        return;
+    }
+    if (m_peer) {
+        m_peer->enqueueIncomingPackets(m_pendingWrites);
+    }
+    m_pendingWrites.clear();
+    m_queuedWriteBytes = 0;
+}
+
+void LoopbackTransport::enqueueIncomingPackets(const QVector<QByteArray> &packets)
+{
+    const bool deliveryScheduled = !m_incomingPackets.isEmpty();
+    m_incomingPackets += packets;
+    for (const QByteArray &packet : packets) {
+        m_incomingBytes += packet.size();
+    }
+    if (!deliveryScheduled) {
+        // The packets are delivered on the next event loop iteration, as socket data would be.
+        QMetaObject::invokeMethod(this, "processIncomingPackets", Qt::QueuedConnection);
+    }
+}
+
+void LoopbackTransport::processIncomingPackets()
+{
+    const QVector<QByteArray> packets = m_incomingPackets;
+    m_incomingPackets.clear();
+    QPointer<LoopbackTransport> guard = this;
+    for (const QByteArray &packet : packets) {
+        if (!guard || (state() != QAbstractSocket::ConnectedState)) {
+            return;
+        }
+        m_incomingBytes -= packet.size();
+        emit packetReceived(packet);
+    }
+    if (!guard) {
+        return;
+    }
+    if (m_peer) {
+        m_peer->updateWriteBufferState();
+    } else if (m_peerDisconnected) {
+        finishPeerDisconnection();
+    }
+}
+
+void LoopbackTransport::onPeerDisconnected()
+{
+    m_peer = nullptr;
+    m_pendingWrites.clear();
+    m_queuedWriteBytes = 0;
+    if (!m_incomingPackets.isEmpty() && (state() == QAbstractSocket::ConnectedState)) {
+        // Deliver the packets sent before the disconnection first, as a socket does
+        m_peerDisconnected = true;
+        return;
+    }
+    finishPeerDisconnection();
+}
+
+void LoopbackTransport::finishPeerDisconnection()
+{
+    m_peerDisconnected = false;
+    m_incomingPackets.clear();
+    m_incomingBytes = 0;
+    if (state() != QAbstractSocket::UnconnectedState) {
+        setError(QAbstractSocket::RemoteHostClosedError, QLatin1String("The remote host closed the connection"));
+        setState(QAbstractSocket::UnconnectedState);
+    }
+}
+
+LoopbackListener::LoopbackListener(QObject *parent) :
+    QObject(parent)
+{
+}
+
+LoopbackListener::~LoopbackListener()
+{
+    close();
+}
+
+bool LoopbackListener::listen(const QString &address, quint16 port)
+{
+    const QString key = listenerKey(address, port);
+    if (s_loopbackListeners->contains(key)) {
+        qCWarning(c_loggingLoopbackTransport) << CALL_INFO << "The address is already in use:" << key;
+        return false;
+    }
+    close();
+    m_address = address;
+    m_port = port;
+    s_loopbackListeners->insert(key, this);
+    return true;
+}
+
+void LoopbackListener::close()
+{
+    if (!isListening()) {
+        return;
+    }
+    s_loopbackListeners->remove(listenerKey(m_address, m_port));
+    m_address.clear();
+    m_port = 0;
+}
+
+LoopbackListener *LoopbackListener::findListener(const QString &address, quint16 port)
+{
+    return s_loopbackListeners->value(listenerKey(address, port));
+}
+
+LoopbackTransport *LoopbackListener::acceptConnection(LoopbackTransport *clientTransport)
+{
+    LoopbackTransport *serverTransport = new LoopbackTransport(this);
+    serverTransport->m_remoteAddress = QStringLiteral("loopback");
+    serverTransport->setPeer(clientTransport);
+    serverTransport->setState(QAbstractSocket::ConnectedState);
+    emit newConnection(serverTransport);
+    return serverTransport;
+}
+
+} // Telegram namespace
@@ -0,0 +1,101 @@
+/*
+   Copyright (C) 2019 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+#ifndef TELEGRAM_LOOPBACK_TRANSPORT_HPP
+#define TELEGRAM_LOOPBACK_TRANSPORT_HPP
+
+#include "CTelegramTransport.hpp"
+
+#include <QPointer>
+#include <QVector>
+
+namespace Telegram {
+
+class LoopbackListener;
+
+// In-process transport: the packets are passed to the peer transport object
+// via the event loop, without any framing, socket or kernel round trip.
+// Both peers must live in the same thread.
+class TELEGRAMQT_INTERNAL_EXPORT LoopbackTransport : public BaseTransport
+{
+    Q_OBJECT
+public:
+    explicit LoopbackTransport(QObject *parent = nullptr);
+    ~LoopbackTransport() override;
+
+    void connectToHost(const QString &ipAddress, quint16 port) override;
+    void disconnectFromHost() override;
+
+    QString remoteAddress() const override;
+    // The packets queued for (or in) the peer and not processed by it yet
+    qint64 bufferedBytes() const override;
+
+    LoopbackTransport *peer() const { return m_peer; }
+
+protected slots:
+    void processIncomingPackets();
+    void finishConnection(const QString &ipAddress, quint16 port);
+
+protected:
+    void setPeer(LoopbackTransport *peer);
+    void sendPacketImplementation(const QByteArray &payload) override;
+    void flushWritesImplementation() override;
+    void enqueueIncomingPackets(const QVector<QByteArray> &packets);
+    void onPeerDisconnected();
+    void finishPeerDisconnection();
+
+    QPointer<LoopbackTransport> m_peer;
+    QVector<QByteArray> m_pendingWrites;
+    QVector<QByteArray> m_incomingPackets;
+    qint64 m_queuedWriteBytes = 0;
+    qint64 m_incomingBytes = 0;
+    QString m_remoteAddress;
+    bool m_peerDisconnected = false; // The incoming packets are delivered before the disconnection
+
+    friend class LoopbackListener;
+};
+
+// The in-process counterpart of QTcpServer
+class TELEGRAMQT_INTERNAL_EXPORT LoopbackListener : public QObject
+{
+    Q_OBJECT
+public:
+    explicit LoopbackListener(QObject *parent = nullptr);
+    ~LoopbackListener() override;
+
+    bool listen(const QString &address, quint16 port);
+    void close();
+    bool isListening() const { return !m_address.isEmpty(); }
+
+    static LoopbackListener *findListener(const QString &address, quint16 port);
+
+signals:
+    // The transport is parented to the listener; reparent it to take the ownership.
+    void newConnection(LoopbackTransport *transport);
+
+protected:
+    LoopbackTransport *acceptConnection(LoopbackTransport *clientTransport);
+
+    QString m_address;
+    quint16 m_port = 0;
+
+    friend class LoopbackTransport;
+};
+
+} // Telegram namespace
+
+#endif // TELEGRAM_LOOPBACK_TRANSPORT_HPP
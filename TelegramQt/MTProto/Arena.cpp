@@ -0,0 +1,92 @@
+/*
+   Copyright (C) 2019 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+#include "Arena.hpp"
+
+#include <cstdlib>
+
+namespace Telegram {
+
+namespace MTProto {
+
+Arena::Arena(int blockSize) :
+    m_blockSize(static_cast<size_t>(qMax(blockSize, 256)))
+{
+}
+
+Arena::~Arena()
+{
+    destroyObjects();
+    for (const Block &block : m_blocks) {
+        ::free(block.data);
+    }
+}
+
+bool Arena::contains(const void *pointer) const
+{
+    const char *data = static_cast<const char *>(pointer);
+    for (const Block &block : m_blocks) {
+        if ((data >= block.data) && (data < block.data + block.size)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void Arena::clear()
+{
+    destroyObjects();
+    if (m_blocks.isEmpty()) {
+        return;
+    }
+    for (int i = 1; i < m_blocks.count(); ++i) {
+        ::free(m_blocks.at(i).data);
+    }
+    m_blocks.resize(1);
+    m_position = m_blocks.first().data;
+    m_end = m_position + m_blocks.first().size;
+}
+
+void *Arena::allocate(size_t size, size_t alignment)
+{
+    quintptr position = (reinterpret_cast<quintptr>(m_position) + alignment - 1) & ~quintptr(alignment - 1);
+    if (!m_position || (position + size > reinterpret_cast<quintptr>(m_end))) {
+        // The malloc() result is suitably aligned for any object type
+        const size_t blockSize = qMax(m_blockSize, size);
+        char *data = static_cast<char *>(::malloc(blockSize));
+        Q_CHECK_PTR(data);
+        m_blocks.append({ data, blockSize });
+        position = reinterpret_cast<quintptr>(data);
+        m_end = data + blockSize;
+    }
+    m_position = reinterpret_cast<char *>(position + size);
+    return reinterpret_cast<void *>(position);
+}
+
+void Arena::destroyObjects()
+{
+    while (m_lastNode) {
+        Node *node = m_lastNode;
+        m_lastNode = node->previous;
+        node->destroy(node);
+    }
+    m_objectCount = 0;
+}
+
+} // MTProto namespace
+
+} // Telegram namespace
@@ -0,0 +1,105 @@
+/*
+   Copyright (C) 2019 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+#ifndef TELEGRAM_QT_MTPROTO_ARENA_HPP
+#define TELEGRAM_QT_MTPROTO_ARENA_HPP
+
+#include "telegramqt_global.h"
+
+#include <QVector>
+
+#include <new>
+
+namespace Telegram {
+
+namespace MTProto {
+
+// A region allocator for the decoded values released together (e.g. the nodes of a rich text reply).
+// The objects are placed one after another in large blocks and destroyed all at once on clear()
+// or the arena destruction. See Stream::setArena().
+class TELEGRAMQT_INTERNAL_EXPORT Arena
+{
+public:
+    explicit Arena(int blockSize = 16 * 1024);
+    ~Arena();
+
+    // Returns a default-constructed object owned by the arena
+    template <typename T>
+    T *create();
+
+    bool contains(const void *pointer) const;
+
+    // Destroys the objects and frees the blocks (except the first one kept for reuse)
+    void clear();
+
+    int blockCount() const { return m_blocks.count(); }
+    int objectCount() const { return m_objectCount; }
+
+protected:
+    Q_DISABLE_COPY(Arena)
+
+    struct Node
+    {
+        void (*destroy)(Node *node);
+        Node *previous;
+    };
+
+    template <typename T>
+    struct ObjectNode : public Node
+    {
+        T value;
+
+        static void destroyNode(Node *node)
+        {
+            static_cast<ObjectNode *>(node)->~ObjectNode();
+        }
+    };
+
+    struct Block
+    {
+        char *data;
+        size_t size;
+    };
+
+    void *allocate(size_t size, size_t alignment);
+    void destroyObjects();
+
+    QVector<Block> m_blocks;
+    char *m_position = nullptr;
+    char *m_end = nullptr;
+    Node *m_lastNode = nullptr;
+    size_t m_blockSize;
+    int m_objectCount = 0;
+};
+
+template <typename T>
+T *Arena::create()
+{
+    void *memory = allocate(sizeof(ObjectNode<T>), alignof(ObjectNode<T>));
+    ObjectNode<T> *node = new (memory) ObjectNode<T>();
+    node->destroy = &ObjectNode<T>::destroyNode;
+    node->previous = m_lastNode;
+    m_lastNode = node;
+    ++m_objectCount;
+    return &node->value;
+}
+
+} // MTProto namespace
+
+} // Telegram namespace
+
+#endif // TELEGRAM_QT_MTPROTO_ARENA_HPP
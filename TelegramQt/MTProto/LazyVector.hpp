@@ -0,0 +1,132 @@
+/*
+   Copyright (C) 2019 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+#ifndef TELEGRAM_QT_MTPROTO_LAZY_VECTOR_HPP
+#define TELEGRAM_QT_MTPROTO_LAZY_VECTOR_HPP
+
+#include "Stream.hpp"
+
+namespace Telegram {
+
+namespace MTProto {
+
+// A TL vector with the elements decoded on access.
+// The stream operator only skips the elements (see Stream::skip()) to record their offsets and
+// keeps a (shared) reference to the stream data. The data of a device stream can not be referenced,
+// so such a stream falls back to the eager decode. Intended for the large replies processed
+// element by element or partially.
+template <typename T>
+class LazyVector
+{
+public:
+    int count() const { return m_eager ? m_values.count() : m_offsets.count(); }
+    bool isEmpty() const { return count() == 0; }
+
+    bool read(int index, T *output) const;
+    T at(int index) const;
+    TLVector<T> toVector() const;
+
+    TLValue tlType = TLValue::Vector;
+
+protected:
+    template <typename U>
+    friend Stream &operator>>(Stream &stream, LazyVector<U> &v);
+
+    QByteArray m_data;
+    QVector<int> m_offsets;
+    TLVector<T> m_values; // The eagerly decoded elements
+    bool m_eager = false;
+};
+
+template <typename T>
+bool LazyVector<T>::read(int index, T *output) const
+{
+    if ((index < 0) || (index >= count())) {
+        return false;
+    }
+    if (m_eager) {
+        *output = m_values.at(index);
+        return true;
+    }
+    Stream stream(m_data);
+    stream.skipBytes(m_offsets.at(index));
+    stream >> *output;
+    return !stream.error();
+}
+
+template <typename T>
+T LazyVector<T>::at(int index) const
+{
+    T value;
+    read(index, &value);
+    return value;
+}
+
+template <typename T>
+TLVector<T> LazyVector<T>::toVector() const
+{
+    if (m_eager) {
+        return m_values;
+    }
+    TLVector<T> result;
+    result.tlType = tlType;
+    result.resize(count());
+    for (int i = 0; i < count(); ++i) {
+        read(i, &result[i]);
+    }
+    return result;
+}
+
+template <typename T>
+Stream &operator>>(Stream &stream, LazyVector<T> &v)
+{
+    v = LazyVector<T>();
+    if (stream.device()) {
+        v.m_eager = true;
+        stream >> v.m_values;
+        v.tlType = v.m_values.tlType;
+        if (stream.error()) {
+            v.m_values.clear();
+        }
+        return stream;
+    }
+
+    stream >> v.tlType;
+    if (v.tlType != TLValue::Vector) {
+        return stream;
+    }
+
+    quint32 length = 0;
+    stream >> length;
+    v.m_data = stream.getData();
+    // Each element takes at least 4 bytes
+    v.m_offsets.reserve(static_cast<int>(qMin<quint32>(length, static_cast<quint32>(stream.bytesAvailable() / 4))));
+    for (quint32 i = 0; (i < length) && !stream.error(); ++i) {
+        v.m_offsets.append(v.m_data.size() - stream.bytesAvailable());
+        stream.skip<T>();
+    }
+    if (stream.error()) {
+        v.m_offsets.clear();
+    }
+    return stream;
+}
+
+} // MTProto namespace
+
+} // Telegram namespace
+
+#endif // TELEGRAM_QT_MTPROTO_LAZY_VECTOR_HPP
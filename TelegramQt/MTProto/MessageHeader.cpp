@@ -19,6 +19,8 @@
 
 #include "RawStream.hpp"
 
+#include <QtEndian>
+
 namespace Telegram {
 
 namespace MTProto {
@@ -59,6 +61,26 @@ RawStream &operator<<(RawStream &stream, const FullMessageHeader &header)
     return stream;
 }
 
+FullMessageHeader FullMessageHeader::fromRawData(const char *data)
+{
+    FullMessageHeader header;
+    header.serverSalt = qFromLittleEndian<quint64>(data);
+    header.sessionId = qFromLittleEndian<quint64>(data + 8);
+    header.messageId = qFromLittleEndian<quint64>(data + 16);
+    header.sequenceNumber = qFromLittleEndian<quint32>(data + 24);
+    header.contentLength = qFromLittleEndian<quint32>(data + 28);
+    return header;
+}
+
+void FullMessageHeader::writeRawData(char *data) const
+{
+    qToLittleEndian<quint64>(serverSalt, data);
+    qToLittleEndian<quint64>(sessionId, data + 8);
+    qToLittleEndian<quint64>(messageId, data + 16);
+    qToLittleEndian<quint32>(sequenceNumber, data + 24);
+    qToLittleEndian<quint32>(contentLength, data + 28);
+}
+
 Message Message::skipBytes(int bytes) const
 {
     Message m = *this;
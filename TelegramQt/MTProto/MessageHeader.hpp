@@ -51,6 +51,10 @@ struct TELEGRAMQT_INTERNAL_EXPORT FullMessageHeader : public MessageHeader
     {
     }
 
+    // Read and write exactly headerLength bytes in the stream byte order
+    static FullMessageHeader fromRawData(const char *data);
+    void writeRawData(char *data) const;
+
     quint64 serverSalt = 0;
     quint64 sessionId = 0;
 
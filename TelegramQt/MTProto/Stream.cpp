@@ -17,6 +17,8 @@
 
 #include "Stream_p.hpp"
 
+#include "AbridgedLength.hpp"
+
 #include <QIODevice>
 #include <QDebug>
 
@@ -139,6 +141,51 @@ Stream &Stream::operator<<(const TLNumber<Size> &n)
     return *this;
 }
 
+quint32 serializedSize(const QByteArray &data)
+{
+    const AbridgedLength length(static_cast<quint32>(data.size()));
+    return static_cast<quint32>(length.packedSize() + data.size() + length.paddingForAlignment(4));
+}
+
+quint32 serializedSize(const QString &str)
+{
+    // The UTF-8 length of the string, the same as str.toUtf8().size() without the conversion
+    int utf8Size = 0;
+    const int size = str.size();
+    const QChar *chars = str.constData();
+    for (int i = 0; i < size; ++i) {
+        const ushort c = chars[i].unicode();
+        if (c < 0x80) {
+            utf8Size += 1;
+        } else if (c < 0x800) {
+            utf8Size += 2;
+        } else if (QChar::isHighSurrogate(c) && (i + 1 < size) && chars[i + 1].isLowSurrogate()) {
+            utf8Size += 4;
+            ++i;
+        } else if (QChar::isSurrogate(c)) {
+            // A lone surrogate is replaced by '?'
+            utf8Size += 1;
+        } else {
+            utf8Size += 3;
+        }
+    }
+    const AbridgedLength length(static_cast<quint32>(utf8Size));
+    return static_cast<quint32>(length.packedSize() + utf8Size + length.paddingForAlignment(4));
+}
+
+Stream &Stream::skipValue(QByteArray *)
+{
+    AbridgedLength length;
+    *this >> length;
+    skipBytes(static_cast<int>(length) + length.paddingForAlignment(4));
+    return *this;
+}
+
+Stream &Stream::skipValue(QString *)
+{
+    return skipValue(static_cast<QByteArray *>(nullptr));
+}
+
 // Generated read operators implementation
 Stream &Stream::operator>>(TLAccountDaysTTL &accountDaysTTLValue)
 {
@@ -154,7 +201,7 @@ Stream &Stream::operator>>(TLAccountDaysTTL &accountDaysTTLValue)
         break;
     }
 
-    accountDaysTTLValue = result;
+    accountDaysTTLValue = std::move(result);
 
     return *this;
 }
@@ -181,7 +228,7 @@ Stream &Stream::operator>>(TLAccountPassword &accountPasswordValue)
         break;
     }
 
-    accountPasswordValue = result;
+    accountPasswordValue = std::move(result);
 
     return *this;
 }
@@ -212,7 +259,7 @@ Stream &Stream::operator>>(TLAccountPasswordInputSettings &accountPasswordInputS
         break;
     }
 
-    accountPasswordInputSettingsValue = result;
+    accountPasswordInputSettingsValue = std::move(result);
 
     return *this;
 }
@@ -231,7 +278,7 @@ Stream &Stream::operator>>(TLAccountPasswordSettings &accountPasswordSettingsVal
         break;
     }
 
-    accountPasswordSettingsValue = result;
+    accountPasswordSettingsValue = std::move(result);
 
     return *this;
 }
@@ -251,7 +298,7 @@ Stream &Stream::operator>>(TLAccountTmpPassword &accountTmpPasswordValue)
         break;
     }
 
-    accountTmpPasswordValue = result;
+    accountTmpPasswordValue = std::move(result);
 
     return *this;
 }
@@ -270,7 +317,7 @@ Stream &Stream::operator>>(TLAuthCheckedPhone &authCheckedPhoneValue)
         break;
     }
 
-    authCheckedPhoneValue = result;
+    authCheckedPhoneValue = std::move(result);
 
     return *this;
 }
@@ -290,7 +337,7 @@ Stream &Stream::operator>>(TLAuthCodeType &authCodeTypeValue)
         break;
     }
 
-    authCodeTypeValue = result;
+    authCodeTypeValue = std::move(result);
 
     return *this;
 }
@@ -310,7 +357,7 @@ Stream &Stream::operator>>(TLAuthExportedAuthorization &authExportedAuthorizatio
         break;
     }
 
-    authExportedAuthorizationValue = result;
+    authExportedAuthorizationValue = std::move(result);
 
     return *this;
 }
@@ -329,7 +376,7 @@ Stream &Stream::operator>>(TLAuthPasswordRecovery &authPasswordRecoveryValue)
         break;
     }
 
-    authPasswordRecoveryValue = result;
+    authPasswordRecoveryValue = std::move(result);
 
     return *this;
 }
@@ -353,7 +400,7 @@ Stream &Stream::operator>>(TLAuthSentCodeType &authSentCodeTypeValue)
         break;
     }
 
-    authSentCodeTypeValue = result;
+    authSentCodeTypeValue = std::move(result);
 
     return *this;
 }
@@ -384,7 +431,7 @@ Stream &Stream::operator>>(TLAuthorization &authorizationValue)
         break;
     }
 
-    authorizationValue = result;
+    authorizationValue = std::move(result);
 
     return *this;
 }
@@ -411,7 +458,7 @@ Stream &Stream::operator>>(TLBadMsgNotification &badMsgNotificationValue)
         break;
     }
 
-    badMsgNotificationValue = result;
+    badMsgNotificationValue = std::move(result);
 
     return *this;
 }
@@ -431,7 +478,7 @@ Stream &Stream::operator>>(TLBotCommand &botCommandValue)
         break;
     }
 
-    botCommandValue = result;
+    botCommandValue = std::move(result);
 
     return *this;
 }
@@ -452,7 +499,7 @@ Stream &Stream::operator>>(TLBotInfo &botInfoValue)
         break;
     }
 
-    botInfoValue = result;
+    botInfoValue = std::move(result);
 
     return *this;
 }
@@ -473,7 +520,7 @@ Stream &Stream::operator>>(TLCdnFileHash &cdnFileHashValue)
         break;
     }
 
-    cdnFileHashValue = result;
+    cdnFileHashValue = std::move(result);
 
     return *this;
 }
@@ -493,7 +540,7 @@ Stream &Stream::operator>>(TLCdnPublicKey &cdnPublicKeyValue)
         break;
     }
 
-    cdnPublicKeyValue = result;
+    cdnPublicKeyValue = std::move(result);
 
     return *this;
 }
@@ -518,7 +565,7 @@ Stream &Stream::operator>>(TLChannelParticipantsFilter &channelParticipantsFilte
         break;
     }
 
-    channelParticipantsFilterValue = result;
+    channelParticipantsFilterValue = std::move(result);
 
     return *this;
 }
@@ -543,7 +590,7 @@ Stream &Stream::operator>>(TLChatParticipant &chatParticipantValue)
         break;
     }
 
-    chatParticipantValue = result;
+    chatParticipantValue = std::move(result);
 
     return *this;
 }
@@ -571,7 +618,7 @@ Stream &Stream::operator>>(TLChatParticipants &chatParticipantsValue)
         break;
     }
 
-    chatParticipantsValue = result;
+    chatParticipantsValue = std::move(result);
 
     return *this;
 }
@@ -593,7 +640,7 @@ Stream &Stream::operator>>(TLClientDHInnerData &clientDHInnerDataValue)
         break;
     }
 
-    clientDHInnerDataValue = result;
+    clientDHInnerDataValue = std::move(result);
 
     return *this;
 }
@@ -613,7 +660,7 @@ Stream &Stream::operator>>(TLContact &contactValue)
         break;
     }
 
-    contactValue = result;
+    contactValue = std::move(result);
 
     return *this;
 }
@@ -633,7 +680,7 @@ Stream &Stream::operator>>(TLContactBlocked &contactBlockedValue)
         break;
     }
 
-    contactBlockedValue = result;
+    contactBlockedValue = std::move(result);
 
     return *this;
 }
@@ -654,7 +701,7 @@ Stream &Stream::operator>>(TLContactLink &contactLinkValue)
         break;
     }
 
-    contactLinkValue = result;
+    contactLinkValue = std::move(result);
 
     return *this;
 }
@@ -673,7 +720,7 @@ Stream &Stream::operator>>(TLDataJSON &dataJSONValue)
         break;
     }
 
-    dataJSONValue = result;
+    dataJSONValue = std::move(result);
 
     return *this;
 }
@@ -693,7 +740,7 @@ Stream &Stream::operator>>(TLDestroyAuthKeyRes &destroyAuthKeyResValue)
         break;
     }
 
-    destroyAuthKeyResValue = result;
+    destroyAuthKeyResValue = std::move(result);
 
     return *this;
 }
@@ -713,7 +760,7 @@ Stream &Stream::operator>>(TLDestroySessionRes &destroySessionResValue)
         break;
     }
 
-    destroySessionResValue = result;
+    destroySessionResValue = std::move(result);
 
     return *this;
 }
@@ -733,7 +780,7 @@ Stream &Stream::operator>>(TLDisabledFeature &disabledFeatureValue)
         break;
     }
 
-    disabledFeatureValue = result;
+    disabledFeatureValue = std::move(result);
 
     return *this;
 }
@@ -777,7 +824,7 @@ Stream &Stream::operator>>(TLEncryptedChat &encryptedChatValue)
         break;
     }
 
-    encryptedChatValue = result;
+    encryptedChatValue = std::move(result);
 
     return *this;
 }
@@ -802,7 +849,7 @@ Stream &Stream::operator>>(TLEncryptedFile &encryptedFileValue)
         break;
     }
 
-    encryptedFileValue = result;
+    encryptedFileValue = std::move(result);
 
     return *this;
 }
@@ -831,7 +878,7 @@ Stream &Stream::operator>>(TLEncryptedMessage &encryptedMessageValue)
         break;
     }
 
-    encryptedMessageValue = result;
+    encryptedMessageValue = std::move(result);
 
     return *this;
 }
@@ -851,7 +898,7 @@ Stream &Stream::operator>>(TLError &errorValue)
         break;
     }
 
-    errorValue = result;
+    errorValue = std::move(result);
 
     return *this;
 }
@@ -872,7 +919,7 @@ Stream &Stream::operator>>(TLExportedChatInvite &exportedChatInviteValue)
         break;
     }
 
-    exportedChatInviteValue = result;
+    exportedChatInviteValue = std::move(result);
 
     return *this;
 }
@@ -891,7 +938,7 @@ Stream &Stream::operator>>(TLExportedMessageLink &exportedMessageLinkValue)
         break;
     }
 
-    exportedMessageLinkValue = result;
+    exportedMessageLinkValue = std::move(result);
 
     return *this;
 }
@@ -918,7 +965,7 @@ Stream &Stream::operator>>(TLFileLocation &fileLocationValue)
         break;
     }
 
-    fileLocationValue = result;
+    fileLocationValue = std::move(result);
 
     return *this;
 }
@@ -939,7 +986,7 @@ Stream &Stream::operator>>(TLFutureSalt &futureSaltValue)
         break;
     }
 
-    futureSaltValue = result;
+    futureSaltValue = std::move(result);
 
     return *this;
 }
@@ -960,7 +1007,7 @@ Stream &Stream::operator>>(TLFutureSalts &futureSaltsValue)
         break;
     }
 
-    futureSaltsValue = result;
+    futureSaltsValue = std::move(result);
 
     return *this;
 }
@@ -982,7 +1029,7 @@ Stream &Stream::operator>>(TLGeoPoint &geoPointValue)
         break;
     }
 
-    geoPointValue = result;
+    geoPointValue = std::move(result);
 
     return *this;
 }
@@ -1006,7 +1053,7 @@ Stream &Stream::operator>>(TLHelpAppUpdate &helpAppUpdateValue)
         break;
     }
 
-    helpAppUpdateValue = result;
+    helpAppUpdateValue = std::move(result);
 
     return *this;
 }
@@ -1025,7 +1072,7 @@ Stream &Stream::operator>>(TLHelpInviteText &helpInviteTextValue)
         break;
     }
 
-    helpInviteTextValue = result;
+    helpInviteTextValue = std::move(result);
 
     return *this;
 }
@@ -1044,7 +1091,7 @@ Stream &Stream::operator>>(TLHelpTermsOfService &helpTermsOfServiceValue)
         break;
     }
 
-    helpTermsOfServiceValue = result;
+    helpTermsOfServiceValue = std::move(result);
 
     return *this;
 }
@@ -1065,7 +1112,7 @@ Stream &Stream::operator>>(TLHighScore &highScoreValue)
         break;
     }
 
-    highScoreValue = result;
+    highScoreValue = std::move(result);
 
     return *this;
 }
@@ -1086,7 +1133,7 @@ Stream &Stream::operator>>(TLHttpWait &httpWaitValue)
         break;
     }
 
-    httpWaitValue = result;
+    httpWaitValue = std::move(result);
 
     return *this;
 }
@@ -1106,7 +1153,7 @@ Stream &Stream::operator>>(TLImportedContact &importedContactValue)
         break;
     }
 
-    importedContactValue = result;
+    importedContactValue = std::move(result);
 
     return *this;
 }
@@ -1126,7 +1173,7 @@ Stream &Stream::operator>>(TLInlineBotSwitchPM &inlineBotSwitchPMValue)
         break;
     }
 
-    inlineBotSwitchPMValue = result;
+    inlineBotSwitchPMValue = std::move(result);
 
     return *this;
 }
@@ -1148,7 +1195,7 @@ Stream &Stream::operator>>(TLInputAppEvent &inputAppEventValue)
         break;
     }
 
-    inputAppEventValue = result;
+    inputAppEventValue = std::move(result);
 
     return *this;
 }
@@ -1169,7 +1216,7 @@ Stream &Stream::operator>>(TLInputBotInlineMessageID &inputBotInlineMessageIDVal
         break;
     }
 
-    inputBotInlineMessageIDValue = result;
+    inputBotInlineMessageIDValue = std::move(result);
 
     return *this;
 }
@@ -1191,7 +1238,7 @@ Stream &Stream::operator>>(TLInputChannel &inputChannelValue)
         break;
     }
 
-    inputChannelValue = result;
+    inputChannelValue = std::move(result);
 
     return *this;
 }
@@ -1213,7 +1260,7 @@ Stream &Stream::operator>>(TLInputContact &inputContactValue)
         break;
     }
 
-    inputContactValue = result;
+    inputContactValue = std::move(result);
 
     return *this;
 }
@@ -1235,7 +1282,7 @@ Stream &Stream::operator>>(TLInputDocument &inputDocumentValue)
         break;
     }
 
-    inputDocumentValue = result;
+    inputDocumentValue = std::move(result);
 
     return *this;
 }
@@ -1255,7 +1302,7 @@ Stream &Stream::operator>>(TLInputEncryptedChat &inputEncryptedChatValue)
         break;
     }
 
-    inputEncryptedChatValue = result;
+    inputEncryptedChatValue = std::move(result);
 
     return *this;
 }
@@ -1288,7 +1335,7 @@ Stream &Stream::operator>>(TLInputEncryptedFile &inputEncryptedFileValue)
         break;
     }
 
-    inputEncryptedFileValue = result;
+    inputEncryptedFileValue = std::move(result);
 
     return *this;
 }
@@ -1315,7 +1362,7 @@ Stream &Stream::operator>>(TLInputFile &inputFileValue)
         break;
     }
 
-    inputFileValue = result;
+    inputFileValue = std::move(result);
 
     return *this;
 }
@@ -1345,7 +1392,7 @@ Stream &Stream::operator>>(TLInputFileLocation &inputFileLocationValue)
         break;
     }
 
-    inputFileLocationValue = result;
+    inputFileLocationValue = std::move(result);
 
     return *this;
 }
@@ -1367,7 +1414,7 @@ Stream &Stream::operator>>(TLInputGeoPoint &inputGeoPointValue)
         break;
     }
 
-    inputGeoPointValue = result;
+    inputGeoPointValue = std::move(result);
 
     return *this;
 }
@@ -1397,7 +1444,7 @@ Stream &Stream::operator>>(TLInputPeer &inputPeerValue)
         break;
     }
 
-    inputPeerValue = result;
+    inputPeerValue = std::move(result);
 
     return *this;
 }
@@ -1416,7 +1463,7 @@ Stream &Stream::operator>>(TLInputPeerNotifyEvents &inputPeerNotifyEventsValue)
         break;
     }
 
-    inputPeerNotifyEventsValue = result;
+    inputPeerNotifyEventsValue = std::move(result);
 
     return *this;
 }
@@ -1436,7 +1483,7 @@ Stream &Stream::operator>>(TLInputPhoneCall &inputPhoneCallValue)
         break;
     }
 
-    inputPhoneCallValue = result;
+    inputPhoneCallValue = std::move(result);
 
     return *this;
 }
@@ -1458,7 +1505,7 @@ Stream &Stream::operator>>(TLInputPhoto &inputPhotoValue)
         break;
     }
 
-    inputPhotoValue = result;
+    inputPhotoValue = std::move(result);
 
     return *this;
 }
@@ -1478,7 +1525,7 @@ Stream &Stream::operator>>(TLInputPrivacyKey &inputPrivacyKeyValue)
         break;
     }
 
-    inputPrivacyKeyValue = result;
+    inputPrivacyKeyValue = std::move(result);
 
     return *this;
 }
@@ -1503,7 +1550,7 @@ Stream &Stream::operator>>(TLInputStickerSet &inputStickerSetValue)
         break;
     }
 
-    inputStickerSetValue = result;
+    inputStickerSetValue = std::move(result);
 
     return *this;
 }
@@ -1525,7 +1572,7 @@ Stream &Stream::operator>>(TLInputStickeredMedia &inputStickeredMediaValue)
         break;
     }
 
-    inputStickeredMediaValue = result;
+    inputStickeredMediaValue = std::move(result);
 
     return *this;
 }
@@ -1548,7 +1595,7 @@ Stream &Stream::operator>>(TLInputUser &inputUserValue)
         break;
     }
 
-    inputUserValue = result;
+    inputUserValue = std::move(result);
 
     return *this;
 }
@@ -1568,7 +1615,7 @@ Stream &Stream::operator>>(TLInputWebFileLocation &inputWebFileLocationValue)
         break;
     }
 
-    inputWebFileLocationValue = result;
+    inputWebFileLocationValue = std::move(result);
 
     return *this;
 }
@@ -1588,7 +1635,7 @@ Stream &Stream::operator>>(TLIpPort &ipPortValue)
         break;
     }
 
-    ipPortValue = result;
+    ipPortValue = std::move(result);
 
     return *this;
 }
@@ -1608,7 +1655,7 @@ Stream &Stream::operator>>(TLLabeledPrice &labeledPriceValue)
         break;
     }
 
-    labeledPriceValue = result;
+    labeledPriceValue = std::move(result);
 
     return *this;
 }
@@ -1629,7 +1676,7 @@ Stream &Stream::operator>>(TLLangPackLanguage &langPackLanguageValue)
         break;
     }
 
-    langPackLanguageValue = result;
+    langPackLanguageValue = std::move(result);
 
     return *this;
 }
@@ -1672,7 +1719,7 @@ Stream &Stream::operator>>(TLLangPackString &langPackStringValue)
         break;
     }
 
-    langPackStringValue = result;
+    langPackStringValue = std::move(result);
 
     return *this;
 }
@@ -1694,7 +1741,7 @@ Stream &Stream::operator>>(TLMaskCoords &maskCoordsValue)
         break;
     }
 
-    maskCoordsValue = result;
+    maskCoordsValue = std::move(result);
 
     return *this;
 }
@@ -1742,7 +1789,7 @@ Stream &Stream::operator>>(TLMessageEntity &messageEntityValue)
         break;
     }
 
-    messageEntityValue = result;
+    messageEntityValue = std::move(result);
 
     return *this;
 }
@@ -1774,7 +1821,7 @@ Stream &Stream::operator>>(TLMessageFwdHeader &messageFwdHeaderValue)
         break;
     }
 
-    messageFwdHeaderValue = result;
+    messageFwdHeaderValue = std::move(result);
 
     return *this;
 }
@@ -1794,7 +1841,7 @@ Stream &Stream::operator>>(TLMessageRange &messageRangeValue)
         break;
     }
 
-    messageRangeValue = result;
+    messageRangeValue = std::move(result);
 
     return *this;
 }
@@ -1815,7 +1862,7 @@ Stream &Stream::operator>>(TLMessagesAffectedHistory &messagesAffectedHistoryVal
         break;
     }
 
-    messagesAffectedHistoryValue = result;
+    messagesAffectedHistoryValue = std::move(result);
 
     return *this;
 }
@@ -1835,7 +1882,7 @@ Stream &Stream::operator>>(TLMessagesAffectedMessages &messagesAffectedMessagesV
         break;
     }
 
-    messagesAffectedMessagesValue = result;
+    messagesAffectedMessagesValue = std::move(result);
 
     return *this;
 }
@@ -1860,7 +1907,7 @@ Stream &Stream::operator>>(TLMessagesDhConfig &messagesDhConfigValue)
         break;
     }
 
-    messagesDhConfigValue = result;
+    messagesDhConfigValue = std::move(result);
 
     return *this;
 }
@@ -1883,7 +1930,7 @@ Stream &Stream::operator>>(TLMessagesSentEncryptedMessage &messagesSentEncrypted
         break;
     }
 
-    messagesSentEncryptedMessageValue = result;
+    messagesSentEncryptedMessageValue = std::move(result);
 
     return *this;
 }
@@ -1910,7 +1957,7 @@ Stream &Stream::operator>>(TLMsgDetailedInfo &msgDetailedInfoValue)
         break;
     }
 
-    msgDetailedInfoValue = result;
+    msgDetailedInfoValue = std::move(result);
 
     return *this;
 }
@@ -1929,7 +1976,7 @@ Stream &Stream::operator>>(TLMsgResendReq &msgResendReqValue)
         break;
     }
 
-    msgResendReqValue = result;
+    msgResendReqValue = std::move(result);
 
     return *this;
 }
@@ -1948,7 +1995,7 @@ Stream &Stream::operator>>(TLMsgsAck &msgsAckValue)
         break;
     }
 
-    msgsAckValue = result;
+    msgsAckValue = std::move(result);
 
     return *this;
 }
@@ -1968,7 +2015,7 @@ Stream &Stream::operator>>(TLMsgsAllInfo &msgsAllInfoValue)
         break;
     }
 
-    msgsAllInfoValue = result;
+    msgsAllInfoValue = std::move(result);
 
     return *this;
 }
@@ -1988,7 +2035,7 @@ Stream &Stream::operator>>(TLMsgsStateInfo &msgsStateInfoValue)
         break;
     }
 
-    msgsStateInfoValue = result;
+    msgsStateInfoValue = std::move(result);
 
     return *this;
 }
@@ -2007,7 +2054,7 @@ Stream &Stream::operator>>(TLMsgsStateReq &msgsStateReqValue)
         break;
     }
 
-    msgsStateReqValue = result;
+    msgsStateReqValue = std::move(result);
 
     return *this;
 }
@@ -2028,7 +2075,7 @@ Stream &Stream::operator>>(TLNearestDc &nearestDcValue)
         break;
     }
 
-    nearestDcValue = result;
+    nearestDcValue = std::move(result);
 
     return *this;
 }
@@ -2049,7 +2096,7 @@ Stream &Stream::operator>>(TLNewSession &newSessionValue)
         break;
     }
 
-    newSessionValue = result;
+    newSessionValue = std::move(result);
 
     return *this;
 }
@@ -2073,7 +2120,7 @@ Stream &Stream::operator>>(TLPQInnerData &pQInnerDataValue)
         break;
     }
 
-    pQInnerDataValue = result;
+    pQInnerDataValue = std::move(result);
 
     return *this;
 }
@@ -2093,7 +2140,7 @@ Stream &Stream::operator>>(TLPaymentCharge &paymentChargeValue)
         break;
     }
 
-    paymentChargeValue = result;
+    paymentChargeValue = std::move(result);
 
     return *this;
 }
@@ -2113,7 +2160,7 @@ Stream &Stream::operator>>(TLPaymentSavedCredentials &paymentSavedCredentialsVal
         break;
     }
 
-    paymentSavedCredentialsValue = result;
+    paymentSavedCredentialsValue = std::move(result);
 
     return *this;
 }
@@ -2138,7 +2185,7 @@ Stream &Stream::operator>>(TLPeer &peerValue)
         break;
     }
 
-    peerValue = result;
+    peerValue = std::move(result);
 
     return *this;
 }
@@ -2157,7 +2204,7 @@ Stream &Stream::operator>>(TLPeerNotifyEvents &peerNotifyEventsValue)
         break;
     }
 
-    peerNotifyEventsValue = result;
+    peerNotifyEventsValue = std::move(result);
 
     return *this;
 }
@@ -2178,7 +2225,7 @@ Stream &Stream::operator>>(TLPhoneCallDiscardReason &phoneCallDiscardReasonValue
         break;
     }
 
-    phoneCallDiscardReasonValue = result;
+    phoneCallDiscardReasonValue = std::move(result);
 
     return *this;
 }
@@ -2201,7 +2248,7 @@ Stream &Stream::operator>>(TLPhoneConnection &phoneConnectionValue)
         break;
     }
 
-    phoneConnectionValue = result;
+    phoneConnectionValue = std::move(result);
 
     return *this;
 }
@@ -2234,7 +2281,7 @@ Stream &Stream::operator>>(TLPhotoSize &photoSizeValue)
         break;
     }
 
-    photoSizeValue = result;
+    photoSizeValue = std::move(result);
 
     return *this;
 }
@@ -2254,7 +2301,7 @@ Stream &Stream::operator>>(TLPong &pongValue)
         break;
     }
 
-    pongValue = result;
+    pongValue = std::move(result);
 
     return *this;
 }
@@ -2274,7 +2321,7 @@ Stream &Stream::operator>>(TLPopularContact &popularContactValue)
         break;
     }
 
-    popularContactValue = result;
+    popularContactValue = std::move(result);
 
     return *this;
 }
@@ -2298,7 +2345,7 @@ Stream &Stream::operator>>(TLPostAddress &postAddressValue)
         break;
     }
 
-    postAddressValue = result;
+    postAddressValue = std::move(result);
 
     return *this;
 }
@@ -2318,7 +2365,7 @@ Stream &Stream::operator>>(TLPrivacyKey &privacyKeyValue)
         break;
     }
 
-    privacyKeyValue = result;
+    privacyKeyValue = std::move(result);
 
     return *this;
 }
@@ -2343,7 +2390,7 @@ Stream &Stream::operator>>(TLPrivacyRule &privacyRuleValue)
         break;
     }
 
-    privacyRuleValue = result;
+    privacyRuleValue = std::move(result);
 
     return *this;
 }
@@ -2363,7 +2410,7 @@ Stream &Stream::operator>>(TLReceivedNotifyMessage &receivedNotifyMessageValue)
         break;
     }
 
-    receivedNotifyMessageValue = result;
+    receivedNotifyMessageValue = std::move(result);
 
     return *this;
 }
@@ -2386,7 +2433,7 @@ Stream &Stream::operator>>(TLReportReason &reportReasonValue)
         break;
     }
 
-    reportReasonValue = result;
+    reportReasonValue = std::move(result);
 
     return *this;
 }
@@ -2408,7 +2455,7 @@ Stream &Stream::operator>>(TLResPQ &resPQValue)
         break;
     }
 
-    resPQValue = result;
+    resPQValue = std::move(result);
 
     return *this;
 }
@@ -2430,15 +2477,15 @@ Stream &Stream::operator>>(TLRichText &richTextValue)
     case TLValue::TextUnderline:
     case TLValue::TextStrike:
     case TLValue::TextFixed:
-        *this >> *result.richText;
+        *this >> result.richText;
         break;
     case TLValue::TextUrl:
-        *this >> *result.richText;
+        *this >> result.richText;
         *this >> result.url;
         *this >> result.webpageId;
         break;
     case TLValue::TextEmail:
-        *this >> *result.richText;
+        *this >> result.richText;
         *this >> result.email;
         break;
     case TLValue::TextConcat:
@@ -2448,7 +2495,7 @@ Stream &Stream::operator>>(TLRichText &richTextValue)
         break;
     }
 
-    richTextValue = result;
+    richTextValue = std::move(result);
 
     return *this;
 }
@@ -2472,7 +2519,7 @@ Stream &Stream::operator>>(TLRpcDropAnswer &rpcDropAnswerValue)
         break;
     }
 
-    rpcDropAnswerValue = result;
+    rpcDropAnswerValue = std::move(result);
 
     return *this;
 }
@@ -2492,7 +2539,7 @@ Stream &Stream::operator>>(TLRpcError &rpcErrorValue)
         break;
     }
 
-    rpcErrorValue = result;
+    rpcErrorValue = std::move(result);
 
     return *this;
 }
@@ -2524,7 +2571,7 @@ Stream &Stream::operator>>(TLSendMessageAction &sendMessageActionValue)
         break;
     }
 
-    sendMessageActionValue = result;
+    sendMessageActionValue = std::move(result);
 
     return *this;
 }
@@ -2548,7 +2595,7 @@ Stream &Stream::operator>>(TLServerDHInnerData &serverDHInnerDataValue)
         break;
     }
 
-    serverDHInnerDataValue = result;
+    serverDHInnerDataValue = std::move(result);
 
     return *this;
 }
@@ -2574,7 +2621,7 @@ Stream &Stream::operator>>(TLServerDHParams &serverDHParamsValue)
         break;
     }
 
-    serverDHParamsValue = result;
+    serverDHParamsValue = std::move(result);
 
     return *this;
 }
@@ -2605,7 +2652,7 @@ Stream &Stream::operator>>(TLSetClientDHParamsAnswer &setClientDHParamsAnswerVal
         break;
     }
 
-    setClientDHParamsAnswerValue = result;
+    setClientDHParamsAnswerValue = std::move(result);
 
     return *this;
 }
@@ -2626,7 +2673,7 @@ Stream &Stream::operator>>(TLShippingOption &shippingOptionValue)
         break;
     }
 
-    shippingOptionValue = result;
+    shippingOptionValue = std::move(result);
 
     return *this;
 }
@@ -2646,7 +2693,7 @@ Stream &Stream::operator>>(TLStickerPack &stickerPackValue)
         break;
     }
 
-    stickerPackValue = result;
+    stickerPackValue = std::move(result);
 
     return *this;
 }
@@ -2673,7 +2720,7 @@ Stream &Stream::operator>>(TLStorageFileType &storageFileTypeValue)
         break;
     }
 
-    storageFileTypeValue = result;
+    storageFileTypeValue = std::move(result);
 
     return *this;
 }
@@ -2693,7 +2740,7 @@ Stream &Stream::operator>>(TLTopPeer &topPeerValue)
         break;
     }
 
-    topPeerValue = result;
+    topPeerValue = std::move(result);
 
     return *this;
 }
@@ -2716,7 +2763,7 @@ Stream &Stream::operator>>(TLTopPeerCategory &topPeerCategoryValue)
         break;
     }
 
-    topPeerCategoryValue = result;
+    topPeerCategoryValue = std::move(result);
 
     return *this;
 }
@@ -2737,7 +2784,7 @@ Stream &Stream::operator>>(TLTopPeerCategoryPeers &topPeerCategoryPeersValue)
         break;
     }
 
-    topPeerCategoryPeersValue = result;
+    topPeerCategoryPeersValue = std::move(result);
 
     return *this;
 }
@@ -2760,7 +2807,7 @@ Stream &Stream::operator>>(TLUpdatesState &updatesStateValue)
         break;
     }
 
-    updatesStateValue = result;
+    updatesStateValue = std::move(result);
 
     return *this;
 }
@@ -2782,7 +2829,7 @@ Stream &Stream::operator>>(TLUploadCdnFile &uploadCdnFileValue)
         break;
     }
 
-    uploadCdnFileValue = result;
+    uploadCdnFileValue = std::move(result);
 
     return *this;
 }
@@ -2810,7 +2857,7 @@ Stream &Stream::operator>>(TLUploadFile &uploadFileValue)
         break;
     }
 
-    uploadFileValue = result;
+    uploadFileValue = std::move(result);
 
     return *this;
 }
@@ -2833,7 +2880,7 @@ Stream &Stream::operator>>(TLUploadWebFile &uploadWebFileValue)
         break;
     }
 
-    uploadWebFileValue = result;
+    uploadWebFileValue = std::move(result);
 
     return *this;
 }
@@ -2856,7 +2903,7 @@ Stream &Stream::operator>>(TLUserProfilePhoto &userProfilePhotoValue)
         break;
     }
 
-    userProfilePhotoValue = result;
+    userProfilePhotoValue = std::move(result);
 
     return *this;
 }
@@ -2883,7 +2930,7 @@ Stream &Stream::operator>>(TLUserStatus &userStatusValue)
         break;
     }
 
-    userStatusValue = result;
+    userStatusValue = std::move(result);
 
     return *this;
 }
@@ -2911,7 +2958,7 @@ Stream &Stream::operator>>(TLWallPaper &wallPaperValue)
         break;
     }
 
-    wallPaperValue = result;
+    wallPaperValue = std::move(result);
 
     return *this;
 }
@@ -2930,7 +2977,7 @@ Stream &Stream::operator>>(TLAccountAuthorizations &accountAuthorizationsValue)
         break;
     }
 
-    accountAuthorizationsValue = result;
+    accountAuthorizationsValue = std::move(result);
 
     return *this;
 }
@@ -2957,7 +3004,7 @@ Stream &Stream::operator>>(TLAuthSentCode &authSentCodeValue)
         break;
     }
 
-    authSentCodeValue = result;
+    authSentCodeValue = std::move(result);
 
     return *this;
 }
@@ -2976,7 +3023,7 @@ Stream &Stream::operator>>(TLCdnConfig &cdnConfigValue)
         break;
     }
 
-    cdnConfigValue = result;
+    cdnConfigValue = std::move(result);
 
     return *this;
 }
@@ -2995,7 +3042,7 @@ Stream &Stream::operator>>(TLChannelAdminLogEventsFilter &channelAdminLogEventsF
         break;
     }
 
-    channelAdminLogEventsFilterValue = result;
+    channelAdminLogEventsFilterValue = std::move(result);
 
     return *this;
 }
@@ -3014,7 +3061,7 @@ Stream &Stream::operator>>(TLChannelAdminRights &channelAdminRightsValue)
         break;
     }
 
-    channelAdminRightsValue = result;
+    channelAdminRightsValue = std::move(result);
 
     return *this;
 }
@@ -3034,7 +3081,7 @@ Stream &Stream::operator>>(TLChannelBannedRights &channelBannedRightsValue)
         break;
     }
 
-    channelBannedRightsValue = result;
+    channelBannedRightsValue = std::move(result);
 
     return *this;
 }
@@ -3056,7 +3103,7 @@ Stream &Stream::operator>>(TLChannelMessagesFilter &channelMessagesFilterValue)
         break;
     }
 
-    channelMessagesFilterValue = result;
+    channelMessagesFilterValue = std::move(result);
 
     return *this;
 }
@@ -3099,7 +3146,7 @@ Stream &Stream::operator>>(TLChannelParticipant &channelParticipantValue)
         break;
     }
 
-    channelParticipantValue = result;
+    channelParticipantValue = std::move(result);
 
     return *this;
 }
@@ -3121,7 +3168,7 @@ Stream &Stream::operator>>(TLChatPhoto &chatPhotoValue)
         break;
     }
 
-    chatPhotoValue = result;
+    chatPhotoValue = std::move(result);
 
     return *this;
 }
@@ -3141,7 +3188,7 @@ Stream &Stream::operator>>(TLContactStatus &contactStatusValue)
         break;
     }
 
-    contactStatusValue = result;
+    contactStatusValue = std::move(result);
 
     return *this;
 }
@@ -3163,7 +3210,7 @@ Stream &Stream::operator>>(TLDcOption &dcOptionValue)
         break;
     }
 
-    dcOptionValue = result;
+    dcOptionValue = std::move(result);
 
     return *this;
 }
@@ -3216,7 +3263,7 @@ Stream &Stream::operator>>(TLDocumentAttribute &documentAttributeValue)
         break;
     }
 
-    documentAttributeValue = result;
+    documentAttributeValue = std::move(result);
 
     return *this;
 }
@@ -3245,7 +3292,7 @@ Stream &Stream::operator>>(TLDraftMessage &draftMessageValue)
         break;
     }
 
-    draftMessageValue = result;
+    draftMessageValue = std::move(result);
 
     return *this;
 }
@@ -3267,7 +3314,7 @@ Stream &Stream::operator>>(TLHelpConfigSimple &helpConfigSimpleValue)
         break;
     }
 
-    helpConfigSimpleValue = result;
+    helpConfigSimpleValue = std::move(result);
 
     return *this;
 }
@@ -3291,7 +3338,7 @@ Stream &Stream::operator>>(TLInputChatPhoto &inputChatPhotoValue)
         break;
     }
 
-    inputChatPhotoValue = result;
+    inputChatPhotoValue = std::move(result);
 
     return *this;
 }
@@ -3315,7 +3362,7 @@ Stream &Stream::operator>>(TLInputGame &inputGameValue)
         break;
     }
 
-    inputGameValue = result;
+    inputGameValue = std::move(result);
 
     return *this;
 }
@@ -3338,7 +3385,7 @@ Stream &Stream::operator>>(TLInputNotifyPeer &inputNotifyPeerValue)
         break;
     }
 
-    inputNotifyPeerValue = result;
+    inputNotifyPeerValue = std::move(result);
 
     return *this;
 }
@@ -3368,7 +3415,7 @@ Stream &Stream::operator>>(TLInputPaymentCredentials &inputPaymentCredentialsVal
         break;
     }
 
-    inputPaymentCredentialsValue = result;
+    inputPaymentCredentialsValue = std::move(result);
 
     return *this;
 }
@@ -3389,7 +3436,7 @@ Stream &Stream::operator>>(TLInputPeerNotifySettings &inputPeerNotifySettingsVal
         break;
     }
 
-    inputPeerNotifySettingsValue = result;
+    inputPeerNotifySettingsValue = std::move(result);
 
     return *this;
 }
@@ -3414,7 +3461,7 @@ Stream &Stream::operator>>(TLInputPrivacyRule &inputPrivacyRuleValue)
         break;
     }
 
-    inputPrivacyRuleValue = result;
+    inputPrivacyRuleValue = std::move(result);
 
     return *this;
 }
@@ -3438,7 +3485,7 @@ Stream &Stream::operator>>(TLInputStickerSetItem &inputStickerSetItemValue)
         break;
     }
 
-    inputStickerSetItemValue = result;
+    inputStickerSetItemValue = std::move(result);
 
     return *this;
 }
@@ -3460,7 +3507,7 @@ Stream &Stream::operator>>(TLInputWebDocument &inputWebDocumentValue)
         break;
     }
 
-    inputWebDocumentValue = result;
+    inputWebDocumentValue = std::move(result);
 
     return *this;
 }
@@ -3481,7 +3528,7 @@ Stream &Stream::operator>>(TLInvoice &invoiceValue)
         break;
     }
 
-    invoiceValue = result;
+    invoiceValue = std::move(result);
 
     return *this;
 }
@@ -3517,7 +3564,7 @@ Stream &Stream::operator>>(TLKeyboardButton &keyboardButtonValue)
         break;
     }
 
-    keyboardButtonValue = result;
+    keyboardButtonValue = std::move(result);
 
     return *this;
 }
@@ -3536,7 +3583,7 @@ Stream &Stream::operator>>(TLKeyboardButtonRow &keyboardButtonRowValue)
         break;
     }
 
-    keyboardButtonRowValue = result;
+    keyboardButtonRowValue = std::move(result);
 
     return *this;
 }
@@ -3558,7 +3605,7 @@ Stream &Stream::operator>>(TLLangPackDifference &langPackDifferenceValue)
         break;
     }
 
-    langPackDifferenceValue = result;
+    langPackDifferenceValue = std::move(result);
 
     return *this;
 }
@@ -3584,7 +3631,7 @@ Stream &Stream::operator>>(TLMessagesBotCallbackAnswer &messagesBotCallbackAnswe
         break;
     }
 
-    messagesBotCallbackAnswerValue = result;
+    messagesBotCallbackAnswerValue = std::move(result);
 
     return *this;
 }
@@ -3619,7 +3666,7 @@ Stream &Stream::operator>>(TLMessagesFilter &messagesFilterValue)
         break;
     }
 
-    messagesFilterValue = result;
+    messagesFilterValue = std::move(result);
 
     return *this;
 }
@@ -3638,7 +3685,7 @@ Stream &Stream::operator>>(TLMessagesMessageEditData &messagesMessageEditDataVal
         break;
     }
 
-    messagesMessageEditDataValue = result;
+    messagesMessageEditDataValue = std::move(result);
 
     return *this;
 }
@@ -3661,7 +3708,7 @@ Stream &Stream::operator>>(TLNotifyPeer &notifyPeerValue)
         break;
     }
 
-    notifyPeerValue = result;
+    notifyPeerValue = std::move(result);
 
     return *this;
 }
@@ -3692,7 +3739,7 @@ Stream &Stream::operator>>(TLPaymentRequestedInfo &paymentRequestedInfoValue)
         break;
     }
 
-    paymentRequestedInfoValue = result;
+    paymentRequestedInfoValue = std::move(result);
 
     return *this;
 }
@@ -3714,7 +3761,7 @@ Stream &Stream::operator>>(TLPaymentsSavedInfo &paymentsSavedInfoValue)
         break;
     }
 
-    paymentsSavedInfoValue = result;
+    paymentsSavedInfoValue = std::move(result);
 
     return *this;
 }
@@ -3739,7 +3786,7 @@ Stream &Stream::operator>>(TLPaymentsValidatedRequestedInfo &paymentsValidatedRe
         break;
     }
 
-    paymentsValidatedRequestedInfoValue = result;
+    paymentsValidatedRequestedInfoValue = std::move(result);
 
     return *this;
 }
@@ -3762,7 +3809,7 @@ Stream &Stream::operator>>(TLPeerNotifySettings &peerNotifySettingsValue)
         break;
     }
 
-    peerNotifySettingsValue = result;
+    peerNotifySettingsValue = std::move(result);
 
     return *this;
 }
@@ -3781,7 +3828,7 @@ Stream &Stream::operator>>(TLPeerSettings &peerSettingsValue)
         break;
     }
 
-    peerSettingsValue = result;
+    peerSettingsValue = std::move(result);
 
     return *this;
 }
@@ -3802,7 +3849,7 @@ Stream &Stream::operator>>(TLPhoneCallProtocol &phoneCallProtocolValue)
         break;
     }
 
-    phoneCallProtocolValue = result;
+    phoneCallProtocolValue = std::move(result);
 
     return *this;
 }
@@ -3828,7 +3875,7 @@ Stream &Stream::operator>>(TLPhoto &photoValue)
         break;
     }
 
-    photoValue = result;
+    photoValue = std::move(result);
 
     return *this;
 }
@@ -3855,7 +3902,7 @@ Stream &Stream::operator>>(TLReplyMarkup &replyMarkupValue)
         break;
     }
 
-    replyMarkupValue = result;
+    replyMarkupValue = std::move(result);
 
     return *this;
 }
@@ -3880,7 +3927,7 @@ Stream &Stream::operator>>(TLStickerSet &stickerSetValue)
         break;
     }
 
-    stickerSetValue = result;
+    stickerSetValue = std::move(result);
 
     return *this;
 }
@@ -3936,7 +3983,7 @@ Stream &Stream::operator>>(TLUser &userValue)
         break;
     }
 
-    userValue = result;
+    userValue = std::move(result);
 
     return *this;
 }
@@ -3960,7 +4007,7 @@ Stream &Stream::operator>>(TLWebDocument &webDocumentValue)
         break;
     }
 
-    webDocumentValue = result;
+    webDocumentValue = std::move(result);
 
     return *this;
 }
@@ -3980,7 +4027,7 @@ Stream &Stream::operator>>(TLAccountPrivacyRules &accountPrivacyRulesValue)
         break;
     }
 
-    accountPrivacyRulesValue = result;
+    accountPrivacyRulesValue = std::move(result);
 
     return *this;
 }
@@ -4003,7 +4050,7 @@ Stream &Stream::operator>>(TLAuthAuthorization &authAuthorizationValue)
         break;
     }
 
-    authAuthorizationValue = result;
+    authAuthorizationValue = std::move(result);
 
     return *this;
 }
@@ -4064,7 +4111,7 @@ Stream &Stream::operator>>(TLBotInlineMessage &botInlineMessageValue)
         break;
     }
 
-    botInlineMessageValue = result;
+    botInlineMessageValue = std::move(result);
 
     return *this;
 }
@@ -4084,7 +4131,7 @@ Stream &Stream::operator>>(TLChannelsChannelParticipant &channelsChannelParticip
         break;
     }
 
-    channelsChannelParticipantValue = result;
+    channelsChannelParticipantValue = std::move(result);
 
     return *this;
 }
@@ -4107,7 +4154,7 @@ Stream &Stream::operator>>(TLChannelsChannelParticipants &channelsChannelPartici
         break;
     }
 
-    channelsChannelParticipantsValue = result;
+    channelsChannelParticipantsValue = std::move(result);
 
     return *this;
 }
@@ -4174,7 +4221,7 @@ Stream &Stream::operator>>(TLChat &chatValue)
         break;
     }
 
-    chatValue = result;
+    chatValue = std::move(result);
 
     return *this;
 }
@@ -4237,7 +4284,7 @@ Stream &Stream::operator>>(TLChatFull &chatFullValue)
         break;
     }
 
-    chatFullValue = result;
+    chatFullValue = std::move(result);
 
     return *this;
 }
@@ -4265,7 +4312,7 @@ Stream &Stream::operator>>(TLChatInvite &chatInviteValue)
         break;
     }
 
-    chatInviteValue = result;
+    chatInviteValue = std::move(result);
 
     return *this;
 }
@@ -4323,7 +4370,7 @@ Stream &Stream::operator>>(TLConfig &configValue)
         break;
     }
 
-    configValue = result;
+    configValue = std::move(result);
 
     return *this;
 }
@@ -4348,7 +4395,7 @@ Stream &Stream::operator>>(TLContactsBlocked &contactsBlockedValue)
         break;
     }
 
-    contactsBlockedValue = result;
+    contactsBlockedValue = std::move(result);
 
     return *this;
 }
@@ -4371,7 +4418,7 @@ Stream &Stream::operator>>(TLContactsContacts &contactsContactsValue)
         break;
     }
 
-    contactsContactsValue = result;
+    contactsContactsValue = std::move(result);
 
     return *this;
 }
@@ -4392,7 +4439,7 @@ Stream &Stream::operator>>(TLContactsFound &contactsFoundValue)
         break;
     }
 
-    contactsFoundValue = result;
+    contactsFoundValue = std::move(result);
 
     return *this;
 }
@@ -4414,7 +4461,7 @@ Stream &Stream::operator>>(TLContactsImportedContacts &contactsImportedContactsV
         break;
     }
 
-    contactsImportedContactsValue = result;
+    contactsImportedContactsValue = std::move(result);
 
     return *this;
 }
@@ -4435,7 +4482,7 @@ Stream &Stream::operator>>(TLContactsLink &contactsLinkValue)
         break;
     }
 
-    contactsLinkValue = result;
+    contactsLinkValue = std::move(result);
 
     return *this;
 }
@@ -4456,7 +4503,7 @@ Stream &Stream::operator>>(TLContactsResolvedPeer &contactsResolvedPeerValue)
         break;
     }
 
-    contactsResolvedPeerValue = result;
+    contactsResolvedPeerValue = std::move(result);
 
     return *this;
 }
@@ -4479,7 +4526,7 @@ Stream &Stream::operator>>(TLContactsTopPeers &contactsTopPeersValue)
         break;
     }
 
-    contactsTopPeersValue = result;
+    contactsTopPeersValue = std::move(result);
 
     return *this;
 }
@@ -4511,7 +4558,7 @@ Stream &Stream::operator>>(TLDialog &dialogValue)
         break;
     }
 
-    dialogValue = result;
+    dialogValue = std::move(result);
 
     return *this;
 }
@@ -4541,7 +4588,7 @@ Stream &Stream::operator>>(TLDocument &documentValue)
         break;
     }
 
-    documentValue = result;
+    documentValue = std::move(result);
 
     return *this;
 }
@@ -4570,7 +4617,7 @@ Stream &Stream::operator>>(TLFoundGif &foundGifValue)
         break;
     }
 
-    foundGifValue = result;
+    foundGifValue = std::move(result);
 
     return *this;
 }
@@ -4598,7 +4645,7 @@ Stream &Stream::operator>>(TLGame &gameValue)
         break;
     }
 
-    gameValue = result;
+    gameValue = std::move(result);
 
     return *this;
 }
@@ -4618,7 +4665,7 @@ Stream &Stream::operator>>(TLHelpSupport &helpSupportValue)
         break;
     }
 
-    helpSupportValue = result;
+    helpSupportValue = std::move(result);
 
     return *this;
 }
@@ -4685,7 +4732,7 @@ Stream &Stream::operator>>(TLInputBotInlineMessage &inputBotInlineMessageValue)
         break;
     }
 
-    inputBotInlineMessageValue = result;
+    inputBotInlineMessageValue = std::move(result);
 
     return *this;
 }
@@ -4758,7 +4805,7 @@ Stream &Stream::operator>>(TLInputBotInlineResult &inputBotInlineResultValue)
         break;
     }
 
-    inputBotInlineResultValue = result;
+    inputBotInlineResultValue = std::move(result);
 
     return *this;
 }
@@ -4867,7 +4914,7 @@ Stream &Stream::operator>>(TLInputMedia &inputMediaValue)
         break;
     }
 
-    inputMediaValue = result;
+    inputMediaValue = std::move(result);
 
     return *this;
 }
@@ -4950,7 +4997,7 @@ Stream &Stream::operator>>(TLMessageAction &messageActionValue)
         break;
     }
 
-    messageActionValue = result;
+    messageActionValue = std::move(result);
 
     return *this;
 }
@@ -4972,7 +5019,7 @@ Stream &Stream::operator>>(TLMessagesAllStickers &messagesAllStickersValue)
         break;
     }
 
-    messagesAllStickersValue = result;
+    messagesAllStickersValue = std::move(result);
 
     return *this;
 }
@@ -4993,7 +5040,7 @@ Stream &Stream::operator>>(TLMessagesChatFull &messagesChatFullValue)
         break;
     }
 
-    messagesChatFullValue = result;
+    messagesChatFullValue = std::move(result);
 
     return *this;
 }
@@ -5016,7 +5063,7 @@ Stream &Stream::operator>>(TLMessagesChats &messagesChatsValue)
         break;
     }
 
-    messagesChatsValue = result;
+    messagesChatsValue = std::move(result);
 
     return *this;
 }
@@ -5039,7 +5086,7 @@ Stream &Stream::operator>>(TLMessagesFavedStickers &messagesFavedStickersValue)
         break;
     }
 
-    messagesFavedStickersValue = result;
+    messagesFavedStickersValue = std::move(result);
 
     return *this;
 }
@@ -5059,7 +5106,7 @@ Stream &Stream::operator>>(TLMessagesFoundGifs &messagesFoundGifsValue)
         break;
     }
 
-    messagesFoundGifsValue = result;
+    messagesFoundGifsValue = std::move(result);
 
     return *this;
 }
@@ -5079,7 +5126,7 @@ Stream &Stream::operator>>(TLMessagesHighScores &messagesHighScoresValue)
         break;
     }
 
-    messagesHighScoresValue = result;
+    messagesHighScoresValue = std::move(result);
 
     return *this;
 }
@@ -5101,7 +5148,7 @@ Stream &Stream::operator>>(TLMessagesRecentStickers &messagesRecentStickersValue
         break;
     }
 
-    messagesRecentStickersValue = result;
+    messagesRecentStickersValue = std::move(result);
 
     return *this;
 }
@@ -5123,7 +5170,7 @@ Stream &Stream::operator>>(TLMessagesSavedGifs &messagesSavedGifsValue)
         break;
     }
 
-    messagesSavedGifsValue = result;
+    messagesSavedGifsValue = std::move(result);
 
     return *this;
 }
@@ -5144,7 +5191,7 @@ Stream &Stream::operator>>(TLMessagesStickerSet &messagesStickerSetValue)
         break;
     }
 
-    messagesStickerSetValue = result;
+    messagesStickerSetValue = std::move(result);
 
     return *this;
 }
@@ -5166,7 +5213,7 @@ Stream &Stream::operator>>(TLMessagesStickers &messagesStickersValue)
         break;
     }
 
-    messagesStickersValue = result;
+    messagesStickersValue = std::move(result);
 
     return *this;
 }
@@ -5188,7 +5235,7 @@ Stream &Stream::operator>>(TLPage &pageValue)
         break;
     }
 
-    pageValue = result;
+    pageValue = std::move(result);
 
     return *this;
 }
@@ -5209,14 +5256,14 @@ Stream &Stream::operator>>(TLPageBlock &pageBlockValue)
     case TLValue::PageBlockSubheader:
     case TLValue::PageBlockParagraph:
     case TLValue::PageBlockFooter:
-        *this >> *result.text;
+        *this >> result.text;
         break;
     case TLValue::PageBlockAuthorDate:
-        *this >> *result.richTextAuthor;
+        *this >> result.richTextAuthor;
         *this >> result.publishedDate;
         break;
     case TLValue::PageBlockPreformatted:
-        *this >> *result.text;
+        *this >> result.text;
         *this >> result.language;
         break;
     case TLValue::PageBlockAnchor:
@@ -5228,20 +5275,20 @@ Stream &Stream::operator>>(TLPageBlock &pageBlockValue)
         break;
     case TLValue::PageBlockBlockquote:
     case TLValue::PageBlockPullquote:
-        *this >> *result.text;
-        *this >> *result.caption;
+        *this >> result.text;
+        *this >> result.caption;
         break;
     case TLValue::PageBlockPhoto:
         *this >> result.photoId;
-        *this >> *result.caption;
+        *this >> result.caption;
         break;
     case TLValue::PageBlockVideo:
         *this >> result.flags;
         *this >> result.videoId;
-        *this >> *result.caption;
+        *this >> result.caption;
         break;
     case TLValue::PageBlockCover:
-        *this >> *result.cover;
+        *this >> result.cover;
         break;
     case TLValue::PageBlockEmbed:
         *this >> result.flags;
@@ -5256,7 +5303,7 @@ Stream &Stream::operator>>(TLPageBlock &pageBlockValue)
         }
         *this >> result.w;
         *this >> result.h;
-        *this >> *result.caption;
+        *this >> result.caption;
         break;
     case TLValue::PageBlockEmbedPost:
         *this >> result.url;
@@ -5265,25 +5312,25 @@ Stream &Stream::operator>>(TLPageBlock &pageBlockValue)
         *this >> result.stringAuthor;
         *this >> result.date;
         *this >> result.blocks;
-        *this >> *result.caption;
+        *this >> result.caption;
         break;
     case TLValue::PageBlockCollage:
     case TLValue::PageBlockSlideshow:
         *this >> result.pageBlockItemsVector;
-        *this >> *result.caption;
+        *this >> result.caption;
         break;
     case TLValue::PageBlockChannel:
         *this >> result.channel;
         break;
     case TLValue::PageBlockAudio:
         *this >> result.audioId;
-        *this >> *result.caption;
+        *this >> result.caption;
         break;
     default:
         break;
     }
 
-    pageBlockValue = result;
+    pageBlockValue = std::move(result);
 
     return *this;
 }
@@ -5319,7 +5366,7 @@ Stream &Stream::operator>>(TLPaymentsPaymentForm &paymentsPaymentFormValue)
         break;
     }
 
-    paymentsPaymentFormValue = result;
+    paymentsPaymentFormValue = std::move(result);
 
     return *this;
 }
@@ -5352,7 +5399,7 @@ Stream &Stream::operator>>(TLPaymentsPaymentReceipt &paymentsPaymentReceiptValue
         break;
     }
 
-    paymentsPaymentReceiptValue = result;
+    paymentsPaymentReceiptValue = std::move(result);
 
     return *this;
 }
@@ -5424,7 +5471,7 @@ Stream &Stream::operator>>(TLPhoneCall &phoneCallValue)
         break;
     }
 
-    phoneCallValue = result;
+    phoneCallValue = std::move(result);
 
     return *this;
 }
@@ -5444,7 +5491,7 @@ Stream &Stream::operator>>(TLPhonePhoneCall &phonePhoneCallValue)
         break;
     }
 
-    phonePhoneCallValue = result;
+    phonePhoneCallValue = std::move(result);
 
     return *this;
 }
@@ -5464,7 +5511,7 @@ Stream &Stream::operator>>(TLPhotosPhoto &photosPhotoValue)
         break;
     }
 
-    photosPhotoValue = result;
+    photosPhotoValue = std::move(result);
 
     return *this;
 }
@@ -5489,7 +5536,7 @@ Stream &Stream::operator>>(TLPhotosPhotos &photosPhotosValue)
         break;
     }
 
-    photosPhotosValue = result;
+    photosPhotosValue = std::move(result);
 
     return *this;
 }
@@ -5513,7 +5560,7 @@ Stream &Stream::operator>>(TLStickerSetCovered &stickerSetCoveredValue)
         break;
     }
 
-    stickerSetCoveredValue = result;
+    stickerSetCoveredValue = std::move(result);
 
     return *this;
 }
@@ -5545,7 +5592,7 @@ Stream &Stream::operator>>(TLUserFull &userFullValue)
         break;
     }
 
-    userFullValue = result;
+    userFullValue = std::move(result);
 
     return *this;
 }
@@ -5616,7 +5663,7 @@ Stream &Stream::operator>>(TLWebPage &webPageValue)
         break;
     }
 
-    webPageValue = result;
+    webPageValue = std::move(result);
 
     return *this;
 }
@@ -5683,7 +5730,7 @@ Stream &Stream::operator>>(TLBotInlineResult &botInlineResultValue)
         break;
     }
 
-    botInlineResultValue = result;
+    botInlineResultValue = std::move(result);
 
     return *this;
 }
@@ -5767,7 +5814,7 @@ Stream &Stream::operator>>(TLMessageMedia &messageMediaValue)
         break;
     }
 
-    messageMediaValue = result;
+    messageMediaValue = std::move(result);
 
     return *this;
 }
@@ -5787,7 +5834,7 @@ Stream &Stream::operator>>(TLMessagesArchivedStickers &messagesArchivedStickersV
         break;
     }
 
-    messagesArchivedStickersValue = result;
+    messagesArchivedStickersValue = std::move(result);
 
     return *this;
 }
@@ -5816,7 +5863,7 @@ Stream &Stream::operator>>(TLMessagesBotResults &messagesBotResultsValue)
         break;
     }
 
-    messagesBotResultsValue = result;
+    messagesBotResultsValue = std::move(result);
 
     return *this;
 }
@@ -5839,7 +5886,7 @@ Stream &Stream::operator>>(TLMessagesFeaturedStickers &messagesFeaturedStickersV
         break;
     }
 
-    messagesFeaturedStickersValue = result;
+    messagesFeaturedStickersValue = std::move(result);
 
     return *this;
 }
@@ -5860,7 +5907,7 @@ Stream &Stream::operator>>(TLMessagesStickerSetInstallResult &messagesStickerSet
         break;
     }
 
-    messagesStickerSetInstallResultValue = result;
+    messagesStickerSetInstallResultValue = std::move(result);
 
     return *this;
 }
@@ -5895,7 +5942,7 @@ Stream &Stream::operator>>(TLRecentMeUrl &recentMeUrlValue)
         break;
     }
 
-    recentMeUrlValue = result;
+    recentMeUrlValue = std::move(result);
 
     return *this;
 }
@@ -5916,7 +5963,7 @@ Stream &Stream::operator>>(TLHelpRecentMeUrls &helpRecentMeUrlsValue)
         break;
     }
 
-    helpRecentMeUrlsValue = result;
+    helpRecentMeUrlsValue = std::move(result);
 
     return *this;
 }
@@ -5985,7 +6032,7 @@ Stream &Stream::operator>>(TLMessage &messageValue)
         break;
     }
 
-    messageValue = result;
+    messageValue = std::move(result);
 
     return *this;
 }
@@ -6014,7 +6061,7 @@ Stream &Stream::operator>>(TLMessagesDialogs &messagesDialogsValue)
         break;
     }
 
-    messagesDialogsValue = result;
+    messagesDialogsValue = std::move(result);
 
     return *this;
 }
@@ -6052,7 +6099,7 @@ Stream &Stream::operator>>(TLMessagesMessages &messagesMessagesValue)
         break;
     }
 
-    messagesMessagesValue = result;
+    messagesMessagesValue = std::move(result);
 
     return *this;
 }
@@ -6075,7 +6122,7 @@ Stream &Stream::operator>>(TLMessagesPeerDialogs &messagesPeerDialogsValue)
         break;
     }
 
-    messagesPeerDialogsValue = result;
+    messagesPeerDialogsValue = std::move(result);
 
     return *this;
 }
@@ -6384,7 +6431,7 @@ Stream &Stream::operator>>(TLUpdate &updateValue)
         break;
     }
 
-    updateValue = result;
+    updateValue = std::move(result);
 
     return *this;
 }
@@ -6477,7 +6524,7 @@ Stream &Stream::operator>>(TLUpdates &updatesValue)
         break;
     }
 
-    updatesValue = result;
+    updatesValue = std::move(result);
 
     return *this;
 }
@@ -6526,7 +6573,7 @@ Stream &Stream::operator>>(TLUpdatesChannelDifference &updatesChannelDifferenceV
         break;
     }
 
-    updatesChannelDifferenceValue = result;
+    updatesChannelDifferenceValue = std::move(result);
 
     return *this;
 }
@@ -6565,7 +6612,7 @@ Stream &Stream::operator>>(TLUpdatesDifference &updatesDifferenceValue)
         break;
     }
 
-    updatesDifferenceValue = result;
+    updatesDifferenceValue = std::move(result);
 
     return *this;
 }
@@ -6619,7 +6666,7 @@ Stream &Stream::operator>>(TLChannelAdminLogEventAction &channelAdminLogEventAct
         break;
     }
 
-    channelAdminLogEventActionValue = result;
+    channelAdminLogEventActionValue = std::move(result);
 
     return *this;
 }
@@ -6641,7 +6688,7 @@ Stream &Stream::operator>>(TLPaymentsPaymentResult &paymentsPaymentResultValue)
         break;
     }
 
-    paymentsPaymentResultValue = result;
+    paymentsPaymentResultValue = std::move(result);
 
     return *this;
 }
@@ -6663,7 +6710,7 @@ Stream &Stream::operator>>(TLChannelAdminLogEvent &channelAdminLogEventValue)
         break;
     }
 
-    channelAdminLogEventValue = result;
+    channelAdminLogEventValue = std::move(result);
 
     return *this;
 }
@@ -6684,7 +6731,7 @@ Stream &Stream::operator>>(TLChannelsAdminLogResults &channelsAdminLogResultsVal
         break;
     }
 
-    channelsAdminLogResultsValue = result;
+    channelsAdminLogResultsValue = std::move(result);
 
     return *this;
 }
@@ -8024,6 +8071,12171 @@ Stream &Stream::operator<<(const TLInputMedia &inputMediaValue)
 }
 // End of generated write operators implementation
 
+// Generated serialized size implementation
+quint32 serializedSize(const TLAccountDaysTTL &accountDaysTTLValue)
+{
+    quint32 size = serializedSize(accountDaysTTLValue.tlType);
+
+    switch (accountDaysTTLValue.tlType) {
+    case TLValue::AccountDaysTTL:
+        size += serializedSize(accountDaysTTLValue.days);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLAccountPassword &accountPasswordValue)
+{
+    quint32 size = serializedSize(accountPasswordValue.tlType);
+
+    switch (accountPasswordValue.tlType) {
+    case TLValue::AccountNoPassword:
+        size += serializedSize(accountPasswordValue.newSalt);
+        size += serializedSize(accountPasswordValue.emailUnconfirmedPattern);
+        break;
+    case TLValue::AccountPassword:
+        size += serializedSize(accountPasswordValue.currentSalt);
+        size += serializedSize(accountPasswordValue.newSalt);
+        size += serializedSize(accountPasswordValue.hint);
+        size += serializedSize(accountPasswordValue.hasRecovery);
+        size += serializedSize(accountPasswordValue.emailUnconfirmedPattern);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLAccountPasswordInputSettings &accountPasswordInputSettingsValue)
+{
+    quint32 size = serializedSize(accountPasswordInputSettingsValue.tlType);
+
+    switch (accountPasswordInputSettingsValue.tlType) {
+    case TLValue::AccountPasswordInputSettings:
+        size += serializedSize(accountPasswordInputSettingsValue.flags);
+        if (accountPasswordInputSettingsValue.flags & TLAccountPasswordInputSettings::NewSalt) {
+            size += serializedSize(accountPasswordInputSettingsValue.newSalt);
+        }
+        if (accountPasswordInputSettingsValue.flags & TLAccountPasswordInputSettings::NewPasswordHash) {
+            size += serializedSize(accountPasswordInputSettingsValue.newPasswordHash);
+        }
+        if (accountPasswordInputSettingsValue.flags & TLAccountPasswordInputSettings::Hint) {
+            size += serializedSize(accountPasswordInputSettingsValue.hint);
+        }
+        if (accountPasswordInputSettingsValue.flags & TLAccountPasswordInputSettings::Email) {
+            size += serializedSize(accountPasswordInputSettingsValue.email);
+        }
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLAccountPasswordSettings &accountPasswordSettingsValue)
+{
+    quint32 size = serializedSize(accountPasswordSettingsValue.tlType);
+
+    switch (accountPasswordSettingsValue.tlType) {
+    case TLValue::AccountPasswordSettings:
+        size += serializedSize(accountPasswordSettingsValue.email);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLAccountTmpPassword &accountTmpPasswordValue)
+{
+    quint32 size = serializedSize(accountTmpPasswordValue.tlType);
+
+    switch (accountTmpPasswordValue.tlType) {
+    case TLValue::AccountTmpPassword:
+        size += serializedSize(accountTmpPasswordValue.tmpPassword);
+        size += serializedSize(accountTmpPasswordValue.validUntil);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLAuthCheckedPhone &authCheckedPhoneValue)
+{
+    quint32 size = serializedSize(authCheckedPhoneValue.tlType);
+
+    switch (authCheckedPhoneValue.tlType) {
+    case TLValue::AuthCheckedPhone:
+        size += serializedSize(authCheckedPhoneValue.phoneRegistered);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLAuthCodeType &authCodeTypeValue)
+{
+    quint32 size = serializedSize(authCodeTypeValue.tlType);
+
+    switch (authCodeTypeValue.tlType) {
+    case TLValue::AuthCodeTypeSms:
+    case TLValue::AuthCodeTypeCall:
+    case TLValue::AuthCodeTypeFlashCall:
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLAuthExportedAuthorization &authExportedAuthorizationValue)
+{
+    quint32 size = serializedSize(authExportedAuthorizationValue.tlType);
+
+    switch (authExportedAuthorizationValue.tlType) {
+    case TLValue::AuthExportedAuthorization:
+        size += serializedSize(authExportedAuthorizationValue.id);
+        size += serializedSize(authExportedAuthorizationValue.bytes);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLAuthPasswordRecovery &authPasswordRecoveryValue)
+{
+    quint32 size = serializedSize(authPasswordRecoveryValue.tlType);
+
+    switch (authPasswordRecoveryValue.tlType) {
+    case TLValue::AuthPasswordRecovery:
+        size += serializedSize(authPasswordRecoveryValue.emailPattern);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLAuthSentCodeType &authSentCodeTypeValue)
+{
+    quint32 size = serializedSize(authSentCodeTypeValue.tlType);
+
+    switch (authSentCodeTypeValue.tlType) {
+    case TLValue::AuthSentCodeTypeApp:
+    case TLValue::AuthSentCodeTypeSms:
+    case TLValue::AuthSentCodeTypeCall:
+        size += serializedSize(authSentCodeTypeValue.length);
+        break;
+    case TLValue::AuthSentCodeTypeFlashCall:
+        size += serializedSize(authSentCodeTypeValue.pattern);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLAuthorization &authorizationValue)
+{
+    quint32 size = serializedSize(authorizationValue.tlType);
+
+    switch (authorizationValue.tlType) {
+    case TLValue::Authorization:
+        size += serializedSize(authorizationValue.hash);
+        size += serializedSize(authorizationValue.flags);
+        size += serializedSize(authorizationValue.deviceModel);
+        size += serializedSize(authorizationValue.platform);
+        size += serializedSize(authorizationValue.systemVersion);
+        size += serializedSize(authorizationValue.apiId);
+        size += serializedSize(authorizationValue.appName);
+        size += serializedSize(authorizationValue.appVersion);
+        size += serializedSize(authorizationValue.dateCreated);
+        size += serializedSize(authorizationValue.dateActive);
+        size += serializedSize(authorizationValue.ip);
+        size += serializedSize(authorizationValue.country);
+        size += serializedSize(authorizationValue.region);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLBadMsgNotification &badMsgNotificationValue)
+{
+    quint32 size = serializedSize(badMsgNotificationValue.tlType);
+
+    switch (badMsgNotificationValue.tlType) {
+    case TLValue::BadMsgNotification:
+        size += serializedSize(badMsgNotificationValue.badMsgId);
+        size += serializedSize(badMsgNotificationValue.badMsgSeqno);
+        size += serializedSize(badMsgNotificationValue.errorCode);
+        break;
+    case TLValue::BadServerSalt:
+        size += serializedSize(badMsgNotificationValue.badMsgId);
+        size += serializedSize(badMsgNotificationValue.badMsgSeqno);
+        size += serializedSize(badMsgNotificationValue.errorCode);
+        size += serializedSize(badMsgNotificationValue.newServerSalt);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLBotCommand &botCommandValue)
+{
+    quint32 size = serializedSize(botCommandValue.tlType);
+
+    switch (botCommandValue.tlType) {
+    case TLValue::BotCommand:
+        size += serializedSize(botCommandValue.command);
+        size += serializedSize(botCommandValue.description);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLBotInfo &botInfoValue)
+{
+    quint32 size = serializedSize(botInfoValue.tlType);
+
+    switch (botInfoValue.tlType) {
+    case TLValue::BotInfo:
+        size += serializedSize(botInfoValue.userId);
+        size += serializedSize(botInfoValue.description);
+        size += serializedSize(botInfoValue.commands);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLCdnFileHash &cdnFileHashValue)
+{
+    quint32 size = serializedSize(cdnFileHashValue.tlType);
+
+    switch (cdnFileHashValue.tlType) {
+    case TLValue::CdnFileHash:
+        size += serializedSize(cdnFileHashValue.offset);
+        size += serializedSize(cdnFileHashValue.limit);
+        size += serializedSize(cdnFileHashValue.hash);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLCdnPublicKey &cdnPublicKeyValue)
+{
+    quint32 size = serializedSize(cdnPublicKeyValue.tlType);
+
+    switch (cdnPublicKeyValue.tlType) {
+    case TLValue::CdnPublicKey:
+        size += serializedSize(cdnPublicKeyValue.dcId);
+        size += serializedSize(cdnPublicKeyValue.publicKey);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLChannelParticipantsFilter &channelParticipantsFilterValue)
+{
+    quint32 size = serializedSize(channelParticipantsFilterValue.tlType);
+
+    switch (channelParticipantsFilterValue.tlType) {
+    case TLValue::ChannelParticipantsRecent:
+    case TLValue::ChannelParticipantsAdmins:
+    case TLValue::ChannelParticipantsBots:
+        break;
+    case TLValue::ChannelParticipantsKicked:
+    case TLValue::ChannelParticipantsBanned:
+    case TLValue::ChannelParticipantsSearch:
+        size += serializedSize(channelParticipantsFilterValue.q);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLChatParticipant &chatParticipantValue)
+{
+    quint32 size = serializedSize(chatParticipantValue.tlType);
+
+    switch (chatParticipantValue.tlType) {
+    case TLValue::ChatParticipant:
+    case TLValue::ChatParticipantAdmin:
+        size += serializedSize(chatParticipantValue.userId);
+        size += serializedSize(chatParticipantValue.inviterId);
+        size += serializedSize(chatParticipantValue.date);
+        break;
+    case TLValue::ChatParticipantCreator:
+        size += serializedSize(chatParticipantValue.userId);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLChatParticipants &chatParticipantsValue)
+{
+    quint32 size = serializedSize(chatParticipantsValue.tlType);
+
+    switch (chatParticipantsValue.tlType) {
+    case TLValue::ChatParticipantsForbidden:
+        size += serializedSize(chatParticipantsValue.flags);
+        size += serializedSize(chatParticipantsValue.chatId);
+        if (chatParticipantsValue.flags & TLChatParticipants::SelfParticipant) {
+            size += serializedSize(chatParticipantsValue.selfParticipant);
+        }
+        break;
+    case TLValue::ChatParticipants:
+        size += serializedSize(chatParticipantsValue.chatId);
+        size += serializedSize(chatParticipantsValue.participants);
+        size += serializedSize(chatParticipantsValue.version);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLClientDHInnerData &clientDHInnerDataValue)
+{
+    quint32 size = serializedSize(clientDHInnerDataValue.tlType);
+
+    switch (clientDHInnerDataValue.tlType) {
+    case TLValue::ClientDHInnerData:
+        size += serializedSize(clientDHInnerDataValue.nonce);
+        size += serializedSize(clientDHInnerDataValue.serverNonce);
+        size += serializedSize(clientDHInnerDataValue.retryId);
+        size += serializedSize(clientDHInnerDataValue.gB);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLContact &contactValue)
+{
+    quint32 size = serializedSize(contactValue.tlType);
+
+    switch (contactValue.tlType) {
+    case TLValue::Contact:
+        size += serializedSize(contactValue.userId);
+        size += serializedSize(contactValue.mutual);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLContactBlocked &contactBlockedValue)
+{
+    quint32 size = serializedSize(contactBlockedValue.tlType);
+
+    switch (contactBlockedValue.tlType) {
+    case TLValue::ContactBlocked:
+        size += serializedSize(contactBlockedValue.userId);
+        size += serializedSize(contactBlockedValue.date);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLContactLink &contactLinkValue)
+{
+    quint32 size = serializedSize(contactLinkValue.tlType);
+
+    switch (contactLinkValue.tlType) {
+    case TLValue::ContactLinkUnknown:
+    case TLValue::ContactLinkNone:
+    case TLValue::ContactLinkHasPhone:
+    case TLValue::ContactLinkContact:
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLDataJSON &dataJSONValue)
+{
+    quint32 size = serializedSize(dataJSONValue.tlType);
+
+    switch (dataJSONValue.tlType) {
+    case TLValue::DataJSON:
+        size += serializedSize(dataJSONValue.data);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLDestroyAuthKeyRes &destroyAuthKeyResValue)
+{
+    quint32 size = serializedSize(destroyAuthKeyResValue.tlType);
+
+    switch (destroyAuthKeyResValue.tlType) {
+    case TLValue::DestroyAuthKeyOk:
+    case TLValue::DestroyAuthKeyNone:
+    case TLValue::DestroyAuthKeyFail:
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLDestroySessionRes &destroySessionResValue)
+{
+    quint32 size = serializedSize(destroySessionResValue.tlType);
+
+    switch (destroySessionResValue.tlType) {
+    case TLValue::DestroySessionOk:
+    case TLValue::DestroySessionNone:
+        size += serializedSize(destroySessionResValue.sessionId);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLDisabledFeature &disabledFeatureValue)
+{
+    quint32 size = serializedSize(disabledFeatureValue.tlType);
+
+    switch (disabledFeatureValue.tlType) {
+    case TLValue::DisabledFeature:
+        size += serializedSize(disabledFeatureValue.feature);
+        size += serializedSize(disabledFeatureValue.description);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLEncryptedChat &encryptedChatValue)
+{
+    quint32 size = serializedSize(encryptedChatValue.tlType);
+
+    switch (encryptedChatValue.tlType) {
+    case TLValue::EncryptedChatEmpty:
+    case TLValue::EncryptedChatDiscarded:
+        size += serializedSize(encryptedChatValue.id);
+        break;
+    case TLValue::EncryptedChatWaiting:
+        size += serializedSize(encryptedChatValue.id);
+        size += serializedSize(encryptedChatValue.accessHash);
+        size += serializedSize(encryptedChatValue.date);
+        size += serializedSize(encryptedChatValue.adminId);
+        size += serializedSize(encryptedChatValue.participantId);
+        break;
+    case TLValue::EncryptedChatRequested:
+        size += serializedSize(encryptedChatValue.id);
+        size += serializedSize(encryptedChatValue.accessHash);
+        size += serializedSize(encryptedChatValue.date);
+        size += serializedSize(encryptedChatValue.adminId);
+        size += serializedSize(encryptedChatValue.participantId);
+        size += serializedSize(encryptedChatValue.gA);
+        break;
+    case TLValue::EncryptedChat:
+        size += serializedSize(encryptedChatValue.id);
+        size += serializedSize(encryptedChatValue.accessHash);
+        size += serializedSize(encryptedChatValue.date);
+        size += serializedSize(encryptedChatValue.adminId);
+        size += serializedSize(encryptedChatValue.participantId);
+        size += serializedSize(encryptedChatValue.gAOrB);
+        size += serializedSize(encryptedChatValue.keyFingerprint);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLEncryptedFile &encryptedFileValue)
+{
+    quint32 size = serializedSize(encryptedFileValue.tlType);
+
+    switch (encryptedFileValue.tlType) {
+    case TLValue::EncryptedFileEmpty:
+        break;
+    case TLValue::EncryptedFile:
+        size += serializedSize(encryptedFileValue.id);
+        size += serializedSize(encryptedFileValue.accessHash);
+        size += serializedSize(encryptedFileValue.size);
+        size += serializedSize(encryptedFileValue.dcId);
+        size += serializedSize(encryptedFileValue.keyFingerprint);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLEncryptedMessage &encryptedMessageValue)
+{
+    quint32 size = serializedSize(encryptedMessageValue.tlType);
+
+    switch (encryptedMessageValue.tlType) {
+    case TLValue::EncryptedMessage:
+        size += serializedSize(encryptedMessageValue.randomId);
+        size += serializedSize(encryptedMessageValue.chatId);
+        size += serializedSize(encryptedMessageValue.date);
+        size += serializedSize(encryptedMessageValue.bytes);
+        size += serializedSize(encryptedMessageValue.file);
+        break;
+    case TLValue::EncryptedMessageService:
+        size += serializedSize(encryptedMessageValue.randomId);
+        size += serializedSize(encryptedMessageValue.chatId);
+        size += serializedSize(encryptedMessageValue.date);
+        size += serializedSize(encryptedMessageValue.bytes);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLError &errorValue)
+{
+    quint32 size = serializedSize(errorValue.tlType);
+
+    switch (errorValue.tlType) {
+    case TLValue::Error:
+        size += serializedSize(errorValue.code);
+        size += serializedSize(errorValue.text);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLExportedChatInvite &exportedChatInviteValue)
+{
+    quint32 size = serializedSize(exportedChatInviteValue.tlType);
+
+    switch (exportedChatInviteValue.tlType) {
+    case TLValue::ChatInviteEmpty:
+        break;
+    case TLValue::ChatInviteExported:
+        size += serializedSize(exportedChatInviteValue.link);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLExportedMessageLink &exportedMessageLinkValue)
+{
+    quint32 size = serializedSize(exportedMessageLinkValue.tlType);
+
+    switch (exportedMessageLinkValue.tlType) {
+    case TLValue::ExportedMessageLink:
+        size += serializedSize(exportedMessageLinkValue.link);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLFileLocation &fileLocationValue)
+{
+    quint32 size = serializedSize(fileLocationValue.tlType);
+
+    switch (fileLocationValue.tlType) {
+    case TLValue::FileLocationUnavailable:
+        size += serializedSize(fileLocationValue.volumeId);
+        size += serializedSize(fileLocationValue.localId);
+        size += serializedSize(fileLocationValue.secret);
+        break;
+    case TLValue::FileLocation:
+        size += serializedSize(fileLocationValue.dcId);
+        size += serializedSize(fileLocationValue.volumeId);
+        size += serializedSize(fileLocationValue.localId);
+        size += serializedSize(fileLocationValue.secret);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLFutureSalt &futureSaltValue)
+{
+    quint32 size = serializedSize(futureSaltValue.tlType);
+
+    switch (futureSaltValue.tlType) {
+    case TLValue::FutureSalt:
+        size += serializedSize(futureSaltValue.validSince);
+        size += serializedSize(futureSaltValue.validUntil);
+        size += serializedSize(futureSaltValue.salt);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLFutureSalts &futureSaltsValue)
+{
+    quint32 size = serializedSize(futureSaltsValue.tlType);
+
+    switch (futureSaltsValue.tlType) {
+    case TLValue::FutureSalts:
+        size += serializedSize(futureSaltsValue.reqMsgId);
+        size += serializedSize(futureSaltsValue.now);
+        size += serializedSize(futureSaltsValue.salts);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLGeoPoint &geoPointValue)
+{
+    quint32 size = serializedSize(geoPointValue.tlType);
+
+    switch (geoPointValue.tlType) {
+    case TLValue::GeoPointEmpty:
+        break;
+    case TLValue::GeoPoint:
+        size += serializedSize(geoPointValue.longitude);
+        size += serializedSize(geoPointValue.latitude);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLHelpAppUpdate &helpAppUpdateValue)
+{
+    quint32 size = serializedSize(helpAppUpdateValue.tlType);
+
+    switch (helpAppUpdateValue.tlType) {
+    case TLValue::HelpAppUpdate:
+        size += serializedSize(helpAppUpdateValue.id);
+        size += serializedSize(helpAppUpdateValue.critical);
+        size += serializedSize(helpAppUpdateValue.url);
+        size += serializedSize(helpAppUpdateValue.text);
+        break;
+    case TLValue::HelpNoAppUpdate:
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLHelpInviteText &helpInviteTextValue)
+{
+    quint32 size = serializedSize(helpInviteTextValue.tlType);
+
+    switch (helpInviteTextValue.tlType) {
+    case TLValue::HelpInviteText:
+        size += serializedSize(helpInviteTextValue.message);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLHelpTermsOfService &helpTermsOfServiceValue)
+{
+    quint32 size = serializedSize(helpTermsOfServiceValue.tlType);
+
+    switch (helpTermsOfServiceValue.tlType) {
+    case TLValue::HelpTermsOfService:
+        size += serializedSize(helpTermsOfServiceValue.text);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLHighScore &highScoreValue)
+{
+    quint32 size = serializedSize(highScoreValue.tlType);
+
+    switch (highScoreValue.tlType) {
+    case TLValue::HighScore:
+        size += serializedSize(highScoreValue.pos);
+        size += serializedSize(highScoreValue.userId);
+        size += serializedSize(highScoreValue.score);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLHttpWait &httpWaitValue)
+{
+    quint32 size = serializedSize(httpWaitValue.tlType);
+
+    switch (httpWaitValue.tlType) {
+    case TLValue::HttpWait:
+        size += serializedSize(httpWaitValue.maxDelay);
+        size += serializedSize(httpWaitValue.waitAfter);
+        size += serializedSize(httpWaitValue.maxWait);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLImportedContact &importedContactValue)
+{
+    quint32 size = serializedSize(importedContactValue.tlType);
+
+    switch (importedContactValue.tlType) {
+    case TLValue::ImportedContact:
+        size += serializedSize(importedContactValue.userId);
+        size += serializedSize(importedContactValue.clientId);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLInlineBotSwitchPM &inlineBotSwitchPMValue)
+{
+    quint32 size = serializedSize(inlineBotSwitchPMValue.tlType);
+
+    switch (inlineBotSwitchPMValue.tlType) {
+    case TLValue::InlineBotSwitchPM:
+        size += serializedSize(inlineBotSwitchPMValue.text);
+        size += serializedSize(inlineBotSwitchPMValue.startParam);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLInputAppEvent &inputAppEventValue)
+{
+    quint32 size = serializedSize(inputAppEventValue.tlType);
+
+    switch (inputAppEventValue.tlType) {
+    case TLValue::InputAppEvent:
+        size += serializedSize(inputAppEventValue.time);
+        size += serializedSize(inputAppEventValue.type);
+        size += serializedSize(inputAppEventValue.peer);
+        size += serializedSize(inputAppEventValue.data);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLInputBotInlineMessageID &inputBotInlineMessageIDValue)
+{
+    quint32 size = serializedSize(inputBotInlineMessageIDValue.tlType);
+
+    switch (inputBotInlineMessageIDValue.tlType) {
+    case TLValue::InputBotInlineMessageID:
+        size += serializedSize(inputBotInlineMessageIDValue.dcId);
+        size += serializedSize(inputBotInlineMessageIDValue.id);
+        size += serializedSize(inputBotInlineMessageIDValue.accessHash);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLInputChannel &inputChannelValue)
+{
+    quint32 size = serializedSize(inputChannelValue.tlType);
+
+    switch (inputChannelValue.tlType) {
+    case TLValue::InputChannelEmpty:
+        break;
+    case TLValue::InputChannel:
+        size += serializedSize(inputChannelValue.channelId);
+        size += serializedSize(inputChannelValue.accessHash);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLInputContact &inputContactValue)
+{
+    quint32 size = serializedSize(inputContactValue.tlType);
+
+    switch (inputContactValue.tlType) {
+    case TLValue::InputPhoneContact:
+        size += serializedSize(inputContactValue.clientId);
+        size += serializedSize(inputContactValue.phone);
+        size += serializedSize(inputContactValue.firstName);
+        size += serializedSize(inputContactValue.lastName);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLInputDocument &inputDocumentValue)
+{
+    quint32 size = serializedSize(inputDocumentValue.tlType);
+
+    switch (inputDocumentValue.tlType) {
+    case TLValue::InputDocumentEmpty:
+        break;
+    case TLValue::InputDocument:
+        size += serializedSize(inputDocumentValue.id);
+        size += serializedSize(inputDocumentValue.accessHash);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLInputEncryptedChat &inputEncryptedChatValue)
+{
+    quint32 size = serializedSize(inputEncryptedChatValue.tlType);
+
+    switch (inputEncryptedChatValue.tlType) {
+    case TLValue::InputEncryptedChat:
+        size += serializedSize(inputEncryptedChatValue.chatId);
+        size += serializedSize(inputEncryptedChatValue.accessHash);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLInputEncryptedFile &inputEncryptedFileValue)
+{
+    quint32 size = serializedSize(inputEncryptedFileValue.tlType);
+
+    switch (inputEncryptedFileValue.tlType) {
+    case TLValue::InputEncryptedFileEmpty:
+        break;
+    case TLValue::InputEncryptedFileUploaded:
+        size += serializedSize(inputEncryptedFileValue.id);
+        size += serializedSize(inputEncryptedFileValue.parts);
+        size += serializedSize(inputEncryptedFileValue.md5Checksum);
+        size += serializedSize(inputEncryptedFileValue.keyFingerprint);
+        break;
+    case TLValue::InputEncryptedFile:
+        size += serializedSize(inputEncryptedFileValue.id);
+        size += serializedSize(inputEncryptedFileValue.accessHash);
+        break;
+    case TLValue::InputEncryptedFileBigUploaded:
+        size += serializedSize(inputEncryptedFileValue.id);
+        size += serializedSize(inputEncryptedFileValue.parts);
+        size += serializedSize(inputEncryptedFileValue.keyFingerprint);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLInputFile &inputFileValue)
+{
+    quint32 size = serializedSize(inputFileValue.tlType);
+
+    switch (inputFileValue.tlType) {
+    case TLValue::InputFile:
+        size += serializedSize(inputFileValue.id);
+        size += serializedSize(inputFileValue.parts);
+        size += serializedSize(inputFileValue.name);
+        size += serializedSize(inputFileValue.md5Checksum);
+        break;
+    case TLValue::InputFileBig:
+        size += serializedSize(inputFileValue.id);
+        size += serializedSize(inputFileValue.parts);
+        size += serializedSize(inputFileValue.name);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLInputFileLocation &inputFileLocationValue)
+{
+    quint32 size = serializedSize(inputFileLocationValue.tlType);
+
+    switch (inputFileLocationValue.tlType) {
+    case TLValue::InputFileLocation:
+        size += serializedSize(inputFileLocationValue.volumeId);
+        size += serializedSize(inputFileLocationValue.localId);
+        size += serializedSize(inputFileLocationValue.secret);
+        break;
+    case TLValue::InputEncryptedFileLocation:
+        size += serializedSize(inputFileLocationValue.id);
+        size += serializedSize(inputFileLocationValue.accessHash);
+        break;
+    case TLValue::InputDocumentFileLocation:
+        size += serializedSize(inputFileLocationValue.id);
+        size += serializedSize(inputFileLocationValue.accessHash);
+        size += serializedSize(inputFileLocationValue.version);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLInputGeoPoint &inputGeoPointValue)
+{
+    quint32 size = serializedSize(inputGeoPointValue.tlType);
+
+    switch (inputGeoPointValue.tlType) {
+    case TLValue::InputGeoPointEmpty:
+        break;
+    case TLValue::InputGeoPoint:
+        size += serializedSize(inputGeoPointValue.latitude);
+        size += serializedSize(inputGeoPointValue.longitude);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLInputPeer &inputPeerValue)
+{
+    quint32 size = serializedSize(inputPeerValue.tlType);
+
+    switch (inputPeerValue.tlType) {
+    case TLValue::InputPeerEmpty:
+    case TLValue::InputPeerSelf:
+        break;
+    case TLValue::InputPeerChat:
+        size += serializedSize(inputPeerValue.chatId);
+        break;
+    case TLValue::InputPeerUser:
+        size += serializedSize(inputPeerValue.userId);
+        size += serializedSize(inputPeerValue.accessHash);
+        break;
+    case TLValue::InputPeerChannel:
+        size += serializedSize(inputPeerValue.channelId);
+        size += serializedSize(inputPeerValue.accessHash);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLInputPeerNotifyEvents &inputPeerNotifyEventsValue)
+{
+    quint32 size = serializedSize(inputPeerNotifyEventsValue.tlType);
+
+    switch (inputPeerNotifyEventsValue.tlType) {
+    case TLValue::InputPeerNotifyEventsEmpty:
+    case TLValue::InputPeerNotifyEventsAll:
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLInputPhoneCall &inputPhoneCallValue)
+{
+    quint32 size = serializedSize(inputPhoneCallValue.tlType);
+
+    switch (inputPhoneCallValue.tlType) {
+    case TLValue::InputPhoneCall:
+        size += serializedSize(inputPhoneCallValue.id);
+        size += serializedSize(inputPhoneCallValue.accessHash);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLInputPhoto &inputPhotoValue)
+{
+    quint32 size = serializedSize(inputPhotoValue.tlType);
+
+    switch (inputPhotoValue.tlType) {
+    case TLValue::InputPhotoEmpty:
+        break;
+    case TLValue::InputPhoto:
+        size += serializedSize(inputPhotoValue.id);
+        size += serializedSize(inputPhotoValue.accessHash);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLInputPrivacyKey &inputPrivacyKeyValue)
+{
+    quint32 size = serializedSize(inputPrivacyKeyValue.tlType);
+
+    switch (inputPrivacyKeyValue.tlType) {
+    case TLValue::InputPrivacyKeyStatusTimestamp:
+    case TLValue::InputPrivacyKeyChatInvite:
+    case TLValue::InputPrivacyKeyPhoneCall:
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLInputStickerSet &inputStickerSetValue)
+{
+    quint32 size = serializedSize(inputStickerSetValue.tlType);
+
+    switch (inputStickerSetValue.tlType) {
+    case TLValue::InputStickerSetEmpty:
+        break;
+    case TLValue::InputStickerSetID:
+        size += serializedSize(inputStickerSetValue.id);
+        size += serializedSize(inputStickerSetValue.accessHash);
+        break;
+    case TLValue::InputStickerSetShortName:
+        size += serializedSize(inputStickerSetValue.shortName);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLInputStickeredMedia &inputStickeredMediaValue)
+{
+    quint32 size = serializedSize(inputStickeredMediaValue.tlType);
+
+    switch (inputStickeredMediaValue.tlType) {
+    case TLValue::InputStickeredMediaPhoto:
+        size += serializedSize(inputStickeredMediaValue.inputPhotoId);
+        break;
+    case TLValue::InputStickeredMediaDocument:
+        size += serializedSize(inputStickeredMediaValue.inputDocumentId);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLInputUser &inputUserValue)
+{
+    quint32 size = serializedSize(inputUserValue.tlType);
+
+    switch (inputUserValue.tlType) {
+    case TLValue::InputUserEmpty:
+    case TLValue::InputUserSelf:
+        break;
+    case TLValue::InputUser:
+        size += serializedSize(inputUserValue.userId);
+        size += serializedSize(inputUserValue.accessHash);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLInputWebFileLocation &inputWebFileLocationValue)
+{
+    quint32 size = serializedSize(inputWebFileLocationValue.tlType);
+
+    switch (inputWebFileLocationValue.tlType) {
+    case TLValue::InputWebFileLocation:
+        size += serializedSize(inputWebFileLocationValue.url);
+        size += serializedSize(inputWebFileLocationValue.accessHash);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLIpPort &ipPortValue)
+{
+    quint32 size = serializedSize(ipPortValue.tlType);
+
+    switch (ipPortValue.tlType) {
+    case TLValue::IpPort:
+        size += serializedSize(ipPortValue.ipv4);
+        size += serializedSize(ipPortValue.port);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLLabeledPrice &labeledPriceValue)
+{
+    quint32 size = serializedSize(labeledPriceValue.tlType);
+
+    switch (labeledPriceValue.tlType) {
+    case TLValue::LabeledPrice:
+        size += serializedSize(labeledPriceValue.label);
+        size += serializedSize(labeledPriceValue.amount);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLLangPackLanguage &langPackLanguageValue)
+{
+    quint32 size = serializedSize(langPackLanguageValue.tlType);
+
+    switch (langPackLanguageValue.tlType) {
+    case TLValue::LangPackLanguage:
+        size += serializedSize(langPackLanguageValue.name);
+        size += serializedSize(langPackLanguageValue.nativeName);
+        size += serializedSize(langPackLanguageValue.langCode);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLLangPackString &langPackStringValue)
+{
+    quint32 size = serializedSize(langPackStringValue.tlType);
+
+    switch (langPackStringValue.tlType) {
+    case TLValue::LangPackString:
+        size += serializedSize(langPackStringValue.key);
+        size += serializedSize(langPackStringValue.value);
+        break;
+    case TLValue::LangPackStringPluralized:
+        size += serializedSize(langPackStringValue.flags);
+        size += serializedSize(langPackStringValue.key);
+        if (langPackStringValue.flags & TLLangPackString::ZeroValue) {
+            size += serializedSize(langPackStringValue.zeroValue);
+        }
+        if (langPackStringValue.flags & TLLangPackString::OneValue) {
+            size += serializedSize(langPackStringValue.oneValue);
+        }
+        if (langPackStringValue.flags & TLLangPackString::TwoValue) {
+            size += serializedSize(langPackStringValue.twoValue);
+        }
+        if (langPackStringValue.flags & TLLangPackString::FewValue) {
+            size += serializedSize(langPackStringValue.fewValue);
+        }
+        if (langPackStringValue.flags & TLLangPackString::ManyValue) {
+            size += serializedSize(langPackStringValue.manyValue);
+        }
+        size += serializedSize(langPackStringValue.otherValue);
+        break;
+    case TLValue::LangPackStringDeleted:
+        size += serializedSize(langPackStringValue.key);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLMaskCoords &maskCoordsValue)
+{
+    quint32 size = serializedSize(maskCoordsValue.tlType);
+
+    switch (maskCoordsValue.tlType) {
+    case TLValue::MaskCoords:
+        size += serializedSize(maskCoordsValue.n);
+        size += serializedSize(maskCoordsValue.x);
+        size += serializedSize(maskCoordsValue.y);
+        size += serializedSize(maskCoordsValue.zoom);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLMessageEntity &messageEntityValue)
+{
+    quint32 size = serializedSize(messageEntityValue.tlType);
+
+    switch (messageEntityValue.tlType) {
+    case TLValue::MessageEntityUnknown:
+    case TLValue::MessageEntityMention:
+    case TLValue::MessageEntityHashtag:
+    case TLValue::MessageEntityBotCommand:
+    case TLValue::MessageEntityUrl:
+    case TLValue::MessageEntityEmail:
+    case TLValue::MessageEntityBold:
+    case TLValue::MessageEntityItalic:
+    case TLValue::MessageEntityCode:
+        size += serializedSize(messageEntityValue.offset);
+        size += serializedSize(messageEntityValue.length);
+        break;
+    case TLValue::MessageEntityPre:
+        size += serializedSize(messageEntityValue.offset);
+        size += serializedSize(messageEntityValue.length);
+        size += serializedSize(messageEntityValue.language);
+        break;
+    case TLValue::MessageEntityTextUrl:
+        size += serializedSize(messageEntityValue.offset);
+        size += serializedSize(messageEntityValue.length);
+        size += serializedSize(messageEntityValue.url);
+        break;
+    case TLValue::MessageEntityMentionName:
+        size += serializedSize(messageEntityValue.offset);
+        size += serializedSize(messageEntityValue.length);
+        size += serializedSize(messageEntityValue.userId);
+        break;
+    case TLValue::InputMessageEntityMentionName:
+        size += serializedSize(messageEntityValue.offset);
+        size += serializedSize(messageEntityValue.length);
+        size += serializedSize(messageEntityValue.inputUserUserId);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLMessageFwdHeader &messageFwdHeaderValue)
+{
+    quint32 size = serializedSize(messageFwdHeaderValue.tlType);
+
+    switch (messageFwdHeaderValue.tlType) {
+    case TLValue::MessageFwdHeader:
+        size += serializedSize(messageFwdHeaderValue.flags);
+        if (messageFwdHeaderValue.flags & TLMessageFwdHeader::FromId) {
+            size += serializedSize(messageFwdHeaderValue.fromId);
+        }
+        size += serializedSize(messageFwdHeaderValue.date);
+        if (messageFwdHeaderValue.flags & TLMessageFwdHeader::ChannelId) {
+            size += serializedSize(messageFwdHeaderValue.channelId);
+        }
+        if (messageFwdHeaderValue.flags & TLMessageFwdHeader::ChannelPost) {
+            size += serializedSize(messageFwdHeaderValue.channelPost);
+        }
+        if (messageFwdHeaderValue.flags & TLMessageFwdHeader::PostAuthor) {
+            size += serializedSize(messageFwdHeaderValue.postAuthor);
+        }
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLMessageRange &messageRangeValue)
+{
+    quint32 size = serializedSize(messageRangeValue.tlType);
+
+    switch (messageRangeValue.tlType) {
+    case TLValue::MessageRange:
+        size += serializedSize(messageRangeValue.minId);
+        size += serializedSize(messageRangeValue.maxId);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLMessagesAffectedHistory &messagesAffectedHistoryValue)
+{
+    quint32 size = serializedSize(messagesAffectedHistoryValue.tlType);
+
+    switch (messagesAffectedHistoryValue.tlType) {
+    case TLValue::MessagesAffectedHistory:
+        size += serializedSize(messagesAffectedHistoryValue.pts);
+        size += serializedSize(messagesAffectedHistoryValue.ptsCount);
+        size += serializedSize(messagesAffectedHistoryValue.offset);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLMessagesAffectedMessages &messagesAffectedMessagesValue)
+{
+    quint32 size = serializedSize(messagesAffectedMessagesValue.tlType);
+
+    switch (messagesAffectedMessagesValue.tlType) {
+    case TLValue::MessagesAffectedMessages:
+        size += serializedSize(messagesAffectedMessagesValue.pts);
+        size += serializedSize(messagesAffectedMessagesValue.ptsCount);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLMessagesDhConfig &messagesDhConfigValue)
+{
+    quint32 size = serializedSize(messagesDhConfigValue.tlType);
+
+    switch (messagesDhConfigValue.tlType) {
+    case TLValue::MessagesDhConfigNotModified:
+        size += serializedSize(messagesDhConfigValue.random);
+        break;
+    case TLValue::MessagesDhConfig:
+        size += serializedSize(messagesDhConfigValue.g);
+        size += serializedSize(messagesDhConfigValue.p);
+        size += serializedSize(messagesDhConfigValue.version);
+        size += serializedSize(messagesDhConfigValue.random);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLMessagesSentEncryptedMessage &messagesSentEncryptedMessageValue)
+{
+    quint32 size = serializedSize(messagesSentEncryptedMessageValue.tlType);
+
+    switch (messagesSentEncryptedMessageValue.tlType) {
+    case TLValue::MessagesSentEncryptedMessage:
+        size += serializedSize(messagesSentEncryptedMessageValue.date);
+        break;
+    case TLValue::MessagesSentEncryptedFile:
+        size += serializedSize(messagesSentEncryptedMessageValue.date);
+        size += serializedSize(messagesSentEncryptedMessageValue.file);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLMsgDetailedInfo &msgDetailedInfoValue)
+{
+    quint32 size = serializedSize(msgDetailedInfoValue.tlType);
+
+    switch (msgDetailedInfoValue.tlType) {
+    case TLValue::MsgDetailedInfo:
+        size += serializedSize(msgDetailedInfoValue.msgId);
+        size += serializedSize(msgDetailedInfoValue.answerMsgId);
+        size += serializedSize(msgDetailedInfoValue.bytes);
+        size += serializedSize(msgDetailedInfoValue.status);
+        break;
+    case TLValue::MsgNewDetailedInfo:
+        size += serializedSize(msgDetailedInfoValue.answerMsgId);
+        size += serializedSize(msgDetailedInfoValue.bytes);
+        size += serializedSize(msgDetailedInfoValue.status);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLMsgResendReq &msgResendReqValue)
+{
+    quint32 size = serializedSize(msgResendReqValue.tlType);
+
+    switch (msgResendReqValue.tlType) {
+    case TLValue::MsgResendReq:
+        size += serializedSize(msgResendReqValue.msgIds);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLMsgsAck &msgsAckValue)
+{
+    quint32 size = serializedSize(msgsAckValue.tlType);
+
+    switch (msgsAckValue.tlType) {
+    case TLValue::MsgsAck:
+        size += serializedSize(msgsAckValue.msgIds);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLMsgsAllInfo &msgsAllInfoValue)
+{
+    quint32 size = serializedSize(msgsAllInfoValue.tlType);
+
+    switch (msgsAllInfoValue.tlType) {
+    case TLValue::MsgsAllInfo:
+        size += serializedSize(msgsAllInfoValue.msgIds);
+        size += serializedSize(msgsAllInfoValue.info);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLMsgsStateInfo &msgsStateInfoValue)
+{
+    quint32 size = serializedSize(msgsStateInfoValue.tlType);
+
+    switch (msgsStateInfoValue.tlType) {
+    case TLValue::MsgsStateInfo:
+        size += serializedSize(msgsStateInfoValue.reqMsgId);
+        size += serializedSize(msgsStateInfoValue.info);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLMsgsStateReq &msgsStateReqValue)
+{
+    quint32 size = serializedSize(msgsStateReqValue.tlType);
+
+    switch (msgsStateReqValue.tlType) {
+    case TLValue::MsgsStateReq:
+        size += serializedSize(msgsStateReqValue.msgIds);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLNearestDc &nearestDcValue)
+{
+    quint32 size = serializedSize(nearestDcValue.tlType);
+
+    switch (nearestDcValue.tlType) {
+    case TLValue::NearestDc:
+        size += serializedSize(nearestDcValue.country);
+        size += serializedSize(nearestDcValue.thisDc);
+        size += serializedSize(nearestDcValue.nearestDc);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLNewSession &newSessionValue)
+{
+    quint32 size = serializedSize(newSessionValue.tlType);
+
+    switch (newSessionValue.tlType) {
+    case TLValue::NewSessionCreated:
+        size += serializedSize(newSessionValue.firstMsgId);
+        size += serializedSize(newSessionValue.uniqueId);
+        size += serializedSize(newSessionValue.serverSalt);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLPQInnerData &pQInnerDataValue)
+{
+    quint32 size = serializedSize(pQInnerDataValue.tlType);
+
+    switch (pQInnerDataValue.tlType) {
+    case TLValue::PQInnerData:
+        size += serializedSize(pQInnerDataValue.pq);
+        size += serializedSize(pQInnerDataValue.p);
+        size += serializedSize(pQInnerDataValue.q);
+        size += serializedSize(pQInnerDataValue.nonce);
+        size += serializedSize(pQInnerDataValue.serverNonce);
+        size += serializedSize(pQInnerDataValue.newNonce);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLPaymentCharge &paymentChargeValue)
+{
+    quint32 size = serializedSize(paymentChargeValue.tlType);
+
+    switch (paymentChargeValue.tlType) {
+    case TLValue::PaymentCharge:
+        size += serializedSize(paymentChargeValue.id);
+        size += serializedSize(paymentChargeValue.providerChargeId);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLPaymentSavedCredentials &paymentSavedCredentialsValue)
+{
+    quint32 size = serializedSize(paymentSavedCredentialsValue.tlType);
+
+    switch (paymentSavedCredentialsValue.tlType) {
+    case TLValue::PaymentSavedCredentialsCard:
+        size += serializedSize(paymentSavedCredentialsValue.id);
+        size += serializedSize(paymentSavedCredentialsValue.title);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLPeer &peerValue)
+{
+    quint32 size = serializedSize(peerValue.tlType);
+
+    switch (peerValue.tlType) {
+    case TLValue::PeerUser:
+        size += serializedSize(peerValue.userId);
+        break;
+    case TLValue::PeerChat:
+        size += serializedSize(peerValue.chatId);
+        break;
+    case TLValue::PeerChannel:
+        size += serializedSize(peerValue.channelId);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLPeerNotifyEvents &peerNotifyEventsValue)
+{
+    quint32 size = serializedSize(peerNotifyEventsValue.tlType);
+
+    switch (peerNotifyEventsValue.tlType) {
+    case TLValue::PeerNotifyEventsEmpty:
+    case TLValue::PeerNotifyEventsAll:
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLPhoneCallDiscardReason &phoneCallDiscardReasonValue)
+{
+    quint32 size = serializedSize(phoneCallDiscardReasonValue.tlType);
+
+    switch (phoneCallDiscardReasonValue.tlType) {
+    case TLValue::PhoneCallDiscardReasonMissed:
+    case TLValue::PhoneCallDiscardReasonDisconnect:
+    case TLValue::PhoneCallDiscardReasonHangup:
+    case TLValue::PhoneCallDiscardReasonBusy:
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLPhoneConnection &phoneConnectionValue)
+{
+    quint32 size = serializedSize(phoneConnectionValue.tlType);
+
+    switch (phoneConnectionValue.tlType) {
+    case TLValue::PhoneConnection:
+        size += serializedSize(phoneConnectionValue.id);
+        size += serializedSize(phoneConnectionValue.ip);
+        size += serializedSize(phoneConnectionValue.ipv6);
+        size += serializedSize(phoneConnectionValue.port);
+        size += serializedSize(phoneConnectionValue.peerTag);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLPhotoSize &photoSizeValue)
+{
+    quint32 size = serializedSize(photoSizeValue.tlType);
+
+    switch (photoSizeValue.tlType) {
+    case TLValue::PhotoSizeEmpty:
+        size += serializedSize(photoSizeValue.type);
+        break;
+    case TLValue::PhotoSize:
+        size += serializedSize(photoSizeValue.type);
+        size += serializedSize(photoSizeValue.location);
+        size += serializedSize(photoSizeValue.w);
+        size += serializedSize(photoSizeValue.h);
+        size += serializedSize(photoSizeValue.size);
+        break;
+    case TLValue::PhotoCachedSize:
+        size += serializedSize(photoSizeValue.type);
+        size += serializedSize(photoSizeValue.location);
+        size += serializedSize(photoSizeValue.w);
+        size += serializedSize(photoSizeValue.h);
+        size += serializedSize(photoSizeValue.bytes);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLPong &pongValue)
+{
+    quint32 size = serializedSize(pongValue.tlType);
+
+    switch (pongValue.tlType) {
+    case TLValue::Pong:
+        size += serializedSize(pongValue.msgId);
+        size += serializedSize(pongValue.pingId);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLPopularContact &popularContactValue)
+{
+    quint32 size = serializedSize(popularContactValue.tlType);
+
+    switch (popularContactValue.tlType) {
+    case TLValue::PopularContact:
+        size += serializedSize(popularContactValue.clientId);
+        size += serializedSize(popularContactValue.importers);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLPostAddress &postAddressValue)
+{
+    quint32 size = serializedSize(postAddressValue.tlType);
+
+    switch (postAddressValue.tlType) {
+    case TLValue::PostAddress:
+        size += serializedSize(postAddressValue.streetLine1);
+        size += serializedSize(postAddressValue.streetLine2);
+        size += serializedSize(postAddressValue.city);
+        size += serializedSize(postAddressValue.state);
+        size += serializedSize(postAddressValue.countryIso2);
+        size += serializedSize(postAddressValue.postCode);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLPrivacyKey &privacyKeyValue)
+{
+    quint32 size = serializedSize(privacyKeyValue.tlType);
+
+    switch (privacyKeyValue.tlType) {
+    case TLValue::PrivacyKeyStatusTimestamp:
+    case TLValue::PrivacyKeyChatInvite:
+    case TLValue::PrivacyKeyPhoneCall:
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLPrivacyRule &privacyRuleValue)
+{
+    quint32 size = serializedSize(privacyRuleValue.tlType);
+
+    switch (privacyRuleValue.tlType) {
+    case TLValue::PrivacyValueAllowContacts:
+    case TLValue::PrivacyValueAllowAll:
+    case TLValue::PrivacyValueDisallowContacts:
+    case TLValue::PrivacyValueDisallowAll:
+        break;
+    case TLValue::PrivacyValueAllowUsers:
+    case TLValue::PrivacyValueDisallowUsers:
+        size += serializedSize(privacyRuleValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLReceivedNotifyMessage &receivedNotifyMessageValue)
+{
+    quint32 size = serializedSize(receivedNotifyMessageValue.tlType);
+
+    switch (receivedNotifyMessageValue.tlType) {
+    case TLValue::ReceivedNotifyMessage:
+        size += serializedSize(receivedNotifyMessageValue.id);
+        size += serializedSize(receivedNotifyMessageValue.flags);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLReportReason &reportReasonValue)
+{
+    quint32 size = serializedSize(reportReasonValue.tlType);
+
+    switch (reportReasonValue.tlType) {
+    case TLValue::InputReportReasonSpam:
+    case TLValue::InputReportReasonViolence:
+    case TLValue::InputReportReasonPornography:
+        break;
+    case TLValue::InputReportReasonOther:
+        size += serializedSize(reportReasonValue.text);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLResPQ &resPQValue)
+{
+    quint32 size = serializedSize(resPQValue.tlType);
+
+    switch (resPQValue.tlType) {
+    case TLValue::ResPQ:
+        size += serializedSize(resPQValue.nonce);
+        size += serializedSize(resPQValue.serverNonce);
+        size += serializedSize(resPQValue.pq);
+        size += serializedSize(resPQValue.serverPublicKeyFingerprints);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLRichText &richTextValue)
+{
+    quint32 size = serializedSize(richTextValue.tlType);
+
+    switch (richTextValue.tlType) {
+    case TLValue::TextEmpty:
+        break;
+    case TLValue::TextPlain:
+        size += serializedSize(richTextValue.stringText);
+        break;
+    case TLValue::TextBold:
+    case TLValue::TextItalic:
+    case TLValue::TextUnderline:
+    case TLValue::TextStrike:
+    case TLValue::TextFixed:
+        size += serializedSize(*richTextValue.richText);
+        break;
+    case TLValue::TextUrl:
+        size += serializedSize(*richTextValue.richText);
+        size += serializedSize(richTextValue.url);
+        size += serializedSize(richTextValue.webpageId);
+        break;
+    case TLValue::TextEmail:
+        size += serializedSize(*richTextValue.richText);
+        size += serializedSize(richTextValue.email);
+        break;
+    case TLValue::TextConcat:
+        size += serializedSize(richTextValue.texts);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLRpcDropAnswer &rpcDropAnswerValue)
+{
+    quint32 size = serializedSize(rpcDropAnswerValue.tlType);
+
+    switch (rpcDropAnswerValue.tlType) {
+    case TLValue::RpcAnswerUnknown:
+    case TLValue::RpcAnswerDroppedRunning:
+        break;
+    case TLValue::RpcAnswerDropped:
+        size += serializedSize(rpcDropAnswerValue.msgId);
+        size += serializedSize(rpcDropAnswerValue.seqNo);
+        size += serializedSize(rpcDropAnswerValue.bytes);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLRpcError &rpcErrorValue)
+{
+    quint32 size = serializedSize(rpcErrorValue.tlType);
+
+    switch (rpcErrorValue.tlType) {
+    case TLValue::RpcError:
+        size += serializedSize(rpcErrorValue.errorCode);
+        size += serializedSize(rpcErrorValue.errorMessage);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLSendMessageAction &sendMessageActionValue)
+{
+    quint32 size = serializedSize(sendMessageActionValue.tlType);
+
+    switch (sendMessageActionValue.tlType) {
+    case TLValue::SendMessageTypingAction:
+    case TLValue::SendMessageCancelAction:
+    case TLValue::SendMessageRecordVideoAction:
+    case TLValue::SendMessageRecordAudioAction:
+    case TLValue::SendMessageGeoLocationAction:
+    case TLValue::SendMessageChooseContactAction:
+    case TLValue::SendMessageGamePlayAction:
+    case TLValue::SendMessageRecordRoundAction:
+        break;
+    case TLValue::SendMessageUploadVideoAction:
+    case TLValue::SendMessageUploadAudioAction:
+    case TLValue::SendMessageUploadPhotoAction:
+    case TLValue::SendMessageUploadDocumentAction:
+    case TLValue::SendMessageUploadRoundAction:
+        size += serializedSize(sendMessageActionValue.progress);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLServerDHInnerData &serverDHInnerDataValue)
+{
+    quint32 size = serializedSize(serverDHInnerDataValue.tlType);
+
+    switch (serverDHInnerDataValue.tlType) {
+    case TLValue::ServerDHInnerData:
+        size += serializedSize(serverDHInnerDataValue.nonce);
+        size += serializedSize(serverDHInnerDataValue.serverNonce);
+        size += serializedSize(serverDHInnerDataValue.g);
+        size += serializedSize(serverDHInnerDataValue.dhPrime);
+        size += serializedSize(serverDHInnerDataValue.gA);
+        size += serializedSize(serverDHInnerDataValue.serverTime);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLServerDHParams &serverDHParamsValue)
+{
+    quint32 size = serializedSize(serverDHParamsValue.tlType);
+
+    switch (serverDHParamsValue.tlType) {
+    case TLValue::ServerDHParamsFail:
+        size += serializedSize(serverDHParamsValue.nonce);
+        size += serializedSize(serverDHParamsValue.serverNonce);
+        size += serializedSize(serverDHParamsValue.newNonceHash);
+        break;
+    case TLValue::ServerDHParamsOk:
+        size += serializedSize(serverDHParamsValue.nonce);
+        size += serializedSize(serverDHParamsValue.serverNonce);
+        size += serializedSize(serverDHParamsValue.encryptedAnswer);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLSetClientDHParamsAnswer &setClientDHParamsAnswerValue)
+{
+    quint32 size = serializedSize(setClientDHParamsAnswerValue.tlType);
+
+    switch (setClientDHParamsAnswerValue.tlType) {
+    case TLValue::DhGenOk:
+        size += serializedSize(setClientDHParamsAnswerValue.nonce);
+        size += serializedSize(setClientDHParamsAnswerValue.serverNonce);
+        size += serializedSize(setClientDHParamsAnswerValue.newNonceHash1);
+        break;
+    case TLValue::DhGenRetry:
+        size += serializedSize(setClientDHParamsAnswerValue.nonce);
+        size += serializedSize(setClientDHParamsAnswerValue.serverNonce);
+        size += serializedSize(setClientDHParamsAnswerValue.newNonceHash2);
+        break;
+    case TLValue::DhGenFail:
+        size += serializedSize(setClientDHParamsAnswerValue.nonce);
+        size += serializedSize(setClientDHParamsAnswerValue.serverNonce);
+        size += serializedSize(setClientDHParamsAnswerValue.newNonceHash3);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLShippingOption &shippingOptionValue)
+{
+    quint32 size = serializedSize(shippingOptionValue.tlType);
+
+    switch (shippingOptionValue.tlType) {
+    case TLValue::ShippingOption:
+        size += serializedSize(shippingOptionValue.id);
+        size += serializedSize(shippingOptionValue.title);
+        size += serializedSize(shippingOptionValue.prices);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLStickerPack &stickerPackValue)
+{
+    quint32 size = serializedSize(stickerPackValue.tlType);
+
+    switch (stickerPackValue.tlType) {
+    case TLValue::StickerPack:
+        size += serializedSize(stickerPackValue.emoticon);
+        size += serializedSize(stickerPackValue.documents);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLStorageFileType &storageFileTypeValue)
+{
+    quint32 size = serializedSize(storageFileTypeValue.tlType);
+
+    switch (storageFileTypeValue.tlType) {
+    case TLValue::StorageFileUnknown:
+    case TLValue::StorageFilePartial:
+    case TLValue::StorageFileJpeg:
+    case TLValue::StorageFileGif:
+    case TLValue::StorageFilePng:
+    case TLValue::StorageFilePdf:
+    case TLValue::StorageFileMp3:
+    case TLValue::StorageFileMov:
+    case TLValue::StorageFileMp4:
+    case TLValue::StorageFileWebp:
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLTopPeer &topPeerValue)
+{
+    quint32 size = serializedSize(topPeerValue.tlType);
+
+    switch (topPeerValue.tlType) {
+    case TLValue::TopPeer:
+        size += serializedSize(topPeerValue.peer);
+        size += serializedSize(topPeerValue.rating);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLTopPeerCategory &topPeerCategoryValue)
+{
+    quint32 size = serializedSize(topPeerCategoryValue.tlType);
+
+    switch (topPeerCategoryValue.tlType) {
+    case TLValue::TopPeerCategoryBotsPM:
+    case TLValue::TopPeerCategoryBotsInline:
+    case TLValue::TopPeerCategoryCorrespondents:
+    case TLValue::TopPeerCategoryGroups:
+    case TLValue::TopPeerCategoryChannels:
+    case TLValue::TopPeerCategoryPhoneCalls:
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLTopPeerCategoryPeers &topPeerCategoryPeersValue)
+{
+    quint32 size = serializedSize(topPeerCategoryPeersValue.tlType);
+
+    switch (topPeerCategoryPeersValue.tlType) {
+    case TLValue::TopPeerCategoryPeers:
+        size += serializedSize(topPeerCategoryPeersValue.category);
+        size += serializedSize(topPeerCategoryPeersValue.count);
+        size += serializedSize(topPeerCategoryPeersValue.peers);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLUpdatesState &updatesStateValue)
+{
+    quint32 size = serializedSize(updatesStateValue.tlType);
+
+    switch (updatesStateValue.tlType) {
+    case TLValue::UpdatesState:
+        size += serializedSize(updatesStateValue.pts);
+        size += serializedSize(updatesStateValue.qts);
+        size += serializedSize(updatesStateValue.date);
+        size += serializedSize(updatesStateValue.seq);
+        size += serializedSize(updatesStateValue.unreadCount);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLUploadCdnFile &uploadCdnFileValue)
+{
+    quint32 size = serializedSize(uploadCdnFileValue.tlType);
+
+    switch (uploadCdnFileValue.tlType) {
+    case TLValue::UploadCdnFileReuploadNeeded:
+        size += serializedSize(uploadCdnFileValue.requestToken);
+        break;
+    case TLValue::UploadCdnFile:
+        size += serializedSize(uploadCdnFileValue.bytes);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLUploadFile &uploadFileValue)
+{
+    quint32 size = serializedSize(uploadFileValue.tlType);
+
+    switch (uploadFileValue.tlType) {
+    case TLValue::UploadFile:
+        size += serializedSize(uploadFileValue.type);
+        size += serializedSize(uploadFileValue.mtime);
+        size += serializedSize(uploadFileValue.bytes);
+        break;
+    case TLValue::UploadFileCdnRedirect:
+        size += serializedSize(uploadFileValue.dcId);
+        size += serializedSize(uploadFileValue.fileToken);
+        size += serializedSize(uploadFileValue.encryptionKey);
+        size += serializedSize(uploadFileValue.encryptionIv);
+        size += serializedSize(uploadFileValue.cdnFileHashes);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLUploadWebFile &uploadWebFileValue)
+{
+    quint32 size = serializedSize(uploadWebFileValue.tlType);
+
+    switch (uploadWebFileValue.tlType) {
+    case TLValue::UploadWebFile:
+        size += serializedSize(uploadWebFileValue.size);
+        size += serializedSize(uploadWebFileValue.mimeType);
+        size += serializedSize(uploadWebFileValue.fileType);
+        size += serializedSize(uploadWebFileValue.mtime);
+        size += serializedSize(uploadWebFileValue.bytes);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLUserProfilePhoto &userProfilePhotoValue)
+{
+    quint32 size = serializedSize(userProfilePhotoValue.tlType);
+
+    switch (userProfilePhotoValue.tlType) {
+    case TLValue::UserProfilePhotoEmpty:
+        break;
+    case TLValue::UserProfilePhoto:
+        size += serializedSize(userProfilePhotoValue.photoId);
+        size += serializedSize(userProfilePhotoValue.photoSmall);
+        size += serializedSize(userProfilePhotoValue.photoBig);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLUserStatus &userStatusValue)
+{
+    quint32 size = serializedSize(userStatusValue.tlType);
+
+    switch (userStatusValue.tlType) {
+    case TLValue::UserStatusEmpty:
+    case TLValue::UserStatusRecently:
+    case TLValue::UserStatusLastWeek:
+    case TLValue::UserStatusLastMonth:
+        break;
+    case TLValue::UserStatusOnline:
+        size += serializedSize(userStatusValue.expires);
+        break;
+    case TLValue::UserStatusOffline:
+        size += serializedSize(userStatusValue.wasOnline);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLWallPaper &wallPaperValue)
+{
+    quint32 size = serializedSize(wallPaperValue.tlType);
+
+    switch (wallPaperValue.tlType) {
+    case TLValue::WallPaper:
+        size += serializedSize(wallPaperValue.id);
+        size += serializedSize(wallPaperValue.title);
+        size += serializedSize(wallPaperValue.sizes);
+        size += serializedSize(wallPaperValue.color);
+        break;
+    case TLValue::WallPaperSolid:
+        size += serializedSize(wallPaperValue.id);
+        size += serializedSize(wallPaperValue.title);
+        size += serializedSize(wallPaperValue.bgColor);
+        size += serializedSize(wallPaperValue.color);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLAccountAuthorizations &accountAuthorizationsValue)
+{
+    quint32 size = serializedSize(accountAuthorizationsValue.tlType);
+
+    switch (accountAuthorizationsValue.tlType) {
+    case TLValue::AccountAuthorizations:
+        size += serializedSize(accountAuthorizationsValue.authorizations);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLAuthSentCode &authSentCodeValue)
+{
+    quint32 size = serializedSize(authSentCodeValue.tlType);
+
+    switch (authSentCodeValue.tlType) {
+    case TLValue::AuthSentCode:
+        size += serializedSize(authSentCodeValue.flags);
+        size += serializedSize(authSentCodeValue.type);
+        size += serializedSize(authSentCodeValue.phoneCodeHash);
+        if (authSentCodeValue.flags & TLAuthSentCode::NextType) {
+            size += serializedSize(authSentCodeValue.nextType);
+        }
+        if (authSentCodeValue.flags & TLAuthSentCode::Timeout) {
+            size += serializedSize(authSentCodeValue.timeout);
+        }
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLCdnConfig &cdnConfigValue)
+{
+    quint32 size = serializedSize(cdnConfigValue.tlType);
+
+    switch (cdnConfigValue.tlType) {
+    case TLValue::CdnConfig:
+        size += serializedSize(cdnConfigValue.publicKeys);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLChannelAdminLogEventsFilter &channelAdminLogEventsFilterValue)
+{
+    quint32 size = serializedSize(channelAdminLogEventsFilterValue.tlType);
+
+    switch (channelAdminLogEventsFilterValue.tlType) {
+    case TLValue::ChannelAdminLogEventsFilter:
+        size += serializedSize(channelAdminLogEventsFilterValue.flags);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLChannelAdminRights &channelAdminRightsValue)
+{
+    quint32 size = serializedSize(channelAdminRightsValue.tlType);
+
+    switch (channelAdminRightsValue.tlType) {
+    case TLValue::ChannelAdminRights:
+        size += serializedSize(channelAdminRightsValue.flags);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLChannelBannedRights &channelBannedRightsValue)
+{
+    quint32 size = serializedSize(channelBannedRightsValue.tlType);
+
+    switch (channelBannedRightsValue.tlType) {
+    case TLValue::ChannelBannedRights:
+        size += serializedSize(channelBannedRightsValue.flags);
+        size += serializedSize(channelBannedRightsValue.untilDate);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLChannelMessagesFilter &channelMessagesFilterValue)
+{
+    quint32 size = serializedSize(channelMessagesFilterValue.tlType);
+
+    switch (channelMessagesFilterValue.tlType) {
+    case TLValue::ChannelMessagesFilterEmpty:
+        break;
+    case TLValue::ChannelMessagesFilter:
+        size += serializedSize(channelMessagesFilterValue.flags);
+        size += serializedSize(channelMessagesFilterValue.ranges);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLChannelParticipant &channelParticipantValue)
+{
+    quint32 size = serializedSize(channelParticipantValue.tlType);
+
+    switch (channelParticipantValue.tlType) {
+    case TLValue::ChannelParticipant:
+        size += serializedSize(channelParticipantValue.userId);
+        size += serializedSize(channelParticipantValue.date);
+        break;
+    case TLValue::ChannelParticipantSelf:
+        size += serializedSize(channelParticipantValue.userId);
+        size += serializedSize(channelParticipantValue.inviterId);
+        size += serializedSize(channelParticipantValue.date);
+        break;
+    case TLValue::ChannelParticipantCreator:
+        size += serializedSize(channelParticipantValue.userId);
+        break;
+    case TLValue::ChannelParticipantAdmin:
+        size += serializedSize(channelParticipantValue.flags);
+        size += serializedSize(channelParticipantValue.userId);
+        size += serializedSize(channelParticipantValue.inviterId);
+        size += serializedSize(channelParticipantValue.promotedBy);
+        size += serializedSize(channelParticipantValue.date);
+        size += serializedSize(channelParticipantValue.adminRights);
+        break;
+    case TLValue::ChannelParticipantBanned:
+        size += serializedSize(channelParticipantValue.flags);
+        size += serializedSize(channelParticipantValue.userId);
+        size += serializedSize(channelParticipantValue.kickedBy);
+        size += serializedSize(channelParticipantValue.date);
+        size += serializedSize(channelParticipantValue.bannedRights);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLChatPhoto &chatPhotoValue)
+{
+    quint32 size = serializedSize(chatPhotoValue.tlType);
+
+    switch (chatPhotoValue.tlType) {
+    case TLValue::ChatPhotoEmpty:
+        break;
+    case TLValue::ChatPhoto:
+        size += serializedSize(chatPhotoValue.photoSmall);
+        size += serializedSize(chatPhotoValue.photoBig);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLContactStatus &contactStatusValue)
+{
+    quint32 size = serializedSize(contactStatusValue.tlType);
+
+    switch (contactStatusValue.tlType) {
+    case TLValue::ContactStatus:
+        size += serializedSize(contactStatusValue.userId);
+        size += serializedSize(contactStatusValue.status);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLDcOption &dcOptionValue)
+{
+    quint32 size = serializedSize(dcOptionValue.tlType);
+
+    switch (dcOptionValue.tlType) {
+    case TLValue::DcOption:
+        size += serializedSize(dcOptionValue.flags);
+        size += serializedSize(dcOptionValue.id);
+        size += serializedSize(dcOptionValue.ipAddress);
+        size += serializedSize(dcOptionValue.port);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLDocumentAttribute &documentAttributeValue)
+{
+    quint32 size = serializedSize(documentAttributeValue.tlType);
+
+    switch (documentAttributeValue.tlType) {
+    case TLValue::DocumentAttributeImageSize:
+        size += serializedSize(documentAttributeValue.w);
+        size += serializedSize(documentAttributeValue.h);
+        break;
+    case TLValue::DocumentAttributeAnimated:
+    case TLValue::DocumentAttributeHasStickers:
+        break;
+    case TLValue::DocumentAttributeSticker:
+        size += serializedSize(documentAttributeValue.flags);
+        size += serializedSize(documentAttributeValue.alt);
+        size += serializedSize(documentAttributeValue.stickerset);
+        if (documentAttributeValue.flags & TLDocumentAttribute::MaskCoords) {
+            size += serializedSize(documentAttributeValue.maskCoords);
+        }
+        break;
+    case TLValue::DocumentAttributeVideo:
+        size += serializedSize(documentAttributeValue.flags);
+        size += serializedSize(documentAttributeValue.duration);
+        size += serializedSize(documentAttributeValue.w);
+        size += serializedSize(documentAttributeValue.h);
+        break;
+    case TLValue::DocumentAttributeAudio:
+        size += serializedSize(documentAttributeValue.flags);
+        size += serializedSize(documentAttributeValue.duration);
+        if (documentAttributeValue.flags & TLDocumentAttribute::Title) {
+            size += serializedSize(documentAttributeValue.title);
+        }
+        if (documentAttributeValue.flags & TLDocumentAttribute::Performer) {
+            size += serializedSize(documentAttributeValue.performer);
+        }
+        if (documentAttributeValue.flags & TLDocumentAttribute::Waveform) {
+            size += serializedSize(documentAttributeValue.waveform);
+        }
+        break;
+    case TLValue::DocumentAttributeFilename:
+        size += serializedSize(documentAttributeValue.fileName);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLDraftMessage &draftMessageValue)
+{
+    quint32 size = serializedSize(draftMessageValue.tlType);
+
+    switch (draftMessageValue.tlType) {
+    case TLValue::DraftMessageEmpty:
+        break;
+    case TLValue::DraftMessage:
+        size += serializedSize(draftMessageValue.flags);
+        if (draftMessageValue.flags & TLDraftMessage::ReplyToMsgId) {
+            size += serializedSize(draftMessageValue.replyToMsgId);
+        }
+        size += serializedSize(draftMessageValue.message);
+        if (draftMessageValue.flags & TLDraftMessage::Entities) {
+            size += serializedSize(draftMessageValue.entities);
+        }
+        size += serializedSize(draftMessageValue.date);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLHelpConfigSimple &helpConfigSimpleValue)
+{
+    quint32 size = serializedSize(helpConfigSimpleValue.tlType);
+
+    switch (helpConfigSimpleValue.tlType) {
+    case TLValue::HelpConfigSimple:
+        size += serializedSize(helpConfigSimpleValue.date);
+        size += serializedSize(helpConfigSimpleValue.expires);
+        size += serializedSize(helpConfigSimpleValue.dcId);
+        size += serializedSize(helpConfigSimpleValue.ipPortList);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLInputChatPhoto &inputChatPhotoValue)
+{
+    quint32 size = serializedSize(inputChatPhotoValue.tlType);
+
+    switch (inputChatPhotoValue.tlType) {
+    case TLValue::InputChatPhotoEmpty:
+        break;
+    case TLValue::InputChatUploadedPhoto:
+        size += serializedSize(inputChatPhotoValue.file);
+        break;
+    case TLValue::InputChatPhoto:
+        size += serializedSize(inputChatPhotoValue.id);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLInputGame &inputGameValue)
+{
+    quint32 size = serializedSize(inputGameValue.tlType);
+
+    switch (inputGameValue.tlType) {
+    case TLValue::InputGameID:
+        size += serializedSize(inputGameValue.id);
+        size += serializedSize(inputGameValue.accessHash);
+        break;
+    case TLValue::InputGameShortName:
+        size += serializedSize(inputGameValue.botId);
+        size += serializedSize(inputGameValue.shortName);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLInputNotifyPeer &inputNotifyPeerValue)
+{
+    quint32 size = serializedSize(inputNotifyPeerValue.tlType);
+
+    switch (inputNotifyPeerValue.tlType) {
+    case TLValue::InputNotifyPeer:
+        size += serializedSize(inputNotifyPeerValue.peer);
+        break;
+    case TLValue::InputNotifyUsers:
+    case TLValue::InputNotifyChats:
+    case TLValue::InputNotifyAll:
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLInputPaymentCredentials &inputPaymentCredentialsValue)
+{
+    quint32 size = serializedSize(inputPaymentCredentialsValue.tlType);
+
+    switch (inputPaymentCredentialsValue.tlType) {
+    case TLValue::InputPaymentCredentialsSaved:
+        size += serializedSize(inputPaymentCredentialsValue.id);
+        size += serializedSize(inputPaymentCredentialsValue.tmpPassword);
+        break;
+    case TLValue::InputPaymentCredentials:
+        size += serializedSize(inputPaymentCredentialsValue.flags);
+        size += serializedSize(inputPaymentCredentialsValue.data);
+        break;
+    case TLValue::InputPaymentCredentialsApplePay:
+        size += serializedSize(inputPaymentCredentialsValue.paymentData);
+        break;
+    case TLValue::InputPaymentCredentialsAndroidPay:
+        size += serializedSize(inputPaymentCredentialsValue.paymentToken);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLInputPeerNotifySettings &inputPeerNotifySettingsValue)
+{
+    quint32 size = serializedSize(inputPeerNotifySettingsValue.tlType);
+
+    switch (inputPeerNotifySettingsValue.tlType) {
+    case TLValue::InputPeerNotifySettings:
+        size += serializedSize(inputPeerNotifySettingsValue.flags);
+        size += serializedSize(inputPeerNotifySettingsValue.muteUntil);
+        size += serializedSize(inputPeerNotifySettingsValue.sound);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLInputPrivacyRule &inputPrivacyRuleValue)
+{
+    quint32 size = serializedSize(inputPrivacyRuleValue.tlType);
+
+    switch (inputPrivacyRuleValue.tlType) {
+    case TLValue::InputPrivacyValueAllowContacts:
+    case TLValue::InputPrivacyValueAllowAll:
+    case TLValue::InputPrivacyValueDisallowContacts:
+    case TLValue::InputPrivacyValueDisallowAll:
+        break;
+    case TLValue::InputPrivacyValueAllowUsers:
+    case TLValue::InputPrivacyValueDisallowUsers:
+        size += serializedSize(inputPrivacyRuleValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLInputStickerSetItem &inputStickerSetItemValue)
+{
+    quint32 size = serializedSize(inputStickerSetItemValue.tlType);
+
+    switch (inputStickerSetItemValue.tlType) {
+    case TLValue::InputStickerSetItem:
+        size += serializedSize(inputStickerSetItemValue.flags);
+        size += serializedSize(inputStickerSetItemValue.document);
+        size += serializedSize(inputStickerSetItemValue.emoji);
+        if (inputStickerSetItemValue.flags & TLInputStickerSetItem::MaskCoords) {
+            size += serializedSize(inputStickerSetItemValue.maskCoords);
+        }
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLInputWebDocument &inputWebDocumentValue)
+{
+    quint32 size = serializedSize(inputWebDocumentValue.tlType);
+
+    switch (inputWebDocumentValue.tlType) {
+    case TLValue::InputWebDocument:
+        size += serializedSize(inputWebDocumentValue.url);
+        size += serializedSize(inputWebDocumentValue.size);
+        size += serializedSize(inputWebDocumentValue.mimeType);
+        size += serializedSize(inputWebDocumentValue.attributes);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLInvoice &invoiceValue)
+{
+    quint32 size = serializedSize(invoiceValue.tlType);
+
+    switch (invoiceValue.tlType) {
+    case TLValue::Invoice:
+        size += serializedSize(invoiceValue.flags);
+        size += serializedSize(invoiceValue.currency);
+        size += serializedSize(invoiceValue.prices);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLKeyboardButton &keyboardButtonValue)
+{
+    quint32 size = serializedSize(keyboardButtonValue.tlType);
+
+    switch (keyboardButtonValue.tlType) {
+    case TLValue::KeyboardButton:
+    case TLValue::KeyboardButtonRequestPhone:
+    case TLValue::KeyboardButtonRequestGeoLocation:
+    case TLValue::KeyboardButtonGame:
+    case TLValue::KeyboardButtonBuy:
+        size += serializedSize(keyboardButtonValue.text);
+        break;
+    case TLValue::KeyboardButtonUrl:
+        size += serializedSize(keyboardButtonValue.text);
+        size += serializedSize(keyboardButtonValue.url);
+        break;
+    case TLValue::KeyboardButtonCallback:
+        size += serializedSize(keyboardButtonValue.text);
+        size += serializedSize(keyboardButtonValue.data);
+        break;
+    case TLValue::KeyboardButtonSwitchInline:
+        size += serializedSize(keyboardButtonValue.flags);
+        size += serializedSize(keyboardButtonValue.text);
+        size += serializedSize(keyboardButtonValue.query);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLKeyboardButtonRow &keyboardButtonRowValue)
+{
+    quint32 size = serializedSize(keyboardButtonRowValue.tlType);
+
+    switch (keyboardButtonRowValue.tlType) {
+    case TLValue::KeyboardButtonRow:
+        size += serializedSize(keyboardButtonRowValue.buttons);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLLangPackDifference &langPackDifferenceValue)
+{
+    quint32 size = serializedSize(langPackDifferenceValue.tlType);
+
+    switch (langPackDifferenceValue.tlType) {
+    case TLValue::LangPackDifference:
+        size += serializedSize(langPackDifferenceValue.langCode);
+        size += serializedSize(langPackDifferenceValue.fromVersion);
+        size += serializedSize(langPackDifferenceValue.version);
+        size += serializedSize(langPackDifferenceValue.strings);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLMessagesBotCallbackAnswer &messagesBotCallbackAnswerValue)
+{
+    quint32 size = serializedSize(messagesBotCallbackAnswerValue.tlType);
+
+    switch (messagesBotCallbackAnswerValue.tlType) {
+    case TLValue::MessagesBotCallbackAnswer:
+        size += serializedSize(messagesBotCallbackAnswerValue.flags);
+        if (messagesBotCallbackAnswerValue.flags & TLMessagesBotCallbackAnswer::Message) {
+            size += serializedSize(messagesBotCallbackAnswerValue.message);
+        }
+        if (messagesBotCallbackAnswerValue.flags & TLMessagesBotCallbackAnswer::Url) {
+            size += serializedSize(messagesBotCallbackAnswerValue.url);
+        }
+        size += serializedSize(messagesBotCallbackAnswerValue.cacheTime);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLMessagesFilter &messagesFilterValue)
+{
+    quint32 size = serializedSize(messagesFilterValue.tlType);
+
+    switch (messagesFilterValue.tlType) {
+    case TLValue::InputMessagesFilterEmpty:
+    case TLValue::InputMessagesFilterPhotos:
+    case TLValue::InputMessagesFilterVideo:
+    case TLValue::InputMessagesFilterPhotoVideo:
+    case TLValue::InputMessagesFilterDocument:
+    case TLValue::InputMessagesFilterUrl:
+    case TLValue::InputMessagesFilterGif:
+    case TLValue::InputMessagesFilterVoice:
+    case TLValue::InputMessagesFilterMusic:
+    case TLValue::InputMessagesFilterChatPhotos:
+    case TLValue::InputMessagesFilterRoundVoice:
+    case TLValue::InputMessagesFilterRoundVideo:
+    case TLValue::InputMessagesFilterMyMentions:
+    case TLValue::InputMessagesFilterGeo:
+    case TLValue::InputMessagesFilterContacts:
+        break;
+    case TLValue::InputMessagesFilterPhoneCalls:
+        size += serializedSize(messagesFilterValue.flags);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLMessagesMessageEditData &messagesMessageEditDataValue)
+{
+    quint32 size = serializedSize(messagesMessageEditDataValue.tlType);
+
+    switch (messagesMessageEditDataValue.tlType) {
+    case TLValue::MessagesMessageEditData:
+        size += serializedSize(messagesMessageEditDataValue.flags);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLNotifyPeer &notifyPeerValue)
+{
+    quint32 size = serializedSize(notifyPeerValue.tlType);
+
+    switch (notifyPeerValue.tlType) {
+    case TLValue::NotifyPeer:
+        size += serializedSize(notifyPeerValue.peer);
+        break;
+    case TLValue::NotifyUsers:
+    case TLValue::NotifyChats:
+    case TLValue::NotifyAll:
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLPaymentRequestedInfo &paymentRequestedInfoValue)
+{
+    quint32 size = serializedSize(paymentRequestedInfoValue.tlType);
+
+    switch (paymentRequestedInfoValue.tlType) {
+    case TLValue::PaymentRequestedInfo:
+        size += serializedSize(paymentRequestedInfoValue.flags);
+        if (paymentRequestedInfoValue.flags & TLPaymentRequestedInfo::Name) {
+            size += serializedSize(paymentRequestedInfoValue.name);
+        }
+        if (paymentRequestedInfoValue.flags & TLPaymentRequestedInfo::Phone) {
+            size += serializedSize(paymentRequestedInfoValue.phone);
+        }
+        if (paymentRequestedInfoValue.flags & TLPaymentRequestedInfo::Email) {
+            size += serializedSize(paymentRequestedInfoValue.email);
+        }
+        if (paymentRequestedInfoValue.flags & TLPaymentRequestedInfo::ShippingAddress) {
+            size += serializedSize(paymentRequestedInfoValue.shippingAddress);
+        }
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLPaymentsSavedInfo &paymentsSavedInfoValue)
+{
+    quint32 size = serializedSize(paymentsSavedInfoValue.tlType);
+
+    switch (paymentsSavedInfoValue.tlType) {
+    case TLValue::PaymentsSavedInfo:
+        size += serializedSize(paymentsSavedInfoValue.flags);
+        if (paymentsSavedInfoValue.flags & TLPaymentsSavedInfo::SavedInfo) {
+            size += serializedSize(paymentsSavedInfoValue.savedInfo);
+        }
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLPaymentsValidatedRequestedInfo &paymentsValidatedRequestedInfoValue)
+{
+    quint32 size = serializedSize(paymentsValidatedRequestedInfoValue.tlType);
+
+    switch (paymentsValidatedRequestedInfoValue.tlType) {
+    case TLValue::PaymentsValidatedRequestedInfo:
+        size += serializedSize(paymentsValidatedRequestedInfoValue.flags);
+        if (paymentsValidatedRequestedInfoValue.flags & TLPaymentsValidatedRequestedInfo::Id) {
+            size += serializedSize(paymentsValidatedRequestedInfoValue.id);
+        }
+        if (paymentsValidatedRequestedInfoValue.flags & TLPaymentsValidatedRequestedInfo::ShippingOptions) {
+            size += serializedSize(paymentsValidatedRequestedInfoValue.shippingOptions);
+        }
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLPeerNotifySettings &peerNotifySettingsValue)
+{
+    quint32 size = serializedSize(peerNotifySettingsValue.tlType);
+
+    switch (peerNotifySettingsValue.tlType) {
+    case TLValue::PeerNotifySettingsEmpty:
+        break;
+    case TLValue::PeerNotifySettings:
+        size += serializedSize(peerNotifySettingsValue.flags);
+        size += serializedSize(peerNotifySettingsValue.muteUntil);
+        size += serializedSize(peerNotifySettingsValue.sound);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLPeerSettings &peerSettingsValue)
+{
+    quint32 size = serializedSize(peerSettingsValue.tlType);
+
+    switch (peerSettingsValue.tlType) {
+    case TLValue::PeerSettings:
+        size += serializedSize(peerSettingsValue.flags);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLPhoneCallProtocol &phoneCallProtocolValue)
+{
+    quint32 size = serializedSize(phoneCallProtocolValue.tlType);
+
+    switch (phoneCallProtocolValue.tlType) {
+    case TLValue::PhoneCallProtocol:
+        size += serializedSize(phoneCallProtocolValue.flags);
+        size += serializedSize(phoneCallProtocolValue.minLayer);
+        size += serializedSize(phoneCallProtocolValue.maxLayer);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLPhoto &photoValue)
+{
+    quint32 size = serializedSize(photoValue.tlType);
+
+    switch (photoValue.tlType) {
+    case TLValue::PhotoEmpty:
+        size += serializedSize(photoValue.id);
+        break;
+    case TLValue::Photo:
+        size += serializedSize(photoValue.flags);
+        size += serializedSize(photoValue.id);
+        size += serializedSize(photoValue.accessHash);
+        size += serializedSize(photoValue.date);
+        size += serializedSize(photoValue.sizes);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLReplyMarkup &replyMarkupValue)
+{
+    quint32 size = serializedSize(replyMarkupValue.tlType);
+
+    switch (replyMarkupValue.tlType) {
+    case TLValue::ReplyKeyboardHide:
+    case TLValue::ReplyKeyboardForceReply:
+        size += serializedSize(replyMarkupValue.flags);
+        break;
+    case TLValue::ReplyKeyboardMarkup:
+        size += serializedSize(replyMarkupValue.flags);
+        size += serializedSize(replyMarkupValue.rows);
+        break;
+    case TLValue::ReplyInlineMarkup:
+        size += serializedSize(replyMarkupValue.rows);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLStickerSet &stickerSetValue)
+{
+    quint32 size = serializedSize(stickerSetValue.tlType);
+
+    switch (stickerSetValue.tlType) {
+    case TLValue::StickerSet:
+        size += serializedSize(stickerSetValue.flags);
+        size += serializedSize(stickerSetValue.id);
+        size += serializedSize(stickerSetValue.accessHash);
+        size += serializedSize(stickerSetValue.title);
+        size += serializedSize(stickerSetValue.shortName);
+        size += serializedSize(stickerSetValue.count);
+        size += serializedSize(stickerSetValue.hash);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLUser &userValue)
+{
+    quint32 size = serializedSize(userValue.tlType);
+
+    switch (userValue.tlType) {
+    case TLValue::UserEmpty:
+        size += serializedSize(userValue.id);
+        break;
+    case TLValue::User:
+        size += serializedSize(userValue.flags);
+        size += serializedSize(userValue.id);
+        if (userValue.flags & TLUser::AccessHash) {
+            size += serializedSize(userValue.accessHash);
+        }
+        if (userValue.flags & TLUser::FirstName) {
+            size += serializedSize(userValue.firstName);
+        }
+        if (userValue.flags & TLUser::LastName) {
+            size += serializedSize(userValue.lastName);
+        }
+        if (userValue.flags & TLUser::Username) {
+            size += serializedSize(userValue.username);
+        }
+        if (userValue.flags & TLUser::Phone) {
+            size += serializedSize(userValue.phone);
+        }
+        if (userValue.flags & TLUser::Photo) {
+            size += serializedSize(userValue.photo);
+        }
+        if (userValue.flags & TLUser::Status) {
+            size += serializedSize(userValue.status);
+        }
+        if (userValue.flags & TLUser::BotInfoVersion) {
+            size += serializedSize(userValue.botInfoVersion);
+        }
+        if (userValue.flags & TLUser::RestrictionReason) {
+            size += serializedSize(userValue.restrictionReason);
+        }
+        if (userValue.flags & TLUser::BotInlinePlaceholder) {
+            size += serializedSize(userValue.botInlinePlaceholder);
+        }
+        if (userValue.flags & TLUser::LangCode) {
+            size += serializedSize(userValue.langCode);
+        }
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLWebDocument &webDocumentValue)
+{
+    quint32 size = serializedSize(webDocumentValue.tlType);
+
+    switch (webDocumentValue.tlType) {
+    case TLValue::WebDocument:
+        size += serializedSize(webDocumentValue.url);
+        size += serializedSize(webDocumentValue.accessHash);
+        size += serializedSize(webDocumentValue.size);
+        size += serializedSize(webDocumentValue.mimeType);
+        size += serializedSize(webDocumentValue.attributes);
+        size += serializedSize(webDocumentValue.dcId);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLAccountPrivacyRules &accountPrivacyRulesValue)
+{
+    quint32 size = serializedSize(accountPrivacyRulesValue.tlType);
+
+    switch (accountPrivacyRulesValue.tlType) {
+    case TLValue::AccountPrivacyRules:
+        size += serializedSize(accountPrivacyRulesValue.rules);
+        size += serializedSize(accountPrivacyRulesValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLAuthAuthorization &authAuthorizationValue)
+{
+    quint32 size = serializedSize(authAuthorizationValue.tlType);
+
+    switch (authAuthorizationValue.tlType) {
+    case TLValue::AuthAuthorization:
+        size += serializedSize(authAuthorizationValue.flags);
+        if (authAuthorizationValue.flags & TLAuthAuthorization::TmpSessions) {
+            size += serializedSize(authAuthorizationValue.tmpSessions);
+        }
+        size += serializedSize(authAuthorizationValue.user);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLBotInlineMessage &botInlineMessageValue)
+{
+    quint32 size = serializedSize(botInlineMessageValue.tlType);
+
+    switch (botInlineMessageValue.tlType) {
+    case TLValue::BotInlineMessageMediaAuto:
+        size += serializedSize(botInlineMessageValue.flags);
+        size += serializedSize(botInlineMessageValue.caption);
+        if (botInlineMessageValue.flags & TLBotInlineMessage::ReplyMarkup) {
+            size += serializedSize(botInlineMessageValue.replyMarkup);
+        }
+        break;
+    case TLValue::BotInlineMessageText:
+        size += serializedSize(botInlineMessageValue.flags);
+        size += serializedSize(botInlineMessageValue.message);
+        if (botInlineMessageValue.flags & TLBotInlineMessage::Entities) {
+            size += serializedSize(botInlineMessageValue.entities);
+        }
+        if (botInlineMessageValue.flags & TLBotInlineMessage::ReplyMarkup) {
+            size += serializedSize(botInlineMessageValue.replyMarkup);
+        }
+        break;
+    case TLValue::BotInlineMessageMediaGeo:
+        size += serializedSize(botInlineMessageValue.flags);
+        size += serializedSize(botInlineMessageValue.geo);
+        size += serializedSize(botInlineMessageValue.period);
+        if (botInlineMessageValue.flags & TLBotInlineMessage::ReplyMarkup) {
+            size += serializedSize(botInlineMessageValue.replyMarkup);
+        }
+        break;
+    case TLValue::BotInlineMessageMediaVenue:
+        size += serializedSize(botInlineMessageValue.flags);
+        size += serializedSize(botInlineMessageValue.geo);
+        size += serializedSize(botInlineMessageValue.title);
+        size += serializedSize(botInlineMessageValue.address);
+        size += serializedSize(botInlineMessageValue.provider);
+        size += serializedSize(botInlineMessageValue.venueId);
+        if (botInlineMessageValue.flags & TLBotInlineMessage::ReplyMarkup) {
+            size += serializedSize(botInlineMessageValue.replyMarkup);
+        }
+        break;
+    case TLValue::BotInlineMessageMediaContact:
+        size += serializedSize(botInlineMessageValue.flags);
+        size += serializedSize(botInlineMessageValue.phoneNumber);
+        size += serializedSize(botInlineMessageValue.firstName);
+        size += serializedSize(botInlineMessageValue.lastName);
+        if (botInlineMessageValue.flags & TLBotInlineMessage::ReplyMarkup) {
+            size += serializedSize(botInlineMessageValue.replyMarkup);
+        }
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLChannelsChannelParticipant &channelsChannelParticipantValue)
+{
+    quint32 size = serializedSize(channelsChannelParticipantValue.tlType);
+
+    switch (channelsChannelParticipantValue.tlType) {
+    case TLValue::ChannelsChannelParticipant:
+        size += serializedSize(channelsChannelParticipantValue.participant);
+        size += serializedSize(channelsChannelParticipantValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLChannelsChannelParticipants &channelsChannelParticipantsValue)
+{
+    quint32 size = serializedSize(channelsChannelParticipantsValue.tlType);
+
+    switch (channelsChannelParticipantsValue.tlType) {
+    case TLValue::ChannelsChannelParticipants:
+        size += serializedSize(channelsChannelParticipantsValue.count);
+        size += serializedSize(channelsChannelParticipantsValue.participants);
+        size += serializedSize(channelsChannelParticipantsValue.users);
+        break;
+    case TLValue::ChannelsChannelParticipantsNotModified:
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLChat &chatValue)
+{
+    quint32 size = serializedSize(chatValue.tlType);
+
+    switch (chatValue.tlType) {
+    case TLValue::ChatEmpty:
+        size += serializedSize(chatValue.id);
+        break;
+    case TLValue::Chat:
+        size += serializedSize(chatValue.flags);
+        size += serializedSize(chatValue.id);
+        size += serializedSize(chatValue.title);
+        size += serializedSize(chatValue.photo);
+        size += serializedSize(chatValue.participantsCount);
+        size += serializedSize(chatValue.date);
+        size += serializedSize(chatValue.version);
+        if (chatValue.flags & TLChat::MigratedTo) {
+            size += serializedSize(chatValue.migratedTo);
+        }
+        break;
+    case TLValue::ChatForbidden:
+        size += serializedSize(chatValue.id);
+        size += serializedSize(chatValue.title);
+        break;
+    case TLValue::Channel:
+        size += serializedSize(chatValue.flags);
+        size += serializedSize(chatValue.id);
+        if (chatValue.flags & TLChat::AccessHash) {
+            size += serializedSize(chatValue.accessHash);
+        }
+        size += serializedSize(chatValue.title);
+        if (chatValue.flags & TLChat::Username) {
+            size += serializedSize(chatValue.username);
+        }
+        size += serializedSize(chatValue.photo);
+        size += serializedSize(chatValue.date);
+        size += serializedSize(chatValue.version);
+        if (chatValue.flags & TLChat::RestrictionReason) {
+            size += serializedSize(chatValue.restrictionReason);
+        }
+        if (chatValue.flags & TLChat::AdminRights) {
+            size += serializedSize(chatValue.adminRights);
+        }
+        if (chatValue.flags & TLChat::BannedRights) {
+            size += serializedSize(chatValue.bannedRights);
+        }
+        break;
+    case TLValue::ChannelForbidden:
+        size += serializedSize(chatValue.flags);
+        size += serializedSize(chatValue.id);
+        size += serializedSize(chatValue.accessHash);
+        size += serializedSize(chatValue.title);
+        if (chatValue.flags & TLChat::UntilDate) {
+            size += serializedSize(chatValue.untilDate);
+        }
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLChatFull &chatFullValue)
+{
+    quint32 size = serializedSize(chatFullValue.tlType);
+
+    switch (chatFullValue.tlType) {
+    case TLValue::ChatFull:
+        size += serializedSize(chatFullValue.id);
+        size += serializedSize(chatFullValue.participants);
+        size += serializedSize(chatFullValue.chatPhoto);
+        size += serializedSize(chatFullValue.notifySettings);
+        size += serializedSize(chatFullValue.exportedInvite);
+        size += serializedSize(chatFullValue.botInfo);
+        break;
+    case TLValue::ChannelFull:
+        size += serializedSize(chatFullValue.flags);
+        size += serializedSize(chatFullValue.id);
+        size += serializedSize(chatFullValue.about);
+        if (chatFullValue.flags & TLChatFull::ParticipantsCount) {
+            size += serializedSize(chatFullValue.participantsCount);
+        }
+        if (chatFullValue.flags & TLChatFull::AdminsCount) {
+            size += serializedSize(chatFullValue.adminsCount);
+        }
+        if (chatFullValue.flags & TLChatFull::KickedCount) {
+            size += serializedSize(chatFullValue.kickedCount);
+        }
+        if (chatFullValue.flags & TLChatFull::BannedCount) {
+            size += serializedSize(chatFullValue.bannedCount);
+        }
+        size += serializedSize(chatFullValue.readInboxMaxId);
+        size += serializedSize(chatFullValue.readOutboxMaxId);
+        size += serializedSize(chatFullValue.unreadCount);
+        size += serializedSize(chatFullValue.chatPhoto);
+        size += serializedSize(chatFullValue.notifySettings);
+        size += serializedSize(chatFullValue.exportedInvite);
+        size += serializedSize(chatFullValue.botInfo);
+        if (chatFullValue.flags & TLChatFull::MigratedFromChatId) {
+            size += serializedSize(chatFullValue.migratedFromChatId);
+        }
+        if (chatFullValue.flags & TLChatFull::MigratedFromMaxId) {
+            size += serializedSize(chatFullValue.migratedFromMaxId);
+        }
+        if (chatFullValue.flags & TLChatFull::PinnedMsgId) {
+            size += serializedSize(chatFullValue.pinnedMsgId);
+        }
+        if (chatFullValue.flags & TLChatFull::Stickerset) {
+            size += serializedSize(chatFullValue.stickerset);
+        }
+        if (chatFullValue.flags & TLChatFull::AvailableMinId) {
+            size += serializedSize(chatFullValue.availableMinId);
+        }
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLChatInvite &chatInviteValue)
+{
+    quint32 size = serializedSize(chatInviteValue.tlType);
+
+    switch (chatInviteValue.tlType) {
+    case TLValue::ChatInviteAlready:
+        size += serializedSize(chatInviteValue.chat);
+        break;
+    case TLValue::ChatInvite:
+        size += serializedSize(chatInviteValue.flags);
+        size += serializedSize(chatInviteValue.title);
+        size += serializedSize(chatInviteValue.photo);
+        size += serializedSize(chatInviteValue.participantsCount);
+        if (chatInviteValue.flags & TLChatInvite::Participants) {
+            size += serializedSize(chatInviteValue.participants);
+        }
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLConfig &configValue)
+{
+    quint32 size = serializedSize(configValue.tlType);
+
+    switch (configValue.tlType) {
+    case TLValue::Config:
+        size += serializedSize(configValue.flags);
+        size += serializedSize(configValue.date);
+        size += serializedSize(configValue.expires);
+        size += serializedSize(configValue.testMode);
+        size += serializedSize(configValue.thisDc);
+        size += serializedSize(configValue.dcOptions);
+        size += serializedSize(configValue.chatSizeMax);
+        size += serializedSize(configValue.megagroupSizeMax);
+        size += serializedSize(configValue.forwardedCountMax);
+        size += serializedSize(configValue.onlineUpdatePeriodMs);
+        size += serializedSize(configValue.offlineBlurTimeoutMs);
+        size += serializedSize(configValue.offlineIdleTimeoutMs);
+        size += serializedSize(configValue.onlineCloudTimeoutMs);
+        size += serializedSize(configValue.notifyCloudDelayMs);
+        size += serializedSize(configValue.notifyDefaultDelayMs);
+        size += serializedSize(configValue.chatBigSize);
+        size += serializedSize(configValue.pushChatPeriodMs);
+        size += serializedSize(configValue.pushChatLimit);
+        size += serializedSize(configValue.savedGifsLimit);
+        size += serializedSize(configValue.editTimeLimit);
+        size += serializedSize(configValue.ratingEDecay);
+        size += serializedSize(configValue.stickersRecentLimit);
+        size += serializedSize(configValue.stickersFavedLimit);
+        size += serializedSize(configValue.channelsReadMediaPeriod);
+        if (configValue.flags & TLConfig::TmpSessions) {
+            size += serializedSize(configValue.tmpSessions);
+        }
+        size += serializedSize(configValue.pinnedDialogsCountMax);
+        size += serializedSize(configValue.callReceiveTimeoutMs);
+        size += serializedSize(configValue.callRingTimeoutMs);
+        size += serializedSize(configValue.callConnectTimeoutMs);
+        size += serializedSize(configValue.callPacketTimeoutMs);
+        size += serializedSize(configValue.meUrlPrefix);
+        if (configValue.flags & TLConfig::SuggestedLangCode) {
+            size += serializedSize(configValue.suggestedLangCode);
+        }
+        if (configValue.flags & TLConfig::LangPackVersion) {
+            size += serializedSize(configValue.langPackVersion);
+        }
+        size += serializedSize(configValue.disabledFeatures);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLContactsBlocked &contactsBlockedValue)
+{
+    quint32 size = serializedSize(contactsBlockedValue.tlType);
+
+    switch (contactsBlockedValue.tlType) {
+    case TLValue::ContactsBlocked:
+        size += serializedSize(contactsBlockedValue.blocked);
+        size += serializedSize(contactsBlockedValue.users);
+        break;
+    case TLValue::ContactsBlockedSlice:
+        size += serializedSize(contactsBlockedValue.count);
+        size += serializedSize(contactsBlockedValue.blocked);
+        size += serializedSize(contactsBlockedValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLContactsContacts &contactsContactsValue)
+{
+    quint32 size = serializedSize(contactsContactsValue.tlType);
+
+    switch (contactsContactsValue.tlType) {
+    case TLValue::ContactsContactsNotModified:
+        break;
+    case TLValue::ContactsContacts:
+        size += serializedSize(contactsContactsValue.contacts);
+        size += serializedSize(contactsContactsValue.savedCount);
+        size += serializedSize(contactsContactsValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLContactsFound &contactsFoundValue)
+{
+    quint32 size = serializedSize(contactsFoundValue.tlType);
+
+    switch (contactsFoundValue.tlType) {
+    case TLValue::ContactsFound:
+        size += serializedSize(contactsFoundValue.results);
+        size += serializedSize(contactsFoundValue.chats);
+        size += serializedSize(contactsFoundValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLContactsImportedContacts &contactsImportedContactsValue)
+{
+    quint32 size = serializedSize(contactsImportedContactsValue.tlType);
+
+    switch (contactsImportedContactsValue.tlType) {
+    case TLValue::ContactsImportedContacts:
+        size += serializedSize(contactsImportedContactsValue.imported);
+        size += serializedSize(contactsImportedContactsValue.popularInvites);
+        size += serializedSize(contactsImportedContactsValue.retryContacts);
+        size += serializedSize(contactsImportedContactsValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLContactsLink &contactsLinkValue)
+{
+    quint32 size = serializedSize(contactsLinkValue.tlType);
+
+    switch (contactsLinkValue.tlType) {
+    case TLValue::ContactsLink:
+        size += serializedSize(contactsLinkValue.myLink);
+        size += serializedSize(contactsLinkValue.foreignLink);
+        size += serializedSize(contactsLinkValue.user);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLContactsResolvedPeer &contactsResolvedPeerValue)
+{
+    quint32 size = serializedSize(contactsResolvedPeerValue.tlType);
+
+    switch (contactsResolvedPeerValue.tlType) {
+    case TLValue::ContactsResolvedPeer:
+        size += serializedSize(contactsResolvedPeerValue.peer);
+        size += serializedSize(contactsResolvedPeerValue.chats);
+        size += serializedSize(contactsResolvedPeerValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLContactsTopPeers &contactsTopPeersValue)
+{
+    quint32 size = serializedSize(contactsTopPeersValue.tlType);
+
+    switch (contactsTopPeersValue.tlType) {
+    case TLValue::ContactsTopPeersNotModified:
+        break;
+    case TLValue::ContactsTopPeers:
+        size += serializedSize(contactsTopPeersValue.categories);
+        size += serializedSize(contactsTopPeersValue.chats);
+        size += serializedSize(contactsTopPeersValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLDialog &dialogValue)
+{
+    quint32 size = serializedSize(dialogValue.tlType);
+
+    switch (dialogValue.tlType) {
+    case TLValue::Dialog:
+        size += serializedSize(dialogValue.flags);
+        size += serializedSize(dialogValue.peer);
+        size += serializedSize(dialogValue.topMessage);
+        size += serializedSize(dialogValue.readInboxMaxId);
+        size += serializedSize(dialogValue.readOutboxMaxId);
+        size += serializedSize(dialogValue.unreadCount);
+        size += serializedSize(dialogValue.unreadMentionsCount);
+        size += serializedSize(dialogValue.notifySettings);
+        if (dialogValue.flags & TLDialog::Pts) {
+            size += serializedSize(dialogValue.pts);
+        }
+        if (dialogValue.flags & TLDialog::Draft) {
+            size += serializedSize(dialogValue.draft);
+        }
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLDocument &documentValue)
+{
+    quint32 size = serializedSize(documentValue.tlType);
+
+    switch (documentValue.tlType) {
+    case TLValue::DocumentEmpty:
+        size += serializedSize(documentValue.id);
+        break;
+    case TLValue::Document:
+        size += serializedSize(documentValue.id);
+        size += serializedSize(documentValue.accessHash);
+        size += serializedSize(documentValue.date);
+        size += serializedSize(documentValue.mimeType);
+        size += serializedSize(documentValue.size);
+        size += serializedSize(documentValue.thumb);
+        size += serializedSize(documentValue.dcId);
+        size += serializedSize(documentValue.version);
+        size += serializedSize(documentValue.attributes);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLFoundGif &foundGifValue)
+{
+    quint32 size = serializedSize(foundGifValue.tlType);
+
+    switch (foundGifValue.tlType) {
+    case TLValue::FoundGif:
+        size += serializedSize(foundGifValue.url);
+        size += serializedSize(foundGifValue.thumbUrl);
+        size += serializedSize(foundGifValue.contentUrl);
+        size += serializedSize(foundGifValue.contentType);
+        size += serializedSize(foundGifValue.w);
+        size += serializedSize(foundGifValue.h);
+        break;
+    case TLValue::FoundGifCached:
+        size += serializedSize(foundGifValue.url);
+        size += serializedSize(foundGifValue.photo);
+        size += serializedSize(foundGifValue.document);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLGame &gameValue)
+{
+    quint32 size = serializedSize(gameValue.tlType);
+
+    switch (gameValue.tlType) {
+    case TLValue::Game:
+        size += serializedSize(gameValue.flags);
+        size += serializedSize(gameValue.id);
+        size += serializedSize(gameValue.accessHash);
+        size += serializedSize(gameValue.shortName);
+        size += serializedSize(gameValue.title);
+        size += serializedSize(gameValue.description);
+        size += serializedSize(gameValue.photo);
+        if (gameValue.flags & TLGame::Document) {
+            size += serializedSize(gameValue.document);
+        }
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLHelpSupport &helpSupportValue)
+{
+    quint32 size = serializedSize(helpSupportValue.tlType);
+
+    switch (helpSupportValue.tlType) {
+    case TLValue::HelpSupport:
+        size += serializedSize(helpSupportValue.phoneNumber);
+        size += serializedSize(helpSupportValue.user);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLInputBotInlineMessage &inputBotInlineMessageValue)
+{
+    quint32 size = serializedSize(inputBotInlineMessageValue.tlType);
+
+    switch (inputBotInlineMessageValue.tlType) {
+    case TLValue::InputBotInlineMessageMediaAuto:
+        size += serializedSize(inputBotInlineMessageValue.flags);
+        size += serializedSize(inputBotInlineMessageValue.caption);
+        if (inputBotInlineMessageValue.flags & TLInputBotInlineMessage::ReplyMarkup) {
+            size += serializedSize(inputBotInlineMessageValue.replyMarkup);
+        }
+        break;
+    case TLValue::InputBotInlineMessageText:
+        size += serializedSize(inputBotInlineMessageValue.flags);
+        size += serializedSize(inputBotInlineMessageValue.message);
+        if (inputBotInlineMessageValue.flags & TLInputBotInlineMessage::Entities) {
+            size += serializedSize(inputBotInlineMessageValue.entities);
+        }
+        if (inputBotInlineMessageValue.flags & TLInputBotInlineMessage::ReplyMarkup) {
+            size += serializedSize(inputBotInlineMessageValue.replyMarkup);
+        }
+        break;
+    case TLValue::InputBotInlineMessageMediaGeo:
+        size += serializedSize(inputBotInlineMessageValue.flags);
+        size += serializedSize(inputBotInlineMessageValue.geoPoint);
+        size += serializedSize(inputBotInlineMessageValue.period);
+        if (inputBotInlineMessageValue.flags & TLInputBotInlineMessage::ReplyMarkup) {
+            size += serializedSize(inputBotInlineMessageValue.replyMarkup);
+        }
+        break;
+    case TLValue::InputBotInlineMessageMediaVenue:
+        size += serializedSize(inputBotInlineMessageValue.flags);
+        size += serializedSize(inputBotInlineMessageValue.geoPoint);
+        size += serializedSize(inputBotInlineMessageValue.title);
+        size += serializedSize(inputBotInlineMessageValue.address);
+        size += serializedSize(inputBotInlineMessageValue.provider);
+        size += serializedSize(inputBotInlineMessageValue.venueId);
+        if (inputBotInlineMessageValue.flags & TLInputBotInlineMessage::ReplyMarkup) {
+            size += serializedSize(inputBotInlineMessageValue.replyMarkup);
+        }
+        break;
+    case TLValue::InputBotInlineMessageMediaContact:
+        size += serializedSize(inputBotInlineMessageValue.flags);
+        size += serializedSize(inputBotInlineMessageValue.phoneNumber);
+        size += serializedSize(inputBotInlineMessageValue.firstName);
+        size += serializedSize(inputBotInlineMessageValue.lastName);
+        if (inputBotInlineMessageValue.flags & TLInputBotInlineMessage::ReplyMarkup) {
+            size += serializedSize(inputBotInlineMessageValue.replyMarkup);
+        }
+        break;
+    case TLValue::InputBotInlineMessageGame:
+        size += serializedSize(inputBotInlineMessageValue.flags);
+        if (inputBotInlineMessageValue.flags & TLInputBotInlineMessage::ReplyMarkup) {
+            size += serializedSize(inputBotInlineMessageValue.replyMarkup);
+        }
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLInputBotInlineResult &inputBotInlineResultValue)
+{
+    quint32 size = serializedSize(inputBotInlineResultValue.tlType);
+
+    switch (inputBotInlineResultValue.tlType) {
+    case TLValue::InputBotInlineResult:
+        size += serializedSize(inputBotInlineResultValue.flags);
+        size += serializedSize(inputBotInlineResultValue.id);
+        size += serializedSize(inputBotInlineResultValue.type);
+        if (inputBotInlineResultValue.flags & TLInputBotInlineResult::Title) {
+            size += serializedSize(inputBotInlineResultValue.title);
+        }
+        if (inputBotInlineResultValue.flags & TLInputBotInlineResult::Description) {
+            size += serializedSize(inputBotInlineResultValue.description);
+        }
+        if (inputBotInlineResultValue.flags & TLInputBotInlineResult::Url) {
+            size += serializedSize(inputBotInlineResultValue.url);
+        }
+        if (inputBotInlineResultValue.flags & TLInputBotInlineResult::ThumbUrl) {
+            size += serializedSize(inputBotInlineResultValue.thumbUrl);
+        }
+        if (inputBotInlineResultValue.flags & TLInputBotInlineResult::ContentUrl) {
+            size += serializedSize(inputBotInlineResultValue.contentUrl);
+        }
+        if (inputBotInlineResultValue.flags & TLInputBotInlineResult::ContentType) {
+            size += serializedSize(inputBotInlineResultValue.contentType);
+        }
+        if (inputBotInlineResultValue.flags & TLInputBotInlineResult::W) {
+            size += serializedSize(inputBotInlineResultValue.w);
+        }
+        if (inputBotInlineResultValue.flags & TLInputBotInlineResult::H) {
+            size += serializedSize(inputBotInlineResultValue.h);
+        }
+        if (inputBotInlineResultValue.flags & TLInputBotInlineResult::Duration) {
+            size += serializedSize(inputBotInlineResultValue.duration);
+        }
+        size += serializedSize(inputBotInlineResultValue.sendMessage);
+        break;
+    case TLValue::InputBotInlineResultPhoto:
+        size += serializedSize(inputBotInlineResultValue.id);
+        size += serializedSize(inputBotInlineResultValue.type);
+        size += serializedSize(inputBotInlineResultValue.photo);
+        size += serializedSize(inputBotInlineResultValue.sendMessage);
+        break;
+    case TLValue::InputBotInlineResultDocument:
+        size += serializedSize(inputBotInlineResultValue.flags);
+        size += serializedSize(inputBotInlineResultValue.id);
+        size += serializedSize(inputBotInlineResultValue.type);
+        if (inputBotInlineResultValue.flags & TLInputBotInlineResult::Title) {
+            size += serializedSize(inputBotInlineResultValue.title);
+        }
+        if (inputBotInlineResultValue.flags & TLInputBotInlineResult::Description) {
+            size += serializedSize(inputBotInlineResultValue.description);
+        }
+        size += serializedSize(inputBotInlineResultValue.document);
+        size += serializedSize(inputBotInlineResultValue.sendMessage);
+        break;
+    case TLValue::InputBotInlineResultGame:
+        size += serializedSize(inputBotInlineResultValue.id);
+        size += serializedSize(inputBotInlineResultValue.shortName);
+        size += serializedSize(inputBotInlineResultValue.sendMessage);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLInputMedia &inputMediaValue)
+{
+    quint32 size = serializedSize(inputMediaValue.tlType);
+
+    switch (inputMediaValue.tlType) {
+    case TLValue::InputMediaEmpty:
+        break;
+    case TLValue::InputMediaUploadedPhoto:
+        size += serializedSize(inputMediaValue.flags);
+        size += serializedSize(inputMediaValue.file);
+        size += serializedSize(inputMediaValue.caption);
+        if (inputMediaValue.flags & TLInputMedia::Stickers) {
+            size += serializedSize(inputMediaValue.stickers);
+        }
+        if (inputMediaValue.flags & TLInputMedia::TtlSeconds1) {
+            size += serializedSize(inputMediaValue.ttlSeconds);
+        }
+        break;
+    case TLValue::InputMediaPhoto:
+        size += serializedSize(inputMediaValue.flags);
+        size += serializedSize(inputMediaValue.inputPhotoId);
+        size += serializedSize(inputMediaValue.caption);
+        if (inputMediaValue.flags & TLInputMedia::TtlSeconds0) {
+            size += serializedSize(inputMediaValue.ttlSeconds);
+        }
+        break;
+    case TLValue::InputMediaGeoPoint:
+        size += serializedSize(inputMediaValue.geoPoint);
+        break;
+    case TLValue::InputMediaContact:
+        size += serializedSize(inputMediaValue.phoneNumber);
+        size += serializedSize(inputMediaValue.firstName);
+        size += serializedSize(inputMediaValue.lastName);
+        break;
+    case TLValue::InputMediaUploadedDocument:
+        size += serializedSize(inputMediaValue.flags);
+        size += serializedSize(inputMediaValue.file);
+        if (inputMediaValue.flags & TLInputMedia::Thumb) {
+            size += serializedSize(inputMediaValue.thumb);
+        }
+        size += serializedSize(inputMediaValue.mimeType);
+        size += serializedSize(inputMediaValue.attributes);
+        size += serializedSize(inputMediaValue.caption);
+        if (inputMediaValue.flags & TLInputMedia::Stickers) {
+            size += serializedSize(inputMediaValue.stickers);
+        }
+        if (inputMediaValue.flags & TLInputMedia::TtlSeconds1) {
+            size += serializedSize(inputMediaValue.ttlSeconds);
+        }
+        break;
+    case TLValue::InputMediaDocument:
+        size += serializedSize(inputMediaValue.flags);
+        size += serializedSize(inputMediaValue.inputDocumentId);
+        size += serializedSize(inputMediaValue.caption);
+        if (inputMediaValue.flags & TLInputMedia::TtlSeconds0) {
+            size += serializedSize(inputMediaValue.ttlSeconds);
+        }
+        break;
+    case TLValue::InputMediaVenue:
+        size += serializedSize(inputMediaValue.geoPoint);
+        size += serializedSize(inputMediaValue.title);
+        size += serializedSize(inputMediaValue.address);
+        size += serializedSize(inputMediaValue.provider);
+        size += serializedSize(inputMediaValue.venueId);
+        size += serializedSize(inputMediaValue.venueType);
+        break;
+    case TLValue::InputMediaGifExternal:
+        size += serializedSize(inputMediaValue.url);
+        size += serializedSize(inputMediaValue.q);
+        break;
+    case TLValue::InputMediaPhotoExternal:
+    case TLValue::InputMediaDocumentExternal:
+        size += serializedSize(inputMediaValue.flags);
+        size += serializedSize(inputMediaValue.url);
+        size += serializedSize(inputMediaValue.caption);
+        if (inputMediaValue.flags & TLInputMedia::TtlSeconds0) {
+            size += serializedSize(inputMediaValue.ttlSeconds);
+        }
+        break;
+    case TLValue::InputMediaGame:
+        size += serializedSize(inputMediaValue.inputGameId);
+        break;
+    case TLValue::InputMediaInvoice:
+        size += serializedSize(inputMediaValue.flags);
+        size += serializedSize(inputMediaValue.title);
+        size += serializedSize(inputMediaValue.description);
+        if (inputMediaValue.flags & TLInputMedia::Photo) {
+            size += serializedSize(inputMediaValue.photo);
+        }
+        size += serializedSize(inputMediaValue.invoice);
+        size += serializedSize(inputMediaValue.payload);
+        size += serializedSize(inputMediaValue.provider);
+        size += serializedSize(inputMediaValue.startParam);
+        break;
+    case TLValue::InputMediaGeoLive:
+        size += serializedSize(inputMediaValue.geoPoint);
+        size += serializedSize(inputMediaValue.period);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLMessageAction &messageActionValue)
+{
+    quint32 size = serializedSize(messageActionValue.tlType);
+
+    switch (messageActionValue.tlType) {
+    case TLValue::MessageActionEmpty:
+    case TLValue::MessageActionChatDeletePhoto:
+    case TLValue::MessageActionPinMessage:
+    case TLValue::MessageActionHistoryClear:
+    case TLValue::MessageActionScreenshotTaken:
+        break;
+    case TLValue::MessageActionChatCreate:
+        size += serializedSize(messageActionValue.title);
+        size += serializedSize(messageActionValue.users);
+        break;
+    case TLValue::MessageActionChatEditTitle:
+    case TLValue::MessageActionChannelCreate:
+        size += serializedSize(messageActionValue.title);
+        break;
+    case TLValue::MessageActionChatEditPhoto:
+        size += serializedSize(messageActionValue.photo);
+        break;
+    case TLValue::MessageActionChatAddUser:
+        size += serializedSize(messageActionValue.users);
+        break;
+    case TLValue::MessageActionChatDeleteUser:
+        size += serializedSize(messageActionValue.userId);
+        break;
+    case TLValue::MessageActionChatJoinedByLink:
+        size += serializedSize(messageActionValue.inviterId);
+        break;
+    case TLValue::MessageActionChatMigrateTo:
+        size += serializedSize(messageActionValue.channelId);
+        break;
+    case TLValue::MessageActionChannelMigrateFrom:
+        size += serializedSize(messageActionValue.title);
+        size += serializedSize(messageActionValue.chatId);
+        break;
+    case TLValue::MessageActionGameScore:
+        size += serializedSize(messageActionValue.gameId);
+        size += serializedSize(messageActionValue.score);
+        break;
+    case TLValue::MessageActionPaymentSentMe:
+        size += serializedSize(messageActionValue.flags);
+        size += serializedSize(messageActionValue.currency);
+        size += serializedSize(messageActionValue.totalAmount);
+        size += serializedSize(messageActionValue.payload);
+        if (messageActionValue.flags & TLMessageAction::Info) {
+            size += serializedSize(messageActionValue.info);
+        }
+        if (messageActionValue.flags & TLMessageAction::ShippingOptionId) {
+            size += serializedSize(messageActionValue.shippingOptionId);
+        }
+        size += serializedSize(messageActionValue.charge);
+        break;
+    case TLValue::MessageActionPaymentSent:
+        size += serializedSize(messageActionValue.currency);
+        size += serializedSize(messageActionValue.totalAmount);
+        break;
+    case TLValue::MessageActionPhoneCall:
+        size += serializedSize(messageActionValue.flags);
+        size += serializedSize(messageActionValue.callId);
+        if (messageActionValue.flags & TLMessageAction::Reason) {
+            size += serializedSize(messageActionValue.reason);
+        }
+        if (messageActionValue.flags & TLMessageAction::Duration) {
+            size += serializedSize(messageActionValue.duration);
+        }
+        break;
+    case TLValue::MessageActionCustomAction:
+        size += serializedSize(messageActionValue.message);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLMessagesAllStickers &messagesAllStickersValue)
+{
+    quint32 size = serializedSize(messagesAllStickersValue.tlType);
+
+    switch (messagesAllStickersValue.tlType) {
+    case TLValue::MessagesAllStickersNotModified:
+        break;
+    case TLValue::MessagesAllStickers:
+        size += serializedSize(messagesAllStickersValue.hash);
+        size += serializedSize(messagesAllStickersValue.sets);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLMessagesChatFull &messagesChatFullValue)
+{
+    quint32 size = serializedSize(messagesChatFullValue.tlType);
+
+    switch (messagesChatFullValue.tlType) {
+    case TLValue::MessagesChatFull:
+        size += serializedSize(messagesChatFullValue.fullChat);
+        size += serializedSize(messagesChatFullValue.chats);
+        size += serializedSize(messagesChatFullValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLMessagesChats &messagesChatsValue)
+{
+    quint32 size = serializedSize(messagesChatsValue.tlType);
+
+    switch (messagesChatsValue.tlType) {
+    case TLValue::MessagesChats:
+        size += serializedSize(messagesChatsValue.chats);
+        break;
+    case TLValue::MessagesChatsSlice:
+        size += serializedSize(messagesChatsValue.count);
+        size += serializedSize(messagesChatsValue.chats);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLMessagesFavedStickers &messagesFavedStickersValue)
+{
+    quint32 size = serializedSize(messagesFavedStickersValue.tlType);
+
+    switch (messagesFavedStickersValue.tlType) {
+    case TLValue::MessagesFavedStickersNotModified:
+        break;
+    case TLValue::MessagesFavedStickers:
+        size += serializedSize(messagesFavedStickersValue.hash);
+        size += serializedSize(messagesFavedStickersValue.packs);
+        size += serializedSize(messagesFavedStickersValue.stickers);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLMessagesFoundGifs &messagesFoundGifsValue)
+{
+    quint32 size = serializedSize(messagesFoundGifsValue.tlType);
+
+    switch (messagesFoundGifsValue.tlType) {
+    case TLValue::MessagesFoundGifs:
+        size += serializedSize(messagesFoundGifsValue.nextOffset);
+        size += serializedSize(messagesFoundGifsValue.results);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLMessagesHighScores &messagesHighScoresValue)
+{
+    quint32 size = serializedSize(messagesHighScoresValue.tlType);
+
+    switch (messagesHighScoresValue.tlType) {
+    case TLValue::MessagesHighScores:
+        size += serializedSize(messagesHighScoresValue.scores);
+        size += serializedSize(messagesHighScoresValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLMessagesRecentStickers &messagesRecentStickersValue)
+{
+    quint32 size = serializedSize(messagesRecentStickersValue.tlType);
+
+    switch (messagesRecentStickersValue.tlType) {
+    case TLValue::MessagesRecentStickersNotModified:
+        break;
+    case TLValue::MessagesRecentStickers:
+        size += serializedSize(messagesRecentStickersValue.hash);
+        size += serializedSize(messagesRecentStickersValue.stickers);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLMessagesSavedGifs &messagesSavedGifsValue)
+{
+    quint32 size = serializedSize(messagesSavedGifsValue.tlType);
+
+    switch (messagesSavedGifsValue.tlType) {
+    case TLValue::MessagesSavedGifsNotModified:
+        break;
+    case TLValue::MessagesSavedGifs:
+        size += serializedSize(messagesSavedGifsValue.hash);
+        size += serializedSize(messagesSavedGifsValue.gifs);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLMessagesStickerSet &messagesStickerSetValue)
+{
+    quint32 size = serializedSize(messagesStickerSetValue.tlType);
+
+    switch (messagesStickerSetValue.tlType) {
+    case TLValue::MessagesStickerSet:
+        size += serializedSize(messagesStickerSetValue.set);
+        size += serializedSize(messagesStickerSetValue.packs);
+        size += serializedSize(messagesStickerSetValue.documents);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLMessagesStickers &messagesStickersValue)
+{
+    quint32 size = serializedSize(messagesStickersValue.tlType);
+
+    switch (messagesStickersValue.tlType) {
+    case TLValue::MessagesStickersNotModified:
+        break;
+    case TLValue::MessagesStickers:
+        size += serializedSize(messagesStickersValue.hash);
+        size += serializedSize(messagesStickersValue.stickers);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLPage &pageValue)
+{
+    quint32 size = serializedSize(pageValue.tlType);
+
+    switch (pageValue.tlType) {
+    case TLValue::PagePart:
+    case TLValue::PageFull:
+        size += serializedSize(pageValue.blocks);
+        size += serializedSize(pageValue.photos);
+        size += serializedSize(pageValue.documents);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLPageBlock &pageBlockValue)
+{
+    quint32 size = serializedSize(pageBlockValue.tlType);
+
+    switch (pageBlockValue.tlType) {
+    case TLValue::PageBlockUnsupported:
+    case TLValue::PageBlockDivider:
+        break;
+    case TLValue::PageBlockTitle:
+    case TLValue::PageBlockSubtitle:
+    case TLValue::PageBlockHeader:
+    case TLValue::PageBlockSubheader:
+    case TLValue::PageBlockParagraph:
+    case TLValue::PageBlockFooter:
+        size += serializedSize(*pageBlockValue.text);
+        break;
+    case TLValue::PageBlockAuthorDate:
+        size += serializedSize(*pageBlockValue.richTextAuthor);
+        size += serializedSize(pageBlockValue.publishedDate);
+        break;
+    case TLValue::PageBlockPreformatted:
+        size += serializedSize(*pageBlockValue.text);
+        size += serializedSize(pageBlockValue.language);
+        break;
+    case TLValue::PageBlockAnchor:
+        size += serializedSize(pageBlockValue.name);
+        break;
+    case TLValue::PageBlockList:
+        size += serializedSize(pageBlockValue.ordered);
+        size += serializedSize(pageBlockValue.richTextItemsVector);
+        break;
+    case TLValue::PageBlockBlockquote:
+    case TLValue::PageBlockPullquote:
+        size += serializedSize(*pageBlockValue.text);
+        size += serializedSize(*pageBlockValue.caption);
+        break;
+    case TLValue::PageBlockPhoto:
+        size += serializedSize(pageBlockValue.photoId);
+        size += serializedSize(*pageBlockValue.caption);
+        break;
+    case TLValue::PageBlockVideo:
+        size += serializedSize(pageBlockValue.flags);
+        size += serializedSize(pageBlockValue.videoId);
+        size += serializedSize(*pageBlockValue.caption);
+        break;
+    case TLValue::PageBlockCover:
+        size += serializedSize(*pageBlockValue.cover);
+        break;
+    case TLValue::PageBlockEmbed:
+        size += serializedSize(pageBlockValue.flags);
+        if (pageBlockValue.flags & TLPageBlock::Url) {
+            size += serializedSize(pageBlockValue.url);
+        }
+        if (pageBlockValue.flags & TLPageBlock::Html) {
+            size += serializedSize(pageBlockValue.html);
+        }
+        if (pageBlockValue.flags & TLPageBlock::PosterPhotoId) {
+            size += serializedSize(pageBlockValue.posterPhotoId);
+        }
+        size += serializedSize(pageBlockValue.w);
+        size += serializedSize(pageBlockValue.h);
+        size += serializedSize(*pageBlockValue.caption);
+        break;
+    case TLValue::PageBlockEmbedPost:
+        size += serializedSize(pageBlockValue.url);
+        size += serializedSize(pageBlockValue.webpageId);
+        size += serializedSize(pageBlockValue.authorPhotoId);
+        size += serializedSize(pageBlockValue.stringAuthor);
+        size += serializedSize(pageBlockValue.date);
+        size += serializedSize(pageBlockValue.blocks);
+        size += serializedSize(*pageBlockValue.caption);
+        break;
+    case TLValue::PageBlockCollage:
+    case TLValue::PageBlockSlideshow:
+        size += serializedSize(pageBlockValue.pageBlockItemsVector);
+        size += serializedSize(*pageBlockValue.caption);
+        break;
+    case TLValue::PageBlockChannel:
+        size += serializedSize(pageBlockValue.channel);
+        break;
+    case TLValue::PageBlockAudio:
+        size += serializedSize(pageBlockValue.audioId);
+        size += serializedSize(*pageBlockValue.caption);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLPaymentsPaymentForm &paymentsPaymentFormValue)
+{
+    quint32 size = serializedSize(paymentsPaymentFormValue.tlType);
+
+    switch (paymentsPaymentFormValue.tlType) {
+    case TLValue::PaymentsPaymentForm:
+        size += serializedSize(paymentsPaymentFormValue.flags);
+        size += serializedSize(paymentsPaymentFormValue.botId);
+        size += serializedSize(paymentsPaymentFormValue.invoice);
+        size += serializedSize(paymentsPaymentFormValue.providerId);
+        size += serializedSize(paymentsPaymentFormValue.url);
+        if (paymentsPaymentFormValue.flags & TLPaymentsPaymentForm::NativeProvider) {
+            size += serializedSize(paymentsPaymentFormValue.nativeProvider);
+        }
+        if (paymentsPaymentFormValue.flags & TLPaymentsPaymentForm::NativeParams) {
+            size += serializedSize(paymentsPaymentFormValue.nativeParams);
+        }
+        if (paymentsPaymentFormValue.flags & TLPaymentsPaymentForm::SavedInfo) {
+            size += serializedSize(paymentsPaymentFormValue.savedInfo);
+        }
+        if (paymentsPaymentFormValue.flags & TLPaymentsPaymentForm::SavedCredentials) {
+            size += serializedSize(paymentsPaymentFormValue.savedCredentials);
+        }
+        size += serializedSize(paymentsPaymentFormValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLPaymentsPaymentReceipt &paymentsPaymentReceiptValue)
+{
+    quint32 size = serializedSize(paymentsPaymentReceiptValue.tlType);
+
+    switch (paymentsPaymentReceiptValue.tlType) {
+    case TLValue::PaymentsPaymentReceipt:
+        size += serializedSize(paymentsPaymentReceiptValue.flags);
+        size += serializedSize(paymentsPaymentReceiptValue.date);
+        size += serializedSize(paymentsPaymentReceiptValue.botId);
+        size += serializedSize(paymentsPaymentReceiptValue.invoice);
+        size += serializedSize(paymentsPaymentReceiptValue.providerId);
+        if (paymentsPaymentReceiptValue.flags & TLPaymentsPaymentReceipt::Info) {
+            size += serializedSize(paymentsPaymentReceiptValue.info);
+        }
+        if (paymentsPaymentReceiptValue.flags & TLPaymentsPaymentReceipt::Shipping) {
+            size += serializedSize(paymentsPaymentReceiptValue.shipping);
+        }
+        size += serializedSize(paymentsPaymentReceiptValue.currency);
+        size += serializedSize(paymentsPaymentReceiptValue.totalAmount);
+        size += serializedSize(paymentsPaymentReceiptValue.credentialsTitle);
+        size += serializedSize(paymentsPaymentReceiptValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLPhoneCall &phoneCallValue)
+{
+    quint32 size = serializedSize(phoneCallValue.tlType);
+
+    switch (phoneCallValue.tlType) {
+    case TLValue::PhoneCallEmpty:
+        size += serializedSize(phoneCallValue.id);
+        break;
+    case TLValue::PhoneCallWaiting:
+        size += serializedSize(phoneCallValue.flags);
+        size += serializedSize(phoneCallValue.id);
+        size += serializedSize(phoneCallValue.accessHash);
+        size += serializedSize(phoneCallValue.date);
+        size += serializedSize(phoneCallValue.adminId);
+        size += serializedSize(phoneCallValue.participantId);
+        size += serializedSize(phoneCallValue.protocol);
+        if (phoneCallValue.flags & TLPhoneCall::ReceiveDate) {
+            size += serializedSize(phoneCallValue.receiveDate);
+        }
+        break;
+    case TLValue::PhoneCallRequested:
+        size += serializedSize(phoneCallValue.id);
+        size += serializedSize(phoneCallValue.accessHash);
+        size += serializedSize(phoneCallValue.date);
+        size += serializedSize(phoneCallValue.adminId);
+        size += serializedSize(phoneCallValue.participantId);
+        size += serializedSize(phoneCallValue.gAHash);
+        size += serializedSize(phoneCallValue.protocol);
+        break;
+    case TLValue::PhoneCallAccepted:
+        size += serializedSize(phoneCallValue.id);
+        size += serializedSize(phoneCallValue.accessHash);
+        size += serializedSize(phoneCallValue.date);
+        size += serializedSize(phoneCallValue.adminId);
+        size += serializedSize(phoneCallValue.participantId);
+        size += serializedSize(phoneCallValue.gB);
+        size += serializedSize(phoneCallValue.protocol);
+        break;
+    case TLValue::PhoneCall:
+        size += serializedSize(phoneCallValue.id);
+        size += serializedSize(phoneCallValue.accessHash);
+        size += serializedSize(phoneCallValue.date);
+        size += serializedSize(phoneCallValue.adminId);
+        size += serializedSize(phoneCallValue.participantId);
+        size += serializedSize(phoneCallValue.gAOrB);
+        size += serializedSize(phoneCallValue.keyFingerprint);
+        size += serializedSize(phoneCallValue.protocol);
+        size += serializedSize(phoneCallValue.connection);
+        size += serializedSize(phoneCallValue.alternativeConnections);
+        size += serializedSize(phoneCallValue.startDate);
+        break;
+    case TLValue::PhoneCallDiscarded:
+        size += serializedSize(phoneCallValue.flags);
+        size += serializedSize(phoneCallValue.id);
+        if (phoneCallValue.flags & TLPhoneCall::Reason) {
+            size += serializedSize(phoneCallValue.reason);
+        }
+        if (phoneCallValue.flags & TLPhoneCall::Duration) {
+            size += serializedSize(phoneCallValue.duration);
+        }
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLPhonePhoneCall &phonePhoneCallValue)
+{
+    quint32 size = serializedSize(phonePhoneCallValue.tlType);
+
+    switch (phonePhoneCallValue.tlType) {
+    case TLValue::PhonePhoneCall:
+        size += serializedSize(phonePhoneCallValue.phoneCall);
+        size += serializedSize(phonePhoneCallValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLPhotosPhoto &photosPhotoValue)
+{
+    quint32 size = serializedSize(photosPhotoValue.tlType);
+
+    switch (photosPhotoValue.tlType) {
+    case TLValue::PhotosPhoto:
+        size += serializedSize(photosPhotoValue.photo);
+        size += serializedSize(photosPhotoValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLPhotosPhotos &photosPhotosValue)
+{
+    quint32 size = serializedSize(photosPhotosValue.tlType);
+
+    switch (photosPhotosValue.tlType) {
+    case TLValue::PhotosPhotos:
+        size += serializedSize(photosPhotosValue.photos);
+        size += serializedSize(photosPhotosValue.users);
+        break;
+    case TLValue::PhotosPhotosSlice:
+        size += serializedSize(photosPhotosValue.count);
+        size += serializedSize(photosPhotosValue.photos);
+        size += serializedSize(photosPhotosValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLStickerSetCovered &stickerSetCoveredValue)
+{
+    quint32 size = serializedSize(stickerSetCoveredValue.tlType);
+
+    switch (stickerSetCoveredValue.tlType) {
+    case TLValue::StickerSetCovered:
+        size += serializedSize(stickerSetCoveredValue.set);
+        size += serializedSize(stickerSetCoveredValue.cover);
+        break;
+    case TLValue::StickerSetMultiCovered:
+        size += serializedSize(stickerSetCoveredValue.set);
+        size += serializedSize(stickerSetCoveredValue.covers);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLUserFull &userFullValue)
+{
+    quint32 size = serializedSize(userFullValue.tlType);
+
+    switch (userFullValue.tlType) {
+    case TLValue::UserFull:
+        size += serializedSize(userFullValue.flags);
+        size += serializedSize(userFullValue.user);
+        if (userFullValue.flags & TLUserFull::About) {
+            size += serializedSize(userFullValue.about);
+        }
+        size += serializedSize(userFullValue.link);
+        if (userFullValue.flags & TLUserFull::ProfilePhoto) {
+            size += serializedSize(userFullValue.profilePhoto);
+        }
+        size += serializedSize(userFullValue.notifySettings);
+        if (userFullValue.flags & TLUserFull::BotInfo) {
+            size += serializedSize(userFullValue.botInfo);
+        }
+        size += serializedSize(userFullValue.commonChatsCount);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLWebPage &webPageValue)
+{
+    quint32 size = serializedSize(webPageValue.tlType);
+
+    switch (webPageValue.tlType) {
+    case TLValue::WebPageEmpty:
+        size += serializedSize(webPageValue.id);
+        break;
+    case TLValue::WebPagePending:
+        size += serializedSize(webPageValue.id);
+        size += serializedSize(webPageValue.date);
+        break;
+    case TLValue::WebPage:
+        size += serializedSize(webPageValue.flags);
+        size += serializedSize(webPageValue.id);
+        size += serializedSize(webPageValue.url);
+        size += serializedSize(webPageValue.displayUrl);
+        size += serializedSize(webPageValue.hash);
+        if (webPageValue.flags & TLWebPage::Type) {
+            size += serializedSize(webPageValue.type);
+        }
+        if (webPageValue.flags & TLWebPage::SiteName) {
+            size += serializedSize(webPageValue.siteName);
+        }
+        if (webPageValue.flags & TLWebPage::Title) {
+            size += serializedSize(webPageValue.title);
+        }
+        if (webPageValue.flags & TLWebPage::Description) {
+            size += serializedSize(webPageValue.description);
+        }
+        if (webPageValue.flags & TLWebPage::Photo) {
+            size += serializedSize(webPageValue.photo);
+        }
+        if (webPageValue.flags & TLWebPage::EmbedUrl) {
+            size += serializedSize(webPageValue.embedUrl);
+        }
+        if (webPageValue.flags & TLWebPage::EmbedType) {
+            size += serializedSize(webPageValue.embedType);
+        }
+        if (webPageValue.flags & TLWebPage::EmbedWidth) {
+            size += serializedSize(webPageValue.embedWidth);
+        }
+        if (webPageValue.flags & TLWebPage::EmbedHeight) {
+            size += serializedSize(webPageValue.embedHeight);
+        }
+        if (webPageValue.flags & TLWebPage::Duration) {
+            size += serializedSize(webPageValue.duration);
+        }
+        if (webPageValue.flags & TLWebPage::Author) {
+            size += serializedSize(webPageValue.author);
+        }
+        if (webPageValue.flags & TLWebPage::Document) {
+            size += serializedSize(webPageValue.document);
+        }
+        if (webPageValue.flags & TLWebPage::CachedPage) {
+            size += serializedSize(webPageValue.cachedPage);
+        }
+        break;
+    case TLValue::WebPageNotModified:
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLBotInlineResult &botInlineResultValue)
+{
+    quint32 size = serializedSize(botInlineResultValue.tlType);
+
+    switch (botInlineResultValue.tlType) {
+    case TLValue::BotInlineResult:
+        size += serializedSize(botInlineResultValue.flags);
+        size += serializedSize(botInlineResultValue.id);
+        size += serializedSize(botInlineResultValue.type);
+        if (botInlineResultValue.flags & TLBotInlineResult::Title1) {
+            size += serializedSize(botInlineResultValue.title);
+        }
+        if (botInlineResultValue.flags & TLBotInlineResult::Description2) {
+            size += serializedSize(botInlineResultValue.description);
+        }
+        if (botInlineResultValue.flags & TLBotInlineResult::Url) {
+            size += serializedSize(botInlineResultValue.url);
+        }
+        if (botInlineResultValue.flags & TLBotInlineResult::ThumbUrl) {
+            size += serializedSize(botInlineResultValue.thumbUrl);
+        }
+        if (botInlineResultValue.flags & TLBotInlineResult::ContentUrl) {
+            size += serializedSize(botInlineResultValue.contentUrl);
+        }
+        if (botInlineResultValue.flags & TLBotInlineResult::ContentType) {
+            size += serializedSize(botInlineResultValue.contentType);
+        }
+        if (botInlineResultValue.flags & TLBotInlineResult::W) {
+            size += serializedSize(botInlineResultValue.w);
+        }
+        if (botInlineResultValue.flags & TLBotInlineResult::H) {
+            size += serializedSize(botInlineResultValue.h);
+        }
+        if (botInlineResultValue.flags & TLBotInlineResult::Duration) {
+            size += serializedSize(botInlineResultValue.duration);
+        }
+        size += serializedSize(botInlineResultValue.sendMessage);
+        break;
+    case TLValue::BotInlineMediaResult:
+        size += serializedSize(botInlineResultValue.flags);
+        size += serializedSize(botInlineResultValue.id);
+        size += serializedSize(botInlineResultValue.type);
+        if (botInlineResultValue.flags & TLBotInlineResult::Photo) {
+            size += serializedSize(botInlineResultValue.photo);
+        }
+        if (botInlineResultValue.flags & TLBotInlineResult::Document) {
+            size += serializedSize(botInlineResultValue.document);
+        }
+        if (botInlineResultValue.flags & TLBotInlineResult::Title2) {
+            size += serializedSize(botInlineResultValue.title);
+        }
+        if (botInlineResultValue.flags & TLBotInlineResult::Description3) {
+            size += serializedSize(botInlineResultValue.description);
+        }
+        size += serializedSize(botInlineResultValue.sendMessage);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLMessageMedia &messageMediaValue)
+{
+    quint32 size = serializedSize(messageMediaValue.tlType);
+
+    switch (messageMediaValue.tlType) {
+    case TLValue::MessageMediaEmpty:
+    case TLValue::MessageMediaUnsupported:
+        break;
+    case TLValue::MessageMediaPhoto:
+        size += serializedSize(messageMediaValue.flags);
+        if (messageMediaValue.flags & TLMessageMedia::Photo) {
+            size += serializedSize(messageMediaValue.photo);
+        }
+        if (messageMediaValue.flags & TLMessageMedia::Caption) {
+            size += serializedSize(messageMediaValue.caption);
+        }
+        if (messageMediaValue.flags & TLMessageMedia::TtlSeconds) {
+            size += serializedSize(messageMediaValue.ttlSeconds);
+        }
+        break;
+    case TLValue::MessageMediaGeo:
+        size += serializedSize(messageMediaValue.geo);
+        break;
+    case TLValue::MessageMediaContact:
+        size += serializedSize(messageMediaValue.phoneNumber);
+        size += serializedSize(messageMediaValue.firstName);
+        size += serializedSize(messageMediaValue.lastName);
+        size += serializedSize(messageMediaValue.userId);
+        break;
+    case TLValue::MessageMediaDocument:
+        size += serializedSize(messageMediaValue.flags);
+        if (messageMediaValue.flags & TLMessageMedia::Document) {
+            size += serializedSize(messageMediaValue.document);
+        }
+        if (messageMediaValue.flags & TLMessageMedia::Caption) {
+            size += serializedSize(messageMediaValue.caption);
+        }
+        if (messageMediaValue.flags & TLMessageMedia::TtlSeconds) {
+            size += serializedSize(messageMediaValue.ttlSeconds);
+        }
+        break;
+    case TLValue::MessageMediaWebPage:
+        size += serializedSize(messageMediaValue.webpage);
+        break;
+    case TLValue::MessageMediaVenue:
+        size += serializedSize(messageMediaValue.geo);
+        size += serializedSize(messageMediaValue.title);
+        size += serializedSize(messageMediaValue.address);
+        size += serializedSize(messageMediaValue.provider);
+        size += serializedSize(messageMediaValue.venueId);
+        size += serializedSize(messageMediaValue.venueType);
+        break;
+    case TLValue::MessageMediaGame:
+        size += serializedSize(messageMediaValue.game);
+        break;
+    case TLValue::MessageMediaInvoice:
+        size += serializedSize(messageMediaValue.flags);
+        size += serializedSize(messageMediaValue.title);
+        size += serializedSize(messageMediaValue.description);
+        if (messageMediaValue.flags & TLMessageMedia::WebDocumentPhoto) {
+            size += serializedSize(messageMediaValue.webDocumentPhoto);
+        }
+        if (messageMediaValue.flags & TLMessageMedia::ReceiptMsgId) {
+            size += serializedSize(messageMediaValue.receiptMsgId);
+        }
+        size += serializedSize(messageMediaValue.currency);
+        size += serializedSize(messageMediaValue.totalAmount);
+        size += serializedSize(messageMediaValue.startParam);
+        break;
+    case TLValue::MessageMediaGeoLive:
+        size += serializedSize(messageMediaValue.geo);
+        size += serializedSize(messageMediaValue.period);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLMessagesArchivedStickers &messagesArchivedStickersValue)
+{
+    quint32 size = serializedSize(messagesArchivedStickersValue.tlType);
+
+    switch (messagesArchivedStickersValue.tlType) {
+    case TLValue::MessagesArchivedStickers:
+        size += serializedSize(messagesArchivedStickersValue.count);
+        size += serializedSize(messagesArchivedStickersValue.sets);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLMessagesBotResults &messagesBotResultsValue)
+{
+    quint32 size = serializedSize(messagesBotResultsValue.tlType);
+
+    switch (messagesBotResultsValue.tlType) {
+    case TLValue::MessagesBotResults:
+        size += serializedSize(messagesBotResultsValue.flags);
+        size += serializedSize(messagesBotResultsValue.queryId);
+        if (messagesBotResultsValue.flags & TLMessagesBotResults::NextOffset) {
+            size += serializedSize(messagesBotResultsValue.nextOffset);
+        }
+        if (messagesBotResultsValue.flags & TLMessagesBotResults::SwitchPm) {
+            size += serializedSize(messagesBotResultsValue.switchPm);
+        }
+        size += serializedSize(messagesBotResultsValue.results);
+        size += serializedSize(messagesBotResultsValue.cacheTime);
+        size += serializedSize(messagesBotResultsValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLMessagesFeaturedStickers &messagesFeaturedStickersValue)
+{
+    quint32 size = serializedSize(messagesFeaturedStickersValue.tlType);
+
+    switch (messagesFeaturedStickersValue.tlType) {
+    case TLValue::MessagesFeaturedStickersNotModified:
+        break;
+    case TLValue::MessagesFeaturedStickers:
+        size += serializedSize(messagesFeaturedStickersValue.hash);
+        size += serializedSize(messagesFeaturedStickersValue.sets);
+        size += serializedSize(messagesFeaturedStickersValue.unread);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLMessagesStickerSetInstallResult &messagesStickerSetInstallResultValue)
+{
+    quint32 size = serializedSize(messagesStickerSetInstallResultValue.tlType);
+
+    switch (messagesStickerSetInstallResultValue.tlType) {
+    case TLValue::MessagesStickerSetInstallResultSuccess:
+        break;
+    case TLValue::MessagesStickerSetInstallResultArchive:
+        size += serializedSize(messagesStickerSetInstallResultValue.sets);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLRecentMeUrl &recentMeUrlValue)
+{
+    quint32 size = serializedSize(recentMeUrlValue.tlType);
+
+    switch (recentMeUrlValue.tlType) {
+    case TLValue::RecentMeUrlUnknown:
+        size += serializedSize(recentMeUrlValue.url);
+        break;
+    case TLValue::RecentMeUrlUser:
+        size += serializedSize(recentMeUrlValue.url);
+        size += serializedSize(recentMeUrlValue.userId);
+        break;
+    case TLValue::RecentMeUrlChat:
+        size += serializedSize(recentMeUrlValue.url);
+        size += serializedSize(recentMeUrlValue.chatId);
+        break;
+    case TLValue::RecentMeUrlChatInvite:
+        size += serializedSize(recentMeUrlValue.url);
+        size += serializedSize(recentMeUrlValue.chatInvite);
+        break;
+    case TLValue::RecentMeUrlStickerSet:
+        size += serializedSize(recentMeUrlValue.url);
+        size += serializedSize(recentMeUrlValue.set);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLHelpRecentMeUrls &helpRecentMeUrlsValue)
+{
+    quint32 size = serializedSize(helpRecentMeUrlsValue.tlType);
+
+    switch (helpRecentMeUrlsValue.tlType) {
+    case TLValue::HelpRecentMeUrls:
+        size += serializedSize(helpRecentMeUrlsValue.urls);
+        size += serializedSize(helpRecentMeUrlsValue.chats);
+        size += serializedSize(helpRecentMeUrlsValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLMessage &messageValue)
+{
+    quint32 size = serializedSize(messageValue.tlType);
+
+    switch (messageValue.tlType) {
+    case TLValue::MessageEmpty:
+        size += serializedSize(messageValue.id);
+        break;
+    case TLValue::Message:
+        size += serializedSize(messageValue.flags);
+        size += serializedSize(messageValue.id);
+        if (messageValue.flags & TLMessage::FromId) {
+            size += serializedSize(messageValue.fromId);
+        }
+        size += serializedSize(messageValue.toId);
+        if (messageValue.flags & TLMessage::FwdFrom) {
+            size += serializedSize(messageValue.fwdFrom);
+        }
+        if (messageValue.flags & TLMessage::ViaBotId) {
+            size += serializedSize(messageValue.viaBotId);
+        }
+        if (messageValue.flags & TLMessage::ReplyToMsgId) {
+            size += serializedSize(messageValue.replyToMsgId);
+        }
+        size += serializedSize(messageValue.date);
+        size += serializedSize(messageValue.message);
+        if (messageValue.flags & TLMessage::Media) {
+            size += serializedSize(messageValue.media);
+        }
+        if (messageValue.flags & TLMessage::ReplyMarkup) {
+            size += serializedSize(messageValue.replyMarkup);
+        }
+        if (messageValue.flags & TLMessage::Entities) {
+            size += serializedSize(messageValue.entities);
+        }
+        if (messageValue.flags & TLMessage::Views) {
+            size += serializedSize(messageValue.views);
+        }
+        if (messageValue.flags & TLMessage::EditDate) {
+            size += serializedSize(messageValue.editDate);
+        }
+        if (messageValue.flags & TLMessage::PostAuthor) {
+            size += serializedSize(messageValue.postAuthor);
+        }
+        break;
+    case TLValue::MessageService:
+        size += serializedSize(messageValue.flags);
+        size += serializedSize(messageValue.id);
+        if (messageValue.flags & TLMessage::FromId) {
+            size += serializedSize(messageValue.fromId);
+        }
+        size += serializedSize(messageValue.toId);
+        if (messageValue.flags & TLMessage::ReplyToMsgId) {
+            size += serializedSize(messageValue.replyToMsgId);
+        }
+        size += serializedSize(messageValue.date);
+        size += serializedSize(messageValue.action);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLMessagesDialogs &messagesDialogsValue)
+{
+    quint32 size = serializedSize(messagesDialogsValue.tlType);
+
+    switch (messagesDialogsValue.tlType) {
+    case TLValue::MessagesDialogs:
+        size += serializedSize(messagesDialogsValue.dialogs);
+        size += serializedSize(messagesDialogsValue.messages);
+        size += serializedSize(messagesDialogsValue.chats);
+        size += serializedSize(messagesDialogsValue.users);
+        break;
+    case TLValue::MessagesDialogsSlice:
+        size += serializedSize(messagesDialogsValue.count);
+        size += serializedSize(messagesDialogsValue.dialogs);
+        size += serializedSize(messagesDialogsValue.messages);
+        size += serializedSize(messagesDialogsValue.chats);
+        size += serializedSize(messagesDialogsValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLMessagesMessages &messagesMessagesValue)
+{
+    quint32 size = serializedSize(messagesMessagesValue.tlType);
+
+    switch (messagesMessagesValue.tlType) {
+    case TLValue::MessagesMessages:
+        size += serializedSize(messagesMessagesValue.messages);
+        size += serializedSize(messagesMessagesValue.chats);
+        size += serializedSize(messagesMessagesValue.users);
+        break;
+    case TLValue::MessagesMessagesSlice:
+        size += serializedSize(messagesMessagesValue.count);
+        size += serializedSize(messagesMessagesValue.messages);
+        size += serializedSize(messagesMessagesValue.chats);
+        size += serializedSize(messagesMessagesValue.users);
+        break;
+    case TLValue::MessagesChannelMessages:
+        size += serializedSize(messagesMessagesValue.flags);
+        size += serializedSize(messagesMessagesValue.pts);
+        size += serializedSize(messagesMessagesValue.count);
+        size += serializedSize(messagesMessagesValue.messages);
+        size += serializedSize(messagesMessagesValue.chats);
+        size += serializedSize(messagesMessagesValue.users);
+        break;
+    case TLValue::MessagesMessagesNotModified:
+        size += serializedSize(messagesMessagesValue.count);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLMessagesPeerDialogs &messagesPeerDialogsValue)
+{
+    quint32 size = serializedSize(messagesPeerDialogsValue.tlType);
+
+    switch (messagesPeerDialogsValue.tlType) {
+    case TLValue::MessagesPeerDialogs:
+        size += serializedSize(messagesPeerDialogsValue.dialogs);
+        size += serializedSize(messagesPeerDialogsValue.messages);
+        size += serializedSize(messagesPeerDialogsValue.chats);
+        size += serializedSize(messagesPeerDialogsValue.users);
+        size += serializedSize(messagesPeerDialogsValue.state);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLUpdate &updateValue)
+{
+    quint32 size = serializedSize(updateValue.tlType);
+
+    switch (updateValue.tlType) {
+    case TLValue::UpdateNewMessage:
+    case TLValue::UpdateNewChannelMessage:
+    case TLValue::UpdateEditChannelMessage:
+    case TLValue::UpdateEditMessage:
+        size += serializedSize(updateValue.message);
+        size += serializedSize(updateValue.pts);
+        size += serializedSize(updateValue.ptsCount);
+        break;
+    case TLValue::UpdateMessageID:
+        size += serializedSize(updateValue.quint32Id);
+        size += serializedSize(updateValue.randomId);
+        break;
+    case TLValue::UpdateDeleteMessages:
+    case TLValue::UpdateReadMessagesContents:
+        size += serializedSize(updateValue.messages);
+        size += serializedSize(updateValue.pts);
+        size += serializedSize(updateValue.ptsCount);
+        break;
+    case TLValue::UpdateUserTyping:
+        size += serializedSize(updateValue.userId);
+        size += serializedSize(updateValue.action);
+        break;
+    case TLValue::UpdateChatUserTyping:
+        size += serializedSize(updateValue.chatId);
+        size += serializedSize(updateValue.userId);
+        size += serializedSize(updateValue.action);
+        break;
+    case TLValue::UpdateChatParticipants:
+        size += serializedSize(updateValue.participants);
+        break;
+    case TLValue::UpdateUserStatus:
+        size += serializedSize(updateValue.userId);
+        size += serializedSize(updateValue.status);
+        break;
+    case TLValue::UpdateUserName:
+        size += serializedSize(updateValue.userId);
+        size += serializedSize(updateValue.firstName);
+        size += serializedSize(updateValue.lastName);
+        size += serializedSize(updateValue.username);
+        break;
+    case TLValue::UpdateUserPhoto:
+        size += serializedSize(updateValue.userId);
+        size += serializedSize(updateValue.date);
+        size += serializedSize(updateValue.photo);
+        size += serializedSize(updateValue.previous);
+        break;
+    case TLValue::UpdateContactRegistered:
+        size += serializedSize(updateValue.userId);
+        size += serializedSize(updateValue.date);
+        break;
+    case TLValue::UpdateContactLink:
+        size += serializedSize(updateValue.userId);
+        size += serializedSize(updateValue.myLink);
+        size += serializedSize(updateValue.foreignLink);
+        break;
+    case TLValue::UpdateNewEncryptedMessage:
+        size += serializedSize(updateValue.encryptedMessage);
+        size += serializedSize(updateValue.qts);
+        break;
+    case TLValue::UpdateEncryptedChatTyping:
+        size += serializedSize(updateValue.chatId);
+        break;
+    case TLValue::UpdateEncryption:
+        size += serializedSize(updateValue.chat);
+        size += serializedSize(updateValue.date);
+        break;
+    case TLValue::UpdateEncryptedMessagesRead:
+        size += serializedSize(updateValue.chatId);
+        size += serializedSize(updateValue.maxDate);
+        size += serializedSize(updateValue.date);
+        break;
+    case TLValue::UpdateChatParticipantAdd:
+        size += serializedSize(updateValue.chatId);
+        size += serializedSize(updateValue.userId);
+        size += serializedSize(updateValue.inviterId);
+        size += serializedSize(updateValue.date);
+        size += serializedSize(updateValue.version);
+        break;
+    case TLValue::UpdateChatParticipantDelete:
+        size += serializedSize(updateValue.chatId);
+        size += serializedSize(updateValue.userId);
+        size += serializedSize(updateValue.version);
+        break;
+    case TLValue::UpdateDcOptions:
+        size += serializedSize(updateValue.dcOptions);
+        break;
+    case TLValue::UpdateUserBlocked:
+        size += serializedSize(updateValue.userId);
+        size += serializedSize(updateValue.blocked);
+        break;
+    case TLValue::UpdateNotifySettings:
+        size += serializedSize(updateValue.notifyPeer);
+        size += serializedSize(updateValue.notifySettings);
+        break;
+    case TLValue::UpdateServiceNotification:
+        size += serializedSize(updateValue.flags);
+        if (updateValue.flags & TLUpdate::InboxDate) {
+            size += serializedSize(updateValue.inboxDate);
+        }
+        size += serializedSize(updateValue.type);
+        size += serializedSize(updateValue.stringMessage);
+        size += serializedSize(updateValue.media);
+        size += serializedSize(updateValue.entities);
+        break;
+    case TLValue::UpdatePrivacy:
+        size += serializedSize(updateValue.key);
+        size += serializedSize(updateValue.rules);
+        break;
+    case TLValue::UpdateUserPhone:
+        size += serializedSize(updateValue.userId);
+        size += serializedSize(updateValue.phone);
+        break;
+    case TLValue::UpdateReadHistoryInbox:
+    case TLValue::UpdateReadHistoryOutbox:
+        size += serializedSize(updateValue.peer);
+        size += serializedSize(updateValue.maxId);
+        size += serializedSize(updateValue.pts);
+        size += serializedSize(updateValue.ptsCount);
+        break;
+    case TLValue::UpdateWebPage:
+        size += serializedSize(updateValue.webpage);
+        size += serializedSize(updateValue.pts);
+        size += serializedSize(updateValue.ptsCount);
+        break;
+    case TLValue::UpdateChannelTooLong:
+        size += serializedSize(updateValue.flags);
+        size += serializedSize(updateValue.channelId);
+        if (updateValue.flags & TLUpdate::Pts) {
+            size += serializedSize(updateValue.pts);
+        }
+        break;
+    case TLValue::UpdateChannel:
+        size += serializedSize(updateValue.channelId);
+        break;
+    case TLValue::UpdateReadChannelInbox:
+    case TLValue::UpdateReadChannelOutbox:
+        size += serializedSize(updateValue.channelId);
+        size += serializedSize(updateValue.maxId);
+        break;
+    case TLValue::UpdateDeleteChannelMessages:
+        size += serializedSize(updateValue.channelId);
+        size += serializedSize(updateValue.messages);
+        size += serializedSize(updateValue.pts);
+        size += serializedSize(updateValue.ptsCount);
+        break;
+    case TLValue::UpdateChannelMessageViews:
+        size += serializedSize(updateValue.channelId);
+        size += serializedSize(updateValue.quint32Id);
+        size += serializedSize(updateValue.views);
+        break;
+    case TLValue::UpdateChatAdmins:
+        size += serializedSize(updateValue.chatId);
+        size += serializedSize(updateValue.enabled);
+        size += serializedSize(updateValue.version);
+        break;
+    case TLValue::UpdateChatParticipantAdmin:
+        size += serializedSize(updateValue.chatId);
+        size += serializedSize(updateValue.userId);
+        size += serializedSize(updateValue.isAdmin);
+        size += serializedSize(updateValue.version);
+        break;
+    case TLValue::UpdateNewStickerSet:
+        size += serializedSize(updateValue.stickerset);
+        break;
+    case TLValue::UpdateStickerSetsOrder:
+        size += serializedSize(updateValue.flags);
+        size += serializedSize(updateValue.quint64OrderVector);
+        break;
+    case TLValue::UpdateStickerSets:
+    case TLValue::UpdateSavedGifs:
+    case TLValue::UpdateReadFeaturedStickers:
+    case TLValue::UpdateRecentStickers:
+    case TLValue::UpdateConfig:
+    case TLValue::UpdatePtsChanged:
+    case TLValue::UpdateLangPackTooLong:
+    case TLValue::UpdateFavedStickers:
+    case TLValue::UpdateContactsReset:
+        break;
+    case TLValue::UpdateBotInlineQuery:
+        size += serializedSize(updateValue.flags);
+        size += serializedSize(updateValue.queryId);
+        size += serializedSize(updateValue.userId);
+        size += serializedSize(updateValue.query);
+        if (updateValue.flags & TLUpdate::Geo) {
+            size += serializedSize(updateValue.geo);
+        }
+        size += serializedSize(updateValue.offset);
+        break;
+    case TLValue::UpdateBotInlineSend:
+        size += serializedSize(updateValue.flags);
+        size += serializedSize(updateValue.userId);
+        size += serializedSize(updateValue.query);
+        if (updateValue.flags & TLUpdate::Geo) {
+            size += serializedSize(updateValue.geo);
+        }
+        size += serializedSize(updateValue.stringId);
+        if (updateValue.flags & TLUpdate::InputBotInlineMessageIDMsgId) {
+            size += serializedSize(updateValue.inputBotInlineMessageIDMsgId);
+        }
+        break;
+    case TLValue::UpdateChannelPinnedMessage:
+        size += serializedSize(updateValue.channelId);
+        size += serializedSize(updateValue.quint32Id);
+        break;
+    case TLValue::UpdateBotCallbackQuery:
+        size += serializedSize(updateValue.flags);
+        size += serializedSize(updateValue.queryId);
+        size += serializedSize(updateValue.userId);
+        size += serializedSize(updateValue.peer);
+        size += serializedSize(updateValue.msgId);
+        size += serializedSize(updateValue.chatInstance);
+        if (updateValue.flags & TLUpdate::ByteArrayData) {
+            size += serializedSize(updateValue.byteArrayData);
+        }
+        if (updateValue.flags & TLUpdate::GameShortName) {
+            size += serializedSize(updateValue.gameShortName);
+        }
+        break;
+    case TLValue::UpdateInlineBotCallbackQuery:
+        size += serializedSize(updateValue.flags);
+        size += serializedSize(updateValue.queryId);
+        size += serializedSize(updateValue.userId);
+        size += serializedSize(updateValue.inputBotInlineMessageIDMsgId);
+        size += serializedSize(updateValue.chatInstance);
+        if (updateValue.flags & TLUpdate::ByteArrayData) {
+            size += serializedSize(updateValue.byteArrayData);
+        }
+        if (updateValue.flags & TLUpdate::GameShortName) {
+            size += serializedSize(updateValue.gameShortName);
+        }
+        break;
+    case TLValue::UpdateDraftMessage:
+        size += serializedSize(updateValue.peer);
+        size += serializedSize(updateValue.draft);
+        break;
+    case TLValue::UpdateChannelWebPage:
+        size += serializedSize(updateValue.channelId);
+        size += serializedSize(updateValue.webpage);
+        size += serializedSize(updateValue.pts);
+        size += serializedSize(updateValue.ptsCount);
+        break;
+    case TLValue::UpdateDialogPinned:
+        size += serializedSize(updateValue.flags);
+        size += serializedSize(updateValue.peer);
+        break;
+    case TLValue::UpdatePinnedDialogs:
+        size += serializedSize(updateValue.flags);
+        if (updateValue.flags & TLUpdate::PeerOrderVector) {
+            size += serializedSize(updateValue.peerOrderVector);
+        }
+        break;
+    case TLValue::UpdateBotWebhookJSON:
+        size += serializedSize(updateValue.jSONData);
+        break;
+    case TLValue::UpdateBotWebhookJSONQuery:
+        size += serializedSize(updateValue.queryId);
+        size += serializedSize(updateValue.jSONData);
+        size += serializedSize(updateValue.timeout);
+        break;
+    case TLValue::UpdateBotShippingQuery:
+        size += serializedSize(updateValue.queryId);
+        size += serializedSize(updateValue.userId);
+        size += serializedSize(updateValue.payload);
+        size += serializedSize(updateValue.shippingAddress);
+        break;
+    case TLValue::UpdateBotPrecheckoutQuery:
+        size += serializedSize(updateValue.flags);
+        size += serializedSize(updateValue.queryId);
+        size += serializedSize(updateValue.userId);
+        size += serializedSize(updateValue.payload);
+        if (updateValue.flags & TLUpdate::Info) {
+            size += serializedSize(updateValue.info);
+        }
+        if (updateValue.flags & TLUpdate::ShippingOptionId) {
+            size += serializedSize(updateValue.shippingOptionId);
+        }
+        size += serializedSize(updateValue.currency);
+        size += serializedSize(updateValue.totalAmount);
+        break;
+    case TLValue::UpdatePhoneCall:
+        size += serializedSize(updateValue.phoneCall);
+        break;
+    case TLValue::UpdateLangPack:
+        size += serializedSize(updateValue.difference);
+        break;
+    case TLValue::UpdateChannelReadMessagesContents:
+        size += serializedSize(updateValue.channelId);
+        size += serializedSize(updateValue.messages);
+        break;
+    case TLValue::UpdateChannelAvailableMessages:
+        size += serializedSize(updateValue.channelId);
+        size += serializedSize(updateValue.availableMinId);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLUpdates &updatesValue)
+{
+    quint32 size = serializedSize(updatesValue.tlType);
+
+    switch (updatesValue.tlType) {
+    case TLValue::UpdatesTooLong:
+        break;
+    case TLValue::UpdateShortMessage:
+        size += serializedSize(updatesValue.flags);
+        size += serializedSize(updatesValue.id);
+        size += serializedSize(updatesValue.userId);
+        size += serializedSize(updatesValue.message);
+        size += serializedSize(updatesValue.pts);
+        size += serializedSize(updatesValue.ptsCount);
+        size += serializedSize(updatesValue.date);
+        if (updatesValue.flags & TLUpdates::FwdFrom) {
+            size += serializedSize(updatesValue.fwdFrom);
+        }
+        if (updatesValue.flags & TLUpdates::ViaBotId) {
+            size += serializedSize(updatesValue.viaBotId);
+        }
+        if (updatesValue.flags & TLUpdates::ReplyToMsgId) {
+            size += serializedSize(updatesValue.replyToMsgId);
+        }
+        if (updatesValue.flags & TLUpdates::Entities) {
+            size += serializedSize(updatesValue.entities);
+        }
+        break;
+    case TLValue::UpdateShortChatMessage:
+        size += serializedSize(updatesValue.flags);
+        size += serializedSize(updatesValue.id);
+        size += serializedSize(updatesValue.fromId);
+        size += serializedSize(updatesValue.chatId);
+        size += serializedSize(updatesValue.message);
+        size += serializedSize(updatesValue.pts);
+        size += serializedSize(updatesValue.ptsCount);
+        size += serializedSize(updatesValue.date);
+        if (updatesValue.flags & TLUpdates::FwdFrom) {
+            size += serializedSize(updatesValue.fwdFrom);
+        }
+        if (updatesValue.flags & TLUpdates::ViaBotId) {
+            size += serializedSize(updatesValue.viaBotId);
+        }
+        if (updatesValue.flags & TLUpdates::ReplyToMsgId) {
+            size += serializedSize(updatesValue.replyToMsgId);
+        }
+        if (updatesValue.flags & TLUpdates::Entities) {
+            size += serializedSize(updatesValue.entities);
+        }
+        break;
+    case TLValue::UpdateShort:
+        size += serializedSize(updatesValue.update);
+        size += serializedSize(updatesValue.date);
+        break;
+    case TLValue::UpdatesCombined:
+        size += serializedSize(updatesValue.updates);
+        size += serializedSize(updatesValue.users);
+        size += serializedSize(updatesValue.chats);
+        size += serializedSize(updatesValue.date);
+        size += serializedSize(updatesValue.seqStart);
+        size += serializedSize(updatesValue.seq);
+        break;
+    case TLValue::Updates:
+        size += serializedSize(updatesValue.updates);
+        size += serializedSize(updatesValue.users);
+        size += serializedSize(updatesValue.chats);
+        size += serializedSize(updatesValue.date);
+        size += serializedSize(updatesValue.seq);
+        break;
+    case TLValue::UpdateShortSentMessage:
+        size += serializedSize(updatesValue.flags);
+        size += serializedSize(updatesValue.id);
+        size += serializedSize(updatesValue.pts);
+        size += serializedSize(updatesValue.ptsCount);
+        size += serializedSize(updatesValue.date);
+        if (updatesValue.flags & TLUpdates::Media) {
+            size += serializedSize(updatesValue.media);
+        }
+        if (updatesValue.flags & TLUpdates::Entities) {
+            size += serializedSize(updatesValue.entities);
+        }
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLUpdatesChannelDifference &updatesChannelDifferenceValue)
+{
+    quint32 size = serializedSize(updatesChannelDifferenceValue.tlType);
+
+    switch (updatesChannelDifferenceValue.tlType) {
+    case TLValue::UpdatesChannelDifferenceEmpty:
+        size += serializedSize(updatesChannelDifferenceValue.flags);
+        size += serializedSize(updatesChannelDifferenceValue.pts);
+        if (updatesChannelDifferenceValue.flags & TLUpdatesChannelDifference::Timeout) {
+            size += serializedSize(updatesChannelDifferenceValue.timeout);
+        }
+        break;
+    case TLValue::UpdatesChannelDifferenceTooLong:
+        size += serializedSize(updatesChannelDifferenceValue.flags);
+        size += serializedSize(updatesChannelDifferenceValue.pts);
+        if (updatesChannelDifferenceValue.flags & TLUpdatesChannelDifference::Timeout) {
+            size += serializedSize(updatesChannelDifferenceValue.timeout);
+        }
+        size += serializedSize(updatesChannelDifferenceValue.topMessage);
+        size += serializedSize(updatesChannelDifferenceValue.readInboxMaxId);
+        size += serializedSize(updatesChannelDifferenceValue.readOutboxMaxId);
+        size += serializedSize(updatesChannelDifferenceValue.unreadCount);
+        size += serializedSize(updatesChannelDifferenceValue.unreadMentionsCount);
+        size += serializedSize(updatesChannelDifferenceValue.messages);
+        size += serializedSize(updatesChannelDifferenceValue.chats);
+        size += serializedSize(updatesChannelDifferenceValue.users);
+        break;
+    case TLValue::UpdatesChannelDifference:
+        size += serializedSize(updatesChannelDifferenceValue.flags);
+        size += serializedSize(updatesChannelDifferenceValue.pts);
+        if (updatesChannelDifferenceValue.flags & TLUpdatesChannelDifference::Timeout) {
+            size += serializedSize(updatesChannelDifferenceValue.timeout);
+        }
+        size += serializedSize(updatesChannelDifferenceValue.newMessages);
+        size += serializedSize(updatesChannelDifferenceValue.otherUpdates);
+        size += serializedSize(updatesChannelDifferenceValue.chats);
+        size += serializedSize(updatesChannelDifferenceValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLUpdatesDifference &updatesDifferenceValue)
+{
+    quint32 size = serializedSize(updatesDifferenceValue.tlType);
+
+    switch (updatesDifferenceValue.tlType) {
+    case TLValue::UpdatesDifferenceEmpty:
+        size += serializedSize(updatesDifferenceValue.date);
+        size += serializedSize(updatesDifferenceValue.seq);
+        break;
+    case TLValue::UpdatesDifference:
+        size += serializedSize(updatesDifferenceValue.newMessages);
+        size += serializedSize(updatesDifferenceValue.newEncryptedMessages);
+        size += serializedSize(updatesDifferenceValue.otherUpdates);
+        size += serializedSize(updatesDifferenceValue.chats);
+        size += serializedSize(updatesDifferenceValue.users);
+        size += serializedSize(updatesDifferenceValue.state);
+        break;
+    case TLValue::UpdatesDifferenceSlice:
+        size += serializedSize(updatesDifferenceValue.newMessages);
+        size += serializedSize(updatesDifferenceValue.newEncryptedMessages);
+        size += serializedSize(updatesDifferenceValue.otherUpdates);
+        size += serializedSize(updatesDifferenceValue.chats);
+        size += serializedSize(updatesDifferenceValue.users);
+        size += serializedSize(updatesDifferenceValue.intermediateState);
+        break;
+    case TLValue::UpdatesDifferenceTooLong:
+        size += serializedSize(updatesDifferenceValue.pts);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLChannelAdminLogEventAction &channelAdminLogEventActionValue)
+{
+    quint32 size = serializedSize(channelAdminLogEventActionValue.tlType);
+
+    switch (channelAdminLogEventActionValue.tlType) {
+    case TLValue::ChannelAdminLogEventActionChangeTitle:
+    case TLValue::ChannelAdminLogEventActionChangeAbout:
+    case TLValue::ChannelAdminLogEventActionChangeUsername:
+        size += serializedSize(channelAdminLogEventActionValue.prevValue);
+        size += serializedSize(channelAdminLogEventActionValue.stringNewValue);
+        break;
+    case TLValue::ChannelAdminLogEventActionChangePhoto:
+        size += serializedSize(channelAdminLogEventActionValue.prevPhoto);
+        size += serializedSize(channelAdminLogEventActionValue.newPhoto);
+        break;
+    case TLValue::ChannelAdminLogEventActionToggleInvites:
+    case TLValue::ChannelAdminLogEventActionToggleSignatures:
+    case TLValue::ChannelAdminLogEventActionTogglePreHistoryHidden:
+        size += serializedSize(channelAdminLogEventActionValue.boolNewValue);
+        break;
+    case TLValue::ChannelAdminLogEventActionUpdatePinned:
+    case TLValue::ChannelAdminLogEventActionDeleteMessage:
+        size += serializedSize(channelAdminLogEventActionValue.message);
+        break;
+    case TLValue::ChannelAdminLogEventActionEditMessage:
+        size += serializedSize(channelAdminLogEventActionValue.prevMessage);
+        size += serializedSize(channelAdminLogEventActionValue.newMessage);
+        break;
+    case TLValue::ChannelAdminLogEventActionParticipantJoin:
+    case TLValue::ChannelAdminLogEventActionParticipantLeave:
+        break;
+    case TLValue::ChannelAdminLogEventActionParticipantInvite:
+        size += serializedSize(channelAdminLogEventActionValue.participant);
+        break;
+    case TLValue::ChannelAdminLogEventActionParticipantToggleBan:
+    case TLValue::ChannelAdminLogEventActionParticipantToggleAdmin:
+        size += serializedSize(channelAdminLogEventActionValue.prevParticipant);
+        size += serializedSize(channelAdminLogEventActionValue.newParticipant);
+        break;
+    case TLValue::ChannelAdminLogEventActionChangeStickerSet:
+        size += serializedSize(channelAdminLogEventActionValue.prevStickerset);
+        size += serializedSize(channelAdminLogEventActionValue.newStickerset);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLPaymentsPaymentResult &paymentsPaymentResultValue)
+{
+    quint32 size = serializedSize(paymentsPaymentResultValue.tlType);
+
+    switch (paymentsPaymentResultValue.tlType) {
+    case TLValue::PaymentsPaymentResult:
+        size += serializedSize(paymentsPaymentResultValue.updates);
+        break;
+    case TLValue::PaymentsPaymentVerficationNeeded:
+        size += serializedSize(paymentsPaymentResultValue.url);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLChannelAdminLogEvent &channelAdminLogEventValue)
+{
+    quint32 size = serializedSize(channelAdminLogEventValue.tlType);
+
+    switch (channelAdminLogEventValue.tlType) {
+    case TLValue::ChannelAdminLogEvent:
+        size += serializedSize(channelAdminLogEventValue.id);
+        size += serializedSize(channelAdminLogEventValue.date);
+        size += serializedSize(channelAdminLogEventValue.userId);
+        size += serializedSize(channelAdminLogEventValue.action);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+quint32 serializedSize(const TLChannelsAdminLogResults &channelsAdminLogResultsValue)
+{
+    quint32 size = serializedSize(channelsAdminLogResultsValue.tlType);
+
+    switch (channelsAdminLogResultsValue.tlType) {
+    case TLValue::ChannelsAdminLogResults:
+        size += serializedSize(channelsAdminLogResultsValue.events);
+        size += serializedSize(channelsAdminLogResultsValue.chats);
+        size += serializedSize(channelsAdminLogResultsValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+// End of generated serialized size implementation
+
+// Generated skip implementation
+Stream &Stream::skipValue(TLAccountDaysTTL *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::AccountDaysTTL:
+        skip<quint32>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLAccountPassword *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::AccountNoPassword:
+        skip<QByteArray>();
+        skip<QString>();
+        break;
+    case TLValue::AccountPassword:
+        skip<QByteArray>();
+        skip<QByteArray>();
+        skip<QString>();
+        skip<bool>();
+        skip<QString>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLAccountPasswordInputSettings *)
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::AccountPasswordInputSettings:
+        *this >> flags;
+        if (flags & TLAccountPasswordInputSettings::NewSalt) {
+            skip<QByteArray>();
+        }
+        if (flags & TLAccountPasswordInputSettings::NewPasswordHash) {
+            skip<QByteArray>();
+        }
+        if (flags & TLAccountPasswordInputSettings::Hint) {
+            skip<QString>();
+        }
+        if (flags & TLAccountPasswordInputSettings::Email) {
+            skip<QString>();
+        }
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLAccountPasswordSettings *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::AccountPasswordSettings:
+        skip<QString>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLAccountTmpPassword *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::AccountTmpPassword:
+        skip<QByteArray>();
+        skip<quint32>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLAuthCheckedPhone *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::AuthCheckedPhone:
+        skip<bool>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLAuthCodeType *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::AuthCodeTypeSms:
+    case TLValue::AuthCodeTypeCall:
+    case TLValue::AuthCodeTypeFlashCall:
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLAuthExportedAuthorization *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::AuthExportedAuthorization:
+        skip<quint32>();
+        skip<QByteArray>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLAuthPasswordRecovery *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::AuthPasswordRecovery:
+        skip<QString>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLAuthSentCodeType *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::AuthSentCodeTypeApp:
+    case TLValue::AuthSentCodeTypeSms:
+    case TLValue::AuthSentCodeTypeCall:
+        skip<quint32>();
+        break;
+    case TLValue::AuthSentCodeTypeFlashCall:
+        skip<QString>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLAuthorization *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::Authorization:
+        skip<quint64>();
+        skip<quint32>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        skip<quint32>();
+        skip<QString>();
+        skip<QString>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLBadMsgNotification *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::BadMsgNotification:
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::BadServerSalt:
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint64>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLBotCommand *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::BotCommand:
+        skip<QString>();
+        skip<QString>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLBotInfo *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::BotInfo:
+        skip<quint32>();
+        skip<QString>();
+        skip<TLVector<TLBotCommand>>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLCdnFileHash *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::CdnFileHash:
+        skip<quint32>();
+        skip<quint32>();
+        skip<QByteArray>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLCdnPublicKey *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::CdnPublicKey:
+        skip<quint32>();
+        skip<QString>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLChannelParticipantsFilter *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ChannelParticipantsRecent:
+    case TLValue::ChannelParticipantsAdmins:
+    case TLValue::ChannelParticipantsBots:
+        break;
+    case TLValue::ChannelParticipantsKicked:
+    case TLValue::ChannelParticipantsBanned:
+    case TLValue::ChannelParticipantsSearch:
+        skip<QString>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLChatParticipant *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ChatParticipant:
+    case TLValue::ChatParticipantAdmin:
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::ChatParticipantCreator:
+        skip<quint32>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLChatParticipants *)
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ChatParticipantsForbidden:
+        *this >> flags;
+        skip<quint32>();
+        if (flags & TLChatParticipants::SelfParticipant) {
+            skip<TLChatParticipant>();
+        }
+        break;
+    case TLValue::ChatParticipants:
+        skip<quint32>();
+        skip<TLVector<TLChatParticipant>>();
+        skip<quint32>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLClientDHInnerData *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ClientDHInnerData:
+        skip<TLNumber128>();
+        skip<TLNumber128>();
+        skip<quint64>();
+        skip<QString>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLContact *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::Contact:
+        skip<quint32>();
+        skip<bool>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLContactBlocked *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ContactBlocked:
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLContactLink *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ContactLinkUnknown:
+    case TLValue::ContactLinkNone:
+    case TLValue::ContactLinkHasPhone:
+    case TLValue::ContactLinkContact:
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLDataJSON *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::DataJSON:
+        skip<QString>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLDestroyAuthKeyRes *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::DestroyAuthKeyOk:
+    case TLValue::DestroyAuthKeyNone:
+    case TLValue::DestroyAuthKeyFail:
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLDestroySessionRes *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::DestroySessionOk:
+    case TLValue::DestroySessionNone:
+        skip<quint64>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLDisabledFeature *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::DisabledFeature:
+        skip<QString>();
+        skip<QString>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLEncryptedChat *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::EncryptedChatEmpty:
+    case TLValue::EncryptedChatDiscarded:
+        skip<quint32>();
+        break;
+    case TLValue::EncryptedChatWaiting:
+        skip<quint32>();
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::EncryptedChatRequested:
+        skip<quint32>();
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<QByteArray>();
+        break;
+    case TLValue::EncryptedChat:
+        skip<quint32>();
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<QByteArray>();
+        skip<quint64>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLEncryptedFile *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::EncryptedFileEmpty:
+        break;
+    case TLValue::EncryptedFile:
+        skip<quint64>();
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLEncryptedMessage *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::EncryptedMessage:
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<QByteArray>();
+        skip<TLEncryptedFile>();
+        break;
+    case TLValue::EncryptedMessageService:
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<QByteArray>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLError *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::Error:
+        skip<quint32>();
+        skip<QString>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLExportedChatInvite *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ChatInviteEmpty:
+        break;
+    case TLValue::ChatInviteExported:
+        skip<QString>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLExportedMessageLink *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ExportedMessageLink:
+        skip<QString>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLFileLocation *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::FileLocationUnavailable:
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint64>();
+        break;
+    case TLValue::FileLocation:
+        skip<quint32>();
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint64>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLFutureSalt *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::FutureSalt:
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint64>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLFutureSalts *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::FutureSalts:
+        skip<quint64>();
+        skip<quint32>();
+        skip<TLVector<TLFutureSalt>>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLGeoPoint *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::GeoPointEmpty:
+        break;
+    case TLValue::GeoPoint:
+        skip<double>();
+        skip<double>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLHelpAppUpdate *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::HelpAppUpdate:
+        skip<quint32>();
+        skip<bool>();
+        skip<QString>();
+        skip<QString>();
+        break;
+    case TLValue::HelpNoAppUpdate:
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLHelpInviteText *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::HelpInviteText:
+        skip<QString>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLHelpTermsOfService *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::HelpTermsOfService:
+        skip<QString>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLHighScore *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::HighScore:
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLHttpWait *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::HttpWait:
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLImportedContact *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ImportedContact:
+        skip<quint32>();
+        skip<quint64>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLInlineBotSwitchPM *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InlineBotSwitchPM:
+        skip<QString>();
+        skip<QString>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLInputAppEvent *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputAppEvent:
+        skip<double>();
+        skip<QString>();
+        skip<quint64>();
+        skip<QString>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLInputBotInlineMessageID *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputBotInlineMessageID:
+        skip<quint32>();
+        skip<quint64>();
+        skip<quint64>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLInputChannel *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputChannelEmpty:
+        break;
+    case TLValue::InputChannel:
+        skip<quint32>();
+        skip<quint64>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLInputContact *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputPhoneContact:
+        skip<quint64>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLInputDocument *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputDocumentEmpty:
+        break;
+    case TLValue::InputDocument:
+        skip<quint64>();
+        skip<quint64>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLInputEncryptedChat *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputEncryptedChat:
+        skip<quint32>();
+        skip<quint64>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLInputEncryptedFile *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputEncryptedFileEmpty:
+        break;
+    case TLValue::InputEncryptedFileUploaded:
+        skip<quint64>();
+        skip<quint32>();
+        skip<QString>();
+        skip<quint32>();
+        break;
+    case TLValue::InputEncryptedFile:
+        skip<quint64>();
+        skip<quint64>();
+        break;
+    case TLValue::InputEncryptedFileBigUploaded:
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLInputFile *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputFile:
+        skip<quint64>();
+        skip<quint32>();
+        skip<QString>();
+        skip<QString>();
+        break;
+    case TLValue::InputFileBig:
+        skip<quint64>();
+        skip<quint32>();
+        skip<QString>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLInputFileLocation *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputFileLocation:
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint64>();
+        break;
+    case TLValue::InputEncryptedFileLocation:
+        skip<quint64>();
+        skip<quint64>();
+        break;
+    case TLValue::InputDocumentFileLocation:
+        skip<quint64>();
+        skip<quint64>();
+        skip<quint32>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLInputGeoPoint *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputGeoPointEmpty:
+        break;
+    case TLValue::InputGeoPoint:
+        skip<double>();
+        skip<double>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLInputPeer *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputPeerEmpty:
+    case TLValue::InputPeerSelf:
+        break;
+    case TLValue::InputPeerChat:
+        skip<quint32>();
+        break;
+    case TLValue::InputPeerUser:
+    case TLValue::InputPeerChannel:
+        skip<quint32>();
+        skip<quint64>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLInputPeerNotifyEvents *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputPeerNotifyEventsEmpty:
+    case TLValue::InputPeerNotifyEventsAll:
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLInputPhoneCall *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputPhoneCall:
+        skip<quint64>();
+        skip<quint64>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLInputPhoto *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputPhotoEmpty:
+        break;
+    case TLValue::InputPhoto:
+        skip<quint64>();
+        skip<quint64>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLInputPrivacyKey *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputPrivacyKeyStatusTimestamp:
+    case TLValue::InputPrivacyKeyChatInvite:
+    case TLValue::InputPrivacyKeyPhoneCall:
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLInputStickerSet *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputStickerSetEmpty:
+        break;
+    case TLValue::InputStickerSetID:
+        skip<quint64>();
+        skip<quint64>();
+        break;
+    case TLValue::InputStickerSetShortName:
+        skip<QString>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLInputStickeredMedia *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputStickeredMediaPhoto:
+        skip<TLInputPhoto>();
+        break;
+    case TLValue::InputStickeredMediaDocument:
+        skip<TLInputDocument>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLInputUser *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputUserEmpty:
+    case TLValue::InputUserSelf:
+        break;
+    case TLValue::InputUser:
+        skip<quint32>();
+        skip<quint64>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLInputWebFileLocation *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputWebFileLocation:
+        skip<QString>();
+        skip<quint64>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLIpPort *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::IpPort:
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLLabeledPrice *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::LabeledPrice:
+        skip<QString>();
+        skip<quint64>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLLangPackLanguage *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::LangPackLanguage:
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLLangPackString *)
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::LangPackString:
+        skip<QString>();
+        skip<QString>();
+        break;
+    case TLValue::LangPackStringPluralized:
+        *this >> flags;
+        skip<QString>();
+        if (flags & TLLangPackString::ZeroValue) {
+            skip<QString>();
+        }
+        if (flags & TLLangPackString::OneValue) {
+            skip<QString>();
+        }
+        if (flags & TLLangPackString::TwoValue) {
+            skip<QString>();
+        }
+        if (flags & TLLangPackString::FewValue) {
+            skip<QString>();
+        }
+        if (flags & TLLangPackString::ManyValue) {
+            skip<QString>();
+        }
+        skip<QString>();
+        break;
+    case TLValue::LangPackStringDeleted:
+        skip<QString>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLMaskCoords *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MaskCoords:
+        skip<quint32>();
+        skip<double>();
+        skip<double>();
+        skip<double>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLMessageEntity *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessageEntityUnknown:
+    case TLValue::MessageEntityMention:
+    case TLValue::MessageEntityHashtag:
+    case TLValue::MessageEntityBotCommand:
+    case TLValue::MessageEntityUrl:
+    case TLValue::MessageEntityEmail:
+    case TLValue::MessageEntityBold:
+    case TLValue::MessageEntityItalic:
+    case TLValue::MessageEntityCode:
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::MessageEntityPre:
+    case TLValue::MessageEntityTextUrl:
+        skip<quint32>();
+        skip<quint32>();
+        skip<QString>();
+        break;
+    case TLValue::MessageEntityMentionName:
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::InputMessageEntityMentionName:
+        skip<quint32>();
+        skip<quint32>();
+        skip<TLInputUser>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLMessageFwdHeader *)
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessageFwdHeader:
+        *this >> flags;
+        if (flags & TLMessageFwdHeader::FromId) {
+            skip<quint32>();
+        }
+        skip<quint32>();
+        if (flags & TLMessageFwdHeader::ChannelId) {
+            skip<quint32>();
+        }
+        if (flags & TLMessageFwdHeader::ChannelPost) {
+            skip<quint32>();
+        }
+        if (flags & TLMessageFwdHeader::PostAuthor) {
+            skip<QString>();
+        }
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLMessageRange *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessageRange:
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLMessagesAffectedHistory *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessagesAffectedHistory:
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLMessagesAffectedMessages *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessagesAffectedMessages:
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLMessagesDhConfig *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessagesDhConfigNotModified:
+        skip<QByteArray>();
+        break;
+    case TLValue::MessagesDhConfig:
+        skip<quint32>();
+        skip<QByteArray>();
+        skip<quint32>();
+        skip<QByteArray>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLMessagesSentEncryptedMessage *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessagesSentEncryptedMessage:
+        skip<quint32>();
+        break;
+    case TLValue::MessagesSentEncryptedFile:
+        skip<quint32>();
+        skip<TLEncryptedFile>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLMsgDetailedInfo *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MsgDetailedInfo:
+        skip<quint64>();
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::MsgNewDetailedInfo:
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLMsgResendReq *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MsgResendReq:
+        skip<TLVector<quint64>>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLMsgsAck *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MsgsAck:
+        skip<TLVector<quint64>>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLMsgsAllInfo *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MsgsAllInfo:
+        skip<TLVector<quint64>>();
+        skip<QString>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLMsgsStateInfo *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MsgsStateInfo:
+        skip<quint64>();
+        skip<QString>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLMsgsStateReq *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MsgsStateReq:
+        skip<TLVector<quint64>>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLNearestDc *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::NearestDc:
+        skip<QString>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLNewSession *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::NewSessionCreated:
+        skip<quint64>();
+        skip<quint64>();
+        skip<quint64>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLPQInnerData *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PQInnerData:
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        skip<TLNumber128>();
+        skip<TLNumber128>();
+        skip<TLNumber256>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLPaymentCharge *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PaymentCharge:
+        skip<QString>();
+        skip<QString>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLPaymentSavedCredentials *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PaymentSavedCredentialsCard:
+        skip<QString>();
+        skip<QString>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLPeer *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PeerUser:
+    case TLValue::PeerChat:
+    case TLValue::PeerChannel:
+        skip<quint32>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLPeerNotifyEvents *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PeerNotifyEventsEmpty:
+    case TLValue::PeerNotifyEventsAll:
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLPhoneCallDiscardReason *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PhoneCallDiscardReasonMissed:
+    case TLValue::PhoneCallDiscardReasonDisconnect:
+    case TLValue::PhoneCallDiscardReasonHangup:
+    case TLValue::PhoneCallDiscardReasonBusy:
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLPhoneConnection *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PhoneConnection:
+        skip<quint64>();
+        skip<QString>();
+        skip<QString>();
+        skip<quint32>();
+        skip<QByteArray>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLPhotoSize *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PhotoSizeEmpty:
+        skip<QString>();
+        break;
+    case TLValue::PhotoSize:
+        skip<QString>();
+        skip<TLFileLocation>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::PhotoCachedSize:
+        skip<QString>();
+        skip<TLFileLocation>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<QByteArray>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLPong *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::Pong:
+        skip<quint64>();
+        skip<quint64>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLPopularContact *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PopularContact:
+        skip<quint64>();
+        skip<quint32>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLPostAddress *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PostAddress:
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLPrivacyKey *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PrivacyKeyStatusTimestamp:
+    case TLValue::PrivacyKeyChatInvite:
+    case TLValue::PrivacyKeyPhoneCall:
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLPrivacyRule *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PrivacyValueAllowContacts:
+    case TLValue::PrivacyValueAllowAll:
+    case TLValue::PrivacyValueDisallowContacts:
+    case TLValue::PrivacyValueDisallowAll:
+        break;
+    case TLValue::PrivacyValueAllowUsers:
+    case TLValue::PrivacyValueDisallowUsers:
+        skip<TLVector<quint32>>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLReceivedNotifyMessage *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ReceivedNotifyMessage:
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLReportReason *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputReportReasonSpam:
+    case TLValue::InputReportReasonViolence:
+    case TLValue::InputReportReasonPornography:
+        break;
+    case TLValue::InputReportReasonOther:
+        skip<QString>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLResPQ *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ResPQ:
+        skip<TLNumber128>();
+        skip<TLNumber128>();
+        skip<QString>();
+        skip<TLVector<quint64>>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLRichText *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::TextEmpty:
+        break;
+    case TLValue::TextPlain:
+        skip<QString>();
+        break;
+    case TLValue::TextBold:
+    case TLValue::TextItalic:
+    case TLValue::TextUnderline:
+    case TLValue::TextStrike:
+    case TLValue::TextFixed:
+        skip<TLRichText>();
+        break;
+    case TLValue::TextUrl:
+        skip<TLRichText>();
+        skip<QString>();
+        skip<quint64>();
+        break;
+    case TLValue::TextEmail:
+        skip<TLRichText>();
+        skip<QString>();
+        break;
+    case TLValue::TextConcat:
+        skip<TLVector<TLRichText>>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLRpcDropAnswer *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::RpcAnswerUnknown:
+    case TLValue::RpcAnswerDroppedRunning:
+        break;
+    case TLValue::RpcAnswerDropped:
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLRpcError *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::RpcError:
+        skip<quint32>();
+        skip<QString>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLSendMessageAction *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::SendMessageTypingAction:
+    case TLValue::SendMessageCancelAction:
+    case TLValue::SendMessageRecordVideoAction:
+    case TLValue::SendMessageRecordAudioAction:
+    case TLValue::SendMessageGeoLocationAction:
+    case TLValue::SendMessageChooseContactAction:
+    case TLValue::SendMessageGamePlayAction:
+    case TLValue::SendMessageRecordRoundAction:
+        break;
+    case TLValue::SendMessageUploadVideoAction:
+    case TLValue::SendMessageUploadAudioAction:
+    case TLValue::SendMessageUploadPhotoAction:
+    case TLValue::SendMessageUploadDocumentAction:
+    case TLValue::SendMessageUploadRoundAction:
+        skip<quint32>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLServerDHInnerData *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ServerDHInnerData:
+        skip<TLNumber128>();
+        skip<TLNumber128>();
+        skip<quint32>();
+        skip<QString>();
+        skip<QString>();
+        skip<quint32>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLServerDHParams *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ServerDHParamsFail:
+        skip<TLNumber128>();
+        skip<TLNumber128>();
+        skip<TLNumber128>();
+        break;
+    case TLValue::ServerDHParamsOk:
+        skip<TLNumber128>();
+        skip<TLNumber128>();
+        skip<QString>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLSetClientDHParamsAnswer *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::DhGenOk:
+    case TLValue::DhGenRetry:
+    case TLValue::DhGenFail:
+        skip<TLNumber128>();
+        skip<TLNumber128>();
+        skip<TLNumber128>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLShippingOption *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ShippingOption:
+        skip<QString>();
+        skip<QString>();
+        skip<TLVector<TLLabeledPrice>>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLStickerPack *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::StickerPack:
+        skip<QString>();
+        skip<TLVector<quint64>>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLStorageFileType *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::StorageFileUnknown:
+    case TLValue::StorageFilePartial:
+    case TLValue::StorageFileJpeg:
+    case TLValue::StorageFileGif:
+    case TLValue::StorageFilePng:
+    case TLValue::StorageFilePdf:
+    case TLValue::StorageFileMp3:
+    case TLValue::StorageFileMov:
+    case TLValue::StorageFileMp4:
+    case TLValue::StorageFileWebp:
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLTopPeer *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::TopPeer:
+        skip<TLPeer>();
+        skip<double>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLTopPeerCategory *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::TopPeerCategoryBotsPM:
+    case TLValue::TopPeerCategoryBotsInline:
+    case TLValue::TopPeerCategoryCorrespondents:
+    case TLValue::TopPeerCategoryGroups:
+    case TLValue::TopPeerCategoryChannels:
+    case TLValue::TopPeerCategoryPhoneCalls:
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLTopPeerCategoryPeers *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::TopPeerCategoryPeers:
+        skip<TLTopPeerCategory>();
+        skip<quint32>();
+        skip<TLVector<TLTopPeer>>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLUpdatesState *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::UpdatesState:
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLUploadCdnFile *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::UploadCdnFileReuploadNeeded:
+    case TLValue::UploadCdnFile:
+        skip<QByteArray>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLUploadFile *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::UploadFile:
+        skip<TLStorageFileType>();
+        skip<quint32>();
+        skip<QByteArray>();
+        break;
+    case TLValue::UploadFileCdnRedirect:
+        skip<quint32>();
+        skip<QByteArray>();
+        skip<QByteArray>();
+        skip<QByteArray>();
+        skip<TLVector<TLCdnFileHash>>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLUploadWebFile *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::UploadWebFile:
+        skip<quint32>();
+        skip<QString>();
+        skip<TLStorageFileType>();
+        skip<quint32>();
+        skip<QByteArray>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLUserProfilePhoto *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::UserProfilePhotoEmpty:
+        break;
+    case TLValue::UserProfilePhoto:
+        skip<quint64>();
+        skip<TLFileLocation>();
+        skip<TLFileLocation>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLUserStatus *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::UserStatusEmpty:
+    case TLValue::UserStatusRecently:
+    case TLValue::UserStatusLastWeek:
+    case TLValue::UserStatusLastMonth:
+        break;
+    case TLValue::UserStatusOnline:
+    case TLValue::UserStatusOffline:
+        skip<quint32>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLWallPaper *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::WallPaper:
+        skip<quint32>();
+        skip<QString>();
+        skip<TLVector<TLPhotoSize>>();
+        skip<quint32>();
+        break;
+    case TLValue::WallPaperSolid:
+        skip<quint32>();
+        skip<QString>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLAccountAuthorizations *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::AccountAuthorizations:
+        skip<TLVector<TLAuthorization>>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLAuthSentCode *)
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::AuthSentCode:
+        *this >> flags;
+        skip<TLAuthSentCodeType>();
+        skip<QString>();
+        if (flags & TLAuthSentCode::NextType) {
+            skip<TLAuthCodeType>();
+        }
+        if (flags & TLAuthSentCode::Timeout) {
+            skip<quint32>();
+        }
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLCdnConfig *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::CdnConfig:
+        skip<TLVector<TLCdnPublicKey>>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLChannelAdminLogEventsFilter *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ChannelAdminLogEventsFilter:
+        skip<quint32>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLChannelAdminRights *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ChannelAdminRights:
+        skip<quint32>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLChannelBannedRights *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ChannelBannedRights:
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLChannelMessagesFilter *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ChannelMessagesFilterEmpty:
+        break;
+    case TLValue::ChannelMessagesFilter:
+        skip<quint32>();
+        skip<TLVector<TLMessageRange>>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLChannelParticipant *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ChannelParticipant:
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::ChannelParticipantSelf:
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::ChannelParticipantCreator:
+        skip<quint32>();
+        break;
+    case TLValue::ChannelParticipantAdmin:
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<TLChannelAdminRights>();
+        break;
+    case TLValue::ChannelParticipantBanned:
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<TLChannelBannedRights>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLChatPhoto *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ChatPhotoEmpty:
+        break;
+    case TLValue::ChatPhoto:
+        skip<TLFileLocation>();
+        skip<TLFileLocation>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLContactStatus *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ContactStatus:
+        skip<quint32>();
+        skip<TLUserStatus>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLDcOption *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::DcOption:
+        skip<quint32>();
+        skip<quint32>();
+        skip<QString>();
+        skip<quint32>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLDocumentAttribute *)
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::DocumentAttributeImageSize:
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::DocumentAttributeAnimated:
+    case TLValue::DocumentAttributeHasStickers:
+        break;
+    case TLValue::DocumentAttributeSticker:
+        *this >> flags;
+        skip<QString>();
+        skip<TLInputStickerSet>();
+        if (flags & TLDocumentAttribute::MaskCoords) {
+            skip<TLMaskCoords>();
+        }
+        break;
+    case TLValue::DocumentAttributeVideo:
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::DocumentAttributeAudio:
+        *this >> flags;
+        skip<quint32>();
+        if (flags & TLDocumentAttribute::Title) {
+            skip<QString>();
+        }
+        if (flags & TLDocumentAttribute::Performer) {
+            skip<QString>();
+        }
+        if (flags & TLDocumentAttribute::Waveform) {
+            skip<QByteArray>();
+        }
+        break;
+    case TLValue::DocumentAttributeFilename:
+        skip<QString>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLDraftMessage *)
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::DraftMessageEmpty:
+        break;
+    case TLValue::DraftMessage:
+        *this >> flags;
+        if (flags & TLDraftMessage::ReplyToMsgId) {
+            skip<quint32>();
+        }
+        skip<QString>();
+        if (flags & TLDraftMessage::Entities) {
+            skip<TLVector<TLMessageEntity>>();
+        }
+        skip<quint32>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLHelpConfigSimple *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::HelpConfigSimple:
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<TLVector<TLIpPort>>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLInputChatPhoto *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputChatPhotoEmpty:
+        break;
+    case TLValue::InputChatUploadedPhoto:
+        skip<TLInputFile>();
+        break;
+    case TLValue::InputChatPhoto:
+        skip<TLInputPhoto>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLInputGame *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputGameID:
+        skip<quint64>();
+        skip<quint64>();
+        break;
+    case TLValue::InputGameShortName:
+        skip<TLInputUser>();
+        skip<QString>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLInputNotifyPeer *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputNotifyPeer:
+        skip<TLInputPeer>();
+        break;
+    case TLValue::InputNotifyUsers:
+    case TLValue::InputNotifyChats:
+    case TLValue::InputNotifyAll:
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLInputPaymentCredentials *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputPaymentCredentialsSaved:
+        skip<QString>();
+        skip<QByteArray>();
+        break;
+    case TLValue::InputPaymentCredentials:
+        skip<quint32>();
+        skip<TLDataJSON>();
+        break;
+    case TLValue::InputPaymentCredentialsApplePay:
+    case TLValue::InputPaymentCredentialsAndroidPay:
+        skip<TLDataJSON>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLInputPeerNotifySettings *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputPeerNotifySettings:
+        skip<quint32>();
+        skip<quint32>();
+        skip<QString>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLInputPrivacyRule *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputPrivacyValueAllowContacts:
+    case TLValue::InputPrivacyValueAllowAll:
+    case TLValue::InputPrivacyValueDisallowContacts:
+    case TLValue::InputPrivacyValueDisallowAll:
+        break;
+    case TLValue::InputPrivacyValueAllowUsers:
+    case TLValue::InputPrivacyValueDisallowUsers:
+        skip<TLVector<TLInputUser>>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLInputStickerSetItem *)
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputStickerSetItem:
+        *this >> flags;
+        skip<TLInputDocument>();
+        skip<QString>();
+        if (flags & TLInputStickerSetItem::MaskCoords) {
+            skip<TLMaskCoords>();
+        }
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLInputWebDocument *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputWebDocument:
+        skip<QString>();
+        skip<quint32>();
+        skip<QString>();
+        skip<TLVector<TLDocumentAttribute>>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLInvoice *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::Invoice:
+        skip<quint32>();
+        skip<QString>();
+        skip<TLVector<TLLabeledPrice>>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLKeyboardButton *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::KeyboardButton:
+    case TLValue::KeyboardButtonRequestPhone:
+    case TLValue::KeyboardButtonRequestGeoLocation:
+    case TLValue::KeyboardButtonGame:
+    case TLValue::KeyboardButtonBuy:
+        skip<QString>();
+        break;
+    case TLValue::KeyboardButtonUrl:
+        skip<QString>();
+        skip<QString>();
+        break;
+    case TLValue::KeyboardButtonCallback:
+        skip<QString>();
+        skip<QByteArray>();
+        break;
+    case TLValue::KeyboardButtonSwitchInline:
+        skip<quint32>();
+        skip<QString>();
+        skip<QString>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLKeyboardButtonRow *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::KeyboardButtonRow:
+        skip<TLVector<TLKeyboardButton>>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLLangPackDifference *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::LangPackDifference:
+        skip<QString>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<TLVector<TLLangPackString>>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLMessagesBotCallbackAnswer *)
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessagesBotCallbackAnswer:
+        *this >> flags;
+        if (flags & TLMessagesBotCallbackAnswer::Message) {
+            skip<QString>();
+        }
+        if (flags & TLMessagesBotCallbackAnswer::Url) {
+            skip<QString>();
+        }
+        skip<quint32>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLMessagesFilter *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputMessagesFilterEmpty:
+    case TLValue::InputMessagesFilterPhotos:
+    case TLValue::InputMessagesFilterVideo:
+    case TLValue::InputMessagesFilterPhotoVideo:
+    case TLValue::InputMessagesFilterDocument:
+    case TLValue::InputMessagesFilterUrl:
+    case TLValue::InputMessagesFilterGif:
+    case TLValue::InputMessagesFilterVoice:
+    case TLValue::InputMessagesFilterMusic:
+    case TLValue::InputMessagesFilterChatPhotos:
+    case TLValue::InputMessagesFilterRoundVoice:
+    case TLValue::InputMessagesFilterRoundVideo:
+    case TLValue::InputMessagesFilterMyMentions:
+    case TLValue::InputMessagesFilterGeo:
+    case TLValue::InputMessagesFilterContacts:
+        break;
+    case TLValue::InputMessagesFilterPhoneCalls:
+        skip<quint32>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLMessagesMessageEditData *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessagesMessageEditData:
+        skip<quint32>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLNotifyPeer *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::NotifyPeer:
+        skip<TLPeer>();
+        break;
+    case TLValue::NotifyUsers:
+    case TLValue::NotifyChats:
+    case TLValue::NotifyAll:
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLPaymentRequestedInfo *)
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PaymentRequestedInfo:
+        *this >> flags;
+        if (flags & TLPaymentRequestedInfo::Name) {
+            skip<QString>();
+        }
+        if (flags & TLPaymentRequestedInfo::Phone) {
+            skip<QString>();
+        }
+        if (flags & TLPaymentRequestedInfo::Email) {
+            skip<QString>();
+        }
+        if (flags & TLPaymentRequestedInfo::ShippingAddress) {
+            skip<TLPostAddress>();
+        }
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLPaymentsSavedInfo *)
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PaymentsSavedInfo:
+        *this >> flags;
+        if (flags & TLPaymentsSavedInfo::SavedInfo) {
+            skip<TLPaymentRequestedInfo>();
+        }
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLPaymentsValidatedRequestedInfo *)
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PaymentsValidatedRequestedInfo:
+        *this >> flags;
+        if (flags & TLPaymentsValidatedRequestedInfo::Id) {
+            skip<QString>();
+        }
+        if (flags & TLPaymentsValidatedRequestedInfo::ShippingOptions) {
+            skip<TLVector<TLShippingOption>>();
+        }
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLPeerNotifySettings *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PeerNotifySettingsEmpty:
+        break;
+    case TLValue::PeerNotifySettings:
+        skip<quint32>();
+        skip<quint32>();
+        skip<QString>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLPeerSettings *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PeerSettings:
+        skip<quint32>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLPhoneCallProtocol *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PhoneCallProtocol:
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLPhoto *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PhotoEmpty:
+        skip<quint64>();
+        break;
+    case TLValue::Photo:
+        skip<quint32>();
+        skip<quint64>();
+        skip<quint64>();
+        skip<quint32>();
+        skip<TLVector<TLPhotoSize>>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLReplyMarkup *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ReplyKeyboardHide:
+    case TLValue::ReplyKeyboardForceReply:
+        skip<quint32>();
+        break;
+    case TLValue::ReplyKeyboardMarkup:
+        skip<quint32>();
+        skip<TLVector<TLKeyboardButtonRow>>();
+        break;
+    case TLValue::ReplyInlineMarkup:
+        skip<TLVector<TLKeyboardButtonRow>>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLStickerSet *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::StickerSet:
+        skip<quint32>();
+        skip<quint64>();
+        skip<quint64>();
+        skip<QString>();
+        skip<QString>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLUser *)
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::UserEmpty:
+        skip<quint32>();
+        break;
+    case TLValue::User:
+        *this >> flags;
+        skip<quint32>();
+        if (flags & TLUser::AccessHash) {
+            skip<quint64>();
+        }
+        if (flags & TLUser::FirstName) {
+            skip<QString>();
+        }
+        if (flags & TLUser::LastName) {
+            skip<QString>();
+        }
+        if (flags & TLUser::Username) {
+            skip<QString>();
+        }
+        if (flags & TLUser::Phone) {
+            skip<QString>();
+        }
+        if (flags & TLUser::Photo) {
+            skip<TLUserProfilePhoto>();
+        }
+        if (flags & TLUser::Status) {
+            skip<TLUserStatus>();
+        }
+        if (flags & TLUser::BotInfoVersion) {
+            skip<quint32>();
+        }
+        if (flags & TLUser::RestrictionReason) {
+            skip<QString>();
+        }
+        if (flags & TLUser::BotInlinePlaceholder) {
+            skip<QString>();
+        }
+        if (flags & TLUser::LangCode) {
+            skip<QString>();
+        }
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLWebDocument *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::WebDocument:
+        skip<QString>();
+        skip<quint64>();
+        skip<quint32>();
+        skip<QString>();
+        skip<TLVector<TLDocumentAttribute>>();
+        skip<quint32>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLAccountPrivacyRules *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::AccountPrivacyRules:
+        skip<TLVector<TLPrivacyRule>>();
+        skip<TLVector<TLUser>>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLAuthAuthorization *)
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::AuthAuthorization:
+        *this >> flags;
+        if (flags & TLAuthAuthorization::TmpSessions) {
+            skip<quint32>();
+        }
+        skip<TLUser>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLBotInlineMessage *)
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::BotInlineMessageMediaAuto:
+        *this >> flags;
+        skip<QString>();
+        if (flags & TLBotInlineMessage::ReplyMarkup) {
+            skip<TLReplyMarkup>();
+        }
+        break;
+    case TLValue::BotInlineMessageText:
+        *this >> flags;
+        skip<QString>();
+        if (flags & TLBotInlineMessage::Entities) {
+            skip<TLVector<TLMessageEntity>>();
+        }
+        if (flags & TLBotInlineMessage::ReplyMarkup) {
+            skip<TLReplyMarkup>();
+        }
+        break;
+    case TLValue::BotInlineMessageMediaGeo:
+        *this >> flags;
+        skip<TLGeoPoint>();
+        skip<quint32>();
+        if (flags & TLBotInlineMessage::ReplyMarkup) {
+            skip<TLReplyMarkup>();
+        }
+        break;
+    case TLValue::BotInlineMessageMediaVenue:
+        *this >> flags;
+        skip<TLGeoPoint>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        if (flags & TLBotInlineMessage::ReplyMarkup) {
+            skip<TLReplyMarkup>();
+        }
+        break;
+    case TLValue::BotInlineMessageMediaContact:
+        *this >> flags;
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        if (flags & TLBotInlineMessage::ReplyMarkup) {
+            skip<TLReplyMarkup>();
+        }
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLChannelsChannelParticipant *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ChannelsChannelParticipant:
+        skip<TLChannelParticipant>();
+        skip<TLVector<TLUser>>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLChannelsChannelParticipants *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ChannelsChannelParticipants:
+        skip<quint32>();
+        skip<TLVector<TLChannelParticipant>>();
+        skip<TLVector<TLUser>>();
+        break;
+    case TLValue::ChannelsChannelParticipantsNotModified:
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLChat *)
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ChatEmpty:
+        skip<quint32>();
+        break;
+    case TLValue::Chat:
+        *this >> flags;
+        skip<quint32>();
+        skip<QString>();
+        skip<TLChatPhoto>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        if (flags & TLChat::MigratedTo) {
+            skip<TLInputChannel>();
+        }
+        break;
+    case TLValue::ChatForbidden:
+        skip<quint32>();
+        skip<QString>();
+        break;
+    case TLValue::Channel:
+        *this >> flags;
+        skip<quint32>();
+        if (flags & TLChat::AccessHash) {
+            skip<quint64>();
+        }
+        skip<QString>();
+        if (flags & TLChat::Username) {
+            skip<QString>();
+        }
+        skip<TLChatPhoto>();
+        skip<quint32>();
+        skip<quint32>();
+        if (flags & TLChat::RestrictionReason) {
+            skip<QString>();
+        }
+        if (flags & TLChat::AdminRights) {
+            skip<TLChannelAdminRights>();
+        }
+        if (flags & TLChat::BannedRights) {
+            skip<TLChannelBannedRights>();
+        }
+        break;
+    case TLValue::ChannelForbidden:
+        *this >> flags;
+        skip<quint32>();
+        skip<quint64>();
+        skip<QString>();
+        if (flags & TLChat::UntilDate) {
+            skip<quint32>();
+        }
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLChatFull *)
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ChatFull:
+        skip<quint32>();
+        skip<TLChatParticipants>();
+        skip<TLPhoto>();
+        skip<TLPeerNotifySettings>();
+        skip<TLExportedChatInvite>();
+        skip<TLVector<TLBotInfo>>();
+        break;
+    case TLValue::ChannelFull:
+        *this >> flags;
+        skip<quint32>();
+        skip<QString>();
+        if (flags & TLChatFull::ParticipantsCount) {
+            skip<quint32>();
+        }
+        if (flags & TLChatFull::AdminsCount) {
+            skip<quint32>();
+        }
+        if (flags & TLChatFull::KickedCount) {
+            skip<quint32>();
+        }
+        if (flags & TLChatFull::BannedCount) {
+            skip<quint32>();
+        }
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<TLPhoto>();
+        skip<TLPeerNotifySettings>();
+        skip<TLExportedChatInvite>();
+        skip<TLVector<TLBotInfo>>();
+        if (flags & TLChatFull::MigratedFromChatId) {
+            skip<quint32>();
+        }
+        if (flags & TLChatFull::MigratedFromMaxId) {
+            skip<quint32>();
+        }
+        if (flags & TLChatFull::PinnedMsgId) {
+            skip<quint32>();
+        }
+        if (flags & TLChatFull::Stickerset) {
+            skip<TLStickerSet>();
+        }
+        if (flags & TLChatFull::AvailableMinId) {
+            skip<quint32>();
+        }
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLChatInvite *)
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ChatInviteAlready:
+        skip<TLChat>();
+        break;
+    case TLValue::ChatInvite:
+        *this >> flags;
+        skip<QString>();
+        skip<TLChatPhoto>();
+        skip<quint32>();
+        if (flags & TLChatInvite::Participants) {
+            skip<TLVector<TLUser>>();
+        }
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLConfig *)
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::Config:
+        *this >> flags;
+        skip<quint32>();
+        skip<quint32>();
+        skip<bool>();
+        skip<quint32>();
+        skip<TLVector<TLDcOption>>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        if (flags & TLConfig::TmpSessions) {
+            skip<quint32>();
+        }
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<QString>();
+        if (flags & TLConfig::SuggestedLangCode) {
+            skip<QString>();
+        }
+        if (flags & TLConfig::LangPackVersion) {
+            skip<quint32>();
+        }
+        skip<TLVector<TLDisabledFeature>>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLContactsBlocked *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ContactsBlocked:
+        skip<TLVector<TLContactBlocked>>();
+        skip<TLVector<TLUser>>();
+        break;
+    case TLValue::ContactsBlockedSlice:
+        skip<quint32>();
+        skip<TLVector<TLContactBlocked>>();
+        skip<TLVector<TLUser>>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLContactsContacts *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ContactsContactsNotModified:
+        break;
+    case TLValue::ContactsContacts:
+        skip<TLVector<TLContact>>();
+        skip<quint32>();
+        skip<TLVector<TLUser>>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLContactsFound *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ContactsFound:
+        skip<TLVector<TLPeer>>();
+        skip<TLVector<TLChat>>();
+        skip<TLVector<TLUser>>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLContactsImportedContacts *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ContactsImportedContacts:
+        skip<TLVector<TLImportedContact>>();
+        skip<TLVector<TLPopularContact>>();
+        skip<TLVector<quint64>>();
+        skip<TLVector<TLUser>>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLContactsLink *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ContactsLink:
+        skip<TLContactLink>();
+        skip<TLContactLink>();
+        skip<TLUser>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLContactsResolvedPeer *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ContactsResolvedPeer:
+        skip<TLPeer>();
+        skip<TLVector<TLChat>>();
+        skip<TLVector<TLUser>>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLContactsTopPeers *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ContactsTopPeersNotModified:
+        break;
+    case TLValue::ContactsTopPeers:
+        skip<TLVector<TLTopPeerCategoryPeers>>();
+        skip<TLVector<TLChat>>();
+        skip<TLVector<TLUser>>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLDialog *)
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::Dialog:
+        *this >> flags;
+        skip<TLPeer>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<TLPeerNotifySettings>();
+        if (flags & TLDialog::Pts) {
+            skip<quint32>();
+        }
+        if (flags & TLDialog::Draft) {
+            skip<TLDraftMessage>();
+        }
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLDocument *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::DocumentEmpty:
+        skip<quint64>();
+        break;
+    case TLValue::Document:
+        skip<quint64>();
+        skip<quint64>();
+        skip<quint32>();
+        skip<QString>();
+        skip<quint32>();
+        skip<TLPhotoSize>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<TLVector<TLDocumentAttribute>>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLFoundGif *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::FoundGif:
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::FoundGifCached:
+        skip<QString>();
+        skip<TLPhoto>();
+        skip<TLDocument>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLGame *)
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::Game:
+        *this >> flags;
+        skip<quint64>();
+        skip<quint64>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        skip<TLPhoto>();
+        if (flags & TLGame::Document) {
+            skip<TLDocument>();
+        }
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLHelpSupport *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::HelpSupport:
+        skip<QString>();
+        skip<TLUser>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLInputBotInlineMessage *)
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputBotInlineMessageMediaAuto:
+        *this >> flags;
+        skip<QString>();
+        if (flags & TLInputBotInlineMessage::ReplyMarkup) {
+            skip<TLReplyMarkup>();
+        }
+        break;
+    case TLValue::InputBotInlineMessageText:
+        *this >> flags;
+        skip<QString>();
+        if (flags & TLInputBotInlineMessage::Entities) {
+            skip<TLVector<TLMessageEntity>>();
+        }
+        if (flags & TLInputBotInlineMessage::ReplyMarkup) {
+            skip<TLReplyMarkup>();
+        }
+        break;
+    case TLValue::InputBotInlineMessageMediaGeo:
+        *this >> flags;
+        skip<TLInputGeoPoint>();
+        skip<quint32>();
+        if (flags & TLInputBotInlineMessage::ReplyMarkup) {
+            skip<TLReplyMarkup>();
+        }
+        break;
+    case TLValue::InputBotInlineMessageMediaVenue:
+        *this >> flags;
+        skip<TLInputGeoPoint>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        if (flags & TLInputBotInlineMessage::ReplyMarkup) {
+            skip<TLReplyMarkup>();
+        }
+        break;
+    case TLValue::InputBotInlineMessageMediaContact:
+        *this >> flags;
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        if (flags & TLInputBotInlineMessage::ReplyMarkup) {
+            skip<TLReplyMarkup>();
+        }
+        break;
+    case TLValue::InputBotInlineMessageGame:
+        *this >> flags;
+        if (flags & TLInputBotInlineMessage::ReplyMarkup) {
+            skip<TLReplyMarkup>();
+        }
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLInputBotInlineResult *)
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputBotInlineResult:
+        *this >> flags;
+        skip<QString>();
+        skip<QString>();
+        if (flags & TLInputBotInlineResult::Title) {
+            skip<QString>();
+        }
+        if (flags & TLInputBotInlineResult::Description) {
+            skip<QString>();
+        }
+        if (flags & TLInputBotInlineResult::Url) {
+            skip<QString>();
+        }
+        if (flags & TLInputBotInlineResult::ThumbUrl) {
+            skip<QString>();
+        }
+        if (flags & TLInputBotInlineResult::ContentUrl) {
+            skip<QString>();
+        }
+        if (flags & TLInputBotInlineResult::ContentType) {
+            skip<QString>();
+        }
+        if (flags & TLInputBotInlineResult::W) {
+            skip<quint32>();
+        }
+        if (flags & TLInputBotInlineResult::H) {
+            skip<quint32>();
+        }
+        if (flags & TLInputBotInlineResult::Duration) {
+            skip<quint32>();
+        }
+        skip<TLInputBotInlineMessage>();
+        break;
+    case TLValue::InputBotInlineResultPhoto:
+        skip<QString>();
+        skip<QString>();
+        skip<TLInputPhoto>();
+        skip<TLInputBotInlineMessage>();
+        break;
+    case TLValue::InputBotInlineResultDocument:
+        *this >> flags;
+        skip<QString>();
+        skip<QString>();
+        if (flags & TLInputBotInlineResult::Title) {
+            skip<QString>();
+        }
+        if (flags & TLInputBotInlineResult::Description) {
+            skip<QString>();
+        }
+        skip<TLInputDocument>();
+        skip<TLInputBotInlineMessage>();
+        break;
+    case TLValue::InputBotInlineResultGame:
+        skip<QString>();
+        skip<QString>();
+        skip<TLInputBotInlineMessage>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLInputMedia *)
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputMediaEmpty:
+        break;
+    case TLValue::InputMediaUploadedPhoto:
+        *this >> flags;
+        skip<TLInputFile>();
+        skip<QString>();
+        if (flags & TLInputMedia::Stickers) {
+            skip<TLVector<TLInputDocument>>();
+        }
+        if (flags & TLInputMedia::TtlSeconds1) {
+            skip<quint32>();
+        }
+        break;
+    case TLValue::InputMediaPhoto:
+        *this >> flags;
+        skip<TLInputPhoto>();
+        skip<QString>();
+        if (flags & TLInputMedia::TtlSeconds0) {
+            skip<quint32>();
+        }
+        break;
+    case TLValue::InputMediaGeoPoint:
+        skip<TLInputGeoPoint>();
+        break;
+    case TLValue::InputMediaContact:
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        break;
+    case TLValue::InputMediaUploadedDocument:
+        *this >> flags;
+        skip<TLInputFile>();
+        if (flags & TLInputMedia::Thumb) {
+            skip<TLInputFile>();
+        }
+        skip<QString>();
+        skip<TLVector<TLDocumentAttribute>>();
+        skip<QString>();
+        if (flags & TLInputMedia::Stickers) {
+            skip<TLVector<TLInputDocument>>();
+        }
+        if (flags & TLInputMedia::TtlSeconds1) {
+            skip<quint32>();
+        }
+        break;
+    case TLValue::InputMediaDocument:
+        *this >> flags;
+        skip<TLInputDocument>();
+        skip<QString>();
+        if (flags & TLInputMedia::TtlSeconds0) {
+            skip<quint32>();
+        }
+        break;
+    case TLValue::InputMediaVenue:
+        skip<TLInputGeoPoint>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        break;
+    case TLValue::InputMediaGifExternal:
+        skip<QString>();
+        skip<QString>();
+        break;
+    case TLValue::InputMediaPhotoExternal:
+    case TLValue::InputMediaDocumentExternal:
+        *this >> flags;
+        skip<QString>();
+        skip<QString>();
+        if (flags & TLInputMedia::TtlSeconds0) {
+            skip<quint32>();
+        }
+        break;
+    case TLValue::InputMediaGame:
+        skip<TLInputGame>();
+        break;
+    case TLValue::InputMediaInvoice:
+        *this >> flags;
+        skip<QString>();
+        skip<QString>();
+        if (flags & TLInputMedia::Photo) {
+            skip<TLInputWebDocument>();
+        }
+        skip<TLInvoice>();
+        skip<QByteArray>();
+        skip<QString>();
+        skip<QString>();
+        break;
+    case TLValue::InputMediaGeoLive:
+        skip<TLInputGeoPoint>();
+        skip<quint32>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLMessageAction *)
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessageActionEmpty:
+    case TLValue::MessageActionChatDeletePhoto:
+    case TLValue::MessageActionPinMessage:
+    case TLValue::MessageActionHistoryClear:
+    case TLValue::MessageActionScreenshotTaken:
+        break;
+    case TLValue::MessageActionChatCreate:
+        skip<QString>();
+        skip<TLVector<quint32>>();
+        break;
+    case TLValue::MessageActionChatEditTitle:
+    case TLValue::MessageActionChannelCreate:
+    case TLValue::MessageActionCustomAction:
+        skip<QString>();
+        break;
+    case TLValue::MessageActionChatEditPhoto:
+        skip<TLPhoto>();
+        break;
+    case TLValue::MessageActionChatAddUser:
+        skip<TLVector<quint32>>();
+        break;
+    case TLValue::MessageActionChatDeleteUser:
+    case TLValue::MessageActionChatJoinedByLink:
+    case TLValue::MessageActionChatMigrateTo:
+        skip<quint32>();
+        break;
+    case TLValue::MessageActionChannelMigrateFrom:
+        skip<QString>();
+        skip<quint32>();
+        break;
+    case TLValue::MessageActionGameScore:
+        skip<quint64>();
+        skip<quint32>();
+        break;
+    case TLValue::MessageActionPaymentSentMe:
+        *this >> flags;
+        skip<QString>();
+        skip<quint64>();
+        skip<QByteArray>();
+        if (flags & TLMessageAction::Info) {
+            skip<TLPaymentRequestedInfo>();
+        }
+        if (flags & TLMessageAction::ShippingOptionId) {
+            skip<QString>();
+        }
+        skip<TLPaymentCharge>();
+        break;
+    case TLValue::MessageActionPaymentSent:
+        skip<QString>();
+        skip<quint64>();
+        break;
+    case TLValue::MessageActionPhoneCall:
+        *this >> flags;
+        skip<quint64>();
+        if (flags & TLMessageAction::Reason) {
+            skip<TLPhoneCallDiscardReason>();
+        }
+        if (flags & TLMessageAction::Duration) {
+            skip<quint32>();
+        }
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLMessagesAllStickers *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessagesAllStickersNotModified:
+        break;
+    case TLValue::MessagesAllStickers:
+        skip<quint32>();
+        skip<TLVector<TLStickerSet>>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLMessagesChatFull *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessagesChatFull:
+        skip<TLChatFull>();
+        skip<TLVector<TLChat>>();
+        skip<TLVector<TLUser>>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLMessagesChats *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessagesChats:
+        skip<TLVector<TLChat>>();
+        break;
+    case TLValue::MessagesChatsSlice:
+        skip<quint32>();
+        skip<TLVector<TLChat>>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLMessagesFavedStickers *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessagesFavedStickersNotModified:
+        break;
+    case TLValue::MessagesFavedStickers:
+        skip<quint32>();
+        skip<TLVector<TLStickerPack>>();
+        skip<TLVector<TLDocument>>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLMessagesFoundGifs *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessagesFoundGifs:
+        skip<quint32>();
+        skip<TLVector<TLFoundGif>>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLMessagesHighScores *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessagesHighScores:
+        skip<TLVector<TLHighScore>>();
+        skip<TLVector<TLUser>>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLMessagesRecentStickers *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessagesRecentStickersNotModified:
+        break;
+    case TLValue::MessagesRecentStickers:
+        skip<quint32>();
+        skip<TLVector<TLDocument>>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLMessagesSavedGifs *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessagesSavedGifsNotModified:
+        break;
+    case TLValue::MessagesSavedGifs:
+        skip<quint32>();
+        skip<TLVector<TLDocument>>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLMessagesStickerSet *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessagesStickerSet:
+        skip<TLStickerSet>();
+        skip<TLVector<TLStickerPack>>();
+        skip<TLVector<TLDocument>>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLMessagesStickers *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessagesStickersNotModified:
+        break;
+    case TLValue::MessagesStickers:
+        skip<QString>();
+        skip<TLVector<TLDocument>>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLPage *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PagePart:
+    case TLValue::PageFull:
+        skip<TLVector<TLPageBlock>>();
+        skip<TLVector<TLPhoto>>();
+        skip<TLVector<TLDocument>>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLPageBlock *)
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PageBlockUnsupported:
+    case TLValue::PageBlockDivider:
+        break;
+    case TLValue::PageBlockTitle:
+    case TLValue::PageBlockSubtitle:
+    case TLValue::PageBlockHeader:
+    case TLValue::PageBlockSubheader:
+    case TLValue::PageBlockParagraph:
+    case TLValue::PageBlockFooter:
+        skip<TLRichText>();
+        break;
+    case TLValue::PageBlockAuthorDate:
+        skip<TLRichText>();
+        skip<quint32>();
+        break;
+    case TLValue::PageBlockPreformatted:
+        skip<TLRichText>();
+        skip<QString>();
+        break;
+    case TLValue::PageBlockAnchor:
+        skip<QString>();
+        break;
+    case TLValue::PageBlockList:
+        skip<bool>();
+        skip<TLVector<TLRichText>>();
+        break;
+    case TLValue::PageBlockBlockquote:
+    case TLValue::PageBlockPullquote:
+        skip<TLRichText>();
+        skip<TLRichText>();
+        break;
+    case TLValue::PageBlockPhoto:
+    case TLValue::PageBlockAudio:
+        skip<quint64>();
+        skip<TLRichText>();
+        break;
+    case TLValue::PageBlockVideo:
+        skip<quint32>();
+        skip<quint64>();
+        skip<TLRichText>();
+        break;
+    case TLValue::PageBlockCover:
+        skip<TLPageBlock>();
+        break;
+    case TLValue::PageBlockEmbed:
+        *this >> flags;
+        if (flags & TLPageBlock::Url) {
+            skip<QString>();
+        }
+        if (flags & TLPageBlock::Html) {
+            skip<QString>();
+        }
+        if (flags & TLPageBlock::PosterPhotoId) {
+            skip<quint64>();
+        }
+        skip<quint32>();
+        skip<quint32>();
+        skip<TLRichText>();
+        break;
+    case TLValue::PageBlockEmbedPost:
+        skip<QString>();
+        skip<quint64>();
+        skip<quint64>();
+        skip<QString>();
+        skip<quint32>();
+        skip<TLVector<TLPageBlock>>();
+        skip<TLRichText>();
+        break;
+    case TLValue::PageBlockCollage:
+    case TLValue::PageBlockSlideshow:
+        skip<TLVector<TLPageBlock>>();
+        skip<TLRichText>();
+        break;
+    case TLValue::PageBlockChannel:
+        skip<TLChat>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLPaymentsPaymentForm *)
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PaymentsPaymentForm:
+        *this >> flags;
+        skip<quint32>();
+        skip<TLInvoice>();
+        skip<quint32>();
+        skip<QString>();
+        if (flags & TLPaymentsPaymentForm::NativeProvider) {
+            skip<QString>();
+        }
+        if (flags & TLPaymentsPaymentForm::NativeParams) {
+            skip<TLDataJSON>();
+        }
+        if (flags & TLPaymentsPaymentForm::SavedInfo) {
+            skip<TLPaymentRequestedInfo>();
+        }
+        if (flags & TLPaymentsPaymentForm::SavedCredentials) {
+            skip<TLPaymentSavedCredentials>();
+        }
+        skip<TLVector<TLUser>>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLPaymentsPaymentReceipt *)
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PaymentsPaymentReceipt:
+        *this >> flags;
+        skip<quint32>();
+        skip<quint32>();
+        skip<TLInvoice>();
+        skip<quint32>();
+        if (flags & TLPaymentsPaymentReceipt::Info) {
+            skip<TLPaymentRequestedInfo>();
+        }
+        if (flags & TLPaymentsPaymentReceipt::Shipping) {
+            skip<TLShippingOption>();
+        }
+        skip<QString>();
+        skip<quint64>();
+        skip<QString>();
+        skip<TLVector<TLUser>>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLPhoneCall *)
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PhoneCallEmpty:
+        skip<quint64>();
+        break;
+    case TLValue::PhoneCallWaiting:
+        *this >> flags;
+        skip<quint64>();
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<TLPhoneCallProtocol>();
+        if (flags & TLPhoneCall::ReceiveDate) {
+            skip<quint32>();
+        }
+        break;
+    case TLValue::PhoneCallRequested:
+    case TLValue::PhoneCallAccepted:
+        skip<quint64>();
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<QByteArray>();
+        skip<TLPhoneCallProtocol>();
+        break;
+    case TLValue::PhoneCall:
+        skip<quint64>();
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<QByteArray>();
+        skip<quint64>();
+        skip<TLPhoneCallProtocol>();
+        skip<TLPhoneConnection>();
+        skip<TLVector<TLPhoneConnection>>();
+        skip<quint32>();
+        break;
+    case TLValue::PhoneCallDiscarded:
+        *this >> flags;
+        skip<quint64>();
+        if (flags & TLPhoneCall::Reason) {
+            skip<TLPhoneCallDiscardReason>();
+        }
+        if (flags & TLPhoneCall::Duration) {
+            skip<quint32>();
+        }
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLPhonePhoneCall *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PhonePhoneCall:
+        skip<TLPhoneCall>();
+        skip<TLVector<TLUser>>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLPhotosPhoto *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PhotosPhoto:
+        skip<TLPhoto>();
+        skip<TLVector<TLUser>>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLPhotosPhotos *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PhotosPhotos:
+        skip<TLVector<TLPhoto>>();
+        skip<TLVector<TLUser>>();
+        break;
+    case TLValue::PhotosPhotosSlice:
+        skip<quint32>();
+        skip<TLVector<TLPhoto>>();
+        skip<TLVector<TLUser>>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLStickerSetCovered *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::StickerSetCovered:
+        skip<TLStickerSet>();
+        skip<TLDocument>();
+        break;
+    case TLValue::StickerSetMultiCovered:
+        skip<TLStickerSet>();
+        skip<TLVector<TLDocument>>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLUserFull *)
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::UserFull:
+        *this >> flags;
+        skip<TLUser>();
+        if (flags & TLUserFull::About) {
+            skip<QString>();
+        }
+        skip<TLContactsLink>();
+        if (flags & TLUserFull::ProfilePhoto) {
+            skip<TLPhoto>();
+        }
+        skip<TLPeerNotifySettings>();
+        if (flags & TLUserFull::BotInfo) {
+            skip<TLBotInfo>();
+        }
+        skip<quint32>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLWebPage *)
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::WebPageEmpty:
+        skip<quint64>();
+        break;
+    case TLValue::WebPagePending:
+        skip<quint64>();
+        skip<quint32>();
+        break;
+    case TLValue::WebPage:
+        *this >> flags;
+        skip<quint64>();
+        skip<QString>();
+        skip<QString>();
+        skip<quint32>();
+        if (flags & TLWebPage::Type) {
+            skip<QString>();
+        }
+        if (flags & TLWebPage::SiteName) {
+            skip<QString>();
+        }
+        if (flags & TLWebPage::Title) {
+            skip<QString>();
+        }
+        if (flags & TLWebPage::Description) {
+            skip<QString>();
+        }
+        if (flags & TLWebPage::Photo) {
+            skip<TLPhoto>();
+        }
+        if (flags & TLWebPage::EmbedUrl) {
+            skip<QString>();
+        }
+        if (flags & TLWebPage::EmbedType) {
+            skip<QString>();
+        }
+        if (flags & TLWebPage::EmbedWidth) {
+            skip<quint32>();
+        }
+        if (flags & TLWebPage::EmbedHeight) {
+            skip<quint32>();
+        }
+        if (flags & TLWebPage::Duration) {
+            skip<quint32>();
+        }
+        if (flags & TLWebPage::Author) {
+            skip<QString>();
+        }
+        if (flags & TLWebPage::Document) {
+            skip<TLDocument>();
+        }
+        if (flags & TLWebPage::CachedPage) {
+            skip<TLPage>();
+        }
+        break;
+    case TLValue::WebPageNotModified:
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLBotInlineResult *)
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::BotInlineResult:
+        *this >> flags;
+        skip<QString>();
+        skip<QString>();
+        if (flags & TLBotInlineResult::Title1) {
+            skip<QString>();
+        }
+        if (flags & TLBotInlineResult::Description2) {
+            skip<QString>();
+        }
+        if (flags & TLBotInlineResult::Url) {
+            skip<QString>();
+        }
+        if (flags & TLBotInlineResult::ThumbUrl) {
+            skip<QString>();
+        }
+        if (flags & TLBotInlineResult::ContentUrl) {
+            skip<QString>();
+        }
+        if (flags & TLBotInlineResult::ContentType) {
+            skip<QString>();
+        }
+        if (flags & TLBotInlineResult::W) {
+            skip<quint32>();
+        }
+        if (flags & TLBotInlineResult::H) {
+            skip<quint32>();
+        }
+        if (flags & TLBotInlineResult::Duration) {
+            skip<quint32>();
+        }
+        skip<TLBotInlineMessage>();
+        break;
+    case TLValue::BotInlineMediaResult:
+        *this >> flags;
+        skip<QString>();
+        skip<QString>();
+        if (flags & TLBotInlineResult::Photo) {
+            skip<TLPhoto>();
+        }
+        if (flags & TLBotInlineResult::Document) {
+            skip<TLDocument>();
+        }
+        if (flags & TLBotInlineResult::Title2) {
+            skip<QString>();
+        }
+        if (flags & TLBotInlineResult::Description3) {
+            skip<QString>();
+        }
+        skip<TLBotInlineMessage>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLMessageMedia *)
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessageMediaEmpty:
+    case TLValue::MessageMediaUnsupported:
+        break;
+    case TLValue::MessageMediaPhoto:
+        *this >> flags;
+        if (flags & TLMessageMedia::Photo) {
+            skip<TLPhoto>();
+        }
+        if (flags & TLMessageMedia::Caption) {
+            skip<QString>();
+        }
+        if (flags & TLMessageMedia::TtlSeconds) {
+            skip<quint32>();
+        }
+        break;
+    case TLValue::MessageMediaGeo:
+        skip<TLGeoPoint>();
+        break;
+    case TLValue::MessageMediaContact:
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        skip<quint32>();
+        break;
+    case TLValue::MessageMediaDocument:
+        *this >> flags;
+        if (flags & TLMessageMedia::Document) {
+            skip<TLDocument>();
+        }
+        if (flags & TLMessageMedia::Caption) {
+            skip<QString>();
+        }
+        if (flags & TLMessageMedia::TtlSeconds) {
+            skip<quint32>();
+        }
+        break;
+    case TLValue::MessageMediaWebPage:
+        skip<TLWebPage>();
+        break;
+    case TLValue::MessageMediaVenue:
+        skip<TLGeoPoint>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        break;
+    case TLValue::MessageMediaGame:
+        skip<TLGame>();
+        break;
+    case TLValue::MessageMediaInvoice:
+        *this >> flags;
+        skip<QString>();
+        skip<QString>();
+        if (flags & TLMessageMedia::WebDocumentPhoto) {
+            skip<TLWebDocument>();
+        }
+        if (flags & TLMessageMedia::ReceiptMsgId) {
+            skip<quint32>();
+        }
+        skip<QString>();
+        skip<quint64>();
+        skip<QString>();
+        break;
+    case TLValue::MessageMediaGeoLive:
+        skip<TLGeoPoint>();
+        skip<quint32>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLMessagesArchivedStickers *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessagesArchivedStickers:
+        skip<quint32>();
+        skip<TLVector<TLStickerSetCovered>>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLMessagesBotResults *)
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessagesBotResults:
+        *this >> flags;
+        skip<quint64>();
+        if (flags & TLMessagesBotResults::NextOffset) {
+            skip<QString>();
+        }
+        if (flags & TLMessagesBotResults::SwitchPm) {
+            skip<TLInlineBotSwitchPM>();
+        }
+        skip<TLVector<TLBotInlineResult>>();
+        skip<quint32>();
+        skip<TLVector<TLUser>>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLMessagesFeaturedStickers *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessagesFeaturedStickersNotModified:
+        break;
+    case TLValue::MessagesFeaturedStickers:
+        skip<quint32>();
+        skip<TLVector<TLStickerSetCovered>>();
+        skip<TLVector<quint64>>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLMessagesStickerSetInstallResult *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessagesStickerSetInstallResultSuccess:
+        break;
+    case TLValue::MessagesStickerSetInstallResultArchive:
+        skip<TLVector<TLStickerSetCovered>>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLRecentMeUrl *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::RecentMeUrlUnknown:
+        skip<QString>();
+        break;
+    case TLValue::RecentMeUrlUser:
+    case TLValue::RecentMeUrlChat:
+        skip<QString>();
+        skip<quint32>();
+        break;
+    case TLValue::RecentMeUrlChatInvite:
+        skip<QString>();
+        skip<TLChatInvite>();
+        break;
+    case TLValue::RecentMeUrlStickerSet:
+        skip<QString>();
+        skip<TLStickerSetCovered>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLHelpRecentMeUrls *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::HelpRecentMeUrls:
+        skip<TLVector<TLRecentMeUrl>>();
+        skip<TLVector<TLChat>>();
+        skip<TLVector<TLUser>>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLMessage *)
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessageEmpty:
+        skip<quint32>();
+        break;
+    case TLValue::Message:
+        *this >> flags;
+        skip<quint32>();
+        if (flags & TLMessage::FromId) {
+            skip<quint32>();
+        }
+        skip<TLPeer>();
+        if (flags & TLMessage::FwdFrom) {
+            skip<TLMessageFwdHeader>();
+        }
+        if (flags & TLMessage::ViaBotId) {
+            skip<quint32>();
+        }
+        if (flags & TLMessage::ReplyToMsgId) {
+            skip<quint32>();
+        }
+        skip<quint32>();
+        skip<QString>();
+        if (flags & TLMessage::Media) {
+            skip<TLMessageMedia>();
+        }
+        if (flags & TLMessage::ReplyMarkup) {
+            skip<TLReplyMarkup>();
+        }
+        if (flags & TLMessage::Entities) {
+            skip<TLVector<TLMessageEntity>>();
+        }
+        if (flags & TLMessage::Views) {
+            skip<quint32>();
+        }
+        if (flags & TLMessage::EditDate) {
+            skip<quint32>();
+        }
+        if (flags & TLMessage::PostAuthor) {
+            skip<QString>();
+        }
+        break;
+    case TLValue::MessageService:
+        *this >> flags;
+        skip<quint32>();
+        if (flags & TLMessage::FromId) {
+            skip<quint32>();
+        }
+        skip<TLPeer>();
+        if (flags & TLMessage::ReplyToMsgId) {
+            skip<quint32>();
+        }
+        skip<quint32>();
+        skip<TLMessageAction>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLMessagesDialogs *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessagesDialogs:
+        skip<TLVector<TLDialog>>();
+        skip<TLVector<TLMessage>>();
+        skip<TLVector<TLChat>>();
+        skip<TLVector<TLUser>>();
+        break;
+    case TLValue::MessagesDialogsSlice:
+        skip<quint32>();
+        skip<TLVector<TLDialog>>();
+        skip<TLVector<TLMessage>>();
+        skip<TLVector<TLChat>>();
+        skip<TLVector<TLUser>>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLMessagesMessages *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessagesMessages:
+        skip<TLVector<TLMessage>>();
+        skip<TLVector<TLChat>>();
+        skip<TLVector<TLUser>>();
+        break;
+    case TLValue::MessagesMessagesSlice:
+        skip<quint32>();
+        skip<TLVector<TLMessage>>();
+        skip<TLVector<TLChat>>();
+        skip<TLVector<TLUser>>();
+        break;
+    case TLValue::MessagesChannelMessages:
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<TLVector<TLMessage>>();
+        skip<TLVector<TLChat>>();
+        skip<TLVector<TLUser>>();
+        break;
+    case TLValue::MessagesMessagesNotModified:
+        skip<quint32>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLMessagesPeerDialogs *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessagesPeerDialogs:
+        skip<TLVector<TLDialog>>();
+        skip<TLVector<TLMessage>>();
+        skip<TLVector<TLChat>>();
+        skip<TLVector<TLUser>>();
+        skip<TLUpdatesState>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLUpdate *)
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::UpdateNewMessage:
+    case TLValue::UpdateNewChannelMessage:
+    case TLValue::UpdateEditChannelMessage:
+    case TLValue::UpdateEditMessage:
+        skip<TLMessage>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::UpdateMessageID:
+        skip<quint32>();
+        skip<quint64>();
+        break;
+    case TLValue::UpdateDeleteMessages:
+    case TLValue::UpdateReadMessagesContents:
+        skip<TLVector<quint32>>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::UpdateUserTyping:
+        skip<quint32>();
+        skip<TLSendMessageAction>();
+        break;
+    case TLValue::UpdateChatUserTyping:
+        skip<quint32>();
+        skip<quint32>();
+        skip<TLSendMessageAction>();
+        break;
+    case TLValue::UpdateChatParticipants:
+        skip<TLChatParticipants>();
+        break;
+    case TLValue::UpdateUserStatus:
+        skip<quint32>();
+        skip<TLUserStatus>();
+        break;
+    case TLValue::UpdateUserName:
+        skip<quint32>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        break;
+    case TLValue::UpdateUserPhoto:
+        skip<quint32>();
+        skip<quint32>();
+        skip<TLUserProfilePhoto>();
+        skip<bool>();
+        break;
+    case TLValue::UpdateContactRegistered:
+    case TLValue::UpdateReadChannelInbox:
+    case TLValue::UpdateChannelPinnedMessage:
+    case TLValue::UpdateReadChannelOutbox:
+    case TLValue::UpdateChannelAvailableMessages:
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::UpdateContactLink:
+        skip<quint32>();
+        skip<TLContactLink>();
+        skip<TLContactLink>();
+        break;
+    case TLValue::UpdateNewEncryptedMessage:
+        skip<TLEncryptedMessage>();
+        skip<quint32>();
+        break;
+    case TLValue::UpdateEncryptedChatTyping:
+    case TLValue::UpdateChannel:
+        skip<quint32>();
+        break;
+    case TLValue::UpdateEncryption:
+        skip<TLEncryptedChat>();
+        skip<quint32>();
+        break;
+    case TLValue::UpdateEncryptedMessagesRead:
+    case TLValue::UpdateChatParticipantDelete:
+    case TLValue::UpdateChannelMessageViews:
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::UpdateChatParticipantAdd:
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::UpdateDcOptions:
+        skip<TLVector<TLDcOption>>();
+        break;
+    case TLValue::UpdateUserBlocked:
+        skip<quint32>();
+        skip<bool>();
+        break;
+    case TLValue::UpdateNotifySettings:
+        skip<TLNotifyPeer>();
+        skip<TLPeerNotifySettings>();
+        break;
+    case TLValue::UpdateServiceNotification:
+        *this >> flags;
+        if (flags & TLUpdate::InboxDate) {
+            skip<quint32>();
+        }
+        skip<QString>();
+        skip<QString>();
+        skip<TLMessageMedia>();
+        skip<TLVector<TLMessageEntity>>();
+        break;
+    case TLValue::UpdatePrivacy:
+        skip<TLPrivacyKey>();
+        skip<TLVector<TLPrivacyRule>>();
+        break;
+    case TLValue::UpdateUserPhone:
+        skip<quint32>();
+        skip<QString>();
+        break;
+    case TLValue::UpdateReadHistoryInbox:
+    case TLValue::UpdateReadHistoryOutbox:
+        skip<TLPeer>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::UpdateWebPage:
+        skip<TLWebPage>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::UpdateChannelTooLong:
+        *this >> flags;
+        skip<quint32>();
+        if (flags & TLUpdate::Pts) {
+            skip<quint32>();
+        }
+        break;
+    case TLValue::UpdateDeleteChannelMessages:
+        skip<quint32>();
+        skip<TLVector<quint32>>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::UpdateChatAdmins:
+        skip<quint32>();
+        skip<bool>();
+        skip<quint32>();
+        break;
+    case TLValue::UpdateChatParticipantAdmin:
+        skip<quint32>();
+        skip<quint32>();
+        skip<bool>();
+        skip<quint32>();
+        break;
+    case TLValue::UpdateNewStickerSet:
+        skip<TLMessagesStickerSet>();
+        break;
+    case TLValue::UpdateStickerSetsOrder:
+        skip<quint32>();
+        skip<TLVector<quint64>>();
+        break;
+    case TLValue::UpdateStickerSets:
+    case TLValue::UpdateSavedGifs:
+    case TLValue::UpdateReadFeaturedStickers:
+    case TLValue::UpdateRecentStickers:
+    case TLValue::UpdateConfig:
+    case TLValue::UpdatePtsChanged:
+    case TLValue::UpdateLangPackTooLong:
+    case TLValue::UpdateFavedStickers:
+    case TLValue::UpdateContactsReset:
+        break;
+    case TLValue::UpdateBotInlineQuery:
+        *this >> flags;
+        skip<quint64>();
+        skip<quint32>();
+        skip<QString>();
+        if (flags & TLUpdate::Geo) {
+            skip<TLGeoPoint>();
+        }
+        skip<QString>();
+        break;
+    case TLValue::UpdateBotInlineSend:
+        *this >> flags;
+        skip<quint32>();
+        skip<QString>();
+        if (flags & TLUpdate::Geo) {
+            skip<TLGeoPoint>();
+        }
+        skip<QString>();
+        if (flags & TLUpdate::InputBotInlineMessageIDMsgId) {
+            skip<TLInputBotInlineMessageID>();
+        }
+        break;
+    case TLValue::UpdateBotCallbackQuery:
+        *this >> flags;
+        skip<quint64>();
+        skip<quint32>();
+        skip<TLPeer>();
+        skip<quint32>();
+        skip<quint64>();
+        if (flags & TLUpdate::ByteArrayData) {
+            skip<QByteArray>();
+        }
+        if (flags & TLUpdate::GameShortName) {
+            skip<QString>();
+        }
+        break;
+    case TLValue::UpdateInlineBotCallbackQuery:
+        *this >> flags;
+        skip<quint64>();
+        skip<quint32>();
+        skip<TLInputBotInlineMessageID>();
+        skip<quint64>();
+        if (flags & TLUpdate::ByteArrayData) {
+            skip<QByteArray>();
+        }
+        if (flags & TLUpdate::GameShortName) {
+            skip<QString>();
+        }
+        break;
+    case TLValue::UpdateDraftMessage:
+        skip<TLPeer>();
+        skip<TLDraftMessage>();
+        break;
+    case TLValue::UpdateChannelWebPage:
+        skip<quint32>();
+        skip<TLWebPage>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::UpdateDialogPinned:
+        skip<quint32>();
+        skip<TLPeer>();
+        break;
+    case TLValue::UpdatePinnedDialogs:
+        *this >> flags;
+        if (flags & TLUpdate::PeerOrderVector) {
+            skip<TLVector<TLPeer>>();
+        }
+        break;
+    case TLValue::UpdateBotWebhookJSON:
+        skip<TLDataJSON>();
+        break;
+    case TLValue::UpdateBotWebhookJSONQuery:
+        skip<quint64>();
+        skip<TLDataJSON>();
+        skip<quint32>();
+        break;
+    case TLValue::UpdateBotShippingQuery:
+        skip<quint64>();
+        skip<quint32>();
+        skip<QByteArray>();
+        skip<TLPostAddress>();
+        break;
+    case TLValue::UpdateBotPrecheckoutQuery:
+        *this >> flags;
+        skip<quint64>();
+        skip<quint32>();
+        skip<QByteArray>();
+        if (flags & TLUpdate::Info) {
+            skip<TLPaymentRequestedInfo>();
+        }
+        if (flags & TLUpdate::ShippingOptionId) {
+            skip<QString>();
+        }
+        skip<QString>();
+        skip<quint64>();
+        break;
+    case TLValue::UpdatePhoneCall:
+        skip<TLPhoneCall>();
+        break;
+    case TLValue::UpdateLangPack:
+        skip<TLLangPackDifference>();
+        break;
+    case TLValue::UpdateChannelReadMessagesContents:
+        skip<quint32>();
+        skip<TLVector<quint32>>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLUpdates *)
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::UpdatesTooLong:
+        break;
+    case TLValue::UpdateShortMessage:
+        *this >> flags;
+        skip<quint32>();
+        skip<quint32>();
+        skip<QString>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        if (flags & TLUpdates::FwdFrom) {
+            skip<TLMessageFwdHeader>();
+        }
+        if (flags & TLUpdates::ViaBotId) {
+            skip<quint32>();
+        }
+        if (flags & TLUpdates::ReplyToMsgId) {
+            skip<quint32>();
+        }
+        if (flags & TLUpdates::Entities) {
+            skip<TLVector<TLMessageEntity>>();
+        }
+        break;
+    case TLValue::UpdateShortChatMessage:
+        *this >> flags;
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<QString>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        if (flags & TLUpdates::FwdFrom) {
+            skip<TLMessageFwdHeader>();
+        }
+        if (flags & TLUpdates::ViaBotId) {
+            skip<quint32>();
+        }
+        if (flags & TLUpdates::ReplyToMsgId) {
+            skip<quint32>();
+        }
+        if (flags & TLUpdates::Entities) {
+            skip<TLVector<TLMessageEntity>>();
+        }
+        break;
+    case TLValue::UpdateShort:
+        skip<TLUpdate>();
+        skip<quint32>();
+        break;
+    case TLValue::UpdatesCombined:
+        skip<TLVector<TLUpdate>>();
+        skip<TLVector<TLUser>>();
+        skip<TLVector<TLChat>>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::Updates:
+        skip<TLVector<TLUpdate>>();
+        skip<TLVector<TLUser>>();
+        skip<TLVector<TLChat>>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::UpdateShortSentMessage:
+        *this >> flags;
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        if (flags & TLUpdates::Media) {
+            skip<TLMessageMedia>();
+        }
+        if (flags & TLUpdates::Entities) {
+            skip<TLVector<TLMessageEntity>>();
+        }
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLUpdatesChannelDifference *)
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::UpdatesChannelDifferenceEmpty:
+        *this >> flags;
+        skip<quint32>();
+        if (flags & TLUpdatesChannelDifference::Timeout) {
+            skip<quint32>();
+        }
+        break;
+    case TLValue::UpdatesChannelDifferenceTooLong:
+        *this >> flags;
+        skip<quint32>();
+        if (flags & TLUpdatesChannelDifference::Timeout) {
+            skip<quint32>();
+        }
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<TLVector<TLMessage>>();
+        skip<TLVector<TLChat>>();
+        skip<TLVector<TLUser>>();
+        break;
+    case TLValue::UpdatesChannelDifference:
+        *this >> flags;
+        skip<quint32>();
+        if (flags & TLUpdatesChannelDifference::Timeout) {
+            skip<quint32>();
+        }
+        skip<TLVector<TLMessage>>();
+        skip<TLVector<TLUpdate>>();
+        skip<TLVector<TLChat>>();
+        skip<TLVector<TLUser>>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLUpdatesDifference *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::UpdatesDifferenceEmpty:
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::UpdatesDifference:
+    case TLValue::UpdatesDifferenceSlice:
+        skip<TLVector<TLMessage>>();
+        skip<TLVector<TLEncryptedMessage>>();
+        skip<TLVector<TLUpdate>>();
+        skip<TLVector<TLChat>>();
+        skip<TLVector<TLUser>>();
+        skip<TLUpdatesState>();
+        break;
+    case TLValue::UpdatesDifferenceTooLong:
+        skip<quint32>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLChannelAdminLogEventAction *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ChannelAdminLogEventActionChangeTitle:
+    case TLValue::ChannelAdminLogEventActionChangeAbout:
+    case TLValue::ChannelAdminLogEventActionChangeUsername:
+        skip<QString>();
+        skip<QString>();
+        break;
+    case TLValue::ChannelAdminLogEventActionChangePhoto:
+        skip<TLChatPhoto>();
+        skip<TLChatPhoto>();
+        break;
+    case TLValue::ChannelAdminLogEventActionToggleInvites:
+    case TLValue::ChannelAdminLogEventActionToggleSignatures:
+    case TLValue::ChannelAdminLogEventActionTogglePreHistoryHidden:
+        skip<bool>();
+        break;
+    case TLValue::ChannelAdminLogEventActionUpdatePinned:
+    case TLValue::ChannelAdminLogEventActionDeleteMessage:
+        skip<TLMessage>();
+        break;
+    case TLValue::ChannelAdminLogEventActionEditMessage:
+        skip<TLMessage>();
+        skip<TLMessage>();
+        break;
+    case TLValue::ChannelAdminLogEventActionParticipantJoin:
+    case TLValue::ChannelAdminLogEventActionParticipantLeave:
+        break;
+    case TLValue::ChannelAdminLogEventActionParticipantInvite:
+        skip<TLChannelParticipant>();
+        break;
+    case TLValue::ChannelAdminLogEventActionParticipantToggleBan:
+    case TLValue::ChannelAdminLogEventActionParticipantToggleAdmin:
+        skip<TLChannelParticipant>();
+        skip<TLChannelParticipant>();
+        break;
+    case TLValue::ChannelAdminLogEventActionChangeStickerSet:
+        skip<TLInputStickerSet>();
+        skip<TLInputStickerSet>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLPaymentsPaymentResult *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PaymentsPaymentResult:
+        skip<TLUpdates>();
+        break;
+    case TLValue::PaymentsPaymentVerficationNeeded:
+        skip<QString>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLChannelAdminLogEvent *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ChannelAdminLogEvent:
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<TLChannelAdminLogEventAction>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+
+Stream &Stream::skipValue(TLChannelsAdminLogResults *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ChannelsAdminLogResults:
+        skip<TLVector<TLChannelAdminLogEvent>>();
+        skip<TLVector<TLChat>>();
+        skip<TLVector<TLUser>>();
+        break;
+    default:
+        // The value size is unknown
+        setError(true);
+        break;
+    }
+
+    return *this;
+}
+// End of generated skip implementation
+
 } // MTProto namespace
 
 } // Telegram namespace
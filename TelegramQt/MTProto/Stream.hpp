@@ -29,6 +29,8 @@ namespace Telegram {
 
 namespace MTProto {
 
+class Arena;
+
 class TELEGRAMQT_INTERNAL_EXPORT Stream : public RawStreamEx
 {
 public:
@@ -36,12 +38,20 @@ public:
     using RawStreamEx::operator <<;
     using RawStreamEx::operator >>;
 
+    // The arena to allocate the decoded TLPtr and TLVector<T*> nodes from (the heap is used if not set).
+    // The nodes are owned by the arena, so the decoded values must not outlive it.
+    Arena *arena() const { return m_arena; }
+    void setArena(Arena *arena) { m_arena = arena; }
+
     Stream &operator>>(TLValue::Value &v);
     Stream &operator<<(const TLValue::Value v);
 
     Stream &operator>>(TLValue &v);
     Stream &operator<<(const TLValue v);
 
+    template <typename TL>
+    Stream &operator>>(TLCompactValue<TL> &v);
+
     Stream &operator>>(QString &str);
     Stream &operator<<(const QString &str);
 
@@ -70,6 +80,24 @@ public:
     template <typename T>
     Stream &operator>>(TLPtr<T> &v);
 
+    // Skips an encoded value of the type T without decoding it.
+    // The skipValue() pointer argument only selects the overload and is never dereferenced.
+    template <typename T>
+    Stream &skip() { return skipValue(static_cast<T *>(nullptr)); }
+
+    Stream &skipValue(quint32 *) { skipBytes(sizeof(quint32)); return *this; }
+    Stream &skipValue(quint64 *) { skipBytes(sizeof(quint64)); return *this; }
+    Stream &skipValue(double *) { skipBytes(sizeof(double)); return *this; }
+    Stream &skipValue(bool *) { skipBytes(sizeof(quint32)); return *this; }
+    Stream &skipValue(TLValue *) { skipBytes(sizeof(quint32)); return *this; }
+    Stream &skipValue(QByteArray *);
+    Stream &skipValue(QString *);
+
+    template <int Size>
+    Stream &skipValue(TLNumber<Size> *) { skipBytes(Size / 8); return *this; }
+    template <typename T>
+    Stream &skipValue(TLVector<T> *);
+
     // Generated read operators
     Stream &operator>>(TLAccountDaysTTL &accountDaysTTLValue);
     Stream &operator>>(TLAccountPassword &accountPasswordValue);
@@ -357,6 +385,238 @@ public:
     Stream &operator<<(const TLInputBotInlineResult &inputBotInlineResultValue);
     Stream &operator<<(const TLInputMedia &inputMediaValue);
     // End of generated write operators
+
+    // Generated skip methods
+    Stream &skipValue(TLAccountDaysTTL *);
+    Stream &skipValue(TLAccountPassword *);
+    Stream &skipValue(TLAccountPasswordInputSettings *);
+    Stream &skipValue(TLAccountPasswordSettings *);
+    Stream &skipValue(TLAccountTmpPassword *);
+    Stream &skipValue(TLAuthCheckedPhone *);
+    Stream &skipValue(TLAuthCodeType *);
+    Stream &skipValue(TLAuthExportedAuthorization *);
+    Stream &skipValue(TLAuthPasswordRecovery *);
+    Stream &skipValue(TLAuthSentCodeType *);
+    Stream &skipValue(TLAuthorization *);
+    Stream &skipValue(TLBadMsgNotification *);
+    Stream &skipValue(TLBotCommand *);
+    Stream &skipValue(TLBotInfo *);
+    Stream &skipValue(TLCdnFileHash *);
+    Stream &skipValue(TLCdnPublicKey *);
+    Stream &skipValue(TLChannelParticipantsFilter *);
+    Stream &skipValue(TLChatParticipant *);
+    Stream &skipValue(TLChatParticipants *);
+    Stream &skipValue(TLClientDHInnerData *);
+    Stream &skipValue(TLContact *);
+    Stream &skipValue(TLContactBlocked *);
+    Stream &skipValue(TLContactLink *);
+    Stream &skipValue(TLDataJSON *);
+    Stream &skipValue(TLDestroyAuthKeyRes *);
+    Stream &skipValue(TLDestroySessionRes *);
+    Stream &skipValue(TLDisabledFeature *);
+    Stream &skipValue(TLEncryptedChat *);
+    Stream &skipValue(TLEncryptedFile *);
+    Stream &skipValue(TLEncryptedMessage *);
+    Stream &skipValue(TLError *);
+    Stream &skipValue(TLExportedChatInvite *);
+    Stream &skipValue(TLExportedMessageLink *);
+    Stream &skipValue(TLFileLocation *);
+    Stream &skipValue(TLFutureSalt *);
+    Stream &skipValue(TLFutureSalts *);
+    Stream &skipValue(TLGeoPoint *);
+    Stream &skipValue(TLHelpAppUpdate *);
+    Stream &skipValue(TLHelpInviteText *);
+    Stream &skipValue(TLHelpTermsOfService *);
+    Stream &skipValue(TLHighScore *);
+    Stream &skipValue(TLHttpWait *);
+    Stream &skipValue(TLImportedContact *);
+    Stream &skipValue(TLInlineBotSwitchPM *);
+    Stream &skipValue(TLInputAppEvent *);
+    Stream &skipValue(TLInputBotInlineMessageID *);
+    Stream &skipValue(TLInputChannel *);
+    Stream &skipValue(TLInputContact *);
+    Stream &skipValue(TLInputDocument *);
+    Stream &skipValue(TLInputEncryptedChat *);
+    Stream &skipValue(TLInputEncryptedFile *);
+    Stream &skipValue(TLInputFile *);
+    Stream &skipValue(TLInputFileLocation *);
+    Stream &skipValue(TLInputGeoPoint *);
+    Stream &skipValue(TLInputPeer *);
+    Stream &skipValue(TLInputPeerNotifyEvents *);
+    Stream &skipValue(TLInputPhoneCall *);
+    Stream &skipValue(TLInputPhoto *);
+    Stream &skipValue(TLInputPrivacyKey *);
+    Stream &skipValue(TLInputStickerSet *);
+    Stream &skipValue(TLInputStickeredMedia *);
+    Stream &skipValue(TLInputUser *);
+    Stream &skipValue(TLInputWebFileLocation *);
+    Stream &skipValue(TLIpPort *);
+    Stream &skipValue(TLLabeledPrice *);
+    Stream &skipValue(TLLangPackLanguage *);
+    Stream &skipValue(TLLangPackString *);
+    Stream &skipValue(TLMaskCoords *);
+    Stream &skipValue(TLMessageEntity *);
+    Stream &skipValue(TLMessageFwdHeader *);
+    Stream &skipValue(TLMessageRange *);
+    Stream &skipValue(TLMessagesAffectedHistory *);
+    Stream &skipValue(TLMessagesAffectedMessages *);
+    Stream &skipValue(TLMessagesDhConfig *);
+    Stream &skipValue(TLMessagesSentEncryptedMessage *);
+    Stream &skipValue(TLMsgDetailedInfo *);
+    Stream &skipValue(TLMsgResendReq *);
+    Stream &skipValue(TLMsgsAck *);
+    Stream &skipValue(TLMsgsAllInfo *);
+    Stream &skipValue(TLMsgsStateInfo *);
+    Stream &skipValue(TLMsgsStateReq *);
+    Stream &skipValue(TLNearestDc *);
+    Stream &skipValue(TLNewSession *);
+    Stream &skipValue(TLPQInnerData *);
+    Stream &skipValue(TLPaymentCharge *);
+    Stream &skipValue(TLPaymentSavedCredentials *);
+    Stream &skipValue(TLPeer *);
+    Stream &skipValue(TLPeerNotifyEvents *);
+    Stream &skipValue(TLPhoneCallDiscardReason *);
+    Stream &skipValue(TLPhoneConnection *);
+    Stream &skipValue(TLPhotoSize *);
+    Stream &skipValue(TLPong *);
+    Stream &skipValue(TLPopularContact *);
+    Stream &skipValue(TLPostAddress *);
+    Stream &skipValue(TLPrivacyKey *);
+    Stream &skipValue(TLPrivacyRule *);
+    Stream &skipValue(TLReceivedNotifyMessage *);
+    Stream &skipValue(TLReportReason *);
+    Stream &skipValue(TLResPQ *);
+    Stream &skipValue(TLRichText *);
+    Stream &skipValue(TLRpcDropAnswer *);
+    Stream &skipValue(TLRpcError *);
+    Stream &skipValue(TLSendMessageAction *);
+    Stream &skipValue(TLServerDHInnerData *);
+    Stream &skipValue(TLServerDHParams *);
+    Stream &skipValue(TLSetClientDHParamsAnswer *);
+    Stream &skipValue(TLShippingOption *);
+    Stream &skipValue(TLStickerPack *);
+    Stream &skipValue(TLStorageFileType *);
+    Stream &skipValue(TLTopPeer *);
+    Stream &skipValue(TLTopPeerCategory *);
+    Stream &skipValue(TLTopPeerCategoryPeers *);
+    Stream &skipValue(TLUpdatesState *);
+    Stream &skipValue(TLUploadCdnFile *);
+    Stream &skipValue(TLUploadFile *);
+    Stream &skipValue(TLUploadWebFile *);
+    Stream &skipValue(TLUserProfilePhoto *);
+    Stream &skipValue(TLUserStatus *);
+    Stream &skipValue(TLWallPaper *);
+    Stream &skipValue(TLAccountAuthorizations *);
+    Stream &skipValue(TLAuthSentCode *);
+    Stream &skipValue(TLCdnConfig *);
+    Stream &skipValue(TLChannelAdminLogEventsFilter *);
+    Stream &skipValue(TLChannelAdminRights *);
+    Stream &skipValue(TLChannelBannedRights *);
+    Stream &skipValue(TLChannelMessagesFilter *);
+    Stream &skipValue(TLChannelParticipant *);
+    Stream &skipValue(TLChatPhoto *);
+    Stream &skipValue(TLContactStatus *);
+    Stream &skipValue(TLDcOption *);
+    Stream &skipValue(TLDocumentAttribute *);
+    Stream &skipValue(TLDraftMessage *);
+    Stream &skipValue(TLHelpConfigSimple *);
+    Stream &skipValue(TLInputChatPhoto *);
+    Stream &skipValue(TLInputGame *);
+    Stream &skipValue(TLInputNotifyPeer *);
+    Stream &skipValue(TLInputPaymentCredentials *);
+    Stream &skipValue(TLInputPeerNotifySettings *);
+    Stream &skipValue(TLInputPrivacyRule *);
+    Stream &skipValue(TLInputStickerSetItem *);
+    Stream &skipValue(TLInputWebDocument *);
+    Stream &skipValue(TLInvoice *);
+    Stream &skipValue(TLKeyboardButton *);
+    Stream &skipValue(TLKeyboardButtonRow *);
+    Stream &skipValue(TLLangPackDifference *);
+    Stream &skipValue(TLMessagesBotCallbackAnswer *);
+    Stream &skipValue(TLMessagesFilter *);
+    Stream &skipValue(TLMessagesMessageEditData *);
+    Stream &skipValue(TLNotifyPeer *);
+    Stream &skipValue(TLPaymentRequestedInfo *);
+    Stream &skipValue(TLPaymentsSavedInfo *);
+    Stream &skipValue(TLPaymentsValidatedRequestedInfo *);
+    Stream &skipValue(TLPeerNotifySettings *);
+    Stream &skipValue(TLPeerSettings *);
+    Stream &skipValue(TLPhoneCallProtocol *);
+    Stream &skipValue(TLPhoto *);
+    Stream &skipValue(TLReplyMarkup *);
+    Stream &skipValue(TLStickerSet *);
+    Stream &skipValue(TLUser *);
+    Stream &skipValue(TLWebDocument *);
+    Stream &skipValue(TLAccountPrivacyRules *);
+    Stream &skipValue(TLAuthAuthorization *);
+    Stream &skipValue(TLBotInlineMessage *);
+    Stream &skipValue(TLChannelsChannelParticipant *);
+    Stream &skipValue(TLChannelsChannelParticipants *);
+    Stream &skipValue(TLChat *);
+    Stream &skipValue(TLChatFull *);
+    Stream &skipValue(TLChatInvite *);
+    Stream &skipValue(TLConfig *);
+    Stream &skipValue(TLContactsBlocked *);
+    Stream &skipValue(TLContactsContacts *);
+    Stream &skipValue(TLContactsFound *);
+    Stream &skipValue(TLContactsImportedContacts *);
+    Stream &skipValue(TLContactsLink *);
+    Stream &skipValue(TLContactsResolvedPeer *);
+    Stream &skipValue(TLContactsTopPeers *);
+    Stream &skipValue(TLDialog *);
+    Stream &skipValue(TLDocument *);
+    Stream &skipValue(TLFoundGif *);
+    Stream &skipValue(TLGame *);
+    Stream &skipValue(TLHelpSupport *);
+    Stream &skipValue(TLInputBotInlineMessage *);
+    Stream &skipValue(TLInputBotInlineResult *);
+    Stream &skipValue(TLInputMedia *);
+    Stream &skipValue(TLMessageAction *);
+    Stream &skipValue(TLMessagesAllStickers *);
+    Stream &skipValue(TLMessagesChatFull *);
+    Stream &skipValue(TLMessagesChats *);
+    Stream &skipValue(TLMessagesFavedStickers *);
+    Stream &skipValue(TLMessagesFoundGifs *);
+    Stream &skipValue(TLMessagesHighScores *);
+    Stream &skipValue(TLMessagesRecentStickers *);
+    Stream &skipValue(TLMessagesSavedGifs *);
+    Stream &skipValue(TLMessagesStickerSet *);
+    Stream &skipValue(TLMessagesStickers *);
+    Stream &skipValue(TLPage *);
+    Stream &skipValue(TLPageBlock *);
+    Stream &skipValue(TLPaymentsPaymentForm *);
+    Stream &skipValue(TLPaymentsPaymentReceipt *);
+    Stream &skipValue(TLPhoneCall *);
+    Stream &skipValue(TLPhonePhoneCall *);
+    Stream &skipValue(TLPhotosPhoto *);
+    Stream &skipValue(TLPhotosPhotos *);
+    Stream &skipValue(TLStickerSetCovered *);
+    Stream &skipValue(TLUserFull *);
+    Stream &skipValue(TLWebPage *);
+    Stream &skipValue(TLBotInlineResult *);
+    Stream &skipValue(TLMessageMedia *);
+    Stream &skipValue(TLMessagesArchivedStickers *);
+    Stream &skipValue(TLMessagesBotResults *);
+    Stream &skipValue(TLMessagesFeaturedStickers *);
+    Stream &skipValue(TLMessagesStickerSetInstallResult *);
+    Stream &skipValue(TLRecentMeUrl *);
+    Stream &skipValue(TLHelpRecentMeUrls *);
+    Stream &skipValue(TLMessage *);
+    Stream &skipValue(TLMessagesDialogs *);
+    Stream &skipValue(TLMessagesMessages *);
+    Stream &skipValue(TLMessagesPeerDialogs *);
+    Stream &skipValue(TLUpdate *);
+    Stream &skipValue(TLUpdates *);
+    Stream &skipValue(TLUpdatesChannelDifference *);
+    Stream &skipValue(TLUpdatesDifference *);
+    Stream &skipValue(TLChannelAdminLogEventAction *);
+    Stream &skipValue(TLPaymentsPaymentResult *);
+    Stream &skipValue(TLChannelAdminLogEvent *);
+    Stream &skipValue(TLChannelsAdminLogResults *);
+    // End of generated skip methods
+
+protected:
+    Arena *m_arena = nullptr;
 };
 
 inline Stream &Stream::operator>>(QString &str)
@@ -428,6 +688,314 @@ inline Stream &Stream::operator<<(const TLValue v)
     return *this;
 }
 
+template <typename TL>
+Stream &Stream::operator>>(TLCompactValue<TL> &v)
+{
+    // Assign via the compact value to switch the alive members of the owner
+    TLValue value;
+    *this >> value;
+    v = value;
+    return *this;
+}
+
+template <typename T>
+Stream &Stream::skipValue(TLVector<T> *)
+{
+    TLValue tlType;
+    *this >> tlType;
+    if (tlType != TLValue::Vector) {
+        setError(true);
+        return *this;
+    }
+    quint32 length = 0;
+    *this >> length;
+    if (!verifyReadLength(length, maxVectorLength(), sizeof(quint32))) {
+        return *this;
+    }
+    for (quint32 i = 0; (i < length) && !error(); ++i) {
+        skip<T>();
+    }
+    return *this;
+}
+
+// The exact number of bytes written by the corresponding Stream operator<<()
+inline quint32 serializedSize(quint32) { return sizeof(quint32); }
+inline quint32 serializedSize(qint32) { return sizeof(qint32); }
+inline quint32 serializedSize(quint64) { return sizeof(quint64); }
+inline quint32 serializedSize(qint64) { return sizeof(qint64); }
+inline quint32 serializedSize(double) { return sizeof(double); }
+inline quint32 serializedSize(bool) { return sizeof(quint32); }
+inline quint32 serializedSize(TLValue) { return sizeof(quint32); }
+inline quint32 serializedSize(TLValue::Value) { return sizeof(quint32); }
+inline quint32 serializedSize(const TLBool &) { return sizeof(quint32); }
+
+template <int Size>
+quint32 serializedSize(const TLNumber<Size> &) { return Size / 8; }
+
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const QByteArray &data);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const QString &str);
+
+// Generated serialized size functions
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLAccountDaysTTL &accountDaysTTLValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLAccountPassword &accountPasswordValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLAccountPasswordInputSettings &accountPasswordInputSettingsValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLAccountPasswordSettings &accountPasswordSettingsValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLAccountTmpPassword &accountTmpPasswordValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLAuthCheckedPhone &authCheckedPhoneValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLAuthCodeType &authCodeTypeValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLAuthExportedAuthorization &authExportedAuthorizationValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLAuthPasswordRecovery &authPasswordRecoveryValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLAuthSentCodeType &authSentCodeTypeValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLAuthorization &authorizationValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLBadMsgNotification &badMsgNotificationValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLBotCommand &botCommandValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLBotInfo &botInfoValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLCdnFileHash &cdnFileHashValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLCdnPublicKey &cdnPublicKeyValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLChannelParticipantsFilter &channelParticipantsFilterValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLChatParticipant &chatParticipantValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLChatParticipants &chatParticipantsValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLClientDHInnerData &clientDHInnerDataValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLContact &contactValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLContactBlocked &contactBlockedValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLContactLink &contactLinkValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLDataJSON &dataJSONValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLDestroyAuthKeyRes &destroyAuthKeyResValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLDestroySessionRes &destroySessionResValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLDisabledFeature &disabledFeatureValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLEncryptedChat &encryptedChatValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLEncryptedFile &encryptedFileValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLEncryptedMessage &encryptedMessageValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLError &errorValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLExportedChatInvite &exportedChatInviteValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLExportedMessageLink &exportedMessageLinkValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLFileLocation &fileLocationValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLFutureSalt &futureSaltValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLFutureSalts &futureSaltsValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLGeoPoint &geoPointValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLHelpAppUpdate &helpAppUpdateValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLHelpInviteText &helpInviteTextValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLHelpTermsOfService &helpTermsOfServiceValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLHighScore &highScoreValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLHttpWait &httpWaitValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLImportedContact &importedContactValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLInlineBotSwitchPM &inlineBotSwitchPMValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLInputAppEvent &inputAppEventValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLInputBotInlineMessageID &inputBotInlineMessageIDValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLInputChannel &inputChannelValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLInputContact &inputContactValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLInputDocument &inputDocumentValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLInputEncryptedChat &inputEncryptedChatValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLInputEncryptedFile &inputEncryptedFileValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLInputFile &inputFileValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLInputFileLocation &inputFileLocationValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLInputGeoPoint &inputGeoPointValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLInputPeer &inputPeerValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLInputPeerNotifyEvents &inputPeerNotifyEventsValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLInputPhoneCall &inputPhoneCallValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLInputPhoto &inputPhotoValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLInputPrivacyKey &inputPrivacyKeyValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLInputStickerSet &inputStickerSetValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLInputStickeredMedia &inputStickeredMediaValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLInputUser &inputUserValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLInputWebFileLocation &inputWebFileLocationValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLIpPort &ipPortValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLLabeledPrice &labeledPriceValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLLangPackLanguage &langPackLanguageValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLLangPackString &langPackStringValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLMaskCoords &maskCoordsValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLMessageEntity &messageEntityValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLMessageFwdHeader &messageFwdHeaderValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLMessageRange &messageRangeValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLMessagesAffectedHistory &messagesAffectedHistoryValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLMessagesAffectedMessages &messagesAffectedMessagesValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLMessagesDhConfig &messagesDhConfigValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLMessagesSentEncryptedMessage &messagesSentEncryptedMessageValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLMsgDetailedInfo &msgDetailedInfoValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLMsgResendReq &msgResendReqValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLMsgsAck &msgsAckValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLMsgsAllInfo &msgsAllInfoValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLMsgsStateInfo &msgsStateInfoValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLMsgsStateReq &msgsStateReqValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLNearestDc &nearestDcValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLNewSession &newSessionValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLPQInnerData &pQInnerDataValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLPaymentCharge &paymentChargeValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLPaymentSavedCredentials &paymentSavedCredentialsValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLPeer &peerValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLPeerNotifyEvents &peerNotifyEventsValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLPhoneCallDiscardReason &phoneCallDiscardReasonValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLPhoneConnection &phoneConnectionValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLPhotoSize &photoSizeValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLPong &pongValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLPopularContact &popularContactValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLPostAddress &postAddressValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLPrivacyKey &privacyKeyValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLPrivacyRule &privacyRuleValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLReceivedNotifyMessage &receivedNotifyMessageValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLReportReason &reportReasonValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLResPQ &resPQValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLRichText &richTextValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLRpcDropAnswer &rpcDropAnswerValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLRpcError &rpcErrorValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLSendMessageAction &sendMessageActionValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLServerDHInnerData &serverDHInnerDataValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLServerDHParams &serverDHParamsValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLSetClientDHParamsAnswer &setClientDHParamsAnswerValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLShippingOption &shippingOptionValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLStickerPack &stickerPackValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLStorageFileType &storageFileTypeValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLTopPeer &topPeerValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLTopPeerCategory &topPeerCategoryValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLTopPeerCategoryPeers &topPeerCategoryPeersValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLUpdatesState &updatesStateValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLUploadCdnFile &uploadCdnFileValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLUploadFile &uploadFileValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLUploadWebFile &uploadWebFileValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLUserProfilePhoto &userProfilePhotoValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLUserStatus &userStatusValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLWallPaper &wallPaperValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLAccountAuthorizations &accountAuthorizationsValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLAuthSentCode &authSentCodeValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLCdnConfig &cdnConfigValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLChannelAdminLogEventsFilter &channelAdminLogEventsFilterValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLChannelAdminRights &channelAdminRightsValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLChannelBannedRights &channelBannedRightsValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLChannelMessagesFilter &channelMessagesFilterValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLChannelParticipant &channelParticipantValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLChatPhoto &chatPhotoValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLContactStatus &contactStatusValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLDcOption &dcOptionValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLDocumentAttribute &documentAttributeValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLDraftMessage &draftMessageValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLHelpConfigSimple &helpConfigSimpleValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLInputChatPhoto &inputChatPhotoValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLInputGame &inputGameValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLInputNotifyPeer &inputNotifyPeerValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLInputPaymentCredentials &inputPaymentCredentialsValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLInputPeerNotifySettings &inputPeerNotifySettingsValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLInputPrivacyRule &inputPrivacyRuleValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLInputStickerSetItem &inputStickerSetItemValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLInputWebDocument &inputWebDocumentValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLInvoice &invoiceValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLKeyboardButton &keyboardButtonValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLKeyboardButtonRow &keyboardButtonRowValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLLangPackDifference &langPackDifferenceValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLMessagesBotCallbackAnswer &messagesBotCallbackAnswerValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLMessagesFilter &messagesFilterValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLMessagesMessageEditData &messagesMessageEditDataValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLNotifyPeer &notifyPeerValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLPaymentRequestedInfo &paymentRequestedInfoValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLPaymentsSavedInfo &paymentsSavedInfoValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLPaymentsValidatedRequestedInfo &paymentsValidatedRequestedInfoValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLPeerNotifySettings &peerNotifySettingsValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLPeerSettings &peerSettingsValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLPhoneCallProtocol &phoneCallProtocolValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLPhoto &photoValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLReplyMarkup &replyMarkupValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLStickerSet &stickerSetValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLUser &userValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLWebDocument &webDocumentValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLAccountPrivacyRules &accountPrivacyRulesValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLAuthAuthorization &authAuthorizationValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLBotInlineMessage &botInlineMessageValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLChannelsChannelParticipant &channelsChannelParticipantValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLChannelsChannelParticipants &channelsChannelParticipantsValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLChat &chatValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLChatFull &chatFullValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLChatInvite &chatInviteValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLConfig &configValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLContactsBlocked &contactsBlockedValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLContactsContacts &contactsContactsValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLContactsFound &contactsFoundValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLContactsImportedContacts &contactsImportedContactsValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLContactsLink &contactsLinkValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLContactsResolvedPeer &contactsResolvedPeerValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLContactsTopPeers &contactsTopPeersValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLDialog &dialogValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLDocument &documentValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLFoundGif &foundGifValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLGame &gameValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLHelpSupport &helpSupportValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLInputBotInlineMessage &inputBotInlineMessageValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLInputBotInlineResult &inputBotInlineResultValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLInputMedia &inputMediaValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLMessageAction &messageActionValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLMessagesAllStickers &messagesAllStickersValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLMessagesChatFull &messagesChatFullValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLMessagesChats &messagesChatsValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLMessagesFavedStickers &messagesFavedStickersValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLMessagesFoundGifs &messagesFoundGifsValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLMessagesHighScores &messagesHighScoresValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLMessagesRecentStickers &messagesRecentStickersValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLMessagesSavedGifs &messagesSavedGifsValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLMessagesStickerSet &messagesStickerSetValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLMessagesStickers &messagesStickersValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLPage &pageValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLPageBlock &pageBlockValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLPaymentsPaymentForm &paymentsPaymentFormValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLPaymentsPaymentReceipt &paymentsPaymentReceiptValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLPhoneCall &phoneCallValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLPhonePhoneCall &phonePhoneCallValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLPhotosPhoto &photosPhotoValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLPhotosPhotos &photosPhotosValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLStickerSetCovered &stickerSetCoveredValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLUserFull &userFullValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLWebPage &webPageValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLBotInlineResult &botInlineResultValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLMessageMedia &messageMediaValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLMessagesArchivedStickers &messagesArchivedStickersValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLMessagesBotResults &messagesBotResultsValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLMessagesFeaturedStickers &messagesFeaturedStickersValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLMessagesStickerSetInstallResult &messagesStickerSetInstallResultValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLRecentMeUrl &recentMeUrlValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLHelpRecentMeUrls &helpRecentMeUrlsValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLMessage &messageValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLMessagesDialogs &messagesDialogsValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLMessagesMessages &messagesMessagesValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLMessagesPeerDialogs &messagesPeerDialogsValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLUpdate &updateValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLUpdates &updatesValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLUpdatesChannelDifference &updatesChannelDifferenceValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLUpdatesDifference &updatesDifferenceValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLChannelAdminLogEventAction &channelAdminLogEventActionValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLPaymentsPaymentResult &paymentsPaymentResultValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLChannelAdminLogEvent &channelAdminLogEventValue);
+TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLChannelsAdminLogResults &channelsAdminLogResultsValue);
+// End of generated serialized size functions
+
+template <typename T>
+quint32 serializedSize(const TLVector<T> &v)
+{
+    quint32 size = serializedSize(v.tlType);
+    if (v.tlType == TLValue::Vector) {
+        size += serializedSize(quint32(v.count()));
+        for (const T &value : v) {
+            size += serializedSize(value);
+        }
+    }
+    return size;
+}
+
+template <typename T>
+quint32 serializedSize(const TLVector<T*> &v)
+{
+    quint32 size = serializedSize(v.tlType);
+    if (v.tlType == TLValue::Vector) {
+        size += serializedSize(quint32(v.count()));
+        for (const T *value : v) {
+            size += serializedSize(*value);
+        }
+    }
+    return size;
+}
+
+template <typename T>
+quint32 serializedSize(const TLPtr<T> &v)
+{
+    return serializedSize(*v);
+}
+
 } // MTProto namespace
 
 } // Telegram namespace
@@ -19,6 +19,7 @@
 #define TELEGRAM_QT_MTPROTO_STREAM_P_HPP
 
 #include "Stream.hpp"
+#include "Arena.hpp"
 
 namespace Telegram {
 
@@ -34,14 +35,16 @@ Stream &Stream::operator>>(TLVector<T> &v)
     if (result.tlType == TLValue::Vector) {
         quint32 length = 0;
         *this >> length;
-        for (quint32 i = 0; i < length; ++i) {
-            T value;
-            *this >> value;
-            result.append(value);
+        // Each element takes at least 4 bytes
+        if (verifyReadLength(length, maxVectorLength(), sizeof(quint32))) {
+            result.resize(static_cast<int>(length));
+            for (int i = 0; (i < result.count()) && !error(); ++i) {
+                *this >> result[i];
+            }
         }
     }
 
-    v = result;
+    v = std::move(result);
     return *this;
 }
 
@@ -49,21 +52,28 @@ template <typename T>
 Stream &Stream::operator>>(TLVector<T*> &v)
 {
     TLVector<T*> result;
+    result.arenaItems = m_arena != nullptr;
 
     *this >> result.tlType;
 
     if (result.tlType == TLValue::Vector) {
         quint32 length = 0;
         *this >> length;
-        for (quint32 i = 0; i < length; ++i) {
-            T *value = new T;
-            *this >> *value;
-            result.append(value);
+        if (verifyReadLength(length, maxVectorLength(), sizeof(quint32))) {
+            result.reserve(static_cast<int>(length));
+            for (quint32 i = 0; (i < length) && !error(); ++i) {
+                T *value = m_arena ? m_arena->create<T>() : new T;
+                *this >> *value;
+                result.append(value);
+            }
         }
     }
 
-    qDeleteAll(v);
-    v = result;
+    // The arena items are released with the arena they were allocated from
+    if (!v.arenaItems) {
+        qDeleteAll(v);
+    }
+    v = std::move(result);
     return *this;
 }
 
@@ -109,6 +119,9 @@ Stream &Stream::operator<<(const TLPtr<T> &v)
 template<typename T>
 Stream &Stream::operator>>(TLPtr<T> &v)
 {
+    if (m_arena && v.isNull()) {
+        v.setUnownedData(m_arena->create<T>());
+    }
     *this >> *v;
     return *this;
 }
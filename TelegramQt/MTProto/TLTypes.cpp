@@ -17,6 +17,8 @@
 
 #include "TLTypes.hpp"
 
+#include <new>
+
 // Generated TLTypes
 bool TLAccountDaysTTL::hasType(const quint32 value)
 {
@@ -7830,6 +7832,902 @@ bool TLUpdate::operator==(const TLUpdate &v) const
     }
 }
 
+TLUpdate::TLUpdate()
+{
+    for (int slot = 0; slot < SlotCount; ++slot) {
+        constructMember(slotMember(tlType, slot));
+    }
+}
+
+TLUpdate::TLUpdate(const TLUpdate &v) :
+    pts(v.pts),
+    ptsCount(v.ptsCount),
+    quint32Id(v.quint32Id),
+    randomId(v.randomId),
+    userId(v.userId),
+    chatId(v.chatId),
+    date(v.date),
+    previous(v.previous),
+    qts(v.qts),
+    maxDate(v.maxDate),
+    inviterId(v.inviterId),
+    version(v.version),
+    blocked(v.blocked),
+    flags(v.flags),
+    inboxDate(v.inboxDate),
+    maxId(v.maxId),
+    channelId(v.channelId),
+    views(v.views),
+    enabled(v.enabled),
+    isAdmin(v.isAdmin),
+    queryId(v.queryId),
+    msgId(v.msgId),
+    chatInstance(v.chatInstance),
+    timeout(v.timeout),
+    totalAmount(v.totalAmount),
+    availableMinId(v.availableMinId),
+    tlType(this, v.tlType)
+{
+    for (int slot = 0; slot < SlotCount; ++slot) {
+        copyMember(slotMember(tlType, slot), v);
+    }
+}
+
+TLUpdate::TLUpdate(TLUpdate &&v) :
+    pts(v.pts),
+    ptsCount(v.ptsCount),
+    quint32Id(v.quint32Id),
+    randomId(v.randomId),
+    userId(v.userId),
+    chatId(v.chatId),
+    date(v.date),
+    previous(v.previous),
+    qts(v.qts),
+    maxDate(v.maxDate),
+    inviterId(v.inviterId),
+    version(v.version),
+    blocked(v.blocked),
+    flags(v.flags),
+    inboxDate(v.inboxDate),
+    maxId(v.maxId),
+    channelId(v.channelId),
+    views(v.views),
+    enabled(v.enabled),
+    isAdmin(v.isAdmin),
+    queryId(v.queryId),
+    msgId(v.msgId),
+    chatInstance(v.chatInstance),
+    timeout(v.timeout),
+    totalAmount(v.totalAmount),
+    availableMinId(v.availableMinId),
+    tlType(this, v.tlType)
+{
+    for (int slot = 0; slot < SlotCount; ++slot) {
+        moveMember(slotMember(tlType, slot), v);
+    }
+}
+
+TLUpdate::~TLUpdate()
+{
+    for (int slot = 0; slot < SlotCount; ++slot) {
+        destroyMember(slotMember(tlType, slot));
+    }
+}
+
+TLUpdate &TLUpdate::operator=(const TLUpdate &v)
+{
+    if (this == &v) {
+        return *this;
+    }
+    for (int slot = 0; slot < SlotCount; ++slot) {
+        destroyMember(slotMember(tlType, slot));
+    }
+    pts = v.pts;
+    ptsCount = v.ptsCount;
+    quint32Id = v.quint32Id;
+    randomId = v.randomId;
+    userId = v.userId;
+    chatId = v.chatId;
+    date = v.date;
+    previous = v.previous;
+    qts = v.qts;
+    maxDate = v.maxDate;
+    inviterId = v.inviterId;
+    version = v.version;
+    blocked = v.blocked;
+    flags = v.flags;
+    inboxDate = v.inboxDate;
+    maxId = v.maxId;
+    channelId = v.channelId;
+    views = v.views;
+    enabled = v.enabled;
+    isAdmin = v.isAdmin;
+    queryId = v.queryId;
+    msgId = v.msgId;
+    chatInstance = v.chatInstance;
+    timeout = v.timeout;
+    totalAmount = v.totalAmount;
+    availableMinId = v.availableMinId;
+    tlType.setValue(v.tlType);
+    for (int slot = 0; slot < SlotCount; ++slot) {
+        copyMember(slotMember(tlType, slot), v);
+    }
+    return *this;
+}
+
+TLUpdate &TLUpdate::operator=(TLUpdate &&v)
+{
+    if (this == &v) {
+        return *this;
+    }
+    for (int slot = 0; slot < SlotCount; ++slot) {
+        destroyMember(slotMember(tlType, slot));
+    }
+    pts = v.pts;
+    ptsCount = v.ptsCount;
+    quint32Id = v.quint32Id;
+    randomId = v.randomId;
+    userId = v.userId;
+    chatId = v.chatId;
+    date = v.date;
+    previous = v.previous;
+    qts = v.qts;
+    maxDate = v.maxDate;
+    inviterId = v.inviterId;
+    version = v.version;
+    blocked = v.blocked;
+    flags = v.flags;
+    inboxDate = v.inboxDate;
+    maxId = v.maxId;
+    channelId = v.channelId;
+    views = v.views;
+    enabled = v.enabled;
+    isAdmin = v.isAdmin;
+    queryId = v.queryId;
+    msgId = v.msgId;
+    chatInstance = v.chatInstance;
+    timeout = v.timeout;
+    totalAmount = v.totalAmount;
+    availableMinId = v.availableMinId;
+    tlType.setValue(v.tlType);
+    for (int slot = 0; slot < SlotCount; ++slot) {
+        moveMember(slotMember(tlType, slot), v);
+    }
+    return *this;
+}
+
+TLUpdate::Member TLUpdate::slotMember(quint32 value, int slot)
+{
+    switch (value) {
+    case TLValue::UpdateNewMessage:
+    case TLValue::UpdateNewChannelMessage:
+    case TLValue::UpdateEditChannelMessage:
+    case TLValue::UpdateEditMessage: {
+        static const Member members[SlotCount] = { MessageMember, NoMember, NoMember, NoMember };
+        return members[slot];
+    }
+    case TLValue::UpdateDeleteMessages:
+    case TLValue::UpdateReadMessagesContents:
+    case TLValue::UpdateDeleteChannelMessages:
+    case TLValue::UpdateChannelReadMessagesContents: {
+        static const Member members[SlotCount] = { MessagesMember, NoMember, NoMember, NoMember };
+        return members[slot];
+    }
+    case TLValue::UpdateUserTyping:
+    case TLValue::UpdateChatUserTyping: {
+        static const Member members[SlotCount] = { ActionMember, NoMember, NoMember, NoMember };
+        return members[slot];
+    }
+    case TLValue::UpdateChatParticipants: {
+        static const Member members[SlotCount] = { ParticipantsMember, NoMember, NoMember, NoMember };
+        return members[slot];
+    }
+    case TLValue::UpdateUserStatus: {
+        static const Member members[SlotCount] = { StatusMember, NoMember, NoMember, NoMember };
+        return members[slot];
+    }
+    case TLValue::UpdateUserName: {
+        static const Member members[SlotCount] = { FirstNameMember, LastNameMember, UsernameMember, NoMember };
+        return members[slot];
+    }
+    case TLValue::UpdateUserPhoto: {
+        static const Member members[SlotCount] = { PhotoMember, NoMember, NoMember, NoMember };
+        return members[slot];
+    }
+    case TLValue::UpdateContactLink: {
+        static const Member members[SlotCount] = { MyLinkMember, ForeignLinkMember, NoMember, NoMember };
+        return members[slot];
+    }
+    case TLValue::UpdateNewEncryptedMessage: {
+        static const Member members[SlotCount] = { EncryptedMessageMember, NoMember, NoMember, NoMember };
+        return members[slot];
+    }
+    case TLValue::UpdateEncryption: {
+        static const Member members[SlotCount] = { ChatMember, NoMember, NoMember, NoMember };
+        return members[slot];
+    }
+    case TLValue::UpdateDcOptions: {
+        static const Member members[SlotCount] = { DcOptionsMember, NoMember, NoMember, NoMember };
+        return members[slot];
+    }
+    case TLValue::UpdateNotifySettings: {
+        static const Member members[SlotCount] = { NotifyPeerMember, NotifySettingsMember, NoMember, NoMember };
+        return members[slot];
+    }
+    case TLValue::UpdateServiceNotification: {
+        static const Member members[SlotCount] = { MediaMember, TypeMember, StringMessageMember, EntitiesMember };
+        return members[slot];
+    }
+    case TLValue::UpdatePrivacy: {
+        static const Member members[SlotCount] = { KeyMember, RulesMember, NoMember, NoMember };
+        return members[slot];
+    }
+    case TLValue::UpdateUserPhone: {
+        static const Member members[SlotCount] = { PhoneMember, NoMember, NoMember, NoMember };
+        return members[slot];
+    }
+    case TLValue::UpdateReadHistoryInbox:
+    case TLValue::UpdateReadHistoryOutbox:
+    case TLValue::UpdateDialogPinned: {
+        static const Member members[SlotCount] = { PeerMember, NoMember, NoMember, NoMember };
+        return members[slot];
+    }
+    case TLValue::UpdateWebPage:
+    case TLValue::UpdateChannelWebPage: {
+        static const Member members[SlotCount] = { WebpageMember, NoMember, NoMember, NoMember };
+        return members[slot];
+    }
+    case TLValue::UpdateNewStickerSet: {
+        static const Member members[SlotCount] = { StickersetMember, NoMember, NoMember, NoMember };
+        return members[slot];
+    }
+    case TLValue::UpdateStickerSetsOrder: {
+        static const Member members[SlotCount] = { Quint64OrderVectorMember, NoMember, NoMember, NoMember };
+        return members[slot];
+    }
+    case TLValue::UpdateStickerSets:
+    case TLValue::UpdateSavedGifs:
+    case TLValue::UpdateBotInlineQuery:
+    case TLValue::UpdateReadFeaturedStickers:
+    case TLValue::UpdateRecentStickers:
+    case TLValue::UpdateConfig:
+    case TLValue::UpdatePtsChanged:
+    case TLValue::UpdateLangPackTooLong:
+    case TLValue::UpdateFavedStickers:
+    case TLValue::UpdateContactsReset: {
+        static const Member members[SlotCount] = { GeoMember, OffsetMember, QueryMember, NoMember };
+        return members[slot];
+    }
+    case TLValue::UpdateBotInlineSend: {
+        static const Member members[SlotCount] = { GeoMember, InputBotInlineMessageIDMsgIdMember, QueryMember, StringIdMember };
+        return members[slot];
+    }
+    case TLValue::UpdateBotCallbackQuery: {
+        static const Member members[SlotCount] = { PeerMember, NoMember, ByteArrayDataMember, GameShortNameMember };
+        return members[slot];
+    }
+    case TLValue::UpdateInlineBotCallbackQuery: {
+        static const Member members[SlotCount] = { NoMember, InputBotInlineMessageIDMsgIdMember, ByteArrayDataMember, GameShortNameMember };
+        return members[slot];
+    }
+    case TLValue::UpdateDraftMessage: {
+        static const Member members[SlotCount] = { PeerMember, DraftMember, NoMember, NoMember };
+        return members[slot];
+    }
+    case TLValue::UpdatePinnedDialogs: {
+        static const Member members[SlotCount] = { PeerOrderVectorMember, NoMember, NoMember, NoMember };
+        return members[slot];
+    }
+    case TLValue::UpdateBotWebhookJSON:
+    case TLValue::UpdateBotWebhookJSONQuery: {
+        static const Member members[SlotCount] = { JSONDataMember, NoMember, NoMember, NoMember };
+        return members[slot];
+    }
+    case TLValue::UpdateBotShippingQuery: {
+        static const Member members[SlotCount] = { ShippingAddressMember, PayloadMember, NoMember, NoMember };
+        return members[slot];
+    }
+    case TLValue::UpdateBotPrecheckoutQuery: {
+        static const Member members[SlotCount] = { InfoMember, PayloadMember, ShippingOptionIdMember, CurrencyMember };
+        return members[slot];
+    }
+    case TLValue::UpdatePhoneCall: {
+        static const Member members[SlotCount] = { PhoneCallMember, NoMember, NoMember, NoMember };
+        return members[slot];
+    }
+    case TLValue::UpdateLangPack: {
+        static const Member members[SlotCount] = { DifferenceMember, NoMember, NoMember, NoMember };
+        return members[slot];
+    }
+    default:
+        return NoMember;
+    }
+}
+
+bool TLUpdate::hasMember(Member member) const
+{
+    for (int slot = 0; slot < SlotCount; ++slot) {
+        if (slotMember(tlType, slot) == member) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void TLUpdate::setTlType(TLValue value)
+{
+    // Keep the members shared by the previous and the new constructors
+    for (int slot = 0; slot < SlotCount; ++slot) {
+        const Member previousMember = slotMember(tlType, slot);
+        const Member newMember = slotMember(value, slot);
+        if (previousMember != newMember) {
+            destroyMember(previousMember);
+            constructMember(newMember);
+        }
+    }
+    tlType.setValue(value);
+}
+
+void TLUpdate::constructMember(Member member)
+{
+    switch (member) {
+    case MessageMember:
+        new (&message) TLMessage();
+        break;
+    case ActionMember:
+        new (&action) TLSendMessageAction();
+        break;
+    case ParticipantsMember:
+        new (&participants) TLChatParticipants();
+        break;
+    case StatusMember:
+        new (&status) TLUserStatus();
+        break;
+    case PhotoMember:
+        new (&photo) TLUserProfilePhoto();
+        break;
+    case MyLinkMember:
+        new (&myLink) TLContactLink();
+        break;
+    case EncryptedMessageMember:
+        new (&encryptedMessage) TLEncryptedMessage();
+        break;
+    case ChatMember:
+        new (&chat) TLEncryptedChat();
+        break;
+    case NotifyPeerMember:
+        new (&notifyPeer) TLNotifyPeer();
+        break;
+    case MediaMember:
+        new (&media) TLMessageMedia();
+        break;
+    case KeyMember:
+        new (&key) TLPrivacyKey();
+        break;
+    case PeerMember:
+        new (&peer) TLPeer();
+        break;
+    case WebpageMember:
+        new (&webpage) TLWebPage();
+        break;
+    case StickersetMember:
+        new (&stickerset) TLMessagesStickerSet();
+        break;
+    case GeoMember:
+        new (&geo) TLGeoPoint();
+        break;
+    case JSONDataMember:
+        new (&jSONData) TLDataJSON();
+        break;
+    case ShippingAddressMember:
+        new (&shippingAddress) TLPostAddress();
+        break;
+    case InfoMember:
+        new (&info) TLPaymentRequestedInfo();
+        break;
+    case PhoneCallMember:
+        new (&phoneCall) TLPhoneCall();
+        break;
+    case DifferenceMember:
+        new (&difference) TLLangPackDifference();
+        break;
+    case MessagesMember:
+        new (&messages) TLVector<quint32>();
+        break;
+    case FirstNameMember:
+        new (&firstName) QString();
+        break;
+    case DcOptionsMember:
+        new (&dcOptions) TLVector<TLDcOption>();
+        break;
+    case PhoneMember:
+        new (&phone) QString();
+        break;
+    case Quint64OrderVectorMember:
+        new (&quint64OrderVector) TLVector<quint64>();
+        break;
+    case PeerOrderVectorMember:
+        new (&peerOrderVector) TLVector<TLPeer>();
+        break;
+    case ForeignLinkMember:
+        new (&foreignLink) TLContactLink();
+        break;
+    case NotifySettingsMember:
+        new (&notifySettings) TLPeerNotifySettings();
+        break;
+    case InputBotInlineMessageIDMsgIdMember:
+        new (&inputBotInlineMessageIDMsgId) TLInputBotInlineMessageID();
+        break;
+    case DraftMember:
+        new (&draft) TLDraftMessage();
+        break;
+    case LastNameMember:
+        new (&lastName) QString();
+        break;
+    case TypeMember:
+        new (&type) QString();
+        break;
+    case RulesMember:
+        new (&rules) TLVector<TLPrivacyRule>();
+        break;
+    case OffsetMember:
+        new (&offset) QString();
+        break;
+    case PayloadMember:
+        new (&payload) QByteArray();
+        break;
+    case UsernameMember:
+        new (&username) QString();
+        break;
+    case StringMessageMember:
+        new (&stringMessage) QString();
+        break;
+    case QueryMember:
+        new (&query) QString();
+        break;
+    case ByteArrayDataMember:
+        new (&byteArrayData) QByteArray();
+        break;
+    case ShippingOptionIdMember:
+        new (&shippingOptionId) QString();
+        break;
+    case EntitiesMember:
+        new (&entities) TLVector<TLMessageEntity>();
+        break;
+    case StringIdMember:
+        new (&stringId) QString();
+        break;
+    case GameShortNameMember:
+        new (&gameShortName) QString();
+        break;
+    case CurrencyMember:
+        new (&currency) QString();
+        break;
+    case NoMember:
+        break;
+    }
+}
+
+void TLUpdate::copyMember(Member member, const TLUpdate &v)
+{
+    switch (member) {
+    case MessageMember:
+        new (&message) TLMessage(v.message);
+        break;
+    case ActionMember:
+        new (&action) TLSendMessageAction(v.action);
+        break;
+    case ParticipantsMember:
+        new (&participants) TLChatParticipants(v.participants);
+        break;
+    case StatusMember:
+        new (&status) TLUserStatus(v.status);
+        break;
+    case PhotoMember:
+        new (&photo) TLUserProfilePhoto(v.photo);
+        break;
+    case MyLinkMember:
+        new (&myLink) TLContactLink(v.myLink);
+        break;
+    case EncryptedMessageMember:
+        new (&encryptedMessage) TLEncryptedMessage(v.encryptedMessage);
+        break;
+    case ChatMember:
+        new (&chat) TLEncryptedChat(v.chat);
+        break;
+    case NotifyPeerMember:
+        new (&notifyPeer) TLNotifyPeer(v.notifyPeer);
+        break;
+    case MediaMember:
+        new (&media) TLMessageMedia(v.media);
+        break;
+    case KeyMember:
+        new (&key) TLPrivacyKey(v.key);
+        break;
+    case PeerMember:
+        new (&peer) TLPeer(v.peer);
+        break;
+    case WebpageMember:
+        new (&webpage) TLWebPage(v.webpage);
+        break;
+    case StickersetMember:
+        new (&stickerset) TLMessagesStickerSet(v.stickerset);
+        break;
+    case GeoMember:
+        new (&geo) TLGeoPoint(v.geo);
+        break;
+    case JSONDataMember:
+        new (&jSONData) TLDataJSON(v.jSONData);
+        break;
+    case ShippingAddressMember:
+        new (&shippingAddress) TLPostAddress(v.shippingAddress);
+        break;
+    case InfoMember:
+        new (&info) TLPaymentRequestedInfo(v.info);
+        break;
+    case PhoneCallMember:
+        new (&phoneCall) TLPhoneCall(v.phoneCall);
+        break;
+    case DifferenceMember:
+        new (&difference) TLLangPackDifference(v.difference);
+        break;
+    case MessagesMember:
+        new (&messages) TLVector<quint32>(v.messages);
+        break;
+    case FirstNameMember:
+        new (&firstName) QString(v.firstName);
+        break;
+    case DcOptionsMember:
+        new (&dcOptions) TLVector<TLDcOption>(v.dcOptions);
+        break;
+    case PhoneMember:
+        new (&phone) QString(v.phone);
+        break;
+    case Quint64OrderVectorMember:
+        new (&quint64OrderVector) TLVector<quint64>(v.quint64OrderVector);
+        break;
+    case PeerOrderVectorMember:
+        new (&peerOrderVector) TLVector<TLPeer>(v.peerOrderVector);
+        break;
+    case ForeignLinkMember:
+        new (&foreignLink) TLContactLink(v.foreignLink);
+        break;
+    case NotifySettingsMember:
+        new (&notifySettings) TLPeerNotifySettings(v.notifySettings);
+        break;
+    case InputBotInlineMessageIDMsgIdMember:
+        new (&inputBotInlineMessageIDMsgId) TLInputBotInlineMessageID(v.inputBotInlineMessageIDMsgId);
+        break;
+    case DraftMember:
+        new (&draft) TLDraftMessage(v.draft);
+        break;
+    case LastNameMember:
+        new (&lastName) QString(v.lastName);
+        break;
+    case TypeMember:
+        new (&type) QString(v.type);
+        break;
+    case RulesMember:
+        new (&rules) TLVector<TLPrivacyRule>(v.rules);
+        break;
+    case OffsetMember:
+        new (&offset) QString(v.offset);
+        break;
+    case PayloadMember:
+        new (&payload) QByteArray(v.payload);
+        break;
+    case UsernameMember:
+        new (&username) QString(v.username);
+        break;
+    case StringMessageMember:
+        new (&stringMessage) QString(v.stringMessage);
+        break;
+    case QueryMember:
+        new (&query) QString(v.query);
+        break;
+    case ByteArrayDataMember:
+        new (&byteArrayData) QByteArray(v.byteArrayData);
+        break;
+    case ShippingOptionIdMember:
+        new (&shippingOptionId) QString(v.shippingOptionId);
+        break;
+    case EntitiesMember:
+        new (&entities) TLVector<TLMessageEntity>(v.entities);
+        break;
+    case StringIdMember:
+        new (&stringId) QString(v.stringId);
+        break;
+    case GameShortNameMember:
+        new (&gameShortName) QString(v.gameShortName);
+        break;
+    case CurrencyMember:
+        new (&currency) QString(v.currency);
+        break;
+    case NoMember:
+        break;
+    }
+}
+
+void TLUpdate::moveMember(Member member, TLUpdate &v)
+{
+    switch (member) {
+    case MessageMember:
+        new (&message) TLMessage(std::move(v.message));
+        break;
+    case ActionMember:
+        new (&action) TLSendMessageAction(std::move(v.action));
+        break;
+    case ParticipantsMember:
+        new (&participants) TLChatParticipants(std::move(v.participants));
+        break;
+    case StatusMember:
+        new (&status) TLUserStatus(std::move(v.status));
+        break;
+    case PhotoMember:
+        new (&photo) TLUserProfilePhoto(std::move(v.photo));
+        break;
+    case MyLinkMember:
+        new (&myLink) TLContactLink(std::move(v.myLink));
+        break;
+    case EncryptedMessageMember:
+        new (&encryptedMessage) TLEncryptedMessage(std::move(v.encryptedMessage));
+        break;
+    case ChatMember:
+        new (&chat) TLEncryptedChat(std::move(v.chat));
+        break;
+    case NotifyPeerMember:
+        new (&notifyPeer) TLNotifyPeer(std::move(v.notifyPeer));
+        break;
+    case MediaMember:
+        new (&media) TLMessageMedia(std::move(v.media));
+        break;
+    case KeyMember:
+        new (&key) TLPrivacyKey(std::move(v.key));
+        break;
+    case PeerMember:
+        new (&peer) TLPeer(std::move(v.peer));
+        break;
+    case WebpageMember:
+        new (&webpage) TLWebPage(std::move(v.webpage));
+        break;
+    case StickersetMember:
+        new (&stickerset) TLMessagesStickerSet(std::move(v.stickerset));
+        break;
+    case GeoMember:
+        new (&geo) TLGeoPoint(std::move(v.geo));
+        break;
+    case JSONDataMember:
+        new (&jSONData) TLDataJSON(std::move(v.jSONData));
+        break;
+    case ShippingAddressMember:
+        new (&shippingAddress) TLPostAddress(std::move(v.shippingAddress));
+        break;
+    case InfoMember:
+        new (&info) TLPaymentRequestedInfo(std::move(v.info));
+        break;
+    case PhoneCallMember:
+        new (&phoneCall) TLPhoneCall(std::move(v.phoneCall));
+        break;
+    case DifferenceMember:
+        new (&difference) TLLangPackDifference(std::move(v.difference));
+        break;
+    case MessagesMember:
+        new (&messages) TLVector<quint32>(std::move(v.messages));
+        break;
+    case FirstNameMember:
+        new (&firstName) QString(std::move(v.firstName));
+        break;
+    case DcOptionsMember:
+        new (&dcOptions) TLVector<TLDcOption>(std::move(v.dcOptions));
+        break;
+    case PhoneMember:
+        new (&phone) QString(std::move(v.phone));
+        break;
+    case Quint64OrderVectorMember:
+        new (&quint64OrderVector) TLVector<quint64>(std::move(v.quint64OrderVector));
+        break;
+    case PeerOrderVectorMember:
+        new (&peerOrderVector) TLVector<TLPeer>(std::move(v.peerOrderVector));
+        break;
+    case ForeignLinkMember:
+        new (&foreignLink) TLContactLink(std::move(v.foreignLink));
+        break;
+    case NotifySettingsMember:
+        new (&notifySettings) TLPeerNotifySettings(std::move(v.notifySettings));
+        break;
+    case InputBotInlineMessageIDMsgIdMember:
+        new (&inputBotInlineMessageIDMsgId) TLInputBotInlineMessageID(std::move(v.inputBotInlineMessageIDMsgId));
+        break;
+    case DraftMember:
+        new (&draft) TLDraftMessage(std::move(v.draft));
+        break;
+    case LastNameMember:
+        new (&lastName) QString(std::move(v.lastName));
+        break;
+    case TypeMember:
+        new (&type) QString(std::move(v.type));
+        break;
+    case RulesMember:
+        new (&rules) TLVector<TLPrivacyRule>(std::move(v.rules));
+        break;
+    case OffsetMember:
+        new (&offset) QString(std::move(v.offset));
+        break;
+    case PayloadMember:
+        new (&payload) QByteArray(std::move(v.payload));
+        break;
+    case UsernameMember:
+        new (&username) QString(std::move(v.username));
+        break;
+    case StringMessageMember:
+        new (&stringMessage) QString(std::move(v.stringMessage));
+        break;
+    case QueryMember:
+        new (&query) QString(std::move(v.query));
+        break;
+    case ByteArrayDataMember:
+        new (&byteArrayData) QByteArray(std::move(v.byteArrayData));
+        break;
+    case ShippingOptionIdMember:
+        new (&shippingOptionId) QString(std::move(v.shippingOptionId));
+        break;
+    case EntitiesMember:
+        new (&entities) TLVector<TLMessageEntity>(std::move(v.entities));
+        break;
+    case StringIdMember:
+        new (&stringId) QString(std::move(v.stringId));
+        break;
+    case GameShortNameMember:
+        new (&gameShortName) QString(std::move(v.gameShortName));
+        break;
+    case CurrencyMember:
+        new (&currency) QString(std::move(v.currency));
+        break;
+    case NoMember:
+        break;
+    }
+}
+
+void TLUpdate::destroyMember(Member member)
+{
+    switch (member) {
+    case MessageMember:
+        message.~TLMessage();
+        break;
+    case ActionMember:
+        action.~TLSendMessageAction();
+        break;
+    case ParticipantsMember:
+        participants.~TLChatParticipants();
+        break;
+    case StatusMember:
+        status.~TLUserStatus();
+        break;
+    case PhotoMember:
+        photo.~TLUserProfilePhoto();
+        break;
+    case MyLinkMember:
+        myLink.~TLContactLink();
+        break;
+    case EncryptedMessageMember:
+        encryptedMessage.~TLEncryptedMessage();
+        break;
+    case ChatMember:
+        chat.~TLEncryptedChat();
+        break;
+    case NotifyPeerMember:
+        notifyPeer.~TLNotifyPeer();
+        break;
+    case MediaMember:
+        media.~TLMessageMedia();
+        break;
+    case KeyMember:
+        key.~TLPrivacyKey();
+        break;
+    case PeerMember:
+        peer.~TLPeer();
+        break;
+    case WebpageMember:
+        webpage.~TLWebPage();
+        break;
+    case StickersetMember:
+        stickerset.~TLMessagesStickerSet();
+        break;
+    case GeoMember:
+        geo.~TLGeoPoint();
+        break;
+    case JSONDataMember:
+        jSONData.~TLDataJSON();
+        break;
+    case ShippingAddressMember:
+        shippingAddress.~TLPostAddress();
+        break;
+    case InfoMember:
+        info.~TLPaymentRequestedInfo();
+        break;
+    case PhoneCallMember:
+        phoneCall.~TLPhoneCall();
+        break;
+    case DifferenceMember:
+        difference.~TLLangPackDifference();
+        break;
+    case MessagesMember:
+        messages.~TLVector<quint32>();
+        break;
+    case FirstNameMember:
+        firstName.~QString();
+        break;
+    case DcOptionsMember:
+        dcOptions.~TLVector<TLDcOption>();
+        break;
+    case PhoneMember:
+        phone.~QString();
+        break;
+    case Quint64OrderVectorMember:
+        quint64OrderVector.~TLVector<quint64>();
+        break;
+    case PeerOrderVectorMember:
+        peerOrderVector.~TLVector<TLPeer>();
+        break;
+    case ForeignLinkMember:
+        foreignLink.~TLContactLink();
+        break;
+    case NotifySettingsMember:
+        notifySettings.~TLPeerNotifySettings();
+        break;
+    case InputBotInlineMessageIDMsgIdMember:
+        inputBotInlineMessageIDMsgId.~TLInputBotInlineMessageID();
+        break;
+    case DraftMember:
+        draft.~TLDraftMessage();
+        break;
+    case LastNameMember:
+        lastName.~QString();
+        break;
+    case TypeMember:
+        type.~QString();
+        break;
+    case RulesMember:
+        rules.~TLVector<TLPrivacyRule>();
+        break;
+    case OffsetMember:
+        offset.~QString();
+        break;
+    case PayloadMember:
+        payload.~QByteArray();
+        break;
+    case UsernameMember:
+        username.~QString();
+        break;
+    case StringMessageMember:
+        stringMessage.~QString();
+        break;
+    case QueryMember:
+        query.~QString();
+        break;
+    case ByteArrayDataMember:
+        byteArrayData.~QByteArray();
+        break;
+    case ShippingOptionIdMember:
+        shippingOptionId.~QString();
+        break;
+    case EntitiesMember:
+        entities.~TLVector<TLMessageEntity>();
+        break;
+    case StringIdMember:
+        stringId.~QString();
+        break;
+    case GameShortNameMember:
+        gameShortName.~QString();
+        break;
+    case CurrencyMember:
+        currency.~QString();
+        break;
+    case NoMember:
+        break;
+    }
+}
+
 bool TLUpdates::hasType(const quint32 value)
 {
     switch (value) {
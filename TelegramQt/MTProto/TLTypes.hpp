@@ -74,7 +74,8 @@ public:
     TLVector() : QVector<T>(), tlType(TLValue::Vector) { }
     explicit TLVector(int size) : QVector<T>(size), tlType(TLValue::Vector) { }
     TLVector(int size, const T &t) : QVector<T>(size, t), tlType(TLValue::Vector) { }
-    TLVector(const TLVector<T> &v) : QVector<T>(v), tlType(v.tlType) { }
+    TLVector(const TLVector<T> &v) : QVector<T>(v), tlType(v.tlType), arenaItems(v.arenaItems) { }
+    TLVector(TLVector<T> &&v) : QVector<T>(std::move(v)), tlType(v.tlType), arenaItems(v.arenaItems) { }
     TLVector(const QVector<T> &v) : QVector<T>(v), tlType(TLValue::Vector) { }
     TLVector(std::initializer_list<T> args) : QVector<T>(args), tlType(TLValue::Vector) { }
 
@@ -102,11 +103,46 @@ public:
 
     TLVector &operator=(const TLVector &v) {
         tlType = v.tlType;
+        arenaItems = v.arenaItems;
         QVector<T>::operator =(v);
         return *this;
     }
 
+    TLVector &operator=(TLVector &&v) {
+        tlType = v.tlType;
+        arenaItems = v.arenaItems;
+        QVector<T>::operator =(std::move(v));
+        return *this;
+    }
+
     TLValue tlType;
+    // The decoded pointer items are owned by an MTProto::Arena and must not be deleted (see Stream::setArena())
+    bool arenaItems = false;
+};
+
+// The tlType of a compact TL struct (see the generator --compact-types option).
+// The struct keeps the constructor-specific members in unions, so an assignment
+// switches the alive members of the owner.
+template <typename TL>
+class TLCompactValue : public TLValue
+{
+public:
+    TLCompactValue(TL *owner, TLValue value) : TLValue(value), m_owner(owner) { }
+    TLCompactValue(const TLCompactValue &) = delete;
+
+    TLCompactValue &operator=(const TLCompactValue &value) { return *this = TLValue(value); }
+    TLCompactValue &operator=(TLValue value)
+    {
+        m_owner->setTlType(value);
+        return *this;
+    }
+    TLCompactValue &operator=(TLValue::Value value) { return *this = TLValue(value); }
+
+private:
+    friend TL;
+    void setValue(TLValue value) { TLValue::operator=(value); }
+
+    TL *m_owner;
 };
 
 // Generated TLTypes
@@ -3748,7 +3784,12 @@ struct TELEGRAMQT_INTERNAL_EXPORT TLMessagesPeerDialogs {
 };
 
 struct TELEGRAMQT_INTERNAL_EXPORT TLUpdate {
-    TLUpdate() = default;
+    TLUpdate();
+    TLUpdate(const TLUpdate &v);
+    TLUpdate(TLUpdate &&v);
+    ~TLUpdate();
+    TLUpdate &operator=(const TLUpdate &v);
+    TLUpdate &operator=(TLUpdate &&v);
 
     bool isValid() const { return hasType(tlType); }
     static bool hasType(const quint32 value);
@@ -3771,77 +3812,147 @@ struct TELEGRAMQT_INTERNAL_EXPORT TLUpdate {
     bool masks() const { return flags & Masks; }
     bool pinned() const { return flags & Pinned; }
 
-    TLMessage message;
     quint32 pts = 0;
     quint32 ptsCount = 0;
     quint32 quint32Id = 0;
     quint64 randomId = 0;
-    TLVector<quint32> messages;
     quint32 userId = 0;
-    TLSendMessageAction action;
     quint32 chatId = 0;
-    TLChatParticipants participants;
-    TLUserStatus status;
-    QString firstName;
-    QString lastName;
-    QString username;
     quint32 date = 0;
-    TLUserProfilePhoto photo;
     bool previous = false;
-    TLContactLink myLink;
-    TLContactLink foreignLink;
-    TLEncryptedMessage encryptedMessage;
     quint32 qts = 0;
-    TLEncryptedChat chat;
     quint32 maxDate = 0;
     quint32 inviterId = 0;
     quint32 version = 0;
-    TLVector<TLDcOption> dcOptions;
     bool blocked = false;
-    TLNotifyPeer notifyPeer;
-    TLPeerNotifySettings notifySettings;
     quint32 flags = 0;
     quint32 inboxDate = 0;
-    QString type;
-    QString stringMessage;
-    TLMessageMedia media;
-    TLVector<TLMessageEntity> entities;
-    TLPrivacyKey key;
-    TLVector<TLPrivacyRule> rules;
-    QString phone;
-    TLPeer peer;
     quint32 maxId = 0;
-    TLWebPage webpage;
     quint32 channelId = 0;
     quint32 views = 0;
     bool enabled = false;
     bool isAdmin = false;
-    TLMessagesStickerSet stickerset;
-    TLVector<quint64> quint64OrderVector;
     quint64 queryId = 0;
-    QString query;
-    TLGeoPoint geo;
-    QString offset;
-    QString stringId;
-    TLInputBotInlineMessageID inputBotInlineMessageIDMsgId;
     quint32 msgId = 0;
     quint64 chatInstance = 0;
-    QByteArray byteArrayData;
-    QString gameShortName;
-    TLDraftMessage draft;
-    TLVector<TLPeer> peerOrderVector;
-    TLDataJSON jSONData;
     quint32 timeout = 0;
-    QByteArray payload;
-    TLPostAddress shippingAddress;
-    TLPaymentRequestedInfo info;
-    QString shippingOptionId;
-    QString currency;
     quint64 totalAmount = 0;
-    TLPhoneCall phoneCall;
-    TLLangPackDifference difference;
     quint32 availableMinId = 0;
-    TLValue tlType = TLValue::UpdateNewMessage;
+    // Only the union members used by the current tlType are constructed
+    union {
+        TLMessage message;
+        TLSendMessageAction action;
+        TLChatParticipants participants;
+        TLUserStatus status;
+        TLUserProfilePhoto photo;
+        TLContactLink myLink;
+        TLEncryptedMessage encryptedMessage;
+        TLEncryptedChat chat;
+        TLNotifyPeer notifyPeer;
+        TLMessageMedia media;
+        TLPrivacyKey key;
+        TLPeer peer;
+        TLWebPage webpage;
+        TLMessagesStickerSet stickerset;
+        TLGeoPoint geo;
+        TLDataJSON jSONData;
+        TLPostAddress shippingAddress;
+        TLPaymentRequestedInfo info;
+        TLPhoneCall phoneCall;
+        TLLangPackDifference difference;
+        TLVector<quint32> messages;
+        QString firstName;
+        TLVector<TLDcOption> dcOptions;
+        QString phone;
+        TLVector<quint64> quint64OrderVector;
+        TLVector<TLPeer> peerOrderVector;
+    };
+    union {
+        TLContactLink foreignLink;
+        TLPeerNotifySettings notifySettings;
+        TLInputBotInlineMessageID inputBotInlineMessageIDMsgId;
+        TLDraftMessage draft;
+        QString lastName;
+        QString type;
+        TLVector<TLPrivacyRule> rules;
+        QString offset;
+        QByteArray payload;
+    };
+    union {
+        QString username;
+        QString stringMessage;
+        QString query;
+        QByteArray byteArrayData;
+        QString shippingOptionId;
+    };
+    union {
+        TLVector<TLMessageEntity> entities;
+        QString stringId;
+        QString gameShortName;
+        QString currency;
+    };
+    TLCompactValue<TLUpdate> tlType { this, TLValue::UpdateNewMessage };
+
+    // The union members. Only the members used by the current tlType are constructed,
+    // so check the member before the access if the tlType is not known for sure.
+    enum Member : quint8 {
+        NoMember,
+        MessageMember,
+        ActionMember,
+        ParticipantsMember,
+        StatusMember,
+        PhotoMember,
+        MyLinkMember,
+        EncryptedMessageMember,
+        ChatMember,
+        NotifyPeerMember,
+        MediaMember,
+        KeyMember,
+        PeerMember,
+        WebpageMember,
+        StickersetMember,
+        GeoMember,
+        JSONDataMember,
+        ShippingAddressMember,
+        InfoMember,
+        PhoneCallMember,
+        DifferenceMember,
+        MessagesMember,
+        FirstNameMember,
+        DcOptionsMember,
+        PhoneMember,
+        Quint64OrderVectorMember,
+        PeerOrderVectorMember,
+        ForeignLinkMember,
+        NotifySettingsMember,
+        InputBotInlineMessageIDMsgIdMember,
+        DraftMember,
+        LastNameMember,
+        TypeMember,
+        RulesMember,
+        OffsetMember,
+        PayloadMember,
+        UsernameMember,
+        StringMessageMember,
+        QueryMember,
+        ByteArrayDataMember,
+        ShippingOptionIdMember,
+        EntitiesMember,
+        StringIdMember,
+        GameShortNameMember,
+        CurrencyMember,
+    };
+    bool hasMember(Member member) const;
+
+private:
+    friend class TLCompactValue<TLUpdate>;
+    enum { SlotCount = 4 };
+    static Member slotMember(quint32 value, int slot);
+    void setTlType(TLValue value);
+    void constructMember(Member member);
+    void copyMember(Member member, const TLUpdate &v);
+    void moveMember(Member member, TLUpdate &v);
+    void destroyMember(Member member);
 };
 
 struct TELEGRAMQT_INTERNAL_EXPORT TLUpdates {
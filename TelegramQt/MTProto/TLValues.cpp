@@ -17,21 +17,935 @@
 
 #include "TLValues.hpp"
 
-#include <QMetaEnum>
+#include <algorithm>
 
-static const int ValueTypeEnumeratorIndex = TLValue::staticMetaObject.indexOfEnumerator("Value");
-static const QMetaEnum enumerator = TLValue::staticMetaObject.enumerator(ValueTypeEnumeratorIndex);
+namespace {
+
+struct TLValueName
+{
+    quint32 value;
+    const char *name;
+};
+
+// Sorted by the value
+constexpr TLValueName c_valueNames[] = {
+    // Generated TLValue names
+    { 0x007efe0e, "StorageFileJpeg" },
+    { 0x008c703f, "UserStatusOffline" },
+    { 0x00f49ca0, "UpdatesDifference" },
+    { 0x03173d78, "UpdatesGetChannelDifference" },
+    { 0x032c3e77, "InputGameID" },
+    { 0x039e9ea0, "MessagesSearch" },
+    { 0x0438865b, "InputStickeredMediaDocument" },
+    { 0x04deb57d, "MsgsStateInfo" },
+    { 0x04ede3cf, "MessagesFeaturedStickersNotModified" },
+    { 0x05162463, "ResPQ" },
+    { 0x0568a748, "KeyboardButtonSwitchInline" },
+    { 0x05a954c0, "MessagesReceivedMessages" },
+    { 0x05d1b8dd, "MessagesEditMessage" },
+    { 0x05d8c6cc, "DcOption" },
+    { 0x0637b7ed, "TopPeerCategoryCorrespondents" },
+    { 0x0656ac4b, "ChannelParticipantsSearch" },
+    { 0x07328bdb, "ChatForbidden" },
+    { 0x07761198, "UpdateChatParticipants" },
+    { 0x07bf09fc, "UserStatusLastWeek" },
+    { 0x08736a09, "ChannelsGetFullChannel" },
+    { 0x08b31c4f, "PageBlockCollage" },
+    { 0x08e57deb, "AccountSendChangePhoneCode" },
+    { 0x08fc711d, "AccountGetAccountTTL" },
+    { 0x0922aec1, "InputMediaPhotoExternal" },
+    { 0x0949d9dc, "FutureSalt" },
+    { 0x096a18d5, "UploadFile" },
+    { 0x09c2dd95, "MessagesSetBotPrecheckoutResults" },
+    { 0x09cb126e, "MessagesCreateChat" },
+    { 0x09d05049, "UserStatusEmpty" },
+    { 0x0a4f63c0, "StorageFilePng" },
+    { 0x0a63011e, "AuthCheckPassword" },
+    { 0x0a74b15b, "BotInlineMessageMediaAuto" },
+    { 0x0a7f6bbb, "ChannelsGetChannels" },
+    { 0x0a9f2259, "DestroyAuthKeyNone" },
+    { 0x0aa1c39f, "InputPaymentCredentialsApplePay" },
+    { 0x0ae30253, "MessageRange" },
+    { 0x0b17f890, "MessagesRecentStickersNotModified" },
+    { 0x0b2e4d7d, "LangpackGetDifference" },
+    { 0x0b446ae3, "MessagesMessagesSlice" },
+    { 0x0ba52007, "InputPrivacyValueDisallowContacts" },
+    { 0x0bb2d201, "UpdateStickerSetsOrder" },
+    { 0x0c7f49b7, "PrivacyValueDisallowUsers" },
+    { 0x0cb44b1c, "Channel" },
+    { 0x0d09e07b, "InputPrivacyValueAllowContacts" },
+    { 0x0d0a48c4, "MessagesGetCommonChats" },
+    { 0x0d91a548, "UsersGetUsers" },
+    { 0x0e0310d7, "HelpRecentMeUrls" },
+    { 0x0e17e23c, "PhotoSizeEmpty" },
+    { 0x0e306d3a, "MessagesReadHistory" },
+    { 0x0e48f964, "UpdateBotInlineSend" },
+    { 0x0ef02ce6, "DocumentAttributeVideo" },
+    { 0x0f0189d3, "MessagesReadMentions" },
+    { 0x0f220f3f, "UserFull" },
+    { 0x0f635e1b, "MessagesGetInlineGameHighScores" },
+    { 0x1081464c, "StorageFileWebp" },
+    { 0x10c2404b, "UpdateLangPackTooLong" },
+    { 0x10e6bd2c, "ChannelsCheckUsername" },
+    { 0x1117dd5f, "GeoPointEmpty" },
+    { 0x117698f1, "LangPackLanguage" },
+    { 0x11b58939, "DocumentAttributeAnimated" },
+    { 0x11f1331c, "UpdateShortSentMessage" },
+    { 0x11f812d8, "ContactsSearch" },
+    { 0x123e05e9, "ChannelsGetParticipants" },
+    { 0x1250abde, "AccountAuthorizations" },
+    { 0x12b299d4, "StickerPack" },
+    { 0x12b3ad31, "AccountGetNotifySettings" },
+    { 0x12b9417b, "UpdateUserPhone" },
+    { 0x12bcbd9a, "UpdateNewEncryptedMessage" },
+    { 0x130c8963, "PageBlockSlideshow" },
+    { 0x131cc67f, "InputPrivacyValueAllowUsers" },
+    { 0x13567e8a, "PageBlockUnsupported" },
+    { 0x137948a5, "AuthPasswordRecovery" },
+    { 0x13d6dd27, "EncryptedChatDiscarded" },
+    { 0x13e27f1e, "ChannelsEditAbout" },
+    { 0x1427a5e1, "ChannelParticipantsBanned" },
+    { 0x14637196, "InputFileLocation" },
+    { 0x148677e2, "TopPeerCategoryBotsInline" },
+    { 0x15051f54, "PhotosPhotosSlice" },
+    { 0x1516d7bd, "AccountSendConfirmPhoneCode" },
+    { 0x15590068, "DocumentAttributeFilename" },
+    { 0x15a3b8e3, "MessagesMigrateChat" },
+    { 0x15ad9f64, "MessagesSetInlineGameScore" },
+    { 0x15ba6c40, "MessagesDialogs" },
+    { 0x15ebac1d, "ChannelParticipant" },
+    { 0x161d9628, "TopPeerCategoryChannels" },
+    { 0x162ecc1f, "FoundGif" },
+    { 0x16812688, "UpdateShortChatMessage" },
+    { 0x16bf744e, "SendMessageTypingAction" },
+    { 0x1710f156, "UpdateEncryptedChatTyping" },
+    { 0x176f8ba1, "SendMessageGeoLocationAction" },
+    { 0x179be863, "InputPeerChat" },
+    { 0x17c6b5f6, "HelpSupport" },
+    { 0x17d54f61, "PhoneReceivedCall" },
+    { 0x17db940b, "BotInlineMediaResult" },
+    { 0x183040d3, "ChannelAdminLogEventActionParticipantJoin" },
+    { 0x1837c364, "InputEncryptedFileEmpty" },
+    { 0x184b35ce, "InputPrivacyValueAllowAll" },
+    { 0x18798952, "InputDocument" },
+    { 0x18cb9f78, "HelpInviteText" },
+    { 0x191ba9c5, "MessagesGetDialogs" },
+    { 0x193b4417, "InputNotifyUsers" },
+    { 0x199f3a6c, "ChannelsInviteToChannel" },
+    { 0x1aa1f784, "ContactsFound" },
+    { 0x1ae373ac, "ContactsResetTopPeerRating" },
+    { 0x1af91c09, "UploadReuploadCdnFile" },
+    { 0x1b067634, "AuthSignUp" },
+    { 0x1b3f4df7, "UpdateEditChannelMessage" },
+    { 0x1b7907ae, "ChannelAdminLogEventActionToggleInvites" },
+    { 0x1b8f4ad1, "PhoneCallWaiting" },
+    { 0x1bfbd823, "UpdateUserStatus" },
+    { 0x1c015b09, "MessagesDeleteHistory" },
+    { 0x1c138d15, "ContactsBlocked" },
+    { 0x1c536a34, "PhoneSetCallRating" },
+    { 0x1c9618b1, "MessagesGetAllStickers" },
+    { 0x1ca48f57, "InputChatPhotoEmpty" },
+    { 0x1cb5c415, "Vector" },
+    { 0x1cd7bf0d, "InputPhotoEmpty" },
+    { 0x1e22c78d, "InputReportReasonViolence" },
+    { 0x1e36fded, "InputPhoneCall" },
+    { 0x1e76a78c, "TopPeerCategoryPhoneCalls" },
+    { 0x1e8caaeb, "PostAddress" },
+    { 0x1f040578, "AuthCancelCode" },
+    { 0x1f2b0afd, "UpdateNewMessage" },
+    { 0x1f486803, "ExportedMessageLink" },
+    { 0x1f69b606, "ChannelsToggleSignatures" },
+    { 0x1fb33026, "HelpGetNearestDc" },
+    { 0x2000bcc3, "UploadGetCdnFile" },
+    { 0x200250ba, "UserEmpty" },
+    { 0x20212ca8, "PhotosPhoto" },
+    { 0x2049d70c, "GeoPoint" },
+    { 0x2064674e, "UpdatesChannelDifference" },
+    { 0x208e68c9, "InputMessageEntityMentionName" },
+    { 0x20adaef8, "InputPeerChannel" },
+    { 0x20b88214, "ChannelsEditAdmin" },
+    { 0x2144ca19, "RpcError" },
+    { 0x21ce0b0e, "MessagesGetFavedStickers" },
+    { 0x21e753bc, "UploadWebFile" },
+    { 0x222c1886, "ChannelParticipantBanned" },
+    { 0x226ccefb, "AuthCodeTypeFlashCall" },
+    { 0x227d824b, "PaymentsGetSavedInfo" },
+    { 0x2331b22d, "PhotoEmpty" },
+    { 0x23734b06, "EncryptedMessageService" },
+    { 0x243e1c66, "SendMessageUploadRoundAction" },
+    { 0x2442485e, "AccountSetAccountTTL" },
+    { 0x249431e2, "MessagesGetRecentLocations" },
+    { 0x24b524c5, "ChannelsJoinChannel" },
+    { 0x24e6818d, "UploadGetWebFile" },
+    { 0x25223e24, "MessagesGetWebPagePreview" },
+    { 0x2575bbb9, "UpdateContactRegistered" },
+    { 0x258aff05, "KeyboardButtonUrl" },
+    { 0x25939651, "UpdatesGetDifference" },
+    { 0x25d6c9c7, "UpdateReadChannelOutbox" },
+    { 0x2619a90e, "MessagesGetStickerSet" },
+    { 0x263d7c26, "PageBlockBlockquote" },
+    { 0x268f3f59, "ContactLinkHasPhone" },
+    { 0x26ae0971, "ChannelAdminLogEventActionToggleSignatures" },
+    { 0x26b5dde6, "MessagesMessageEditData" },
+    { 0x26cf8950, "MessagesGetDhConfig" },
+    { 0x2714d86c, "AccountCheckUsername" },
+    { 0x276d3ec6, "MsgDetailedInfo" },
+    { 0x277add7e, "PhoneSaveCallDebug" },
+    { 0x289da732, "ChannelForbidden" },
+    { 0x28a20571, "MessageEntityCode" },
+    { 0x292c7be9, "PageBlockEmbedPost" },
+    { 0x292fed13, "InputBotInlineMessageMediaAuto" },
+    { 0x2979eeb2, "LangPackStringDeleted" },
+    { 0x2b8879b3, "PaymentsSendPaymentForm" },
+    { 0x2c221edd, "MessagesDhConfig" },
+    { 0x2c800be5, "ContactsImportContacts" },
+    { 0x2cbbe15a, "InputBotInlineResult" },
+    { 0x2d9776b9, "MessagesGetPeerDialogs" },
+    { 0x2dacca4f, "MessagesGetFeaturedStickers" },
+    { 0x2daf01a7, "InputBotInlineMessageMediaContact" },
+    { 0x2dc173c8, "InputEncryptedFileBigUploaded" },
+    { 0x2e02a614, "ChatFull" },
+    { 0x2e0709a5, "MessagesSavedGifs" },
+    { 0x2e13f4c3, "User" },
+    { 0x2e1ee318, "LangpackGetStrings" },
+    { 0x2e59d922, "InputReportReasonPornography" },
+    { 0x2ec0533f, "MessageMediaVenue" },
+    { 0x2efe1722, "PhoneConfirmCall" },
+    { 0x2f2f21bf, "UpdateReadHistoryOutbox" },
+    { 0x2f37e231, "InputMediaUploadedPhoto" },
+    { 0x3072cfa1, "GzipPacked" },
+    { 0x31b81a7f, "PageBlockAudio" },
+    { 0x327a30cb, "MessagesSaveGif" },
+    { 0x3289be6a, "MessagesToggleDialogPin" },
+    { 0x32ca8f91, "MessagesGetWebPage" },
+    { 0x32d439a4, "MessagesSendEncryptedService" },
+    { 0x332b49fc, "ContactsBlock" },
+    { 0x3354678f, "UpdatePtsChanged" },
+    { 0x3371c354, "MessagesPeerDialogs" },
+    { 0x338e2464, "MessagesGetDocumentByHash" },
+    { 0x33963bf9, "MessagesForwardMessage" },
+    { 0x33ddf480, "ChannelsGetAdminLog" },
+    { 0x3407e51b, "StickerSetMultiCovered" },
+    { 0x3417d728, "InputPaymentCredentials" },
+    { 0x347773c5, "Pong" },
+    { 0x350170f3, "HelpGetTermsOfService" },
+    { 0x3502758c, "ReplyKeyboardMarkup" },
+    { 0x3514b3de, "ChannelsUpdateUsername" },
+    { 0x352dca58, "MessageEntityMentionName" },
+    { 0x35e410a8, "MessagesStickerSetInstallResultArchive" },
+    { 0x35edb4d4, "BotInlineMessageMediaContact" },
+    { 0x36585ea4, "MessagesBotCallbackAnswer" },
+    { 0x3672e09c, "MessagesGetPeerSettings" },
+    { 0x36a73f77, "MessagesReadMessageContents" },
+    { 0x36f8c871, "DocumentEmpty" },
+    { 0x3751b49e, "InputMessagesFilterMusic" },
+    { 0x37c1011c, "ChatPhotoEmpty" },
+    { 0x38641628, "MessagesStickerSetInstallResultSuccess" },
+    { 0x38935eb2, "InputPeerNotifySettings" },
+    { 0x38df3532, "AccountUpdateDeviceLocked" },
+    { 0x38fe25b7, "UpdateEncryptedMessagesRead" },
+    { 0x392718f8, "MessagesSaveRecentSticker" },
+    { 0x39f23300, "PageBlockCover" },
+    { 0x3a20ecb8, "InputMessagesFilterChatPhotos" },
+    { 0x3a58c7f4, "PageBlockList" },
+    { 0x3ace484c, "ContactsLink" },
+    { 0x3b5a3e40, "ChannelAdminLogEvent" },
+    { 0x3b831c66, "MessagesGetFullChat" },
+    { 0x3bcbf734, "DhGenOk" },
+    { 0x3bd2b4a0, "PhoneAcceptCall" },
+    { 0x3bf703dc, "EncryptedChatWaiting" },
+    { 0x3c20629f, "InlineBotSwitchPM" },
+    { 0x3c2884c1, "TextUrl" },
+    { 0x3c6aa187, "MessagesGetChats" },
+    { 0x3d662b7b, "PrivacyKeyPhoneCall" },
+    { 0x3dbb5986, "AuthSentCodeTypeApp" },
+    { 0x3dbc0415, "MessagesAcceptEncryption" },
+    { 0x3dc0f114, "HelpGetRecentMeUrls" },
+    { 0x3dc4b4f0, "InvokeAfterMsgs" },
+    { 0x3dcd7a87, "InputBotInlineMessageText" },
+    { 0x3ded6320, "MessageMediaEmpty" },
+    { 0x3e0bdd7c, "AccountUpdateUsername" },
+    { 0x3e11affb, "UpdatesChannelDifferenceEmpty" },
+    { 0x3eadb1bb, "MessagesCheckChatInvite" },
+    { 0x3ef1a9bf, "AuthResendCode" },
+    { 0x3f460fed, "ChatParticipants" },
+    { 0x3f56aea3, "PaymentsPaymentForm" },
+    { 0x3fedd339, "True" },
+    { 0x40699cd0, "MessageActionPaymentSent" },
+    { 0x40771900, "UpdateChannelWebPage" },
+    { 0x40bc6f52, "StorageFilePartial" },
+    { 0x418d4e0b, "AccountDeleteAccount" },
+    { 0x4214f37f, "UpdateReadChannelInbox" },
+    { 0x4222fa74, "MessagesGetMessages" },
+    { 0x42e047bb, "ChannelAdminLogEventActionDeleteMessage" },
+    { 0x430f0724, "InputDocumentFileLocation" },
+    { 0x4366232e, "BotInlineMessageMediaVenue" },
+    { 0x43ae3dec, "UpdateStickerSets" },
+    { 0x450a1c0a, "MessagesFoundGifs" },
+    { 0x46578472, "MessagesGetUnreadMentions" },
+    { 0x467a0766, "PageBlockParagraph" },
+    { 0x46dc1fb9, "DhGenRetry" },
+    { 0x46e1d13d, "RecentMeUrlUnknown" },
+    { 0x4792929b, "MessageActionScreenshotTaken" },
+    { 0x4843b0fd, "InputMediaGifExternal" },
+    { 0x48870999, "PageBlockFooter" },
+    { 0x488a7337, "MessageActionChatAddUser" },
+    { 0x48a30254, "ReplyInlineMarkup" },
+    { 0x49609307, "ChannelsToggleInvites" },
+    { 0x4a70994c, "EncryptedFile" },
+    { 0x4a82327e, "AccountGetTmpPassword" },
+    { 0x4a95e84e, "InputNotifyChats" },
+    { 0x4a992157, "InputStickeredMediaPhoto" },
+    { 0x4afe8f6d, "UpdatesDifferenceTooLong" },
+    { 0x4b09ebbc, "StorageFileMov" },
+    { 0x4b0c8c0f, "MessagesReportEncryptedSpam" },
+    { 0x4b425864, "InputBotInlineMessageGame" },
+    { 0x4d392343, "HelpGetInviteText" },
+    { 0x4d5bbe0c, "PrivacyValueAllowUsers" },
+    { 0x4e5f810d, "PaymentsPaymentResult" },
+    { 0x4e90bfd6, "UpdateMessageID" },
+    { 0x4ea56e92, "AuthRecoverPassword" },
+    { 0x4f11bae1, "UserProfilePhotoEmpty" },
+    { 0x4f32c098, "PhotosUploadProfilePhoto" },
+    { 0x4f4456d3, "PageBlockPullquote" },
+    { 0x4f96cb18, "InputPrivacyKeyStatusTimestamp" },
+    { 0x4fa417f2, "InputBotInlineResultGame" },
+    { 0x4fcba9c8, "MessagesArchivedStickers" },
+    { 0x4fe196fe, "ContactsImportCard" },
+    { 0x500911e1, "PaymentsPaymentReceipt" },
+    { 0x500e6dfa, "PrivacyKeyChatInvite" },
+    { 0x50ca4de1, "PhoneCallDiscarded" },
+    { 0x50f41ccf, "KeyboardButtonGame" },
+    { 0x50f5c392, "InputMessagesFilterVoice" },
+    { 0x514e999d, "MessagesGetInlineBotResults" },
+    { 0x519bc2b1, "MessagesUploadMedia" },
+    { 0x51bdb021, "MessageActionChatMigrateTo" },
+    { 0x52029342, "HelpGetCdnConfig" },
+    { 0x528a0677, "StorageFileMp3" },
+    { 0x5353e5a7, "AuthSentCodeTypeCall" },
+    { 0x5366c915, "PhoneCallEmpty" },
+    { 0x53d69076, "FileLocation" },
+    { 0x546dd7a6, "ChannelsGetParticipant" },
+    { 0x54826690, "UpdateBotInlineQuery" },
+    { 0x548a30f5, "AccountGetPassword" },
+    { 0x55188a2e, "ChannelAdminLogEventActionChangeAbout" },
+    { 0x55451fa9, "PhoneGetCallConfig" },
+    { 0x554abb6f, "AccountPrivacyRules" },
+    { 0x556ec7aa, "PageFull" },
+    { 0x55a5bb66, "MessagesReceivedQueue" },
+    { 0x56022f4d, "UpdateLangPack" },
+    { 0x560f8935, "MessagesSentEncryptedMessage" },
+    { 0x561bc879, "ContactBlocked" },
+    { 0x566decd0, "ChannelsEditTitle" },
+    { 0x56730bcc, "Null" },
+    { 0x56e0d474, "MessageMediaGeo" },
+    { 0x56e9f0e4, "InputMessagesFilterPhotoVideo" },
+    { 0x5717da40, "AuthLogOut" },
+    { 0x571d2742, "UpdateReadFeaturedStickers" },
+    { 0x5725e40a, "CdnConfig" },
+    { 0x57adc690, "PhoneCallDiscardReasonHangup" },
+    { 0x57e2f66c, "InputMessagesFilterEmpty" },
+    { 0x57f17692, "MessagesGetArchivedStickers" },
+    { 0x58cf4249, "ChannelBannedRights" },
+    { 0x58dbcab8, "InputReportReasonSpam" },
+    { 0x58e4a740, "RpcDropAnswer" },
+    { 0x58fffcd0, "HighScore" },
+    { 0x59ab389e, "ContactsDeleteContacts" },
+    { 0x5a17b5e5, "InputEncryptedFile" },
+    { 0x5a686d7c, "ChatInviteAlready" },
+    { 0x5acb668e, "InputMediaDocument" },
+    { 0x5b118126, "MessagesReadFeaturedStickers" },
+    { 0x5b95b3d4, "PhoneRequestCall" },
+    { 0x5c486927, "UpdateUserTyping" },
+    { 0x5ce14175, "PopularContact" },
+    { 0x5ce20970, "MessagesRecentStickers" },
+    { 0x5d2f3aa9, "UpdateBotPrecheckoutQuery" },
+    { 0x5d75a138, "UpdatesDifferenceEmpty" },
+    { 0x5d7ceba5, "ChannelAdminRights" },
+    { 0x5e002502, "AuthSentCode" },
+    { 0x5e2ad36e, "RpcAnswerUnknown" },
+    { 0x5e7d2f39, "MessageMediaContact" },
+    { 0x5ea192c9, "MessagesGetRecentStickers" },
+    { 0x5f07b4bc, "WebPage" },
+    { 0x5f2178c3, "AccountConfirmPhone" },
+    { 0x5f4f9247, "ContactLinkUnknown" },
+    { 0x5f5c95f1, "ChannelAdminLogEventActionTogglePreHistoryHidden" },
+    { 0x60469778, "ReqPq" },
+    { 0x6153276a, "ChatPhoto" },
+    { 0x628cbc6f, "SendMessageChooseContactAction" },
+    { 0x62ba04d9, "UpdateNewChannelMessage" },
+    { 0x62d350c9, "DestroySessionNone" },
+    { 0x62d6b459, "MsgsAck" },
+    { 0x63117f24, "WallPaperSolid" },
+    { 0x6319d612, "DocumentAttributeSticker" },
+    { 0x637ea878, "AccountRegisterDevice" },
+    { 0x6410a5d2, "StickerSetCovered" },
+    { 0x64bd0306, "InputEncryptedFileUploaded" },
+    { 0x64e475c2, "MessageEntityEmail" },
+    { 0x64ff9fd5, "MessagesChats" },
+    { 0x65427b82, "PrivacyValueAllowAll" },
+    { 0x65b8c79f, "MessagesGetMaskStickers" },
+    { 0x65c55b40, "AccountUnregisterDevice" },
+    { 0x6628562c, "AccountUpdateStatus" },
+    { 0x6643b654, "ClientDHInnerData" },
+    { 0x6724abc4, "TextBold" },
+    { 0x67a3ff2c, "AuthImportBotAuthorization" },
+    { 0x683a5e46, "KeyboardButtonCallback" },
+    { 0x688a30aa, "UpdateNewStickerSet" },
+    { 0x68c13933, "UpdateReadMessagesContents" },
+    { 0x69df3769, "ChatInviteEmpty" },
+    { 0x6a3f8d65, "MessagesGetAllDrafts" },
+    { 0x6a4afc38, "ChannelAdminLogEventActionChangeUsername" },
+    { 0x6a9d7b35, "UpdatesChannelDifferenceTooLong" },
+    { 0x6b56b921, "PaymentsPaymentVerficationNeeded" },
+    { 0x6c37c15c, "DocumentAttributeImageSize" },
+    { 0x6c3f19b9, "TextFixed" },
+    { 0x6c47ac9f, "LangPackStringPluralized" },
+    { 0x6c50051c, "MessagesImportChatInvite" },
+    { 0x6cef8ac7, "MessageEntityBotCommand" },
+    { 0x6d003d3f, "PhoneCallAccepted" },
+    { 0x6d1ded88, "PeerNotifyEventsAll" },
+    { 0x6e5f8c22, "UpdateChatParticipantDelete" },
+    { 0x6e947941, "UpdateChatAdmins" },
+    { 0x6ed02538, "MessageEntityUrl" },
+    { 0x6f02f748, "HelpSaveAppLog" },
+    { 0x6f635b0d, "MessageEntityHashtag" },
+    { 0x6fe51dfb, "AuthCheckPhone" },
+    { 0x7084a7be, "UpdateContactsReset" },
+    { 0x708e0195, "MessagesForwardMessages" },
+    { 0x709b2405, "ChannelAdminLogEventActionEditMessage" },
+    { 0x70a68512, "PeerNotifySettingsEmpty" },
+    { 0x70abc3fd, "PageBlockTitle" },
+    { 0x70b772a8, "ContactsTopPeers" },
+    { 0x70c32edb, "AccountChangePhone" },
+    { 0x70db6837, "UpdateChannelAvailableMessages" },
+    { 0x71e094f3, "MessagesDialogsSlice" },
+    { 0x725b04c3, "UpdatesCombined" },
+    { 0x72a3158c, "AuthCodeTypeSms" },
+    { 0x72f0eaae, "InputDocumentEmpty" },
+    { 0x73924be0, "MessageEntityPre" },
+    { 0x73f1f8dc, "MsgContainer" },
+    { 0x741cd3e3, "AuthCodeTypeCall" },
+    { 0x744694e0, "TextPlain" },
+    { 0x74535f21, "MessagesMessagesNotModified" },
+    { 0x74ae4240, "Updates" },
+    { 0x74d07c60, "NotifyAll" },
+    { 0x76a6d327, "MessageEntityTextUrl" },
+    { 0x76af5481, "ChannelFull" },
+    { 0x770656a8, "InputAppEvent" },
+    { 0x770a8e74, "PaymentsValidateRequestedInfo" },
+    { 0x771c1d97, "AuthSendInvites" },
+    { 0x77608b83, "KeyboardButtonRow" },
+    { 0x77bfb61b, "PhotoSize" },
+    { 0x77d01c3b, "ContactsImportedContacts" },
+    { 0x77ebc742, "UserStatusLastMonth" },
+    { 0x77eec38f, "CdnFileHash" },
+    { 0x78337739, "MessagesReorderStickerSets" },
+    { 0x78515775, "AccountUpdateProfile" },
+    { 0x78d413a6, "PhoneDiscardCall" },
+    { 0x78d4dec1, "UpdateShort" },
+    { 0x791451ed, "MessagesSetEncryptedTyping" },
+    { 0x795667a6, "InputPaymentCredentialsAndroidPay" },
+    { 0x79cb045d, "ServerDHParamsFail" },
+    { 0x7a7c17a4, "InputMessagesFilterRoundVoice" },
+    { 0x7abe77ec, "Ping" },
+    { 0x7b1a118f, "InputMediaGeoLive" },
+    { 0x7b8e7de6, "InputPeerUser" },
+    { 0x7bf2e6f6, "Authorization" },
+    { 0x7c18141c, "AccountPassword" },
+    { 0x7c3c2609, "MessageMediaGeoLive" },
+    { 0x7c4414d3, "MessageMediaDocument" },
+    { 0x7c596b46, "FileLocationUnavailable" },
+    { 0x7d748d04, "DataJSON" },
+    { 0x7d861a08, "MsgResendReq" },
+    { 0x7d885289, "MessagesExportChatInvite" },
+    { 0x7da07ec9, "InputPeerSelf" },
+    { 0x7e6260d7, "TextConcat" },
+    { 0x7ef0dd87, "InputMessagesFilterUrl" },
+    { 0x7f077ad9, "ContactsResolvedPeer" },
+    { 0x7f3b18ea, "InputPeerEmpty" },
+    { 0x7f4b690a, "MessagesReadEncryptedHistory" },
+    { 0x7f891213, "UpdateWebPage" },
+    { 0x7fcb13a8, "MessageActionChatEditPhoto" },
+    { 0x800fd57d, "LangpackGetLanguages" },
+    { 0x809db6df, "MsgNewDetailedInfo" },
+    { 0x80c99768, "InputMessagesFilterPhoneCalls" },
+    { 0x80e11a7f, "MessageActionPhoneCall" },
+    { 0x80ece81a, "UpdateUserBlocked" },
+    { 0x810a9fec, "MessagesGetBotCallbackAnswer" },
+    { 0x811ea28e, "AuthCheckedPhone" },
+    { 0x818426cd, "PeerSettings" },
+    { 0x81fa373a, "InputMediaPhoto" },
+    { 0x826f8b60, "MessageEntityItalic" },
+    { 0x8317c0c3, "UpdateBotWebhookJSON" },
+    { 0x83761ce4, "PhoneCallRequested" },
+    { 0x83bf3d52, "MessagesGetSavedGifs" },
+    { 0x83c95aec, "PQInnerData" },
+    { 0x83e5de54, "MessageEmpty" },
+    { 0x84551347, "MessageMediaInvoice" },
+    { 0x84be5b93, "AccountUpdateNotifySettings" },
+    { 0x84c1fd4e, "ChannelsDeleteMessages" },
+    { 0x84d19185, "MessagesAffectedMessages" },
+    { 0x84e53737, "ContactsExportCard" },
+    { 0x85849473, "WebPageNotModified" },
+    { 0x85e42301, "PhoneCallDiscardReasonMissed" },
+    { 0x861cc8a0, "InputStickerSetShortName" },
+    { 0x8653febe, "StickersAddStickerToSet" },
+    { 0x86916deb, "AccountPasswordInputSettings" },
+    { 0x86aef0ec, "AuthSendCode" },
+    { 0x87232bc7, "Document" },
+    { 0x879537f1, "ContactsResetSaved" },
+    { 0x87cf7f2f, "PhotosDeletePhotos" },
+    { 0x88f27fbc, "SendMessageRecordRoundAction" },
+    { 0x890c3d89, "InputBotInlineMessageID" },
+    { 0x8953ad37, "InputChatPhoto" },
+    { 0x8987f311, "HelpAppUpdate" },
+    { 0x89893b45, "UpdateChannelReadMessagesContents" },
+    { 0x8999602d, "MessagesClearRecentStickers" },
+    { 0x8a8ecd32, "MessagesStickers" },
+    { 0x8b73e763, "PrivacyValueDisallowAll" },
+    { 0x8c718e87, "MessagesMessages" },
+    { 0x8c7f65e2, "BotInlineMessageText" },
+    { 0x8cc0d131, "MsgsAllInfo" },
+    { 0x8d8d82d7, "ChannelsGetAdminedPublicChannels" },
+    { 0x8dbc3336, "RecentMeUrlUser" },
+    { 0x8dca6aa5, "PhotosPhotos" },
+    { 0x8e1a1775, "NearestDc" },
+    { 0x8e3f9ebe, "PagePart" },
+    { 0x8e48a188, "AuthDropTempAuthKeys" },
+    { 0x8e5e9873, "UpdateDcOptions" },
+    { 0x8e953744, "ContactsDeleteContact" },
+    { 0x8ef8ecc0, "MessagesSetGameScore" },
+    { 0x8f31b327, "MessageActionPaymentSentMe" },
+    { 0x8ffa9a1f, "PageBlockSubtitle" },
+    { 0x900802a1, "ContactsBlockedSlice" },
+    { 0x9010ef6f, "HelpGetAppChangelog" },
+    { 0x90110467, "InputPrivacyValueDisallowUsers" },
+    { 0x909c3f94, "PaymentRequestedInfo" },
+    { 0x90dddc11, "Message" },
+    { 0x914fbf11, "UpdateShortMessage" },
+    { 0x91cd32a8, "PhotosGetUserPhotos" },
+    { 0x92153685, "InputMediaInvoice" },
+    { 0x927c55b4, "InputChatUploadedPhoto" },
+    { 0x9288dd29, "Photo" },
+    { 0x9299359f, "HttpWait" },
+    { 0x92a72876, "MessageActionGameScore" },
+    { 0x9375341e, "UpdateSavedGifs" },
+    { 0x93d7b347, "ChannelsGetMessages" },
+    { 0x947ca848, "MessagesBotResults" },
+    { 0x9493ff32, "MessagesSentEncryptedFile" },
+    { 0x94bd38ed, "MessageActionPinMessage" },
+    { 0x94d42ee7, "ChannelMessagesFilterEmpty" },
+    { 0x95313b0c, "UpdateUserPhoto" },
+    { 0x959ff644, "MessagesReorderPinnedDialogs" },
+    { 0x95d2ac92, "MessageActionChannelCreate" },
+    { 0x95e3fbef, "MessageActionChatDeletePhoto" },
+    { 0x9609a51c, "InputMessagesFilterPhotos" },
+    { 0x9664f57f, "InputMediaEmpty" },
+    { 0x96dabc18, "AccountNoPassword" },
+    { 0x9801d2f7, "DocumentAttributeHasStickers" },
+    { 0x9852f9c6, "DocumentAttributeAudio" },
+    { 0x98592475, "UpdateChannelPinnedMessage" },
+    { 0x98a12b4b, "UpdateChannelMessageViews" },
+    { 0x98e81d3a, "BotInfo" },
+    { 0x99262e37, "MessagesChannelMessages" },
+    { 0x9961fd5c, "UpdateReadHistoryInbox" },
+    { 0x997275b5, "BoolTrue" },
+    { 0x99f09745, "PaymentsGetPaymentForm" },
+    { 0x9a3bfd99, "MessagesHighScores" },
+    { 0x9a422c20, "UpdateRecentStickers" },
+    { 0x9a5f6e95, "ContestSaveDeveloperInfo" },
+    { 0x9a65ea1f, "UpdateChatUserTyping" },
+    { 0x9a901b66, "MessagesSendEncryptedFile" },
+    { 0x9ab5c58e, "LangpackGetLangPack" },
+    { 0x9acda4c0, "PeerNotifySettings" },
+    { 0x9b9240a6, "UpdateBotWebhookJSONQuery" },
+    { 0x9ba2d800, "ChatEmpty" },
+    { 0x9bd86e6a, "StickersCreateStickerSet" },
+    { 0x9bebaeb9, "BotInlineResult" },
+    { 0x9bed434d, "InputWebDocument" },
+    { 0x9bf8bb95, "TextStrike" },
+    { 0x9c750409, "FoundGifCached" },
+    { 0x9c840964, "Config" },
+    { 0x9cd81144, "MessagesChatsSlice" },
+    { 0x9cdf08cd, "HelpGetSupport" },
+    { 0x9d2e67c5, "UpdateContactLink" },
+    { 0x9d4c17c0, "PhoneConnection" },
+    { 0x9db1bc6d, "PeerUser" },
+    { 0x9de7a269, "InputStickerSetID" },
+    { 0x9e19a1f6, "MessageService" },
+    { 0x9e3cacb0, "MessagesSearchGlobal" },
+    { 0x9e8fa6d3, "MessagesFavedStickersNotModified" },
+    { 0x9ec20908, "NewSessionCreated" },
+    { 0x9eddf188, "InputMessagesFilterDocument" },
+    { 0x9f84f49e, "MessageMediaUnsupported" },
+    { 0x9fab0d1a, "AuthResetAuthorizations" },
+    { 0x9fbab604, "MessageActionHistoryClear" },
+    { 0x9fc00e65, "InputMessagesFilterVideo" },
+    { 0x9fd40bd8, "NotifyPeer" },
+    { 0xa01b22f9, "RecentMeUrlChat" },
+    { 0xa03e5b85, "ReplyKeyboardHide" },
+    { 0xa092a980, "PaymentsGetPaymentReceipt" },
+    { 0xa187d66f, "SendMessageRecordVideoAction" },
+    { 0xa20db0e5, "UpdateDeleteMessages" },
+    { 0xa229dd06, "UpdateConfig" },
+    { 0xa2bb35cb, "PhoneCallProtocol" },
+    { 0xa2fa4880, "KeyboardButton" },
+    { 0xa3289a6d, "ChannelParticipantSelf" },
+    { 0xa32dd600, "MessageMediaWebPage" },
+    { 0xa3825e50, "MessagesSetTyping" },
+    { 0xa384b779, "ReceivedNotifyMessage" },
+    { 0xa3b54985, "ChannelParticipantsKicked" },
+    { 0xa429b886, "InputNotifyAll" },
+    { 0xa43ad8b7, "RpcAnswerDropped" },
+    { 0xa56c2a3e, "UpdatesState" },
+    { 0xa6638b9a, "MessageActionChatCreate" },
+    { 0xa69dae02, "DhGenFail" },
+    { 0xa6e45987, "InputMediaContact" },
+    { 0xa72ded52, "ChannelsUpdatePinnedMessage" },
+    { 0xa7332b73, "UpdateUserName" },
+    { 0xa7eff811, "BadMsgNotification" },
+    { 0xa82fa898, "ChannelParticipantAdmin" },
+    { 0xa8d864a7, "InputBotInlineResultPhoto" },
+    { 0xa8f1709b, "MessagesHideReportSpam" },
+    { 0xa8fb1981, "UpdatesDifferenceSlice" },
+    { 0xa9776773, "MessagesSendEncrypted" },
+    { 0xa99fca4f, "UploadCdnFile" },
+    { 0xa9e69f2e, "MessagesEditChatAdmin" },
+    { 0xaa0cd9e4, "SendMessageUploadDocumentAction" },
+    { 0xaa2769ed, "BotsSendCustomRequest" },
+    { 0xaa963b05, "StorageFileUnknown" },
+    { 0xaaafadc8, "InputBotInlineMessageMediaVenue" },
+    { 0xab03c6d9, "AuthSentCodeTypeFlashCall" },
+    { 0xab0f6b1e, "UpdatePhoneCall" },
+    { 0xab661b5b, "TopPeerCategoryBotsPM" },
+    { 0xab7ec0a0, "EncryptedChatEmpty" },
+    { 0xadd53cb3, "PeerNotifyEventsEmpty" },
+    { 0xae189d5f, "AccountReportPeer" },
+    { 0xae1e508d, "StorageFilePdf" },
+    { 0xae2de196, "HelpGetAppUpdate" },
+    { 0xae500895, "FutureSalts" },
+    { 0xae636f24, "DisabledFeature" },
+    { 0xaed6dbb2, "MaskCoords" },
+    { 0xaf369d42, "ChannelsDeleteHistory" },
+    { 0xafd93fbb, "KeyboardButtonBuy" },
+    { 0xafeb712e, "InputChannel" },
+    { 0xb055eaee, "MessageActionChannelMigrateFrom" },
+    { 0xb0d1865b, "ChannelParticipantsBots" },
+    { 0xb0e08243, "MessagesEditInlineBotMessage" },
+    { 0xb16a6c29, "KeyboardButtonRequestPhone" },
+    { 0xb16e06fe, "MessagesSendInlineBotResult" },
+    { 0xb1c3caa7, "ChannelAdminLogEventActionChangeStickerSet" },
+    { 0xb2ae9b0c, "MessageActionChatDeleteUser" },
+    { 0xb304a621, "UploadSaveFilePart" },
+    { 0xb3cea0e4, "StorageFileMp4" },
+    { 0xb45c69d1, "MessagesAffectedHistory" },
+    { 0xb4608969, "ChannelParticipantsAdmins" },
+    { 0xb4a2e88d, "UpdateEncryption" },
+    { 0xb4c83b4c, "NotifyUsers" },
+    { 0xb5223b0f, "MessageMediaPhoto" },
+    { 0xb549da53, "InputMessagesFilterRoundVideo" },
+    { 0xb5890dba, "ServerDHInnerData" },
+    { 0xb5a1ce5a, "MessageActionChatEditTitle" },
+    { 0xb60a24a6, "MessagesStickerSet" },
+    { 0xb6213cdf, "ShippingOption" },
+    { 0xb6901959, "UpdateChatParticipantAdmin" },
+    { 0xb6aef7b0, "MessageActionEmpty" },
+    { 0xb6d45656, "UpdateChannel" },
+    { 0xb6f74335, "InputMediaDocumentExternal" },
+    { 0xb722de65, "BotInlineMessageMediaGeo" },
+    { 0xb74ba9d2, "ContactsContactsNotModified" },
+    { 0xb7b72ab3, "AccountPasswordSettings" },
+    { 0xb82f55c3, "ChannelAdminLogEventActionChangePhoto" },
+    { 0xb8bc5b0c, "InputNotifyPeer" },
+    { 0xb8d0afdf, "AccountDaysTTL" },
+    { 0xb921bd04, "GetFutureSalts" },
+    { 0xb98886cf, "InputUserEmpty" },
+    { 0xb9ffc55b, "MessagesFaveSticker" },
+    { 0xba4baec5, "DraftMessageEmpty" },
+    { 0xbaafe5e0, "PageBlockAuthorDate" },
+    { 0xbad0e5bb, "PeerChat" },
+    { 0xbb92ba95, "MessageEntityUnknown" },
+    { 0xbc0a57dc, "RecentMeUrlStickerSet" },
+    { 0xbc2eab30, "PrivacyKeyStatusTimestamp" },
+    { 0xbc39e14b, "MessagesSaveDraft" },
+    { 0xbc799737, "BoolFalse" },
+    { 0xbc8d11bb, "AccountGetPasswordSettings" },
+    { 0xbcd51581, "AuthSignIn" },
+    { 0xbd17a14a, "TopPeerCategoryGroups" },
+    { 0xbd610bc9, "MessageEntityBold" },
+    { 0xbddde532, "PeerChannel" },
+    { 0xbdf9653b, "Game" },
+    { 0xbdfb0426, "InputPrivacyKeyChatInvite" },
+    { 0xbec268ef, "UpdateNotifySettings" },
+    { 0xbf9459b7, "InvokeWithoutUpdates" },
+    { 0xbf9a776b, "MessagesSearchGifs" },
+    { 0xbfd064ec, "PageBlockHeader" },
+    { 0xbfd915cd, "ChannelsEditBanned" },
+    { 0xc000bba2, "AuthSentCodeTypeSms" },
+    { 0xc007cec3, "NotifyChats" },
+    { 0xc0111fe3, "ChannelsDeleteChannel" },
+    { 0xc023849f, "ContactsGetContacts" },
+    { 0xc04cfac2, "AccountGetWallPapers" },
+    { 0xc070d93e, "PageBlockPreformatted" },
+    { 0xc0e24635, "MessagesDhConfigNotModified" },
+    { 0xc10eb2cf, "InputPaymentCredentialsSaved" },
+    { 0xc12622c4, "TextUnderline" },
+    { 0xc13d1c11, "InputMediaVenue" },
+    { 0xc1b15d65, "InputBotInlineMessageMediaGeo" },
+    { 0xc1f8e69a, "InputMessagesFilterMyMentions" },
+    { 0xc21f497e, "EncryptedFileEmpty" },
+    { 0xc239d686, "InputWebFileLocation" },
+    { 0xc27ac8c7, "BotCommand" },
+    { 0xc30aa358, "Invoice" },
+    { 0xc331e80a, "InputGameShortName" },
+    { 0xc37521c9, "UpdateDeleteChannelMessages" },
+    { 0xc45a6536, "HelpNoAppUpdate" },
+    { 0xc4a353ee, "ContactsGetStatuses" },
+    { 0xc4b9f9bb, "Error" },
+    { 0xc4c8a55d, "MessagesGetMessagesViews" },
+    { 0xc4f9186b, "HelpGetConfig" },
+    { 0xc586da1c, "WebPagePending" },
+    { 0xc61acbd8, "WebDocument" },
+    { 0xc7481da6, "InitConnection" },
+    { 0xc7560885, "ChannelsExportInvite" },
+    { 0xc78fe460, "MessagesInstallStickerSet" },
+    { 0xc846d22d, "ChannelsExportMessageLink" },
+    { 0xc878527e, "EncryptedChatRequested" },
+    { 0xc8d7493e, "ChatParticipant" },
+    { 0xc8f16791, "MessagesSendMedia" },
+    { 0xc97df020, "MessagesSendScreenshotNotification" },
+    { 0xc982eaba, "CdnPublicKey" },
+    { 0xc9f81ce8, "AccountSetPrivacy" },
+    { 0xca30a5b1, "UsersGetFullUser" },
+    { 0xca4c79d8, "MessagesEditChatPhoto" },
+    { 0xcad181f6, "LangPackString" },
+    { 0xcae1aadf, "StorageFileGif" },
+    { 0xcb296bf8, "LabeledPrice" },
+    { 0xcb9f372d, "InvokeAfterMsg" },
+    { 0xcc104937, "ChannelsReadHistory" },
+    { 0xcc5b67cc, "MessagesGetAttachedStickers" },
+    { 0xccb03657, "WallPaper" },
+    { 0xcd050916, "AuthAuthorization" },
+    { 0xcd303b41, "StickerSet" },
+    { 0xcd77d957, "ChannelMessagesFilter" },
+    { 0xcd78e586, "RpcAnswerDroppedRunning" },
+    { 0xcdc27a1f, "PaymentSavedCredentialsCard" },
+    { 0xcdd42a05, "AuthBindTempAuthKey" },
+    { 0xcde200d1, "PageBlockEmbed" },
+    { 0xce0d37b0, "PageBlockAnchor" },
+    { 0xcf1592db, "MessagesReportSpam" },
+    { 0xd0028438, "ImportedContact" },
+    { 0xd0d9b163, "ChannelsChannelParticipant" },
+    { 0xd0e8075c, "ServerDHParamsOk" },
+    { 0xd10dd71b, "ChannelsDeleteUserHistory" },
+    { 0xd1435160, "DestroyAuthKey" },
+    { 0xd1451883, "PaymentsValidatedRequestedInfo" },
+    { 0xd1d34a26, "SendMessageUploadPhotoAction" },
+    { 0xd33f43f3, "InputMediaGame" },
+    { 0xd3680c61, "ContactStatus" },
+    { 0xd433ad73, "IpPort" },
+    { 0xd4982db5, "ContactsGetTopPeers" },
+    { 0xd502c2d0, "ContactLinkContact" },
+    { 0xd52f73f7, "SendMessageRecordAudioAction" },
+    { 0xd559d8c8, "UserProfilePhoto" },
+    { 0xd5676710, "ChannelAdminLogEventActionParticipantToggleAdmin" },
+    { 0xd58f130a, "MessagesSetBotCallbackAnswer" },
+    { 0xd66b66c9, "InputPrivacyValueDisallowAll" },
+    { 0xd711a2cc, "UpdateDialogPinned" },
+    { 0xd712e4be, "ReqDHParams" },
+    { 0xd8292816, "InputUser" },
+    { 0xd83d70c1, "PaymentsClearSavedInfo" },
+    { 0xd897bc66, "AuthRequestPasswordRecovery" },
+    { 0xd8caf68d, "UpdatePinnedDialogs" },
+    { 0xd912a59c, "TextItalic" },
+    { 0xd91cdd54, "Chat" },
+    { 0xd997c3c5, "HelpConfigSimple" },
+    { 0xd9d71866, "PageBlockVideo" },
+    { 0xda13538a, "ChatParticipantCreator" },
+    { 0xda69fb52, "MsgsStateReq" },
+    { 0xda9b0d0d, "InvokeWithLayer" },
+    { 0xdadbc950, "AccountGetPrivacy" },
+    { 0xdb20b188, "PageBlockDivider" },
+    { 0xdb64fd34, "AccountTmpPassword" },
+    { 0xdb74f558, "ChatInvite" },
+    { 0xdb7e1747, "AccountResetNotifySettings" },
+    { 0xdc3d824f, "TextEmpty" },
+    { 0xdc452855, "MessagesEditChatTitle" },
+    { 0xdcbb8260, "MessagesGetHistory" },
+    { 0xdd6a8f48, "SendMessageGamePlayAction" },
+    { 0xde266ef5, "ContactsTopPeersNotModified" },
+    { 0xde3f3c79, "ChannelParticipantsRecent" },
+    { 0xde5a0dd6, "TextEmail" },
+    { 0xde7b673d, "UploadSaveBigFilePart" },
+    { 0xdf77f3bc, "AccountResetAuthorization" },
+    { 0xdf969c2d, "AuthExportedAuthorization" },
+    { 0xe06046b2, "MsgCopy" },
+    { 0xe0611f16, "MessagesDeleteChatUser" },
+    { 0xe062db83, "InputMessagesFilterContacts" },
+    { 0xe095c1a0, "PhoneCallDiscardReasonDisconnect" },
+    { 0xe0cdc940, "UpdateBotShippingQuery" },
+    { 0xe1746d0a, "InputReportReasonOther" },
+    { 0xe22045fc, "DestroySessionOk" },
+    { 0xe254d64e, "MessagesGetPinnedDialogs" },
+    { 0xe26f42f1, "UserStatusRecently" },
+    { 0xe2d6e436, "ChatParticipantAdmin" },
+    { 0xe317af7e, "UpdatesTooLong" },
+    { 0xe31c34d8, "ChannelAdminLogEventActionParticipantInvite" },
+    { 0xe320c158, "AccountGetAuthorizations" },
+    { 0xe39621fd, "InputMediaUploadedDocument" },
+    { 0xe3a6cfb5, "UploadGetFile" },
+    { 0xe3e2e1f9, "ChannelParticipantCreator" },
+    { 0xe3ef9613, "AuthImportAuthorization" },
+    { 0xe40370a3, "UpdateEditMessage" },
+    { 0xe4c123d6, "InputGeoPointEmpty" },
+    { 0xe4def5db, "Dialog" },
+    { 0xe511996d, "UpdateFavedStickers" },
+    { 0xe54100bd, "ContactsUnblock" },
+    { 0xe58e95d2, "MessagesDeleteMessages" },
+    { 0xe5bfffcd, "AuthExportAuthorization" },
+    { 0xe5d7d19c, "MessagesChatFull" },
+    { 0xe5f672fa, "MessagesSetBotShippingResults" },
+    { 0xe6213f4d, "BotsAnswerWebhookJSONQuery" },
+    { 0xe6d83d7e, "ChannelAdminLogEventActionParticipantToggleBan" },
+    { 0xe6df7378, "MessagesStartBot" },
+    { 0xe6dfb825, "ChannelAdminLogEventActionChangeTitle" },
+    { 0xe7026d0d, "InputMessagesFilterGeo" },
+    { 0xe73547e1, "UpdateBotCallbackQuery" },
+    { 0xe7512126, "DestroySession" },
+    { 0xe8025ca2, "MessagesSavedGifsNotModified" },
+    { 0xe822649d, "MessagesGetGameHighScores" },
+    { 0xe86602c3, "MessagesAllStickersNotModified" },
+    { 0xe86a2c74, "InputPeerNotifyEventsAll" },
+    { 0xe9763aec, "SendMessageUploadVideoAction" },
+    { 0xe9a734fa, "PhotoCachedSize" },
+    { 0xe9c69982, "PageBlockPhoto" },
+    { 0xe9e82c18, "ChannelAdminLogEventActionUpdatePinned" },
+    { 0xea02c27e, "PaymentCharge" },
+    { 0xea107ae4, "ChannelAdminLogEventsFilter" },
+    { 0xea109b13, "DestroyAuthKeyFail" },
+    { 0xea4b0e5c, "UpdateChatParticipantAdd" },
+    { 0xea52fe5a, "UploadFileCdnRedirect" },
+    { 0xea8ca4f9, "ChannelsSetStickers" },
+    { 0xeab5dc38, "ChannelsReadMessageContents" },
+    { 0xeabbb94c, "ChannelsTogglePreHistoryHidden" },
+    { 0xeae87e42, "ContactsContacts" },
+    { 0xeb0467fb, "UpdateChannelTooLong" },
+    { 0xeb1477e8, "WebPageEmpty" },
+    { 0xeb49081d, "RecentMeUrlChatInvite" },
+    { 0xeb5ea206, "MessagesSetInlineBotResults" },
+    { 0xeba80ff0, "MessagesGetAllChats" },
+    { 0xebe46819, "UpdateServiceNotification" },
+    { 0xec22cfcd, "HelpSetBotUpdatesStatus" },
+    { 0xec82e140, "PhonePhoneCall" },
+    { 0xec8bd9e1, "MessagesToggleChatAdmins" },
+    { 0xed18c118, "EncryptedMessage" },
+    { 0xed8af74d, "ChannelsAdminLogResults" },
+    { 0xedab447b, "BadServerSalt" },
+    { 0xedb93949, "UserStatusOnline" },
+    { 0xedcdc05b, "TopPeer" },
+    { 0xedd4882a, "UpdatesGetState" },
+    { 0xedd923c5, "MessagesDiscardEncryption" },
+    { 0xedfd405f, "MessagesAllStickers" },
+    { 0xee2bb969, "UpdateDraftMessage" },
+    { 0xee3b272a, "UpdatePrivacy" },
+    { 0xee8c1e86, "InputChannelEmpty" },
+    { 0xeea8e46e, "UploadCdnFileReuploadNeeded" },
+    { 0xef1751b5, "PageBlockChannel" },
+    { 0xf0173fe9, "ChannelsChannelParticipantsNotModified" },
+    { 0xf03064d8, "InputPeerNotifyEventsEmpty" },
+    { 0xf0bb5152, "PhotosUpdateProfilePhoto" },
+    { 0xf12bb6e1, "PageBlockSubheader" },
+    { 0xf12e57c9, "ChannelsEditPhoto" },
+    { 0xf141b5e1, "InputEncryptedChat" },
+    { 0xf1749a22, "MessagesStickersNotModified" },
+    { 0xf1ee3e90, "HelpTermsOfService" },
+    { 0xf3427b8c, "PingDelayDisconnect" },
+    { 0xf351d7ab, "SendMessageUploadAudioAction" },
+    { 0xf35c6d01, "RpcResult" },
+    { 0xf37f2f16, "MessagesFavedStickers" },
+    { 0xf385c1f6, "LangPackDifference" },
+    { 0xf392b7f4, "InputPhoneContact" },
+    { 0xf3b7acc9, "InputGeoPoint" },
+    { 0xf4108aa0, "ReplyKeyboardForceReply" },
+    { 0xf4893d7f, "ChannelsCreateChannel" },
+    { 0xf5045f1f, "SetClientDHParams" },
+    { 0xf5235d55, "InputEncryptedFileLocation" },
+    { 0xf52ff27f, "InputFile" },
+    { 0xf56ee2a8, "ChannelsChannelParticipants" },
+    { 0xf57c350f, "ContactsGetBlocked" },
+    { 0xf64daf43, "MessagesRequestEncryption" },
+    { 0xf660e1d4, "DestroyAuthKeyOk" },
+    { 0xf715c87b, "UploadGetCdnFileHashes" },
+    { 0xf7760f51, "StickersRemoveStickerFromSet" },
+    { 0xf7c1b13f, "InputUserSelf" },
+    { 0xf836aa95, "ChannelsLeaveChannel" },
+    { 0xf888fa1a, "PrivacyValueDisallowContacts" },
+    { 0xf89777f2, "ChannelAdminLogEventActionParticipantLeave" },
+    { 0xf89cf5e8, "MessageActionChatJoinedByLink" },
+    { 0xf89d88e5, "MessagesFeaturedStickers" },
+    { 0xf911c994, "Contact" },
+    { 0xf93ccba3, "ContactsResolveUsername" },
+    { 0xf96e55de, "MessagesUninstallStickerSet" },
+    { 0xf9a0aa09, "MessagesAddChatUser" },
+    { 0xf9c44144, "InputMediaGeoPoint" },
+    { 0xf9d27a5a, "UpdateInlineBotCallbackQuery" },
+    { 0xfa04579d, "MessageEntityMention" },
+    { 0xfa4f0bb5, "InputFileBig" },
+    { 0xfa56ce36, "EncryptedChat" },
+    { 0xfa7c4b86, "AccountUpdatePasswordSettings" },
+    { 0xfa88427a, "MessagesSendMessage" },
+    { 0xfabadc5f, "InputPrivacyKeyPhoneCall" },
+    { 0xfadff4ac, "MessageFwdHeader" },
+    { 0xfae69f56, "MessageActionCustomAction" },
+    { 0xfaf7e8c9, "PhoneCallDiscardReasonBusy" },
+    { 0xfb834291, "TopPeerCategoryPeers" },
+    { 0xfb8fe43c, "PaymentsSavedInfo" },
+    { 0xfb95c6c4, "InputPhoto" },
+    { 0xfc2e05bc, "ChatInviteExported" },
+    { 0xfc796b3f, "KeyboardButtonRequestGeoLocation" },
+    { 0xfc900c2b, "ChatParticipantsForbidden" },
+    { 0xfd5ec8f5, "SendMessageCancelAction" },
+    { 0xfd8e711f, "DraftMessage" },
+    { 0xfda68d36, "MessagesGetMessageEditData" },
+    { 0xfdb19008, "MessageMediaGame" },
+    { 0xfe087810, "ChannelsReportSpam" },
+    { 0xfeedd3ad, "ContactLinkNone" },
+    { 0xffa0a496, "InputStickerSetItem" },
+    { 0xffb62b95, "InputStickerSetEmpty" },
+    { 0xffb6d4ca, "StickersChangeStickerPosition" },
+    { 0xffc86587, "InputMessagesFilterGif" },
+    { 0xffe6ab67, "PhoneCall" },
+    { 0xfff8fdc4, "InputBotInlineResultDocument" },
+    { 0xfffe1bac, "PrivacyValueAllowContacts" },
+    // End of generated TLValue names
+};
+
+} // anonymous namespace
+
+const char *TLValue::name() const
+{
+    const TLValueName *end = c_valueNames + sizeof(c_valueNames) / sizeof(c_valueNames[0]);
+    const TLValueName *it = std::lower_bound(c_valueNames, end, quint32(m_value),
+                                             [](const TLValueName &entry, quint32 value) {
+        return entry.value < value;
+    });
+    if ((it == end) || (it->value != m_value)) {
+        return nullptr;
+    }
+    return it->name;
+}
 
 bool TLValue::isValid() const
 {
-    return enumerator.valueToKey(m_value);
+    return name();
 }
 
 QString TLValue::toString() const
 {
-    const char *value = enumerator.valueToKey(m_value);
-    if (value) {
-        return QString::fromLatin1(value);
+    const char *valueName = name();
+    if (valueName) {
+        return QString::fromLatin1(valueName);
     } else {
         return QString(QLatin1String("%1")).arg(m_value, 8, 16, QLatin1Char('0'));
     }
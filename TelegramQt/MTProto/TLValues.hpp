@@ -958,6 +958,9 @@ public:
 
     bool isValid() const;
 
+    // The predicate name (e.g. "ResPQ") or nullptr if the value is unknown. Does not allocate.
+    const char *name() const;
+
     TLValue &operator=(TLValue::Value v)
     {
         m_value = v;
@@ -516,8 +516,13 @@ ChannelsRpcLayer *MessagingApiPrivate::channelsLayer()
 
 void MessagingApiPrivate::onGetDialogsFinished(PendingOperation *operation, MessagesRpcLayer::PendingMessagesDialogs *rpcOperation)
 {
-    TLMessagesDialogs dialogs;
-    rpcOperation->getResult(&dialogs);
+    // The messages, chats and users are decoded one by one straight to the data storage
+    LazyMessagesDialogs dialogs;
+    {
+        MTProto::Stream replyStream;
+        messagesLayer()->prepareReplyStream(&replyStream, rpcOperation);
+        replyStream >> dialogs;
+    }
     dataInternalApi()->processData(dialogs);
     rpcOperation->deleteLater();
 
@@ -534,12 +539,11 @@ void MessagingApiPrivate::onGetDialogsFinished(PendingOperation *operation, Mess
         const TLDialog &lastTlDialog = dialogs.dialogs.last();
         const TLInputPeer inputPeer = dataInternalApi()->toInputPeer(lastTlDialog.peer);
         quint32 date = 0;
-        // Iterate over messages to get the last dialog date
-        for (const TLMessage &message : dialogs.messages) {
-            if ((message.id == lastTlDialog.topMessage) && (message.toId == lastTlDialog.peer)) {
-                date = message.date;
-                break;
-            }
+        // The top messages are already processed
+        const TLMessage *lastMessage = dataInternalApi()->getMessage(Utils::toPublicPeer(lastTlDialog.peer),
+                                                                     lastTlDialog.topMessage);
+        if (lastMessage) {
+            date = lastMessage->date;
         }
 
         quint32 excludePinned = 1;
@@ -18,9 +18,15 @@
 #include "RandomGenerator.hpp"
 
 #include <QCryptographicHash>
+#include <QThreadStorage>
 
+#include <openssl/crypto.h>
 #include <openssl/rand.h>
 
+#ifdef Q_OS_UNIX
+#include <unistd.h>
+#endif
+
 namespace Telegram {
 
 static RandomGenerator *s_randomGenerator = nullptr;
@@ -49,6 +55,67 @@ RandomGenerator *RandomGenerator::setInstance(RandomGenerator *instance)
     return previousGenerator;
 }
 
+struct RandomBuffer
+{
+    uchar data[BufferedRandomGenerator::BufferSize];
+    int offset = BufferedRandomGenerator::BufferSize; // Empty
+#ifdef Q_OS_UNIX
+    pid_t pid = 0;
+#endif
+
+    ~RandomBuffer()
+    {
+        OPENSSL_cleanse(data, sizeof(data));
+    }
+
+    bool refill()
+    {
+        if (RAND_bytes(data, sizeof(data)) != 1) {
+            offset = BufferedRandomGenerator::BufferSize;
+            return false;
+        }
+        offset = 0;
+#ifdef Q_OS_UNIX
+        pid = getpid();
+#endif
+        return true;
+    }
+};
+
+static QThreadStorage<RandomBuffer *> s_randomBuffer;
+
+int BufferedRandomGenerator::generate(void *buffer, int count)
+{
+    if (count <= 0) {
+        return 0;
+    }
+    // Large requests gain nothing from the buffering
+    if (count > BufferSize / 4) {
+        return RAND_bytes(static_cast<unsigned char *>(buffer), count) == 1 ? count : 0;
+    }
+    if (!s_randomBuffer.hasLocalData()) {
+        s_randomBuffer.setLocalData(new RandomBuffer());
+    }
+    RandomBuffer *randomBuffer = s_randomBuffer.localData();
+#ifdef Q_OS_UNIX
+    // Never share the bytes with a forked child (or the parent)
+    if (randomBuffer->pid != getpid()) {
+        randomBuffer->offset = BufferSize;
+    }
+#endif
+    if (BufferSize - randomBuffer->offset < count) {
+        if (!randomBuffer->refill()) {
+            return 0;
+        }
+    }
+    uchar *source = randomBuffer->data + randomBuffer->offset;
+    memcpy(buffer, source, static_cast<size_t>(count));
+    // The served bytes must not stay in memory
+    OPENSSL_cleanse(source, static_cast<size_t>(count));
+    randomBuffer->offset += count;
+    return count;
+}
+
 DeterministicGenerator::DeterministicGenerator() :
     RandomGenerator(),
     m_initializationData(QByteArrayLiteral("default"))
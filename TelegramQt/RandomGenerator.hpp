@@ -61,6 +61,21 @@ public:
     static RandomGenerator *setInstance(RandomGenerator *instance);
 };
 
+// Serves the small requests (paddings, nonces, ids) from a per-thread buffer
+// which is refilled in bulk from the OpenSSL CSPRNG (seeded from the OS).
+// The buffer is dropped in a forked child process.
+class TELEGRAMQT_INTERNAL_EXPORT BufferedRandomGenerator : public RandomGenerator
+{
+public:
+    enum {
+        BufferSize = 4096,
+    };
+
+    using RandomGenerator::generate;
+
+    int generate(void *buffer, int count) override;
+};
+
 class TELEGRAMQT_INTERNAL_EXPORT DeterministicGenerator : public RandomGenerator
 {
 public:
@@ -19,38 +19,35 @@
 #include "AbridgedLength.hpp"
 
 #include <QIODevice>
-#include <QBuffer>
 
 static const char s_nulls[4] = { 0, 0, 0, 0 };
 
 namespace Telegram {
 
-RawStream::RawStream(QByteArray *data, bool write) :
-    m_ownDevice(true)
+RawStream::RawStream(QByteArray *data, bool write)
 {
-    setDevice(new QBuffer(data));
     if (write) {
-        m_device->open(QIODevice::Append);
+        // Append to the given array
+        m_backend = Backend::MemoryWriter;
+        m_writeBuffer = data;
     } else {
-        m_device->open(QIODevice::ReadOnly);
+        setReadData(*data);
     }
 }
 
 RawStream::RawStream(const QByteArray &data)
 {
-    setData(data);
+    setReadData(data);
 }
 
 RawStream::RawStream(Mode m, quint32 reserveBytes) :
-    m_ownDevice(true)
+    m_backend(Backend::MemoryWriter)
 {
     Q_UNUSED(m)
-    QBuffer *buffer = new QBuffer();
     if (reserveBytes) {
-        buffer->buffer().reserve(static_cast<int>(reserveBytes));
+        m_data.reserve(static_cast<int>(reserveBytes));
     }
-    setDevice(buffer);
-    m_device->open(QIODevice::WriteOnly);
+    m_writeBuffer = &m_data;
 }
 
 RawStream::RawStream(QIODevice *d)
@@ -67,18 +64,28 @@ RawStream::~RawStream()
 
 void RawStream::setData(const QByteArray &data)
 {
-    QBuffer *buffer = new QBuffer();
-    buffer->setData(data);
-    setDevice(buffer);
-    m_device->open(QIODevice::ReadOnly);
-    m_ownDevice = true;
+    setReadData(data);
+}
+
+void RawStream::setReadData(const QByteArray &data)
+{
+    setDevice(nullptr);
+    m_backend = Backend::MemoryReader;
+    m_data = data;
+    m_writeBuffer = nullptr;
+    m_readPosition = m_data.constData();
+    m_readEnd = m_readPosition + m_data.size();
 }
 
 QByteArray RawStream::getData() const
 {
-    if (m_ownDevice) {
-        QBuffer *buffer = static_cast<QBuffer*>(m_device);
-        return buffer->data();
+    switch (m_backend) {
+    case Backend::MemoryReader:
+        return m_data;
+    case Backend::MemoryWriter:
+        return *m_writeBuffer;
+    case Backend::Device:
+        break;
     }
     return QByteArray();
 }
@@ -93,6 +100,11 @@ void RawStream::setDevice(QIODevice *newDevice)
     }
 
     m_device = newDevice;
+    m_backend = Backend::Device;
+    m_data.clear();
+    m_writeBuffer = nullptr;
+    m_readPosition = nullptr;
+    m_readEnd = nullptr;
 }
 
 void RawStream::unsetDevice()
@@ -102,36 +114,97 @@ void RawStream::unsetDevice()
 
 bool RawStream::atEnd() const
 {
+    switch (m_backend) {
+    case Backend::MemoryReader:
+        return m_readPosition == m_readEnd;
+    case Backend::MemoryWriter:
+        return true;
+    case Backend::Device:
+        break;
+    }
     return m_device ? m_device->atEnd() : true;
 }
 
 int RawStream::bytesAvailable() const
 {
+    switch (m_backend) {
+    case Backend::MemoryReader:
+        return static_cast<int>(m_readEnd - m_readPosition);
+    case Backend::MemoryWriter:
+        return 0;
+    case Backend::Device:
+        break;
+    }
     return m_device ? static_cast<int>(m_device->bytesAvailable()) : 0;
 }
 
 bool RawStream::writeBytes(const QByteArray &data)
 {
-    m_error = m_error || m_device->write(data) != data.size();
-    return m_error;
+    if (m_backend == Backend::Device) {
+        m_error = m_error || !m_device || m_device->write(data) != data.size();
+        return m_error;
+    }
+    return write(data.constData(), data.size());
 }
 
 bool RawStream::read(void *data, qint64 size)
 {
-    if (size) {
-        m_error = m_error || m_device->read(static_cast<char *>(data), size) != size;
+    if (!size) {
+        return m_error;
+    }
+    switch (m_backend) {
+    case Backend::MemoryReader:
+    {
+        // Same as QIODevice::read(): copy the available bytes and fail on a short read
+        const qint64 available = m_readEnd - m_readPosition;
+        const qint64 bytesToRead = qBound<qint64>(0, size, available);
+        memcpy(data, m_readPosition, static_cast<size_t>(bytesToRead));
+        m_readPosition += bytesToRead;
+        m_error = m_error || bytesToRead != size;
+        break;
+    }
+    case Backend::MemoryWriter:
+        m_error = true;
+        break;
+    case Backend::Device:
+        m_error = m_error || !m_device || m_device->read(static_cast<char *>(data), size) != size;
+        break;
     }
     return m_error;
 }
 
 bool RawStream::write(const void *data, qint64 size)
 {
-    if (size) {
-        m_error = m_error || m_device->write(static_cast<const char *>(data), size) != size;
+    if (!size) {
+        return m_error;
+    }
+    switch (m_backend) {
+    case Backend::MemoryWriter:
+        m_writeBuffer->append(static_cast<const char *>(data), static_cast<int>(size));
+        break;
+    case Backend::MemoryReader:
+        m_error = true;
+        break;
+    case Backend::Device:
+        m_error = m_error || !m_device || m_device->write(static_cast<const char *>(data), size) != size;
+        break;
     }
     return m_error;
 }
 
+bool RawStream::verifyReadLength(quint32 count, quint32 limit, int itemSize)
+{
+    if (m_error) {
+        return false;
+    }
+    const quint64 minimumSize = static_cast<quint64>(count) * static_cast<quint64>(itemSize);
+    if ((count > limit) || (minimumSize > static_cast<quint64>(qMax(0, bytesAvailable())))) {
+        m_error = true;
+        return false;
+    }
+    return true;
+}
+
 void RawStream::setError(bool error)
 {
     m_error = error;
@@ -139,11 +212,36 @@ void RawStream::setError(bool error)
 
 QByteArray RawStream::readBytes(int count)
 {
-    QByteArray result = m_device->read(count);
-    m_error = m_error || result.size() != count;
+    if (m_backend != Backend::MemoryReader) {
+        QByteArray result = m_device ? m_device->read(count) : QByteArray();
+        m_error = m_error || result.size() != count;
+        return result;
+    }
+    const int bytesToRead = qBound(0, count, bytesAvailable());
+    QByteArray result;
+    if (m_bytesReferenceData) {
+        result = QByteArray::fromRawData(m_readPosition, bytesToRead);
+    } else {
+        result = QByteArray(m_readPosition, bytesToRead);
+    }
+    m_readPosition += bytesToRead;
+    m_error = m_error || bytesToRead != count;
     return result;
 }
 
+bool RawStream::skipBytes(int count)
+{
+    if (m_backend != Backend::MemoryReader) {
+        // QIODevice::skip() is not available in Qt 5.5
+        m_error = m_error || !m_device || m_device->read(count).size() != count;
+        return m_error;
+    }
+    const int bytesToSkip = qBound(0, count, bytesAvailable());
+    m_readPosition += bytesToSkip;
+    m_error = m_error || bytesToSkip != count;
+    return m_error;
+}
+
 RawStream &RawStream::operator>>(qint8 &i)
 {
     return protectedRead(i);
@@ -244,9 +342,18 @@ RawStreamEx &RawStreamEx::operator>>(QByteArray &data)
 {
     Telegram::AbridgedLength length;
     *this >> length;
-    data.resize(static_cast<int>(length));
-    read(data.data(), data.size());
-    readBytes(length.paddingForAlignment(4));
+    if (!verifyReadLength(length, maxBytesLength(), 1)) {
+        data.clear();
+        return *this;
+    }
+    if (bytesReferenceData()) {
+        data = readBytes(static_cast<int>(length));
+    } else {
+        data.resize(static_cast<int>(length));
+        read(data.data(), data.size());
+    }
+    char padding[4];
+    read(padding, length.paddingForAlignment(4));
     return *this;
 }
 
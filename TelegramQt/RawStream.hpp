@@ -53,8 +53,23 @@ public:
     bool atEnd() const;
     int bytesAvailable() const;
 
+    // The read byte arrays reference the stream data (see QByteArray::fromRawData()) instead of
+    // holding a copy. Works only for the streams constructed from a QByteArray; the caller must keep
+    // the data alive (e.g. by the stream itself) for as long as the read values are in use.
+    bool bytesReferenceData() const { return m_bytesReferenceData; }
+    void setBytesReferenceData(bool reference) { m_bytesReferenceData = reference; }
+
+    // The limits of the decoded bytes (strings) and vectors length. A decoded length is also
+    // checked against the available data (before any allocation), so a corrupted length
+    // makes the stream error instead of a huge allocation.
+    quint32 maxBytesLength() const { return m_maxBytesLength; }
+    void setMaxBytesLength(quint32 length) { m_maxBytesLength = length; }
+    quint32 maxVectorLength() const { return m_maxVectorLength; }
+    void setMaxVectorLength(quint32 length) { m_maxVectorLength = length; }
+
     bool writeBytes(const QByteArray &bytes);
     QByteArray readBytes(int count);
+    bool skipBytes(int count);
 
     QByteArray readAll();
 
@@ -86,6 +101,10 @@ protected:
     bool read(void *data, qint64 size);
     bool write(const void *data, qint64 size);
 
+    // Returns false and sets the error if the count of items (of at least the itemSize bytes)
+    // exceeds the limit or the available data
+    bool verifyReadLength(quint32 count, quint32 limit, int itemSize);
+
     template<typename Int>
     inline RawStream &protectedWrite(Int i);
 
@@ -95,8 +114,25 @@ protected:
     void setError(bool error);
 
 private:
+    // The streams built from a QByteArray work on the contiguous memory instead of a QIODevice
+    enum class Backend : quint8 {
+        Device,
+        MemoryReader,
+        MemoryWriter,
+    };
+
+    void setReadData(const QByteArray &data);
+
     QIODevice *m_device = nullptr;
+    QByteArray m_data; // The data of the reader or the own buffer of the writer
+    QByteArray *m_writeBuffer = nullptr; // The writer target (m_data or an external array)
+    const char *m_readPosition = nullptr;
+    const char *m_readEnd = nullptr;
+    quint32 m_maxBytesLength = 0xffffffffu;
+    quint32 m_maxVectorLength = 0xffffffffu;
+    Backend m_backend = Backend::Device;
     bool m_ownDevice = false;
+    bool m_bytesReferenceData = false;
     bool m_error = false;
 
 };
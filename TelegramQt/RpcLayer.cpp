@@ -18,6 +18,7 @@
 #include "RpcLayer.hpp"
 
 #include "AbridgedLength.hpp"
+#include "Connection.hpp"
 #include "RandomGenerator.hpp"
 #include "RawStream.hpp"
 #include "SendPackageHelper.hpp"
@@ -30,6 +31,9 @@
 #include "Debug_p.hpp"
 
 #include <QLoggingCategory>
+#include <QtEndian>
+
+#include <openssl/sha.h>
 
 Q_LOGGING_CATEGORY(c_baseRpcLayerCategory, "telegram.base.rpclayer", QtWarningMsg)
 Q_LOGGING_CATEGORY(c_baseRpcLayerCategoryIn, "telegram.base.rpclayer.in", QtWarningMsg)
@@ -37,11 +41,34 @@ Q_LOGGING_CATEGORY(c_baseRpcLayerCategoryOut, "telegram.base.rpclayer.out", QtWa
 
 namespace Telegram {
 
+struct BaseRpcLayer::AuthKeyCache
+{
+    enum {
+        KeyPartSize = 36,
+        MessageKeyPartSize = 32,
+    };
+    static int index(KeyPart x) { return x == ClientKeyPart ? 0 : 1; }
+
+    // The same as QByteArray::mid(offset, size).size()
+    static int partSize(int keySize, int offset, int size) { return qBound(0, keySize - offset, size); }
+
+    quint64 authId = 0;
+    // Fed with substr(auth_key, 88 + x, 32) for the msg_key calculation
+    SHA256_CTX messageKeyContext[2];
+    // substr(auth_key, x, 36) and substr(auth_key, 40 + x, 36) for the AES key and IV calculation
+    uchar keyPartA[2][KeyPartSize];
+    uchar keyPartB[2][KeyPartSize];
+    int keyPartASize[2];
+    int keyPartBSize[2];
+};
+
 BaseRpcLayer::BaseRpcLayer(QObject *parent) :
     QObject(parent)
 {
 }
 
+BaseRpcLayer::~BaseRpcLayer() = default;
+
 void BaseRpcLayer::setSendHelper(BaseMTProtoSendHelper *helper)
 {
     m_sendHelper = helper;
@@ -49,9 +76,21 @@ void BaseRpcLayer::setSendHelper(BaseMTProtoSendHelper *helper)
 
 bool BaseRpcLayer::processPacket(const QByteArray &package)
 {
-    if (package.size() < 24) {
+    // auth_key_id (8) + msg_key (16) + encrypted_data
+    constexpr int c_encryptedDataOffset = 8 + MessageKeySize;
+    constexpr int c_headerLength = MTProto::FullMessageHeader::headerLength;
+    const int encryptedSize = package.size() - c_encryptedDataOffset;
+    if (encryptedSize < c_headerLength) {
         qCWarning(c_baseRpcLayerCategoryIn) << CALL_INFO
-                                            << "Packet is too small:" << package.size() << " < 24";
+                                            << "Packet is too small:" << package.size()
+                                            << " < " << c_encryptedDataOffset + c_headerLength;
+        return false;
+    }
+    if (encryptedSize % 16) {
+        qCWarning(c_baseRpcLayerCategoryIn) << CALL_INFO << "Encrypted data is not aligned:" << encryptedSize;
+        if (ConnectionCounters *counters = m_sendHelper->counters()) {
+            counters->addDecryptionFailure();
+        }
         return false;
     }
     qCDebug(c_baseRpcLayerCategoryIn) << CALL_INFO
@@ -60,20 +99,23 @@ bool BaseRpcLayer::processPacket(const QByteArray &package)
 #ifdef BASE_RPC_IO_DEBUG
     const quint64 *authKeyIdBytes = reinterpret_cast<const quint64*>(package.constData());
 #endif
-    const QByteArray messageKey = package.mid(8, 16);
-    const QByteArray encryptedData = package.mid(24);
-    const Crypto::AesKey key = getDecryptionAesKey(messageKey);
-    const QByteArray decryptedData = Crypto::aesDecrypt(encryptedData, key).left(encryptedData.length());
+    const char *messageKey = package.constData() + 8;
+    const char *encryptedData = package.constData() + c_encryptedDataOffset;
+
+    // The header (two AES blocks) is decrypted to the stack and the rest (the content and the padding)
+    // is decrypted right into the message data, so the payload is copied only once.
+    Crypto::AesKey key = getDecryptionAesKey(messageKey);
+    char headerData[c_headerLength];
+    QByteArray innerData(encryptedSize - c_headerLength, Qt::Uninitialized);
+    Crypto::aesDecrypt(encryptedData, headerData, c_headerLength, &key);
+    Crypto::aesDecrypt(encryptedData + c_headerLength, innerData.data(), innerData.size(), &key);
 #ifdef BASE_RPC_IO_DEBUG
     qCDebug(c_baseRpcLayerCategoryIn) << "authKeyId:" << hex << showbase << *authKeyIdBytes;
-    qCDebug(c_baseRpcLayerCategoryIn) << "messageKey:" << messageKey.toHex();
-    qCDebug(c_baseRpcLayerCategoryIn) << "encryptedData:" << encryptedData.toHex();
-    qCDebug(c_baseRpcLayerCategoryIn) << "decryptedData:" << decryptedData.toHex();
+    qCDebug(c_baseRpcLayerCategoryIn) << "messageKey:" << QByteArray(messageKey, MessageKeySize).toHex();
+    qCDebug(c_baseRpcLayerCategoryIn) << "encryptedData:" << package.mid(c_encryptedDataOffset).toHex();
+    qCDebug(c_baseRpcLayerCategoryIn) << "decryptedData:" << (QByteArray(headerData, c_headerLength) + innerData).toHex();
 #endif
-    RawStream decryptedStream(decryptedData);
-
-    MTProto::FullMessageHeader messageHeader;
-    decryptedStream >> messageHeader;
+    const MTProto::FullMessageHeader messageHeader = MTProto::FullMessageHeader::fromRawData(headerData);
 
 #ifdef DEVELOPER_BUILD
     qCDebug(c_baseRpcLayerCategoryIn) << CALL_INFO << messageHeader;
@@ -84,32 +126,35 @@ bool BaseRpcLayer::processPacket(const QByteArray &package)
         return false;
     }
 
-    if (int(messageHeader.contentLength) > decryptedStream.bytesAvailable()) {
+    if (messageHeader.contentLength > static_cast<quint32>(innerData.size())) {
         qCWarning(c_baseRpcLayerCategoryIn) << CALL_INFO << "Expected more data than actually available."
-                                            << "Actual:" << decryptedStream.bytesAvailable()
+                                            << "Actual:" << innerData.size()
                                             << "Expected:" << messageHeader.contentLength;
+        if (ConnectionCounters *counters = m_sendHelper->counters()) {
+            counters->addDecryptionFailure();
+        }
         return false;
     }
-#ifdef USE_MTProto_V1
-    QByteArray expectedMessageKey = Utils::sha1(
-                decryptedData.left(MTProto::FullMessageHeader::headerLength + messageHeader.contentLength)).mid(4);
-#else // MTProto_V2
-    QByteArray expectedMessageKey = Utils::sha256(getVerificationKeyPart() + decryptedData).mid(8, 16);
-#endif
+    char expectedMessageKey[MessageKeySize];
+    generateMessageKey(headerData, c_headerLength, innerData.constData(), innerData.size(),
+                       decryptionKeyPart(), expectedMessageKey);
 
-    if (messageKey != expectedMessageKey) {
+    if (memcmp(messageKey, expectedMessageKey, MessageKeySize) != 0) {
         qCWarning(c_baseRpcLayerCategoryIn) << CALL_INFO << "Invalid message key";
+        if (ConnectionCounters *counters = m_sendHelper->counters()) {
+            counters->addDecryptionFailure();
+        }
         return false;
     }
 
-    QByteArray innerData = decryptedStream.readBytes(messageHeader.contentLength);
-    if (decryptedStream.error()) {
-        qCWarning(c_baseRpcLayerCategoryIn) << CALL_INFO << "Decrypted content read error";
-        return false;
-    }
+    // Drop the padding; shrinking does not reallocate the data
+    innerData.truncate(static_cast<int>(messageHeader.contentLength));
     MTProto::Message message(messageHeader, innerData);
     if (message.firstValue() == TLValue::GzipPacked) {
         qCDebug(c_baseRpcLayerCategoryIn) << CALL_INFO << "message is GzipPacked";
+        if (ConnectionCounters *counters = m_sendHelper->counters()) {
+            counters->addReceivedGzipPackedMessage();
+        }
         QByteArray data;
         MTProto::Stream packedStream(innerData);
         TLValue gzipValue;
@@ -121,25 +166,80 @@ bool BaseRpcLayer::processPacket(const QByteArray &package)
     return processMTProtoMessage(message);
 }
 
-Crypto::AesKey BaseRpcLayer::generateAesKey(const QByteArray &messageKey, int x) const
+const BaseRpcLayer::AuthKeyCache *BaseRpcLayer::authKeyCache() const
 {
+    if (m_authKeyCache && (m_authKeyCache->authId == m_sendHelper->authId())) {
+        return m_authKeyCache.data();
+    }
     const QByteArray authKey = m_sendHelper->authKey();
-#ifdef USE_MTProto_V1
-    QByteArray sha1_a = Utils::sha1(messageKey + authKey.mid(x, 32));
-    QByteArray sha1_b = Utils::sha1(authKey.mid(32 + x, 16) + messageKey + authKey.mid(48 + x, 16));
-    QByteArray sha1_c = Utils::sha1(authKey.mid(64 + x, 32) + messageKey);
-    QByteArray sha1_d = Utils::sha1(messageKey + authKey.mid(96 + x, 32));
-
-    const QByteArray key = sha1_a.mid(0, 8) + sha1_b.mid(8, 12) + sha1_c.mid(4, 12);
-    const QByteArray iv  = sha1_a.mid(8, 12) + sha1_b.left(8) + sha1_c.mid(16, 4) + sha1_d.left(8);
-#else // MTProto_V2
-    QByteArray sha256_a = Utils::sha256(messageKey + authKey.mid(x, 36));
-    QByteArray sha256_b = Utils::sha256(authKey.mid(40 + x, 36) + messageKey);
-    const QByteArray key = sha256_a.left(8) + sha256_b.mid(8, 16) + sha256_a.mid(24, 8);
-    const QByteArray iv  = sha256_b.left(8) + sha256_a.mid(8, 16) + sha256_b.mid(24, 8);
-#endif
+    if (!m_authKeyCache) {
+        m_authKeyCache.reset(new AuthKeyCache());
+    }
+    AuthKeyCache *cache = m_authKeyCache.data();
+    const uchar *authKeyData = reinterpret_cast<const uchar *>(authKey.constData());
+    const int keySize = authKey.size(); // 256 bytes for any real key
+    for (const KeyPart x : { ClientKeyPart, ServerKeyPart }) {
+        const int i = AuthKeyCache::index(x);
+        const int messageKeyPartSize = AuthKeyCache::partSize(keySize, 88 + x, AuthKeyCache::MessageKeyPartSize);
+        SHA256_Init(&cache->messageKeyContext[i]);
+        if (messageKeyPartSize) {
+            SHA256_Update(&cache->messageKeyContext[i], authKeyData + 88 + x, static_cast<size_t>(messageKeyPartSize));
+        }
+        cache->keyPartASize[i] = AuthKeyCache::partSize(keySize, x, AuthKeyCache::KeyPartSize);
+        cache->keyPartBSize[i] = AuthKeyCache::partSize(keySize, 40 + x, AuthKeyCache::KeyPartSize);
+        if (cache->keyPartASize[i]) {
+            memcpy(cache->keyPartA[i], authKeyData + x, static_cast<size_t>(cache->keyPartASize[i]));
+        }
+        if (cache->keyPartBSize[i]) {
+            memcpy(cache->keyPartB[i], authKeyData + 40 + x, static_cast<size_t>(cache->keyPartBSize[i]));
+        }
+    }
+    cache->authId = m_sendHelper->authId();
+    return cache;
+}
 
-    return Crypto::AesKey(key, iv);
+Crypto::AesKey BaseRpcLayer::generateAesKey(const char *messageKey, KeyPart x) const
+{
+    const AuthKeyCache *cache = authKeyCache();
+    const int i = AuthKeyCache::index(x);
+
+    // sha256_a = SHA256(msg_key + substr(auth_key, x, 36))
+    // sha256_b = SHA256(substr(auth_key, 40 + x, 36) + msg_key)
+    uchar buffer[MessageKeySize + AuthKeyCache::KeyPartSize];
+    uchar sha256_a[SHA256_DIGEST_LENGTH];
+    uchar sha256_b[SHA256_DIGEST_LENGTH];
+    const int partASize = cache->keyPartASize[i];
+    const int partBSize = cache->keyPartBSize[i];
+    memcpy(buffer, messageKey, MessageKeySize);
+    memcpy(buffer + MessageKeySize, cache->keyPartA[i], static_cast<size_t>(partASize));
+    SHA256(buffer, static_cast<size_t>(MessageKeySize + partASize), sha256_a);
+    memcpy(buffer, cache->keyPartB[i], static_cast<size_t>(partBSize));
+    memcpy(buffer + partBSize, messageKey, MessageKeySize);
+    SHA256(buffer, static_cast<size_t>(partBSize + MessageKeySize), sha256_b);
+
+    // aes_key = substr(sha256_a, 0, 8) + substr(sha256_b, 8, 16) + substr(sha256_a, 24, 8)
+    // aes_iv = substr(sha256_b, 0, 8) + substr(sha256_a, 8, 16) + substr(sha256_b, 24, 8)
+    Crypto::AesKey result;
+    memcpy(result.key, sha256_a, 8);
+    memcpy(result.key + 8, sha256_b + 8, 16);
+    memcpy(result.key + 24, sha256_a + 24, 8);
+    memcpy(result.iv, sha256_b, 8);
+    memcpy(result.iv + 8, sha256_a + 8, 16);
+    memcpy(result.iv + 24, sha256_b + 24, 8);
+    return result;
+}
+
+void BaseRpcLayer::generateMessageKey(const char *header, int headerSize, const char *data, int size,
+                                      KeyPart x, char *messageKey) const
+{
+    // msg_key = substr(SHA256(substr(auth_key, 88 + x, 32) + plaintext + random_padding), 8, 16)
+    const AuthKeyCache *cache = authKeyCache();
+    SHA256_CTX context = cache->messageKeyContext[AuthKeyCache::index(x)];
+    uchar digest[SHA256_DIGEST_LENGTH];
+    SHA256_Update(&context, header, static_cast<size_t>(headerSize));
+    SHA256_Update(&context, data, static_cast<size_t>(size));
+    SHA256_Final(digest, &context);
+    memcpy(messageKey, digest + 8, MessageKeySize);
 }
 
 quint32 BaseRpcLayer::contentRelatedMessagesNumber() const
@@ -164,60 +264,49 @@ bool BaseRpcLayer::sendPacket(const MTProto::Message &message)
         qCCritical(c_baseRpcLayerCategoryOut) << CALL_INFO << "Auth key is not set!";
         return 0;
     }
-    QByteArray encryptedPackage;
-    QByteArray messageKey;
     constexpr int c_alignment = 16;
     constexpr int c_v2_minimumPadding = 12;
-    {
-        const MTProto::FullMessageHeader messageHeader(message, serverSalt(), sessionId());
+    // auth_key_id (8) + msg_key (16) + encrypted_data
+    constexpr int c_encryptedDataOffset = 8 + MessageKeySize;
+    constexpr int c_headerLength = MTProto::FullMessageHeader::headerLength;
+
+    const MTProto::FullMessageHeader messageHeader(message, serverSalt(), sessionId());
 #ifdef DEVELOPER_BUILD
-        qCDebug(c_baseRpcLayerCategoryOut) << "RpcLayer::sendPackage():" << messageHeader;
+    qCDebug(c_baseRpcLayerCategoryOut) << "RpcLayer::sendPackage():" << messageHeader;
 #endif
-        RawStream stream(RawStream::WriteOnly);
-        stream << messageHeader;
-        stream.writeBytes(message.data);
-
-        int packageLength = stream.getData().length();
-        int padding = AbridgedLength::paddingForAlignment(c_alignment, packageLength);
-#ifdef USE_MTProto_V1
-        if (padding) {
-            QByteArray randomPadding(padding, Qt::Uninitialized);
-             RandomGenerator::instance()->generate(&randomPadding);
-            stream << randomPadding;
-            packageLength += padding;
-        }
-        const QByteArray data = stream.getData();
-        messageKey = Utils::sha1(data).mid(4);
-#else // MTProto_V2
-        if (padding < c_v2_minimumPadding) {
-            padding += c_alignment;
-        }
-        {
-            QByteArray randomPadding(padding, Qt::Uninitialized);
-            RandomGenerator::instance()->generate(&randomPadding);
-            stream << randomPadding;
-            packageLength += padding;
-        }
-        const QByteArray decryptedData = stream.getData();
-        messageKey = Utils::sha256(getEncryptionKeyPart() + decryptedData).mid(8, 16);
+    const int packageLength = c_headerLength + message.data.size();
+    int padding = AbridgedLength::paddingForAlignment(c_alignment, packageLength);
+    if (padding < c_v2_minimumPadding) {
+        padding += c_alignment;
+    }
+    const int encryptedSize = packageLength + padding;
+
+    // The header, the payload and the random padding are written to the final packet buffer
+    // and then the message key is calculated and the data is encrypted in place.
+    QByteArray packet(c_encryptedDataOffset + encryptedSize, Qt::Uninitialized);
+    char *messageKey = packet.data() + 8;
+    char *decryptedData = packet.data() + c_encryptedDataOffset;
+    qToLittleEndian<quint64>(m_sendHelper->authId(), packet.data()); // keyId
+    messageHeader.writeRawData(decryptedData);
+    memcpy(decryptedData + c_headerLength, message.data.constData(), static_cast<size_t>(message.data.size()));
+    RandomGenerator::instance()->generate(decryptedData + packageLength, padding);
+
+    generateMessageKey(decryptedData, c_headerLength, decryptedData + c_headerLength, encryptedSize - c_headerLength,
+                       encryptionKeyPart(), messageKey);
+#ifdef BASE_RPC_IO_DEBUG
+    const QByteArray plainData(decryptedData, encryptedSize);
 #endif
-        const Crypto::AesKey key = getEncryptionAesKey(messageKey);
-        encryptedPackage = Crypto::aesEncrypt(decryptedData, key).left(packageLength);
+    Crypto::AesKey key = getEncryptionAesKey(messageKey);
+    Crypto::aesEncrypt(decryptedData, decryptedData, encryptedSize, &key);
 
 #ifdef BASE_RPC_IO_DEBUG
-        qCDebug(c_baseRpcLayerCategoryOut) << "authKeyId:"
-                                           << hex << showbase << m_sendHelper->authId();
-        qCDebug(c_baseRpcLayerCategoryOut) << "messageKey:" << messageKey.toHex();
-        qCDebug(c_baseRpcLayerCategoryOut) << "encryptedData:" << encryptedPackage.toHex();
-        qCDebug(c_baseRpcLayerCategoryOut) << "decryptedData:" << decryptedData.toHex();
+    qCDebug(c_baseRpcLayerCategoryOut) << "authKeyId:"
+                                       << hex << showbase << m_sendHelper->authId();
+    qCDebug(c_baseRpcLayerCategoryOut) << "messageKey:" << QByteArray(messageKey, MessageKeySize).toHex();
+    qCDebug(c_baseRpcLayerCategoryOut) << "encryptedData:" << packet.mid(c_encryptedDataOffset).toHex();
+    qCDebug(c_baseRpcLayerCategoryOut) << "decryptedData:" << plainData.toHex();
 #endif
-    }
-
-    RawStream output(RawStream::WriteOnly);
-    output << m_sendHelper->authId(); // keyId
-    output << messageKey;
-    output << encryptedPackage;
-    m_sendHelper->sendPacket(output.getData());
+    m_sendHelper->sendPacket(packet);
     return true;
 }
 
@@ -259,6 +348,31 @@ quint64 BaseRpcLayer::sendPacket(const QByteArray &buffer, SendMode mode, Messag
     return message.messageId;
 }
 
+int BaseRpcLayer::containedMessageSize(const MTProto::Message &message)
+{
+    return MTProto::MessageHeader::headerLength + message.data.size();
+}
+
+quint64 BaseRpcLayer::sendContainer(const QVector<const MTProto::Message *> &messages, SendMode mode)
+{
+    // https://core.telegram.org/mtproto/service_messages#simple-container
+    // msg_container#73f1f8dc messages:vector<%Message> = MessageContainer;
+    int containerSize = static_cast<int>(sizeof(quint32) * 2); // The constructor and the items count
+    for (const MTProto::Message *message : messages) {
+        containerSize += containedMessageSize(*message);
+    }
+    RawStream stream(RawStream::WriteOnly, static_cast<quint32>(containerSize));
+    stream << static_cast<quint32>(TLValue::MsgContainer);
+    stream << static_cast<quint32>(messages.count());
+    for (const MTProto::Message *message : messages) {
+        stream << static_cast<const MTProto::MessageHeader &>(*message);
+        stream << message->data;
+    }
+    qCDebug(c_baseRpcLayerCategoryOut) << CALL_INFO << messages.count() << "items"
+                                       << containerSize << "bytes";
+    return sendPacket(stream.getData(), mode, NotContentRelatedMessage);
+}
+
 bool BaseRpcLayer::processMsgContainer(const MTProto::Message &message)
 {
     // https://core.telegram.org/mtproto/service_messages#simple-container
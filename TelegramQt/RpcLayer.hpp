@@ -21,6 +21,8 @@
 #include "telegramqt_global.h"
 
 #include <QObject>
+#include <QScopedPointer>
+#include <QVector>
 
 #include "Crypto/Aes.hpp"
 
@@ -46,6 +48,7 @@ public:
         NotContentRelatedMessage
     };
     explicit BaseRpcLayer(QObject *parent = nullptr);
+    ~BaseRpcLayer() override;
 
     virtual quint64 sessionId() const = 0;
     virtual quint64 serverSalt() const = 0;
@@ -61,22 +64,49 @@ public:
     virtual void onConnectionLost(const QVariantHash &details);
 
 protected:
-    Crypto::AesKey generateAesKey(const QByteArray &messageKey, int x) const;
-    Crypto::AesKey generateClientToServerAesKey(const QByteArray &messageKey) const { return generateAesKey(messageKey, 0); }
-    Crypto::AesKey generateServerToClientAesKey(const QByteArray &messageKey) const { return generateAesKey(messageKey, 8); }
-    virtual Crypto::AesKey getDecryptionAesKey(const QByteArray &messageKey) const = 0;
-    virtual Crypto::AesKey getEncryptionAesKey(const QByteArray &messageKey) const = 0;
-
-    virtual QByteArray getEncryptionKeyPart() const = 0;
-    virtual QByteArray getVerificationKeyPart() const = 0;
+    // The x parameter of the MTProto 2.0 key derivation (the auth key offset)
+    enum KeyPart {
+        ClientKeyPart = 0, // Client to server messages
+        ServerKeyPart = 8, // Server to client messages
+    };
+    enum {
+        MessageKeySize = 16,
+    };
+    // The limits of the outgoing msg_container
+    enum {
+        MaxContainerMessages = 64,
+        MaxContainerSize = 32 * 1024,
+    };
+
+    virtual KeyPart encryptionKeyPart() const = 0;
+    KeyPart decryptionKeyPart() const { return encryptionKeyPart() == ClientKeyPart ? ServerKeyPart : ClientKeyPart; }
+
+    Crypto::AesKey generateAesKey(const char *messageKey, KeyPart x) const;
+    Crypto::AesKey getDecryptionAesKey(const char *messageKey) const { return generateAesKey(messageKey, decryptionKeyPart()); }
+    Crypto::AesKey getEncryptionAesKey(const char *messageKey) const { return generateAesKey(messageKey, encryptionKeyPart()); }
+    // Writes MessageKeySize bytes of msg_key for the plain message (the header and the padded data) to the messageKey
+    void generateMessageKey(const char *header, int headerSize, const char *data, int size,
+                            KeyPart x, char *messageKey) const;
+
     quint32 getNextMessageSequenceNumber(MessageType messageType);
 
     bool sendPacket(const MTProto::Message &message);
     quint64 sendPacket(const QByteArray &buffer, SendMode mode, MessageType messageType);
 
+    // The size of the message in a msg_container (the inner header and the data)
+    static int containedMessageSize(const MTProto::Message &message);
+    // Packs the (already numbered) messages to a msg_container and sends it in a single packet.
+    // Returns the container message id or 0 on failure.
+    quint64 sendContainer(const QVector<const MTProto::Message *> &messages, SendMode mode);
+
     BaseMTProtoSendHelper *m_sendHelper = nullptr;
     quint32 m_sequenceNumber = 0;
     quint32 m_contentRelatedMessages = 0;
+
+private:
+    struct AuthKeyCache;
+    const AuthKeyCache *authKeyCache() const;
+    mutable QScopedPointer<AuthKeyCache> m_authKeyCache;
 };
 
 } // Telegram namespace
@@ -48,7 +48,11 @@ AccountRpcLayer::AccountRpcLayer(QObject *parent) :
 AccountRpcLayer::PendingUser *AccountRpcLayer::changePhone(const QString &phoneNumber, const QString &phoneCodeHash, const QString &phoneCode)
 {
     qCDebug(c_clientRpcAccountCategory) << Q_FUNC_INFO << phoneNumber << phoneCodeHash << phoneCode;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::AccountChangePhone)
+            + MTProto::serializedSize(phoneNumber)
+            + MTProto::serializedSize(phoneCodeHash)
+            + MTProto::serializedSize(phoneCode);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::AccountChangePhone;
     outputStream << phoneNumber;
     outputStream << phoneCodeHash;
@@ -61,7 +65,9 @@ AccountRpcLayer::PendingUser *AccountRpcLayer::changePhone(const QString &phoneN
 AccountRpcLayer::PendingBool *AccountRpcLayer::checkUsername(const QString &username)
 {
     qCDebug(c_clientRpcAccountCategory) << Q_FUNC_INFO << username;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::AccountCheckUsername)
+            + MTProto::serializedSize(username);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::AccountCheckUsername;
     outputStream << username;
     PendingBool *op = new PendingBool(this, outputStream.getData());
@@ -72,7 +78,10 @@ AccountRpcLayer::PendingBool *AccountRpcLayer::checkUsername(const QString &user
 AccountRpcLayer::PendingBool *AccountRpcLayer::confirmPhone(const QString &phoneCodeHash, const QString &phoneCode)
 {
     qCDebug(c_clientRpcAccountCategory) << Q_FUNC_INFO << phoneCodeHash << phoneCode;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::AccountConfirmPhone)
+            + MTProto::serializedSize(phoneCodeHash)
+            + MTProto::serializedSize(phoneCode);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::AccountConfirmPhone;
     outputStream << phoneCodeHash;
     outputStream << phoneCode;
@@ -84,7 +93,9 @@ AccountRpcLayer::PendingBool *AccountRpcLayer::confirmPhone(const QString &phone
 AccountRpcLayer::PendingBool *AccountRpcLayer::deleteAccount(const QString &reason)
 {
     qCDebug(c_clientRpcAccountCategory) << Q_FUNC_INFO << reason;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::AccountDeleteAccount)
+            + MTProto::serializedSize(reason);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::AccountDeleteAccount;
     outputStream << reason;
     PendingBool *op = new PendingBool(this, outputStream.getData());
@@ -95,7 +106,8 @@ AccountRpcLayer::PendingBool *AccountRpcLayer::deleteAccount(const QString &reas
 AccountRpcLayer::PendingAccountDaysTTL *AccountRpcLayer::getAccountTTL()
 {
     qCDebug(c_clientRpcAccountCategory) << Q_FUNC_INFO;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::AccountGetAccountTTL);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::AccountGetAccountTTL;
     PendingAccountDaysTTL *op = new PendingAccountDaysTTL(this, outputStream.getData());
     processRpcCall(op);
@@ -105,7 +117,8 @@ AccountRpcLayer::PendingAccountDaysTTL *AccountRpcLayer::getAccountTTL()
 AccountRpcLayer::PendingAccountAuthorizations *AccountRpcLayer::getAuthorizations()
 {
     qCDebug(c_clientRpcAccountCategory) << Q_FUNC_INFO;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::AccountGetAuthorizations);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::AccountGetAuthorizations;
     PendingAccountAuthorizations *op = new PendingAccountAuthorizations(this, outputStream.getData());
     processRpcCall(op);
@@ -115,7 +128,9 @@ AccountRpcLayer::PendingAccountAuthorizations *AccountRpcLayer::getAuthorization
 AccountRpcLayer::PendingPeerNotifySettings *AccountRpcLayer::getNotifySettings(const TLInputNotifyPeer &peer)
 {
     qCDebug(c_clientRpcAccountCategory) << Q_FUNC_INFO << peer;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::AccountGetNotifySettings)
+            + MTProto::serializedSize(peer);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::AccountGetNotifySettings;
     outputStream << peer;
     PendingPeerNotifySettings *op = new PendingPeerNotifySettings(this, outputStream.getData());
@@ -126,7 +141,8 @@ AccountRpcLayer::PendingPeerNotifySettings *AccountRpcLayer::getNotifySettings(c
 AccountRpcLayer::PendingAccountPassword *AccountRpcLayer::getPassword()
 {
     qCDebug(c_clientRpcAccountCategory) << Q_FUNC_INFO;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::AccountGetPassword);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::AccountGetPassword;
     PendingAccountPassword *op = new PendingAccountPassword(this, outputStream.getData());
     processRpcCall(op);
@@ -136,7 +152,9 @@ AccountRpcLayer::PendingAccountPassword *AccountRpcLayer::getPassword()
 AccountRpcLayer::PendingAccountPasswordSettings *AccountRpcLayer::getPasswordSettings(const QByteArray &currentPasswordHash)
 {
     qCDebug(c_clientRpcAccountCategory) << Q_FUNC_INFO << currentPasswordHash.toHex();
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::AccountGetPasswordSettings)
+            + MTProto::serializedSize(currentPasswordHash);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::AccountGetPasswordSettings;
     outputStream << currentPasswordHash;
     PendingAccountPasswordSettings *op = new PendingAccountPasswordSettings(this, outputStream.getData());
@@ -147,7 +165,9 @@ AccountRpcLayer::PendingAccountPasswordSettings *AccountRpcLayer::getPasswordSet
 AccountRpcLayer::PendingAccountPrivacyRules *AccountRpcLayer::getPrivacy(const TLInputPrivacyKey &key)
 {
     qCDebug(c_clientRpcAccountCategory) << Q_FUNC_INFO << key;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::AccountGetPrivacy)
+            + MTProto::serializedSize(key);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::AccountGetPrivacy;
     outputStream << key;
     PendingAccountPrivacyRules *op = new PendingAccountPrivacyRules(this, outputStream.getData());
@@ -158,7 +178,10 @@ AccountRpcLayer::PendingAccountPrivacyRules *AccountRpcLayer::getPrivacy(const T
 AccountRpcLayer::PendingAccountTmpPassword *AccountRpcLayer::getTmpPassword(const QByteArray &passwordHash, quint32 period)
 {
     qCDebug(c_clientRpcAccountCategory) << Q_FUNC_INFO << passwordHash.toHex() << period;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::AccountGetTmpPassword)
+            + MTProto::serializedSize(passwordHash)
+            + MTProto::serializedSize(period);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::AccountGetTmpPassword;
     outputStream << passwordHash;
     outputStream << period;
@@ -170,7 +193,8 @@ AccountRpcLayer::PendingAccountTmpPassword *AccountRpcLayer::getTmpPassword(cons
 AccountRpcLayer::PendingWallPaperVector *AccountRpcLayer::getWallPapers()
 {
     qCDebug(c_clientRpcAccountCategory) << Q_FUNC_INFO;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::AccountGetWallPapers);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::AccountGetWallPapers;
     PendingWallPaperVector *op = new PendingWallPaperVector(this, outputStream.getData());
     processRpcCall(op);
@@ -180,7 +204,10 @@ AccountRpcLayer::PendingWallPaperVector *AccountRpcLayer::getWallPapers()
 AccountRpcLayer::PendingBool *AccountRpcLayer::registerDevice(quint32 tokenType, const QString &token)
 {
     qCDebug(c_clientRpcAccountCategory) << Q_FUNC_INFO << tokenType << token;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::AccountRegisterDevice)
+            + MTProto::serializedSize(tokenType)
+            + MTProto::serializedSize(token);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::AccountRegisterDevice;
     outputStream << tokenType;
     outputStream << token;
@@ -192,7 +219,10 @@ AccountRpcLayer::PendingBool *AccountRpcLayer::registerDevice(quint32 tokenType,
 AccountRpcLayer::PendingBool *AccountRpcLayer::reportPeer(const TLInputPeer &peer, const TLReportReason &reason)
 {
     qCDebug(c_clientRpcAccountCategory) << Q_FUNC_INFO << peer << reason;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::AccountReportPeer)
+            + MTProto::serializedSize(peer)
+            + MTProto::serializedSize(reason);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::AccountReportPeer;
     outputStream << peer;
     outputStream << reason;
@@ -204,7 +234,9 @@ AccountRpcLayer::PendingBool *AccountRpcLayer::reportPeer(const TLInputPeer &pee
 AccountRpcLayer::PendingBool *AccountRpcLayer::resetAuthorization(quint64 hash)
 {
     qCDebug(c_clientRpcAccountCategory) << Q_FUNC_INFO << hash;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::AccountResetAuthorization)
+            + MTProto::serializedSize(hash);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::AccountResetAuthorization;
     outputStream << hash;
     PendingBool *op = new PendingBool(this, outputStream.getData());
@@ -215,7 +247,8 @@ AccountRpcLayer::PendingBool *AccountRpcLayer::resetAuthorization(quint64 hash)
 AccountRpcLayer::PendingBool *AccountRpcLayer::resetNotifySettings()
 {
     qCDebug(c_clientRpcAccountCategory) << Q_FUNC_INFO;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::AccountResetNotifySettings);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::AccountResetNotifySettings;
     PendingBool *op = new PendingBool(this, outputStream.getData());
     processRpcCall(op);
@@ -225,7 +258,11 @@ AccountRpcLayer::PendingBool *AccountRpcLayer::resetNotifySettings()
 AccountRpcLayer::PendingAuthSentCode *AccountRpcLayer::sendChangePhoneCode(quint32 flags, const QString &phoneNumber, bool currentNumber)
 {
     qCDebug(c_clientRpcAccountCategory) << Q_FUNC_INFO << flags << phoneNumber << currentNumber;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::AccountSendChangePhoneCode)
+            + MTProto::serializedSize(flags)
+            + MTProto::serializedSize(phoneNumber)
+            + (flags & 1 << 0 ? MTProto::serializedSize(currentNumber) : 0u);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::AccountSendChangePhoneCode;
     outputStream << flags;
     // (flags & 1 << 0) stands for allowFlashcall "true" value
@@ -241,7 +278,11 @@ AccountRpcLayer::PendingAuthSentCode *AccountRpcLayer::sendChangePhoneCode(quint
 AccountRpcLayer::PendingAuthSentCode *AccountRpcLayer::sendConfirmPhoneCode(quint32 flags, const QString &hash, bool currentNumber)
 {
     qCDebug(c_clientRpcAccountCategory) << Q_FUNC_INFO << flags << hash << currentNumber;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::AccountSendConfirmPhoneCode)
+            + MTProto::serializedSize(flags)
+            + MTProto::serializedSize(hash)
+            + (flags & 1 << 0 ? MTProto::serializedSize(currentNumber) : 0u);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::AccountSendConfirmPhoneCode;
     outputStream << flags;
     // (flags & 1 << 0) stands for allowFlashcall "true" value
@@ -257,7 +298,9 @@ AccountRpcLayer::PendingAuthSentCode *AccountRpcLayer::sendConfirmPhoneCode(quin
 AccountRpcLayer::PendingBool *AccountRpcLayer::setAccountTTL(const TLAccountDaysTTL &ttl)
 {
     qCDebug(c_clientRpcAccountCategory) << Q_FUNC_INFO << ttl;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::AccountSetAccountTTL)
+            + MTProto::serializedSize(ttl);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::AccountSetAccountTTL;
     outputStream << ttl;
     PendingBool *op = new PendingBool(this, outputStream.getData());
@@ -268,7 +311,10 @@ AccountRpcLayer::PendingBool *AccountRpcLayer::setAccountTTL(const TLAccountDays
 AccountRpcLayer::PendingAccountPrivacyRules *AccountRpcLayer::setPrivacy(const TLInputPrivacyKey &key, const TLVector<TLInputPrivacyRule> &rules)
 {
     qCDebug(c_clientRpcAccountCategory) << Q_FUNC_INFO << key << rules;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::AccountSetPrivacy)
+            + MTProto::serializedSize(key)
+            + MTProto::serializedSize(rules);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::AccountSetPrivacy;
     outputStream << key;
     outputStream << rules;
@@ -280,7 +326,10 @@ AccountRpcLayer::PendingAccountPrivacyRules *AccountRpcLayer::setPrivacy(const T
 AccountRpcLayer::PendingBool *AccountRpcLayer::unregisterDevice(quint32 tokenType, const QString &token)
 {
     qCDebug(c_clientRpcAccountCategory) << Q_FUNC_INFO << tokenType << token;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::AccountUnregisterDevice)
+            + MTProto::serializedSize(tokenType)
+            + MTProto::serializedSize(token);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::AccountUnregisterDevice;
     outputStream << tokenType;
     outputStream << token;
@@ -292,7 +341,9 @@ AccountRpcLayer::PendingBool *AccountRpcLayer::unregisterDevice(quint32 tokenTyp
 AccountRpcLayer::PendingBool *AccountRpcLayer::updateDeviceLocked(quint32 period)
 {
     qCDebug(c_clientRpcAccountCategory) << Q_FUNC_INFO << period;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::AccountUpdateDeviceLocked)
+            + MTProto::serializedSize(period);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::AccountUpdateDeviceLocked;
     outputStream << period;
     PendingBool *op = new PendingBool(this, outputStream.getData());
@@ -303,7 +354,10 @@ AccountRpcLayer::PendingBool *AccountRpcLayer::updateDeviceLocked(quint32 period
 AccountRpcLayer::PendingBool *AccountRpcLayer::updateNotifySettings(const TLInputNotifyPeer &peer, const TLInputPeerNotifySettings &settings)
 {
     qCDebug(c_clientRpcAccountCategory) << Q_FUNC_INFO << peer << settings;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::AccountUpdateNotifySettings)
+            + MTProto::serializedSize(peer)
+            + MTProto::serializedSize(settings);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::AccountUpdateNotifySettings;
     outputStream << peer;
     outputStream << settings;
@@ -315,7 +369,10 @@ AccountRpcLayer::PendingBool *AccountRpcLayer::updateNotifySettings(const TLInpu
 AccountRpcLayer::PendingBool *AccountRpcLayer::updatePasswordSettings(const QByteArray &currentPasswordHash, const TLAccountPasswordInputSettings &newSettings)
 {
     qCDebug(c_clientRpcAccountCategory) << Q_FUNC_INFO << currentPasswordHash.toHex() << newSettings;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::AccountUpdatePasswordSettings)
+            + MTProto::serializedSize(currentPasswordHash)
+            + MTProto::serializedSize(newSettings);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::AccountUpdatePasswordSettings;
     outputStream << currentPasswordHash;
     outputStream << newSettings;
@@ -327,7 +384,12 @@ AccountRpcLayer::PendingBool *AccountRpcLayer::updatePasswordSettings(const QByt
 AccountRpcLayer::PendingUser *AccountRpcLayer::updateProfile(quint32 flags, const QString &firstName, const QString &lastName, const QString &about)
 {
     qCDebug(c_clientRpcAccountCategory) << Q_FUNC_INFO << flags << firstName << lastName << about;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::AccountUpdateProfile)
+            + MTProto::serializedSize(flags)
+            + (flags & 1 << 0 ? MTProto::serializedSize(firstName) : 0u)
+            + (flags & 1 << 1 ? MTProto::serializedSize(lastName) : 0u)
+            + (flags & 1 << 2 ? MTProto::serializedSize(about) : 0u);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::AccountUpdateProfile;
     outputStream << flags;
     if (flags & 1 << 0) {
@@ -347,7 +409,9 @@ AccountRpcLayer::PendingUser *AccountRpcLayer::updateProfile(quint32 flags, cons
 AccountRpcLayer::PendingBool *AccountRpcLayer::updateStatus(bool offline)
 {
     qCDebug(c_clientRpcAccountCategory) << Q_FUNC_INFO << offline;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::AccountUpdateStatus)
+            + MTProto::serializedSize(offline);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::AccountUpdateStatus;
     outputStream << offline;
     PendingBool *op = new PendingBool(this, outputStream.getData());
@@ -358,7 +422,9 @@ AccountRpcLayer::PendingBool *AccountRpcLayer::updateStatus(bool offline)
 AccountRpcLayer::PendingUser *AccountRpcLayer::updateUsername(const QString &username)
 {
     qCDebug(c_clientRpcAccountCategory) << Q_FUNC_INFO << username;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::AccountUpdateUsername)
+            + MTProto::serializedSize(username);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::AccountUpdateUsername;
     outputStream << username;
     PendingUser *op = new PendingUser(this, outputStream.getData());
@@ -50,7 +50,12 @@ AuthRpcLayer::AuthRpcLayer(QObject *parent) :
 AuthRpcLayer::PendingBool *AuthRpcLayer::bindTempAuthKey(quint64 permAuthKeyId, quint64 nonce, quint32 expiresAt, const QByteArray &encryptedMessage)
 {
     qCDebug(c_clientRpcAuthCategory) << Q_FUNC_INFO << permAuthKeyId << nonce << expiresAt << encryptedMessage.toHex();
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::AuthBindTempAuthKey)
+            + MTProto::serializedSize(permAuthKeyId)
+            + MTProto::serializedSize(nonce)
+            + MTProto::serializedSize(expiresAt)
+            + MTProto::serializedSize(encryptedMessage);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::AuthBindTempAuthKey;
     outputStream << permAuthKeyId;
     outputStream << nonce;
@@ -64,7 +69,10 @@ AuthRpcLayer::PendingBool *AuthRpcLayer::bindTempAuthKey(quint64 permAuthKeyId,
 AuthRpcLayer::PendingBool *AuthRpcLayer::cancelCode(const QString &phoneNumber, const QString &phoneCodeHash)
 {
     qCDebug(c_clientRpcAuthCategory) << Q_FUNC_INFO << phoneNumber << phoneCodeHash;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::AuthCancelCode)
+            + MTProto::serializedSize(phoneNumber)
+            + MTProto::serializedSize(phoneCodeHash);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::AuthCancelCode;
     outputStream << phoneNumber;
     outputStream << phoneCodeHash;
@@ -76,7 +84,9 @@ AuthRpcLayer::PendingBool *AuthRpcLayer::cancelCode(const QString &phoneNumber,
 AuthRpcLayer::PendingAuthAuthorization *AuthRpcLayer::checkPassword(const QByteArray &passwordHash)
 {
     qCDebug(c_clientRpcAuthCategory) << Q_FUNC_INFO << passwordHash.toHex();
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::AuthCheckPassword)
+            + MTProto::serializedSize(passwordHash);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::AuthCheckPassword;
     outputStream << passwordHash;
     PendingAuthAuthorization *op = new PendingAuthAuthorization(this, outputStream.getData());
@@ -87,7 +97,9 @@ AuthRpcLayer::PendingAuthAuthorization *AuthRpcLayer::checkPassword(const QByteA
 AuthRpcLayer::PendingAuthCheckedPhone *AuthRpcLayer::checkPhone(const QString &phoneNumber)
 {
     qCDebug(c_clientRpcAuthCategory) << Q_FUNC_INFO << phoneNumber;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::AuthCheckPhone)
+            + MTProto::serializedSize(phoneNumber);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::AuthCheckPhone;
     outputStream << phoneNumber;
     PendingAuthCheckedPhone *op = new PendingAuthCheckedPhone(this, outputStream.getData());
@@ -98,7 +110,9 @@ AuthRpcLayer::PendingAuthCheckedPhone *AuthRpcLayer::checkPhone(const QString &p
 AuthRpcLayer::PendingBool *AuthRpcLayer::dropTempAuthKeys(const TLVector<quint64> &exceptAuthKeys)
 {
     qCDebug(c_clientRpcAuthCategory) << Q_FUNC_INFO << exceptAuthKeys;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::AuthDropTempAuthKeys)
+            + MTProto::serializedSize(exceptAuthKeys);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::AuthDropTempAuthKeys;
     outputStream << exceptAuthKeys;
     PendingBool *op = new PendingBool(this, outputStream.getData());
@@ -109,7 +123,9 @@ AuthRpcLayer::PendingBool *AuthRpcLayer::dropTempAuthKeys(const TLVector<quint64
 AuthRpcLayer::PendingAuthExportedAuthorization *AuthRpcLayer::exportAuthorization(quint32 dcId)
 {
     qCDebug(c_clientRpcAuthCategory) << Q_FUNC_INFO << dcId;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::AuthExportAuthorization)
+            + MTProto::serializedSize(dcId);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::AuthExportAuthorization;
     outputStream << dcId;
     PendingAuthExportedAuthorization *op = new PendingAuthExportedAuthorization(this, outputStream.getData());
@@ -120,7 +136,10 @@ AuthRpcLayer::PendingAuthExportedAuthorization *AuthRpcLayer::exportAuthorizatio
 AuthRpcLayer::PendingAuthAuthorization *AuthRpcLayer::importAuthorization(quint32 id, const QByteArray &bytes)
 {
     qCDebug(c_clientRpcAuthCategory) << Q_FUNC_INFO << id << bytes.toHex();
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::AuthImportAuthorization)
+            + MTProto::serializedSize(id)
+            + MTProto::serializedSize(bytes);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::AuthImportAuthorization;
     outputStream << id;
     outputStream << bytes;
@@ -132,7 +151,12 @@ AuthRpcLayer::PendingAuthAuthorization *AuthRpcLayer::importAuthorization(quint3
 AuthRpcLayer::PendingAuthAuthorization *AuthRpcLayer::importBotAuthorization(quint32 flags, quint32 apiId, const QString &apiHash, const QString &botAuthToken)
 {
     qCDebug(c_clientRpcAuthCategory) << Q_FUNC_INFO << flags << apiId << apiHash << botAuthToken;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::AuthImportBotAuthorization)
+            + MTProto::serializedSize(flags)
+            + MTProto::serializedSize(apiId)
+            + MTProto::serializedSize(apiHash)
+            + MTProto::serializedSize(botAuthToken);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::AuthImportBotAuthorization;
     outputStream << flags;
     outputStream << apiId;
@@ -146,7 +170,8 @@ AuthRpcLayer::PendingAuthAuthorization *AuthRpcLayer::importBotAuthorization(qui
 AuthRpcLayer::PendingBool *AuthRpcLayer::logOut()
 {
     qCDebug(c_clientRpcAuthCategory) << Q_FUNC_INFO;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::AuthLogOut);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::AuthLogOut;
     PendingBool *op = new PendingBool(this, outputStream.getData());
     processRpcCall(op);
@@ -156,7 +181,9 @@ AuthRpcLayer::PendingBool *AuthRpcLayer::logOut()
 AuthRpcLayer::PendingAuthAuthorization *AuthRpcLayer::recoverPassword(const QString &code)
 {
     qCDebug(c_clientRpcAuthCategory) << Q_FUNC_INFO << code;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::AuthRecoverPassword)
+            + MTProto::serializedSize(code);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::AuthRecoverPassword;
     outputStream << code;
     PendingAuthAuthorization *op = new PendingAuthAuthorization(this, outputStream.getData());
@@ -167,7 +194,8 @@ AuthRpcLayer::PendingAuthAuthorization *AuthRpcLayer::recoverPassword(const QStr
 AuthRpcLayer::PendingAuthPasswordRecovery *AuthRpcLayer::requestPasswordRecovery()
 {
     qCDebug(c_clientRpcAuthCategory) << Q_FUNC_INFO;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::AuthRequestPasswordRecovery);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::AuthRequestPasswordRecovery;
     PendingAuthPasswordRecovery *op = new PendingAuthPasswordRecovery(this, outputStream.getData());
     processRpcCall(op);
@@ -177,7 +205,10 @@ AuthRpcLayer::PendingAuthPasswordRecovery *AuthRpcLayer::requestPasswordRecovery
 AuthRpcLayer::PendingAuthSentCode *AuthRpcLayer::resendCode(const QString &phoneNumber, const QString &phoneCodeHash)
 {
     qCDebug(c_clientRpcAuthCategory) << Q_FUNC_INFO << phoneNumber << phoneCodeHash;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::AuthResendCode)
+            + MTProto::serializedSize(phoneNumber)
+            + MTProto::serializedSize(phoneCodeHash);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::AuthResendCode;
     outputStream << phoneNumber;
     outputStream << phoneCodeHash;
@@ -189,7 +220,8 @@ AuthRpcLayer::PendingAuthSentCode *AuthRpcLayer::resendCode(const QString &phone
 AuthRpcLayer::PendingBool *AuthRpcLayer::resetAuthorizations()
 {
     qCDebug(c_clientRpcAuthCategory) << Q_FUNC_INFO;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::AuthResetAuthorizations);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::AuthResetAuthorizations;
     PendingBool *op = new PendingBool(this, outputStream.getData());
     processRpcCall(op);
@@ -199,7 +231,13 @@ AuthRpcLayer::PendingBool *AuthRpcLayer::resetAuthorizations()
 AuthRpcLayer::PendingAuthSentCode *AuthRpcLayer::sendCode(quint32 flags, const QString &phoneNumber, bool currentNumber, quint32 apiId, const QString &apiHash)
 {
     qCDebug(c_clientRpcAuthCategory) << Q_FUNC_INFO << flags << phoneNumber << currentNumber << apiId << apiHash;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::AuthSendCode)
+            + MTProto::serializedSize(flags)
+            + MTProto::serializedSize(phoneNumber)
+            + (flags & 1 << 0 ? MTProto::serializedSize(currentNumber) : 0u)
+            + MTProto::serializedSize(apiId)
+            + MTProto::serializedSize(apiHash);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::AuthSendCode;
     outputStream << flags;
     // (flags & 1 << 0) stands for allowFlashcall "true" value
@@ -217,7 +255,10 @@ AuthRpcLayer::PendingAuthSentCode *AuthRpcLayer::sendCode(quint32 flags, const Q
 AuthRpcLayer::PendingBool *AuthRpcLayer::sendInvites(const TLVector<QString> &phoneNumbers, const QString &message)
 {
     qCDebug(c_clientRpcAuthCategory) << Q_FUNC_INFO << phoneNumbers << message;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::AuthSendInvites)
+            + MTProto::serializedSize(phoneNumbers)
+            + MTProto::serializedSize(message);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::AuthSendInvites;
     outputStream << phoneNumbers;
     outputStream << message;
@@ -229,7 +270,11 @@ AuthRpcLayer::PendingBool *AuthRpcLayer::sendInvites(const TLVector<QString> &ph
 AuthRpcLayer::PendingAuthAuthorization *AuthRpcLayer::signIn(const QString &phoneNumber, const QString &phoneCodeHash, const QString &phoneCode)
 {
     qCDebug(c_clientRpcAuthCategory) << Q_FUNC_INFO << phoneNumber << phoneCodeHash << phoneCode;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::AuthSignIn)
+            + MTProto::serializedSize(phoneNumber)
+            + MTProto::serializedSize(phoneCodeHash)
+            + MTProto::serializedSize(phoneCode);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::AuthSignIn;
     outputStream << phoneNumber;
     outputStream << phoneCodeHash;
@@ -242,7 +287,13 @@ AuthRpcLayer::PendingAuthAuthorization *AuthRpcLayer::signIn(const QString &phon
 AuthRpcLayer::PendingAuthAuthorization *AuthRpcLayer::signUp(const QString &phoneNumber, const QString &phoneCodeHash, const QString &phoneCode, const QString &firstName, const QString &lastName)
 {
     qCDebug(c_clientRpcAuthCategory) << Q_FUNC_INFO << phoneNumber << phoneCodeHash << phoneCode << firstName << lastName;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::AuthSignUp)
+            + MTProto::serializedSize(phoneNumber)
+            + MTProto::serializedSize(phoneCodeHash)
+            + MTProto::serializedSize(phoneCode)
+            + MTProto::serializedSize(firstName)
+            + MTProto::serializedSize(lastName);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::AuthSignUp;
     outputStream << phoneNumber;
     outputStream << phoneCodeHash;
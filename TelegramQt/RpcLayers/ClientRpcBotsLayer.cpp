@@ -45,7 +45,10 @@ BotsRpcLayer::BotsRpcLayer(QObject *parent) :
 BotsRpcLayer::PendingBool *BotsRpcLayer::answerWebhookJSONQuery(quint64 queryId, const TLDataJSON &data)
 {
     qCDebug(c_clientRpcBotsCategory) << Q_FUNC_INFO << queryId << data;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::BotsAnswerWebhookJSONQuery)
+            + MTProto::serializedSize(queryId)
+            + MTProto::serializedSize(data);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::BotsAnswerWebhookJSONQuery;
     outputStream << queryId;
     outputStream << data;
@@ -57,7 +60,10 @@ BotsRpcLayer::PendingBool *BotsRpcLayer::answerWebhookJSONQuery(quint64 queryId,
 BotsRpcLayer::PendingDataJSON *BotsRpcLayer::sendCustomRequest(const QString &customMethod, const TLDataJSON &params)
 {
     qCDebug(c_clientRpcBotsCategory) << Q_FUNC_INFO << customMethod << params;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::BotsSendCustomRequest)
+            + MTProto::serializedSize(customMethod)
+            + MTProto::serializedSize(params);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::BotsSendCustomRequest;
     outputStream << customMethod;
     outputStream << params;
@@ -52,7 +52,10 @@ ChannelsRpcLayer::ChannelsRpcLayer(QObject *parent) :
 ChannelsRpcLayer::PendingBool *ChannelsRpcLayer::checkUsername(const TLInputChannel &channel, const QString &username)
 {
     qCDebug(c_clientRpcChannelsCategory) << Q_FUNC_INFO << channel << username;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::ChannelsCheckUsername)
+            + MTProto::serializedSize(channel)
+            + MTProto::serializedSize(username);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::ChannelsCheckUsername;
     outputStream << channel;
     outputStream << username;
@@ -64,7 +67,11 @@ ChannelsRpcLayer::PendingBool *ChannelsRpcLayer::checkUsername(const TLInputChan
 ChannelsRpcLayer::PendingUpdates *ChannelsRpcLayer::createChannel(quint32 flags, const QString &title, const QString &about)
 {
     qCDebug(c_clientRpcChannelsCategory) << Q_FUNC_INFO << flags << title << about;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::ChannelsCreateChannel)
+            + MTProto::serializedSize(flags)
+            + MTProto::serializedSize(title)
+            + MTProto::serializedSize(about);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::ChannelsCreateChannel;
     outputStream << flags;
     // (flags & 1 << 0) stands for broadcast "true" value
@@ -79,7 +86,9 @@ ChannelsRpcLayer::PendingUpdates *ChannelsRpcLayer::createChannel(quint32 flags,
 ChannelsRpcLayer::PendingUpdates *ChannelsRpcLayer::deleteChannel(const TLInputChannel &channel)
 {
     qCDebug(c_clientRpcChannelsCategory) << Q_FUNC_INFO << channel;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::ChannelsDeleteChannel)
+            + MTProto::serializedSize(channel);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::ChannelsDeleteChannel;
     outputStream << channel;
     PendingUpdates *op = new PendingUpdates(this, outputStream.getData());
@@ -90,7 +99,10 @@ ChannelsRpcLayer::PendingUpdates *ChannelsRpcLayer::deleteChannel(const TLInputC
 ChannelsRpcLayer::PendingBool *ChannelsRpcLayer::deleteHistory(const TLInputChannel &channel, quint32 maxId)
 {
     qCDebug(c_clientRpcChannelsCategory) << Q_FUNC_INFO << channel << maxId;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::ChannelsDeleteHistory)
+            + MTProto::serializedSize(channel)
+            + MTProto::serializedSize(maxId);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::ChannelsDeleteHistory;
     outputStream << channel;
     outputStream << maxId;
@@ -102,7 +114,10 @@ ChannelsRpcLayer::PendingBool *ChannelsRpcLayer::deleteHistory(const TLInputChan
 ChannelsRpcLayer::PendingMessagesAffectedMessages *ChannelsRpcLayer::deleteMessages(const TLInputChannel &channel, const TLVector<quint32> &id)
 {
     qCDebug(c_clientRpcChannelsCategory) << Q_FUNC_INFO << channel << id;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::ChannelsDeleteMessages)
+            + MTProto::serializedSize(channel)
+            + MTProto::serializedSize(id);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::ChannelsDeleteMessages;
     outputStream << channel;
     outputStream << id;
@@ -114,7 +129,10 @@ ChannelsRpcLayer::PendingMessagesAffectedMessages *ChannelsRpcLayer::deleteMessa
 ChannelsRpcLayer::PendingMessagesAffectedHistory *ChannelsRpcLayer::deleteUserHistory(const TLInputChannel &channel, const TLInputUser &userId)
 {
     qCDebug(c_clientRpcChannelsCategory) << Q_FUNC_INFO << channel << userId;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::ChannelsDeleteUserHistory)
+            + MTProto::serializedSize(channel)
+            + MTProto::serializedSize(userId);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::ChannelsDeleteUserHistory;
     outputStream << channel;
     outputStream << userId;
@@ -126,7 +144,10 @@ ChannelsRpcLayer::PendingMessagesAffectedHistory *ChannelsRpcLayer::deleteUserHi
 ChannelsRpcLayer::PendingBool *ChannelsRpcLayer::editAbout(const TLInputChannel &channel, const QString &about)
 {
     qCDebug(c_clientRpcChannelsCategory) << Q_FUNC_INFO << channel << about;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::ChannelsEditAbout)
+            + MTProto::serializedSize(channel)
+            + MTProto::serializedSize(about);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::ChannelsEditAbout;
     outputStream << channel;
     outputStream << about;
@@ -138,7 +159,11 @@ ChannelsRpcLayer::PendingBool *ChannelsRpcLayer::editAbout(const TLInputChannel
 ChannelsRpcLayer::PendingUpdates *ChannelsRpcLayer::editAdmin(const TLInputChannel &channel, const TLInputUser &userId, const TLChannelAdminRights &adminRights)
 {
     qCDebug(c_clientRpcChannelsCategory) << Q_FUNC_INFO << channel << userId << adminRights;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::ChannelsEditAdmin)
+            + MTProto::serializedSize(channel)
+            + MTProto::serializedSize(userId)
+            + MTProto::serializedSize(adminRights);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::ChannelsEditAdmin;
     outputStream << channel;
     outputStream << userId;
@@ -151,7 +176,11 @@ ChannelsRpcLayer::PendingUpdates *ChannelsRpcLayer::editAdmin(const TLInputChann
 ChannelsRpcLayer::PendingUpdates *ChannelsRpcLayer::editBanned(const TLInputChannel &channel, const TLInputUser &userId, const TLChannelBannedRights &bannedRights)
 {
     qCDebug(c_clientRpcChannelsCategory) << Q_FUNC_INFO << channel << userId << bannedRights;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::ChannelsEditBanned)
+            + MTProto::serializedSize(channel)
+            + MTProto::serializedSize(userId)
+            + MTProto::serializedSize(bannedRights);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::ChannelsEditBanned;
     outputStream << channel;
     outputStream << userId;
@@ -164,7 +193,10 @@ ChannelsRpcLayer::PendingUpdates *ChannelsRpcLayer::editBanned(const TLInputChan
 ChannelsRpcLayer::PendingUpdates *ChannelsRpcLayer::editPhoto(const TLInputChannel &channel, const TLInputChatPhoto &photo)
 {
     qCDebug(c_clientRpcChannelsCategory) << Q_FUNC_INFO << channel << photo;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::ChannelsEditPhoto)
+            + MTProto::serializedSize(channel)
+            + MTProto::serializedSize(photo);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::ChannelsEditPhoto;
     outputStream << channel;
     outputStream << photo;
@@ -176,7 +208,10 @@ ChannelsRpcLayer::PendingUpdates *ChannelsRpcLayer::editPhoto(const TLInputChann
 ChannelsRpcLayer::PendingUpdates *ChannelsRpcLayer::editTitle(const TLInputChannel &channel, const QString &title)
 {
     qCDebug(c_clientRpcChannelsCategory) << Q_FUNC_INFO << channel << title;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::ChannelsEditTitle)
+            + MTProto::serializedSize(channel)
+            + MTProto::serializedSize(title);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::ChannelsEditTitle;
     outputStream << channel;
     outputStream << title;
@@ -188,7 +223,9 @@ ChannelsRpcLayer::PendingUpdates *ChannelsRpcLayer::editTitle(const TLInputChann
 ChannelsRpcLayer::PendingExportedChatInvite *ChannelsRpcLayer::exportInvite(const TLInputChannel &channel)
 {
     qCDebug(c_clientRpcChannelsCategory) << Q_FUNC_INFO << channel;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::ChannelsExportInvite)
+            + MTProto::serializedSize(channel);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::ChannelsExportInvite;
     outputStream << channel;
     PendingExportedChatInvite *op = new PendingExportedChatInvite(this, outputStream.getData());
@@ -199,7 +236,10 @@ ChannelsRpcLayer::PendingExportedChatInvite *ChannelsRpcLayer::exportInvite(cons
 ChannelsRpcLayer::PendingExportedMessageLink *ChannelsRpcLayer::exportMessageLink(const TLInputChannel &channel, quint32 id)
 {
     qCDebug(c_clientRpcChannelsCategory) << Q_FUNC_INFO << channel << id;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::ChannelsExportMessageLink)
+            + MTProto::serializedSize(channel)
+            + MTProto::serializedSize(id);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::ChannelsExportMessageLink;
     outputStream << channel;
     outputStream << id;
@@ -211,7 +251,16 @@ ChannelsRpcLayer::PendingExportedMessageLink *ChannelsRpcLayer::exportMessageLin
 ChannelsRpcLayer::PendingChannelsAdminLogResults *ChannelsRpcLayer::getAdminLog(quint32 flags, const TLInputChannel &channel, const QString &q, const TLChannelAdminLogEventsFilter &eventsFilter, const TLVector<TLInputUser> &admins, quint64 maxId, quint64 minId, quint32 limit)
 {
     qCDebug(c_clientRpcChannelsCategory) << Q_FUNC_INFO << flags << channel << q << eventsFilter << admins << maxId << minId << limit;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::ChannelsGetAdminLog)
+            + MTProto::serializedSize(flags)
+            + MTProto::serializedSize(channel)
+            + MTProto::serializedSize(q)
+            + (flags & 1 << 0 ? MTProto::serializedSize(eventsFilter) : 0u)
+            + (flags & 1 << 1 ? MTProto::serializedSize(admins) : 0u)
+            + MTProto::serializedSize(maxId)
+            + MTProto::serializedSize(minId)
+            + MTProto::serializedSize(limit);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::ChannelsGetAdminLog;
     outputStream << flags;
     outputStream << channel;
@@ -233,7 +282,8 @@ ChannelsRpcLayer::PendingChannelsAdminLogResults *ChannelsRpcLayer::getAdminLog(
 ChannelsRpcLayer::PendingMessagesChats *ChannelsRpcLayer::getAdminedPublicChannels()
 {
     qCDebug(c_clientRpcChannelsCategory) << Q_FUNC_INFO;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::ChannelsGetAdminedPublicChannels);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::ChannelsGetAdminedPublicChannels;
     PendingMessagesChats *op = new PendingMessagesChats(this, outputStream.getData());
     processRpcCall(op);
@@ -243,7 +293,9 @@ ChannelsRpcLayer::PendingMessagesChats *ChannelsRpcLayer::getAdminedPublicChanne
 ChannelsRpcLayer::PendingMessagesChats *ChannelsRpcLayer::getChannels(const TLVector<TLInputChannel> &id)
 {
     qCDebug(c_clientRpcChannelsCategory) << Q_FUNC_INFO << id;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::ChannelsGetChannels)
+            + MTProto::serializedSize(id);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::ChannelsGetChannels;
     outputStream << id;
     PendingMessagesChats *op = new PendingMessagesChats(this, outputStream.getData());
@@ -254,7 +306,9 @@ ChannelsRpcLayer::PendingMessagesChats *ChannelsRpcLayer::getChannels(const TLVe
 ChannelsRpcLayer::PendingMessagesChatFull *ChannelsRpcLayer::getFullChannel(const TLInputChannel &channel)
 {
     qCDebug(c_clientRpcChannelsCategory) << Q_FUNC_INFO << channel;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::ChannelsGetFullChannel)
+            + MTProto::serializedSize(channel);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::ChannelsGetFullChannel;
     outputStream << channel;
     PendingMessagesChatFull *op = new PendingMessagesChatFull(this, outputStream.getData());
@@ -265,7 +319,10 @@ ChannelsRpcLayer::PendingMessagesChatFull *ChannelsRpcLayer::getFullChannel(cons
 ChannelsRpcLayer::PendingMessagesMessages *ChannelsRpcLayer::getMessages(const TLInputChannel &channel, const TLVector<quint32> &id)
 {
     qCDebug(c_clientRpcChannelsCategory) << Q_FUNC_INFO << channel << id;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::ChannelsGetMessages)
+            + MTProto::serializedSize(channel)
+            + MTProto::serializedSize(id);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::ChannelsGetMessages;
     outputStream << channel;
     outputStream << id;
@@ -277,7 +334,10 @@ ChannelsRpcLayer::PendingMessagesMessages *ChannelsRpcLayer::getMessages(const T
 ChannelsRpcLayer::PendingChannelsChannelParticipant *ChannelsRpcLayer::getParticipant(const TLInputChannel &channel, const TLInputUser &userId)
 {
     qCDebug(c_clientRpcChannelsCategory) << Q_FUNC_INFO << channel << userId;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::ChannelsGetParticipant)
+            + MTProto::serializedSize(channel)
+            + MTProto::serializedSize(userId);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::ChannelsGetParticipant;
     outputStream << channel;
     outputStream << userId;
@@ -289,7 +349,13 @@ ChannelsRpcLayer::PendingChannelsChannelParticipant *ChannelsRpcLayer::getPartic
 ChannelsRpcLayer::PendingChannelsChannelParticipants *ChannelsRpcLayer::getParticipants(const TLInputChannel &channel, const TLChannelParticipantsFilter &filter, quint32 offset, quint32 limit, quint32 hash)
 {
     qCDebug(c_clientRpcChannelsCategory) << Q_FUNC_INFO << channel << filter << offset << limit << hash;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::ChannelsGetParticipants)
+            + MTProto::serializedSize(channel)
+            + MTProto::serializedSize(filter)
+            + MTProto::serializedSize(offset)
+            + MTProto::serializedSize(limit)
+            + MTProto::serializedSize(hash);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::ChannelsGetParticipants;
     outputStream << channel;
     outputStream << filter;
@@ -304,7 +370,10 @@ ChannelsRpcLayer::PendingChannelsChannelParticipants *ChannelsRpcLayer::getParti
 ChannelsRpcLayer::PendingUpdates *ChannelsRpcLayer::inviteToChannel(const TLInputChannel &channel, const TLVector<TLInputUser> &users)
 {
     qCDebug(c_clientRpcChannelsCategory) << Q_FUNC_INFO << channel << users;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::ChannelsInviteToChannel)
+            + MTProto::serializedSize(channel)
+            + MTProto::serializedSize(users);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::ChannelsInviteToChannel;
     outputStream << channel;
     outputStream << users;
@@ -316,7 +385,9 @@ ChannelsRpcLayer::PendingUpdates *ChannelsRpcLayer::inviteToChannel(const TLInpu
 ChannelsRpcLayer::PendingUpdates *ChannelsRpcLayer::joinChannel(const TLInputChannel &channel)
 {
     qCDebug(c_clientRpcChannelsCategory) << Q_FUNC_INFO << channel;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::ChannelsJoinChannel)
+            + MTProto::serializedSize(channel);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::ChannelsJoinChannel;
     outputStream << channel;
     PendingUpdates *op = new PendingUpdates(this, outputStream.getData());
@@ -327,7 +398,9 @@ ChannelsRpcLayer::PendingUpdates *ChannelsRpcLayer::joinChannel(const TLInputCha
 ChannelsRpcLayer::PendingUpdates *ChannelsRpcLayer::leaveChannel(const TLInputChannel &channel)
 {
     qCDebug(c_clientRpcChannelsCategory) << Q_FUNC_INFO << channel;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::ChannelsLeaveChannel)
+            + MTProto::serializedSize(channel);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::ChannelsLeaveChannel;
     outputStream << channel;
     PendingUpdates *op = new PendingUpdates(this, outputStream.getData());
@@ -338,7 +411,10 @@ ChannelsRpcLayer::PendingUpdates *ChannelsRpcLayer::leaveChannel(const TLInputCh
 ChannelsRpcLayer::PendingBool *ChannelsRpcLayer::readHistory(const TLInputChannel &channel, quint32 maxId)
 {
     qCDebug(c_clientRpcChannelsCategory) << Q_FUNC_INFO << channel << maxId;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::ChannelsReadHistory)
+            + MTProto::serializedSize(channel)
+            + MTProto::serializedSize(maxId);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::ChannelsReadHistory;
     outputStream << channel;
     outputStream << maxId;
@@ -350,7 +426,10 @@ ChannelsRpcLayer::PendingBool *ChannelsRpcLayer::readHistory(const TLInputChanne
 ChannelsRpcLayer::PendingBool *ChannelsRpcLayer::readMessageContents(const TLInputChannel &channel, const TLVector<quint32> &id)
 {
     qCDebug(c_clientRpcChannelsCategory) << Q_FUNC_INFO << channel << id;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::ChannelsReadMessageContents)
+            + MTProto::serializedSize(channel)
+            + MTProto::serializedSize(id);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::ChannelsReadMessageContents;
     outputStream << channel;
     outputStream << id;
@@ -362,7 +441,11 @@ ChannelsRpcLayer::PendingBool *ChannelsRpcLayer::readMessageContents(const TLInp
 ChannelsRpcLayer::PendingBool *ChannelsRpcLayer::reportSpam(const TLInputChannel &channel, const TLInputUser &userId, const TLVector<quint32> &id)
 {
     qCDebug(c_clientRpcChannelsCategory) << Q_FUNC_INFO << channel << userId << id;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::ChannelsReportSpam)
+            + MTProto::serializedSize(channel)
+            + MTProto::serializedSize(userId)
+            + MTProto::serializedSize(id);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::ChannelsReportSpam;
     outputStream << channel;
     outputStream << userId;
@@ -375,7 +458,10 @@ ChannelsRpcLayer::PendingBool *ChannelsRpcLayer::reportSpam(const TLInputChannel
 ChannelsRpcLayer::PendingBool *ChannelsRpcLayer::setStickers(const TLInputChannel &channel, const TLInputStickerSet &stickerset)
 {
     qCDebug(c_clientRpcChannelsCategory) << Q_FUNC_INFO << channel << stickerset;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::ChannelsSetStickers)
+            + MTProto::serializedSize(channel)
+            + MTProto::serializedSize(stickerset);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::ChannelsSetStickers;
     outputStream << channel;
     outputStream << stickerset;
@@ -387,7 +473,10 @@ ChannelsRpcLayer::PendingBool *ChannelsRpcLayer::setStickers(const TLInputChanne
 ChannelsRpcLayer::PendingUpdates *ChannelsRpcLayer::toggleInvites(const TLInputChannel &channel, bool enabled)
 {
     qCDebug(c_clientRpcChannelsCategory) << Q_FUNC_INFO << channel << enabled;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::ChannelsToggleInvites)
+            + MTProto::serializedSize(channel)
+            + MTProto::serializedSize(enabled);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::ChannelsToggleInvites;
     outputStream << channel;
     outputStream << enabled;
@@ -399,7 +488,10 @@ ChannelsRpcLayer::PendingUpdates *ChannelsRpcLayer::toggleInvites(const TLInputC
 ChannelsRpcLayer::PendingUpdates *ChannelsRpcLayer::togglePreHistoryHidden(const TLInputChannel &channel, bool enabled)
 {
     qCDebug(c_clientRpcChannelsCategory) << Q_FUNC_INFO << channel << enabled;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::ChannelsTogglePreHistoryHidden)
+            + MTProto::serializedSize(channel)
+            + MTProto::serializedSize(enabled);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::ChannelsTogglePreHistoryHidden;
     outputStream << channel;
     outputStream << enabled;
@@ -411,7 +503,10 @@ ChannelsRpcLayer::PendingUpdates *ChannelsRpcLayer::togglePreHistoryHidden(const
 ChannelsRpcLayer::PendingUpdates *ChannelsRpcLayer::toggleSignatures(const TLInputChannel &channel, bool enabled)
 {
     qCDebug(c_clientRpcChannelsCategory) << Q_FUNC_INFO << channel << enabled;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::ChannelsToggleSignatures)
+            + MTProto::serializedSize(channel)
+            + MTProto::serializedSize(enabled);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::ChannelsToggleSignatures;
     outputStream << channel;
     outputStream << enabled;
@@ -423,7 +518,11 @@ ChannelsRpcLayer::PendingUpdates *ChannelsRpcLayer::toggleSignatures(const TLInp
 ChannelsRpcLayer::PendingUpdates *ChannelsRpcLayer::updatePinnedMessage(quint32 flags, const TLInputChannel &channel, quint32 id)
 {
     qCDebug(c_clientRpcChannelsCategory) << Q_FUNC_INFO << flags << channel << id;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::ChannelsUpdatePinnedMessage)
+            + MTProto::serializedSize(flags)
+            + MTProto::serializedSize(channel)
+            + MTProto::serializedSize(id);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::ChannelsUpdatePinnedMessage;
     outputStream << flags;
     // (flags & 1 << 0) stands for silent "true" value
@@ -437,7 +536,10 @@ ChannelsRpcLayer::PendingUpdates *ChannelsRpcLayer::updatePinnedMessage(quint32
 ChannelsRpcLayer::PendingBool *ChannelsRpcLayer::updateUsername(const TLInputChannel &channel, const QString &username)
 {
     qCDebug(c_clientRpcChannelsCategory) << Q_FUNC_INFO << channel << username;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::ChannelsUpdateUsername)
+            + MTProto::serializedSize(channel)
+            + MTProto::serializedSize(username);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::ChannelsUpdateUsername;
     outputStream << channel;
     outputStream << username;
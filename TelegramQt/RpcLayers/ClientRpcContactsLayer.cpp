@@ -52,7 +52,9 @@ ContactsRpcLayer::ContactsRpcLayer(QObject *parent) :
 ContactsRpcLayer::PendingBool *ContactsRpcLayer::block(const TLInputUser &id)
 {
     qCDebug(c_clientRpcContactsCategory) << Q_FUNC_INFO << id;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::ContactsBlock)
+            + MTProto::serializedSize(id);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::ContactsBlock;
     outputStream << id;
     PendingBool *op = new PendingBool(this, outputStream.getData());
@@ -63,7 +65,9 @@ ContactsRpcLayer::PendingBool *ContactsRpcLayer::block(const TLInputUser &id)
 ContactsRpcLayer::PendingContactsLink *ContactsRpcLayer::deleteContact(const TLInputUser &id)
 {
     qCDebug(c_clientRpcContactsCategory) << Q_FUNC_INFO << id;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::ContactsDeleteContact)
+            + MTProto::serializedSize(id);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::ContactsDeleteContact;
     outputStream << id;
     PendingContactsLink *op = new PendingContactsLink(this, outputStream.getData());
@@ -74,7 +78,9 @@ ContactsRpcLayer::PendingContactsLink *ContactsRpcLayer::deleteContact(const TLI
 ContactsRpcLayer::PendingBool *ContactsRpcLayer::deleteContacts(const TLVector<TLInputUser> &id)
 {
     qCDebug(c_clientRpcContactsCategory) << Q_FUNC_INFO << id;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::ContactsDeleteContacts)
+            + MTProto::serializedSize(id);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::ContactsDeleteContacts;
     outputStream << id;
     PendingBool *op = new PendingBool(this, outputStream.getData());
@@ -85,7 +91,8 @@ ContactsRpcLayer::PendingBool *ContactsRpcLayer::deleteContacts(const TLVector<T
 ContactsRpcLayer::PendingQuint32Vector *ContactsRpcLayer::exportCard()
 {
     qCDebug(c_clientRpcContactsCategory) << Q_FUNC_INFO;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::ContactsExportCard);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::ContactsExportCard;
     PendingQuint32Vector *op = new PendingQuint32Vector(this, outputStream.getData());
     processRpcCall(op);
@@ -95,7 +102,10 @@ ContactsRpcLayer::PendingQuint32Vector *ContactsRpcLayer::exportCard()
 ContactsRpcLayer::PendingContactsBlocked *ContactsRpcLayer::getBlocked(quint32 offset, quint32 limit)
 {
     qCDebug(c_clientRpcContactsCategory) << Q_FUNC_INFO << offset << limit;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::ContactsGetBlocked)
+            + MTProto::serializedSize(offset)
+            + MTProto::serializedSize(limit);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::ContactsGetBlocked;
     outputStream << offset;
     outputStream << limit;
@@ -107,7 +117,9 @@ ContactsRpcLayer::PendingContactsBlocked *ContactsRpcLayer::getBlocked(quint32 o
 ContactsRpcLayer::PendingContactsContacts *ContactsRpcLayer::getContacts(quint32 hash)
 {
     qCDebug(c_clientRpcContactsCategory) << Q_FUNC_INFO << hash;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::ContactsGetContacts)
+            + MTProto::serializedSize(hash);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::ContactsGetContacts;
     outputStream << hash;
     PendingContactsContacts *op = new PendingContactsContacts(this, outputStream.getData());
@@ -118,7 +130,8 @@ ContactsRpcLayer::PendingContactsContacts *ContactsRpcLayer::getContacts(quint32
 ContactsRpcLayer::PendingContactStatusVector *ContactsRpcLayer::getStatuses()
 {
     qCDebug(c_clientRpcContactsCategory) << Q_FUNC_INFO;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::ContactsGetStatuses);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::ContactsGetStatuses;
     PendingContactStatusVector *op = new PendingContactStatusVector(this, outputStream.getData());
     processRpcCall(op);
@@ -128,7 +141,12 @@ ContactsRpcLayer::PendingContactStatusVector *ContactsRpcLayer::getStatuses()
 ContactsRpcLayer::PendingContactsTopPeers *ContactsRpcLayer::getTopPeers(quint32 flags, quint32 offset, quint32 limit, quint32 hash)
 {
     qCDebug(c_clientRpcContactsCategory) << Q_FUNC_INFO << flags << offset << limit << hash;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::ContactsGetTopPeers)
+            + MTProto::serializedSize(flags)
+            + MTProto::serializedSize(offset)
+            + MTProto::serializedSize(limit)
+            + MTProto::serializedSize(hash);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::ContactsGetTopPeers;
     outputStream << flags;
     // (flags & 1 << 0) stands for correspondents "true" value
@@ -148,7 +166,9 @@ ContactsRpcLayer::PendingContactsTopPeers *ContactsRpcLayer::getTopPeers(quint32
 ContactsRpcLayer::PendingUser *ContactsRpcLayer::importCard(const TLVector<quint32> &exportCard)
 {
     qCDebug(c_clientRpcContactsCategory) << Q_FUNC_INFO << exportCard;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::ContactsImportCard)
+            + MTProto::serializedSize(exportCard);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::ContactsImportCard;
     outputStream << exportCard;
     PendingUser *op = new PendingUser(this, outputStream.getData());
@@ -159,7 +179,9 @@ ContactsRpcLayer::PendingUser *ContactsRpcLayer::importCard(const TLVector<quint
 ContactsRpcLayer::PendingContactsImportedContacts *ContactsRpcLayer::importContacts(const TLVector<TLInputContact> &contacts)
 {
     qCDebug(c_clientRpcContactsCategory) << Q_FUNC_INFO << contacts;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::ContactsImportContacts)
+            + MTProto::serializedSize(contacts);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::ContactsImportContacts;
     outputStream << contacts;
     PendingContactsImportedContacts *op = new PendingContactsImportedContacts(this, outputStream.getData());
@@ -170,7 +192,8 @@ ContactsRpcLayer::PendingContactsImportedContacts *ContactsRpcLayer::importConta
 ContactsRpcLayer::PendingBool *ContactsRpcLayer::resetSaved()
 {
     qCDebug(c_clientRpcContactsCategory) << Q_FUNC_INFO;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::ContactsResetSaved);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::ContactsResetSaved;
     PendingBool *op = new PendingBool(this, outputStream.getData());
     processRpcCall(op);
@@ -180,7 +203,10 @@ ContactsRpcLayer::PendingBool *ContactsRpcLayer::resetSaved()
 ContactsRpcLayer::PendingBool *ContactsRpcLayer::resetTopPeerRating(const TLTopPeerCategory &category, const TLInputPeer &peer)
 {
     qCDebug(c_clientRpcContactsCategory) << Q_FUNC_INFO << category << peer;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::ContactsResetTopPeerRating)
+            + MTProto::serializedSize(category)
+            + MTProto::serializedSize(peer);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::ContactsResetTopPeerRating;
     outputStream << category;
     outputStream << peer;
@@ -192,7 +218,9 @@ ContactsRpcLayer::PendingBool *ContactsRpcLayer::resetTopPeerRating(const TLTopP
 ContactsRpcLayer::PendingContactsResolvedPeer *ContactsRpcLayer::resolveUsername(const QString &username)
 {
     qCDebug(c_clientRpcContactsCategory) << Q_FUNC_INFO << username;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::ContactsResolveUsername)
+            + MTProto::serializedSize(username);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::ContactsResolveUsername;
     outputStream << username;
     PendingContactsResolvedPeer *op = new PendingContactsResolvedPeer(this, outputStream.getData());
@@ -203,7 +231,10 @@ ContactsRpcLayer::PendingContactsResolvedPeer *ContactsRpcLayer::resolveUsername
 ContactsRpcLayer::PendingContactsFound *ContactsRpcLayer::search(const QString &q, quint32 limit)
 {
     qCDebug(c_clientRpcContactsCategory) << Q_FUNC_INFO << q << limit;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::ContactsSearch)
+            + MTProto::serializedSize(q)
+            + MTProto::serializedSize(limit);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::ContactsSearch;
     outputStream << q;
     outputStream << limit;
@@ -215,7 +246,9 @@ ContactsRpcLayer::PendingContactsFound *ContactsRpcLayer::search(const QString &
 ContactsRpcLayer::PendingBool *ContactsRpcLayer::unblock(const TLInputUser &id)
 {
     qCDebug(c_clientRpcContactsCategory) << Q_FUNC_INFO << id;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::ContactsUnblock)
+            + MTProto::serializedSize(id);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::ContactsUnblock;
     outputStream << id;
     PendingBool *op = new PendingBool(this, outputStream.getData());
@@ -48,7 +48,9 @@ HelpRpcLayer::HelpRpcLayer(QObject *parent) :
 HelpRpcLayer::PendingUpdates *HelpRpcLayer::getAppChangelog(const QString &prevAppVersion)
 {
     qCDebug(c_clientRpcHelpCategory) << Q_FUNC_INFO << prevAppVersion;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::HelpGetAppChangelog)
+            + MTProto::serializedSize(prevAppVersion);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::HelpGetAppChangelog;
     outputStream << prevAppVersion;
     PendingUpdates *op = new PendingUpdates(this, outputStream.getData());
@@ -59,7 +61,8 @@ HelpRpcLayer::PendingUpdates *HelpRpcLayer::getAppChangelog(const QString &prevA
 HelpRpcLayer::PendingHelpAppUpdate *HelpRpcLayer::getAppUpdate()
 {
     qCDebug(c_clientRpcHelpCategory) << Q_FUNC_INFO;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::HelpGetAppUpdate);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::HelpGetAppUpdate;
     PendingHelpAppUpdate *op = new PendingHelpAppUpdate(this, outputStream.getData());
     processRpcCall(op);
@@ -69,7 +72,8 @@ HelpRpcLayer::PendingHelpAppUpdate *HelpRpcLayer::getAppUpdate()
 HelpRpcLayer::PendingCdnConfig *HelpRpcLayer::getCdnConfig()
 {
     qCDebug(c_clientRpcHelpCategory) << Q_FUNC_INFO;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::HelpGetCdnConfig);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::HelpGetCdnConfig;
     PendingCdnConfig *op = new PendingCdnConfig(this, outputStream.getData());
     processRpcCall(op);
@@ -79,7 +83,8 @@ HelpRpcLayer::PendingCdnConfig *HelpRpcLayer::getCdnConfig()
 HelpRpcLayer::PendingConfig *HelpRpcLayer::getConfig()
 {
     qCDebug(c_clientRpcHelpCategory) << Q_FUNC_INFO;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::HelpGetConfig);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::HelpGetConfig;
     PendingConfig *op = new PendingConfig(this, outputStream.getData());
     processRpcCall(op);
@@ -89,7 +94,8 @@ HelpRpcLayer::PendingConfig *HelpRpcLayer::getConfig()
 HelpRpcLayer::PendingHelpInviteText *HelpRpcLayer::getInviteText()
 {
     qCDebug(c_clientRpcHelpCategory) << Q_FUNC_INFO;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::HelpGetInviteText);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::HelpGetInviteText;
     PendingHelpInviteText *op = new PendingHelpInviteText(this, outputStream.getData());
     processRpcCall(op);
@@ -99,7 +105,8 @@ HelpRpcLayer::PendingHelpInviteText *HelpRpcLayer::getInviteText()
 HelpRpcLayer::PendingNearestDc *HelpRpcLayer::getNearestDc()
 {
     qCDebug(c_clientRpcHelpCategory) << Q_FUNC_INFO;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::HelpGetNearestDc);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::HelpGetNearestDc;
     PendingNearestDc *op = new PendingNearestDc(this, outputStream.getData());
     processRpcCall(op);
@@ -109,7 +116,9 @@ HelpRpcLayer::PendingNearestDc *HelpRpcLayer::getNearestDc()
 HelpRpcLayer::PendingHelpRecentMeUrls *HelpRpcLayer::getRecentMeUrls(const QString &referer)
 {
     qCDebug(c_clientRpcHelpCategory) << Q_FUNC_INFO << referer;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::HelpGetRecentMeUrls)
+            + MTProto::serializedSize(referer);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::HelpGetRecentMeUrls;
     outputStream << referer;
     PendingHelpRecentMeUrls *op = new PendingHelpRecentMeUrls(this, outputStream.getData());
@@ -120,7 +129,8 @@ HelpRpcLayer::PendingHelpRecentMeUrls *HelpRpcLayer::getRecentMeUrls(const QStri
 HelpRpcLayer::PendingHelpSupport *HelpRpcLayer::getSupport()
 {
     qCDebug(c_clientRpcHelpCategory) << Q_FUNC_INFO;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::HelpGetSupport);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::HelpGetSupport;
     PendingHelpSupport *op = new PendingHelpSupport(this, outputStream.getData());
     processRpcCall(op);
@@ -130,7 +140,8 @@ HelpRpcLayer::PendingHelpSupport *HelpRpcLayer::getSupport()
 HelpRpcLayer::PendingHelpTermsOfService *HelpRpcLayer::getTermsOfService()
 {
     qCDebug(c_clientRpcHelpCategory) << Q_FUNC_INFO;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::HelpGetTermsOfService);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::HelpGetTermsOfService;
     PendingHelpTermsOfService *op = new PendingHelpTermsOfService(this, outputStream.getData());
     processRpcCall(op);
@@ -140,7 +151,9 @@ HelpRpcLayer::PendingHelpTermsOfService *HelpRpcLayer::getTermsOfService()
 HelpRpcLayer::PendingBool *HelpRpcLayer::saveAppLog(const TLVector<TLInputAppEvent> &events)
 {
     qCDebug(c_clientRpcHelpCategory) << Q_FUNC_INFO << events;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::HelpSaveAppLog)
+            + MTProto::serializedSize(events);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::HelpSaveAppLog;
     outputStream << events;
     PendingBool *op = new PendingBool(this, outputStream.getData());
@@ -151,7 +164,10 @@ HelpRpcLayer::PendingBool *HelpRpcLayer::saveAppLog(const TLVector<TLInputAppEve
 HelpRpcLayer::PendingBool *HelpRpcLayer::setBotUpdatesStatus(quint32 pendingUpdatesCount, const QString &message)
 {
     qCDebug(c_clientRpcHelpCategory) << Q_FUNC_INFO << pendingUpdatesCount << message;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::HelpSetBotUpdatesStatus)
+            + MTProto::serializedSize(pendingUpdatesCount)
+            + MTProto::serializedSize(message);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::HelpSetBotUpdatesStatus;
     outputStream << pendingUpdatesCount;
     outputStream << message;
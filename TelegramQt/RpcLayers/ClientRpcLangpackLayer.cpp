@@ -41,7 +41,9 @@ LangpackRpcLayer::LangpackRpcLayer(QObject *parent) :
 LangpackRpcLayer::PendingLangPackDifference *LangpackRpcLayer::getDifference(quint32 fromVersion)
 {
     qCDebug(c_clientRpcLangpackCategory) << Q_FUNC_INFO << fromVersion;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::LangpackGetDifference)
+            + MTProto::serializedSize(fromVersion);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::LangpackGetDifference;
     outputStream << fromVersion;
     PendingLangPackDifference *op = new PendingLangPackDifference(this, outputStream.getData());
@@ -52,7 +54,9 @@ LangpackRpcLayer::PendingLangPackDifference *LangpackRpcLayer::getDifference(qui
 LangpackRpcLayer::PendingLangPackDifference *LangpackRpcLayer::getLangPack(const QString &langCode)
 {
     qCDebug(c_clientRpcLangpackCategory) << Q_FUNC_INFO << langCode;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::LangpackGetLangPack)
+            + MTProto::serializedSize(langCode);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::LangpackGetLangPack;
     outputStream << langCode;
     PendingLangPackDifference *op = new PendingLangPackDifference(this, outputStream.getData());
@@ -63,7 +67,8 @@ LangpackRpcLayer::PendingLangPackDifference *LangpackRpcLayer::getLangPack(const
 LangpackRpcLayer::PendingLangPackLanguageVector *LangpackRpcLayer::getLanguages()
 {
     qCDebug(c_clientRpcLangpackCategory) << Q_FUNC_INFO;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::LangpackGetLanguages);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::LangpackGetLanguages;
     PendingLangPackLanguageVector *op = new PendingLangPackLanguageVector(this, outputStream.getData());
     processRpcCall(op);
@@ -73,7 +78,10 @@ LangpackRpcLayer::PendingLangPackLanguageVector *LangpackRpcLayer::getLanguages(
 LangpackRpcLayer::PendingLangPackStringVector *LangpackRpcLayer::getStrings(const QString &langCode, const TLVector<QString> &keys)
 {
     qCDebug(c_clientRpcLangpackCategory) << Q_FUNC_INFO << langCode << keys;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::LangpackGetStrings)
+            + MTProto::serializedSize(langCode)
+            + MTProto::serializedSize(keys);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::LangpackGetStrings;
     outputStream << langCode;
     outputStream << keys;
@@ -71,7 +71,11 @@ MessagesRpcLayer::MessagesRpcLayer(QObject *parent) :
 MessagesRpcLayer::PendingEncryptedChat *MessagesRpcLayer::acceptEncryption(const TLInputEncryptedChat &peer, const QByteArray &gB, quint64 keyFingerprint)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << peer << gB.toHex() << keyFingerprint;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesAcceptEncryption)
+            + MTProto::serializedSize(peer)
+            + MTProto::serializedSize(gB)
+            + MTProto::serializedSize(keyFingerprint);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesAcceptEncryption;
     outputStream << peer;
     outputStream << gB;
@@ -84,7 +88,11 @@ MessagesRpcLayer::PendingEncryptedChat *MessagesRpcLayer::acceptEncryption(const
 MessagesRpcLayer::PendingUpdates *MessagesRpcLayer::addChatUser(quint32 chatId, const TLInputUser &userId, quint32 fwdLimit)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << chatId << userId << fwdLimit;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesAddChatUser)
+            + MTProto::serializedSize(chatId)
+            + MTProto::serializedSize(userId)
+            + MTProto::serializedSize(fwdLimit);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesAddChatUser;
     outputStream << chatId;
     outputStream << userId;
@@ -97,7 +105,9 @@ MessagesRpcLayer::PendingUpdates *MessagesRpcLayer::addChatUser(quint32 chatId,
 MessagesRpcLayer::PendingChatInvite *MessagesRpcLayer::checkChatInvite(const QString &hash)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << hash;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesCheckChatInvite)
+            + MTProto::serializedSize(hash);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesCheckChatInvite;
     outputStream << hash;
     PendingChatInvite *op = new PendingChatInvite(this, outputStream.getData());
@@ -108,7 +118,9 @@ MessagesRpcLayer::PendingChatInvite *MessagesRpcLayer::checkChatInvite(const QSt
 MessagesRpcLayer::PendingBool *MessagesRpcLayer::clearRecentStickers(quint32 flags)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << flags;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesClearRecentStickers)
+            + MTProto::serializedSize(flags);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesClearRecentStickers;
     outputStream << flags;
     // (flags & 1 << 0) stands for attached "true" value
@@ -120,7 +132,10 @@ MessagesRpcLayer::PendingBool *MessagesRpcLayer::clearRecentStickers(quint32 fla
 MessagesRpcLayer::PendingUpdates *MessagesRpcLayer::createChat(const TLVector<TLInputUser> &users, const QString &title)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << users << title;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesCreateChat)
+            + MTProto::serializedSize(users)
+            + MTProto::serializedSize(title);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesCreateChat;
     outputStream << users;
     outputStream << title;
@@ -132,7 +147,10 @@ MessagesRpcLayer::PendingUpdates *MessagesRpcLayer::createChat(const TLVector<TL
 MessagesRpcLayer::PendingUpdates *MessagesRpcLayer::deleteChatUser(quint32 chatId, const TLInputUser &userId)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << chatId << userId;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesDeleteChatUser)
+            + MTProto::serializedSize(chatId)
+            + MTProto::serializedSize(userId);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesDeleteChatUser;
     outputStream << chatId;
     outputStream << userId;
@@ -144,7 +162,11 @@ MessagesRpcLayer::PendingUpdates *MessagesRpcLayer::deleteChatUser(quint32 chatI
 MessagesRpcLayer::PendingMessagesAffectedHistory *MessagesRpcLayer::deleteHistory(quint32 flags, const TLInputPeer &peer, quint32 maxId)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << flags << peer << maxId;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesDeleteHistory)
+            + MTProto::serializedSize(flags)
+            + MTProto::serializedSize(peer)
+            + MTProto::serializedSize(maxId);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesDeleteHistory;
     outputStream << flags;
     // (flags & 1 << 0) stands for justClear "true" value
@@ -158,7 +180,10 @@ MessagesRpcLayer::PendingMessagesAffectedHistory *MessagesRpcLayer::deleteHistor
 MessagesRpcLayer::PendingMessagesAffectedMessages *MessagesRpcLayer::deleteMessages(quint32 flags, const TLVector<quint32> &id)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << flags << id;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesDeleteMessages)
+            + MTProto::serializedSize(flags)
+            + MTProto::serializedSize(id);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesDeleteMessages;
     outputStream << flags;
     // (flags & 1 << 0) stands for revoke "true" value
@@ -171,7 +196,9 @@ MessagesRpcLayer::PendingMessagesAffectedMessages *MessagesRpcLayer::deleteMessa
 MessagesRpcLayer::PendingBool *MessagesRpcLayer::discardEncryption(quint32 chatId)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << chatId;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesDiscardEncryption)
+            + MTProto::serializedSize(chatId);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesDiscardEncryption;
     outputStream << chatId;
     PendingBool *op = new PendingBool(this, outputStream.getData());
@@ -182,7 +209,11 @@ MessagesRpcLayer::PendingBool *MessagesRpcLayer::discardEncryption(quint32 chatI
 MessagesRpcLayer::PendingBool *MessagesRpcLayer::editChatAdmin(quint32 chatId, const TLInputUser &userId, bool isAdmin)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << chatId << userId << isAdmin;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesEditChatAdmin)
+            + MTProto::serializedSize(chatId)
+            + MTProto::serializedSize(userId)
+            + MTProto::serializedSize(isAdmin);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesEditChatAdmin;
     outputStream << chatId;
     outputStream << userId;
@@ -195,7 +226,10 @@ MessagesRpcLayer::PendingBool *MessagesRpcLayer::editChatAdmin(quint32 chatId, c
 MessagesRpcLayer::PendingUpdates *MessagesRpcLayer::editChatPhoto(quint32 chatId, const TLInputChatPhoto &photo)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << chatId << photo;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesEditChatPhoto)
+            + MTProto::serializedSize(chatId)
+            + MTProto::serializedSize(photo);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesEditChatPhoto;
     outputStream << chatId;
     outputStream << photo;
@@ -207,7 +241,10 @@ MessagesRpcLayer::PendingUpdates *MessagesRpcLayer::editChatPhoto(quint32 chatId
 MessagesRpcLayer::PendingUpdates *MessagesRpcLayer::editChatTitle(quint32 chatId, const QString &title)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << chatId << title;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesEditChatTitle)
+            + MTProto::serializedSize(chatId)
+            + MTProto::serializedSize(title);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesEditChatTitle;
     outputStream << chatId;
     outputStream << title;
@@ -219,7 +256,14 @@ MessagesRpcLayer::PendingUpdates *MessagesRpcLayer::editChatTitle(quint32 chatId
 MessagesRpcLayer::PendingBool *MessagesRpcLayer::editInlineBotMessage(quint32 flags, const TLInputBotInlineMessageID &id, const QString &message, const TLReplyMarkup &replyMarkup, const TLVector<TLMessageEntity> &entities, const TLInputGeoPoint &geoPoint)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << flags << id << message << replyMarkup << entities << geoPoint;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesEditInlineBotMessage)
+            + MTProto::serializedSize(flags)
+            + MTProto::serializedSize(id)
+            + (flags & 1 << 11 ? MTProto::serializedSize(message) : 0u)
+            + (flags & 1 << 2 ? MTProto::serializedSize(replyMarkup) : 0u)
+            + (flags & 1 << 3 ? MTProto::serializedSize(entities) : 0u)
+            + (flags & 1 << 13 ? MTProto::serializedSize(geoPoint) : 0u);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesEditInlineBotMessage;
     outputStream << flags;
     // (flags & 1 << 1) stands for noWebpage "true" value
@@ -245,7 +289,15 @@ MessagesRpcLayer::PendingBool *MessagesRpcLayer::editInlineBotMessage(quint32 fl
 MessagesRpcLayer::PendingUpdates *MessagesRpcLayer::editMessage(quint32 flags, const TLInputPeer &peer, quint32 id, const QString &message, const TLReplyMarkup &replyMarkup, const TLVector<TLMessageEntity> &entities, const TLInputGeoPoint &geoPoint)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << flags << peer << id << message << replyMarkup << entities << geoPoint;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesEditMessage)
+            + MTProto::serializedSize(flags)
+            + MTProto::serializedSize(peer)
+            + MTProto::serializedSize(id)
+            + (flags & 1 << 11 ? MTProto::serializedSize(message) : 0u)
+            + (flags & 1 << 2 ? MTProto::serializedSize(replyMarkup) : 0u)
+            + (flags & 1 << 3 ? MTProto::serializedSize(entities) : 0u)
+            + (flags & 1 << 13 ? MTProto::serializedSize(geoPoint) : 0u);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesEditMessage;
     outputStream << flags;
     // (flags & 1 << 1) stands for noWebpage "true" value
@@ -272,7 +324,9 @@ MessagesRpcLayer::PendingUpdates *MessagesRpcLayer::editMessage(quint32 flags, c
 MessagesRpcLayer::PendingExportedChatInvite *MessagesRpcLayer::exportChatInvite(quint32 chatId)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << chatId;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesExportChatInvite)
+            + MTProto::serializedSize(chatId);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesExportChatInvite;
     outputStream << chatId;
     PendingExportedChatInvite *op = new PendingExportedChatInvite(this, outputStream.getData());
@@ -283,7 +337,10 @@ MessagesRpcLayer::PendingExportedChatInvite *MessagesRpcLayer::exportChatInvite(
 MessagesRpcLayer::PendingBool *MessagesRpcLayer::faveSticker(const TLInputDocument &id, bool unfave)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << id << unfave;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesFaveSticker)
+            + MTProto::serializedSize(id)
+            + MTProto::serializedSize(unfave);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesFaveSticker;
     outputStream << id;
     outputStream << unfave;
@@ -295,7 +352,11 @@ MessagesRpcLayer::PendingBool *MessagesRpcLayer::faveSticker(const TLInputDocume
 MessagesRpcLayer::PendingUpdates *MessagesRpcLayer::forwardMessage(const TLInputPeer &peer, quint32 id, quint64 randomId)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << peer << id << randomId;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesForwardMessage)
+            + MTProto::serializedSize(peer)
+            + MTProto::serializedSize(id)
+            + MTProto::serializedSize(randomId);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesForwardMessage;
     outputStream << peer;
     outputStream << id;
@@ -308,7 +369,13 @@ MessagesRpcLayer::PendingUpdates *MessagesRpcLayer::forwardMessage(const TLInput
 MessagesRpcLayer::PendingUpdates *MessagesRpcLayer::forwardMessages(quint32 flags, const TLInputPeer &fromPeer, const TLVector<quint32> &id, const TLVector<quint64> &randomId, const TLInputPeer &toPeer)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << flags << fromPeer << id << randomId << toPeer;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesForwardMessages)
+            + MTProto::serializedSize(flags)
+            + MTProto::serializedSize(fromPeer)
+            + MTProto::serializedSize(id)
+            + MTProto::serializedSize(randomId)
+            + MTProto::serializedSize(toPeer);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesForwardMessages;
     outputStream << flags;
     // (flags & 1 << 5) stands for silent "true" value
@@ -326,7 +393,9 @@ MessagesRpcLayer::PendingUpdates *MessagesRpcLayer::forwardMessages(quint32 flag
 MessagesRpcLayer::PendingMessagesChats *MessagesRpcLayer::getAllChats(const TLVector<quint32> &exceptIds)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << exceptIds;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesGetAllChats)
+            + MTProto::serializedSize(exceptIds);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesGetAllChats;
     outputStream << exceptIds;
     PendingMessagesChats *op = new PendingMessagesChats(this, outputStream.getData());
@@ -337,7 +406,8 @@ MessagesRpcLayer::PendingMessagesChats *MessagesRpcLayer::getAllChats(const TLVe
 MessagesRpcLayer::PendingUpdates *MessagesRpcLayer::getAllDrafts()
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesGetAllDrafts);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesGetAllDrafts;
     PendingUpdates *op = new PendingUpdates(this, outputStream.getData());
     processRpcCall(op);
@@ -347,7 +417,9 @@ MessagesRpcLayer::PendingUpdates *MessagesRpcLayer::getAllDrafts()
 MessagesRpcLayer::PendingMessagesAllStickers *MessagesRpcLayer::getAllStickers(quint32 hash)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << hash;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesGetAllStickers)
+            + MTProto::serializedSize(hash);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesGetAllStickers;
     outputStream << hash;
     PendingMessagesAllStickers *op = new PendingMessagesAllStickers(this, outputStream.getData());
@@ -358,7 +430,11 @@ MessagesRpcLayer::PendingMessagesAllStickers *MessagesRpcLayer::getAllStickers(q
 MessagesRpcLayer::PendingMessagesArchivedStickers *MessagesRpcLayer::getArchivedStickers(quint32 flags, quint64 offsetId, quint32 limit)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << flags << offsetId << limit;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesGetArchivedStickers)
+            + MTProto::serializedSize(flags)
+            + MTProto::serializedSize(offsetId)
+            + MTProto::serializedSize(limit);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesGetArchivedStickers;
     outputStream << flags;
     // (flags & 1 << 0) stands for masks "true" value
@@ -372,7 +448,9 @@ MessagesRpcLayer::PendingMessagesArchivedStickers *MessagesRpcLayer::getArchived
 MessagesRpcLayer::PendingStickerSetCoveredVector *MessagesRpcLayer::getAttachedStickers(const TLInputStickeredMedia &media)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << media;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesGetAttachedStickers)
+            + MTProto::serializedSize(media);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesGetAttachedStickers;
     outputStream << media;
     PendingStickerSetCoveredVector *op = new PendingStickerSetCoveredVector(this, outputStream.getData());
@@ -383,7 +461,12 @@ MessagesRpcLayer::PendingStickerSetCoveredVector *MessagesRpcLayer::getAttachedS
 MessagesRpcLayer::PendingMessagesBotCallbackAnswer *MessagesRpcLayer::getBotCallbackAnswer(quint32 flags, const TLInputPeer &peer, quint32 msgId, const QByteArray &data)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << flags << peer << msgId << data.toHex();
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesGetBotCallbackAnswer)
+            + MTProto::serializedSize(flags)
+            + MTProto::serializedSize(peer)
+            + MTProto::serializedSize(msgId)
+            + (flags & 1 << 0 ? MTProto::serializedSize(data) : 0u);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesGetBotCallbackAnswer;
     outputStream << flags;
     // (flags & 1 << 1) stands for game "true" value
@@ -400,7 +483,9 @@ MessagesRpcLayer::PendingMessagesBotCallbackAnswer *MessagesRpcLayer::getBotCall
 MessagesRpcLayer::PendingMessagesChats *MessagesRpcLayer::getChats(const TLVector<quint32> &id)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << id;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesGetChats)
+            + MTProto::serializedSize(id);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesGetChats;
     outputStream << id;
     PendingMessagesChats *op = new PendingMessagesChats(this, outputStream.getData());
@@ -411,7 +496,11 @@ MessagesRpcLayer::PendingMessagesChats *MessagesRpcLayer::getChats(const TLVecto
 MessagesRpcLayer::PendingMessagesChats *MessagesRpcLayer::getCommonChats(const TLInputUser &userId, quint32 maxId, quint32 limit)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << userId << maxId << limit;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesGetCommonChats)
+            + MTProto::serializedSize(userId)
+            + MTProto::serializedSize(maxId)
+            + MTProto::serializedSize(limit);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesGetCommonChats;
     outputStream << userId;
     outputStream << maxId;
@@ -424,7 +513,10 @@ MessagesRpcLayer::PendingMessagesChats *MessagesRpcLayer::getCommonChats(const T
 MessagesRpcLayer::PendingMessagesDhConfig *MessagesRpcLayer::getDhConfig(quint32 version, quint32 randomLength)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << version << randomLength;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesGetDhConfig)
+            + MTProto::serializedSize(version)
+            + MTProto::serializedSize(randomLength);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesGetDhConfig;
     outputStream << version;
     outputStream << randomLength;
@@ -436,7 +528,13 @@ MessagesRpcLayer::PendingMessagesDhConfig *MessagesRpcLayer::getDhConfig(quint32
 MessagesRpcLayer::PendingMessagesDialogs *MessagesRpcLayer::getDialogs(quint32 flags, quint32 offsetDate, quint32 offsetId, const TLInputPeer &offsetPeer, quint32 limit)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << flags << offsetDate << offsetId << offsetPeer << limit;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesGetDialogs)
+            + MTProto::serializedSize(flags)
+            + MTProto::serializedSize(offsetDate)
+            + MTProto::serializedSize(offsetId)
+            + MTProto::serializedSize(offsetPeer)
+            + MTProto::serializedSize(limit);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesGetDialogs;
     outputStream << flags;
     // (flags & 1 << 0) stands for excludePinned "true" value
@@ -452,7 +550,11 @@ MessagesRpcLayer::PendingMessagesDialogs *MessagesRpcLayer::getDialogs(quint32 f
 MessagesRpcLayer::PendingDocument *MessagesRpcLayer::getDocumentByHash(const QByteArray &sha256, quint32 size, const QString &mimeType)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << sha256.toHex() << size << mimeType;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesGetDocumentByHash)
+            + MTProto::serializedSize(sha256)
+            + MTProto::serializedSize(size)
+            + MTProto::serializedSize(mimeType);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesGetDocumentByHash;
     outputStream << sha256;
     outputStream << size;
@@ -465,7 +567,9 @@ MessagesRpcLayer::PendingDocument *MessagesRpcLayer::getDocumentByHash(const QBy
 MessagesRpcLayer::PendingMessagesFavedStickers *MessagesRpcLayer::getFavedStickers(quint32 hash)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << hash;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesGetFavedStickers)
+            + MTProto::serializedSize(hash);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesGetFavedStickers;
     outputStream << hash;
     PendingMessagesFavedStickers *op = new PendingMessagesFavedStickers(this, outputStream.getData());
@@ -476,7 +580,9 @@ MessagesRpcLayer::PendingMessagesFavedStickers *MessagesRpcLayer::getFavedSticke
 MessagesRpcLayer::PendingMessagesFeaturedStickers *MessagesRpcLayer::getFeaturedStickers(quint32 hash)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << hash;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesGetFeaturedStickers)
+            + MTProto::serializedSize(hash);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesGetFeaturedStickers;
     outputStream << hash;
     PendingMessagesFeaturedStickers *op = new PendingMessagesFeaturedStickers(this, outputStream.getData());
@@ -487,7 +593,9 @@ MessagesRpcLayer::PendingMessagesFeaturedStickers *MessagesRpcLayer::getFeatured
 MessagesRpcLayer::PendingMessagesChatFull *MessagesRpcLayer::getFullChat(quint32 chatId)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << chatId;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesGetFullChat)
+            + MTProto::serializedSize(chatId);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesGetFullChat;
     outputStream << chatId;
     PendingMessagesChatFull *op = new PendingMessagesChatFull(this, outputStream.getData());
@@ -498,7 +606,11 @@ MessagesRpcLayer::PendingMessagesChatFull *MessagesRpcLayer::getFullChat(quint32
 MessagesRpcLayer::PendingMessagesHighScores *MessagesRpcLayer::getGameHighScores(const TLInputPeer &peer, quint32 id, const TLInputUser &userId)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << peer << id << userId;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesGetGameHighScores)
+            + MTProto::serializedSize(peer)
+            + MTProto::serializedSize(id)
+            + MTProto::serializedSize(userId);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesGetGameHighScores;
     outputStream << peer;
     outputStream << id;
@@ -511,7 +623,16 @@ MessagesRpcLayer::PendingMessagesHighScores *MessagesRpcLayer::getGameHighScores
 MessagesRpcLayer::PendingMessagesMessages *MessagesRpcLayer::getHistory(const TLInputPeer &peer, quint32 offsetId, quint32 offsetDate, quint32 addOffset, quint32 limit, quint32 maxId, quint32 minId, quint32 hash)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << peer << offsetId << offsetDate << addOffset << limit << maxId << minId << hash;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesGetHistory)
+            + MTProto::serializedSize(peer)
+            + MTProto::serializedSize(offsetId)
+            + MTProto::serializedSize(offsetDate)
+            + MTProto::serializedSize(addOffset)
+            + MTProto::serializedSize(limit)
+            + MTProto::serializedSize(maxId)
+            + MTProto::serializedSize(minId)
+            + MTProto::serializedSize(hash);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesGetHistory;
     outputStream << peer;
     outputStream << offsetId;
@@ -529,7 +650,14 @@ MessagesRpcLayer::PendingMessagesMessages *MessagesRpcLayer::getHistory(const TL
 MessagesRpcLayer::PendingMessagesBotResults *MessagesRpcLayer::getInlineBotResults(quint32 flags, const TLInputUser &bot, const TLInputPeer &peer, const TLInputGeoPoint &geoPoint, const QString &query, const QString &offset)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << flags << bot << peer << geoPoint << query << offset;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesGetInlineBotResults)
+            + MTProto::serializedSize(flags)
+            + MTProto::serializedSize(bot)
+            + MTProto::serializedSize(peer)
+            + (flags & 1 << 0 ? MTProto::serializedSize(geoPoint) : 0u)
+            + MTProto::serializedSize(query)
+            + MTProto::serializedSize(offset);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesGetInlineBotResults;
     outputStream << flags;
     outputStream << bot;
@@ -547,7 +675,10 @@ MessagesRpcLayer::PendingMessagesBotResults *MessagesRpcLayer::getInlineBotResul
 MessagesRpcLayer::PendingMessagesHighScores *MessagesRpcLayer::getInlineGameHighScores(const TLInputBotInlineMessageID &id, const TLInputUser &userId)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << id << userId;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesGetInlineGameHighScores)
+            + MTProto::serializedSize(id)
+            + MTProto::serializedSize(userId);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesGetInlineGameHighScores;
     outputStream << id;
     outputStream << userId;
@@ -559,7 +690,9 @@ MessagesRpcLayer::PendingMessagesHighScores *MessagesRpcLayer::getInlineGameHigh
 MessagesRpcLayer::PendingMessagesAllStickers *MessagesRpcLayer::getMaskStickers(quint32 hash)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << hash;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesGetMaskStickers)
+            + MTProto::serializedSize(hash);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesGetMaskStickers;
     outputStream << hash;
     PendingMessagesAllStickers *op = new PendingMessagesAllStickers(this, outputStream.getData());
@@ -570,7 +703,10 @@ MessagesRpcLayer::PendingMessagesAllStickers *MessagesRpcLayer::getMaskStickers(
 MessagesRpcLayer::PendingMessagesMessageEditData *MessagesRpcLayer::getMessageEditData(const TLInputPeer &peer, quint32 id)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << peer << id;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesGetMessageEditData)
+            + MTProto::serializedSize(peer)
+            + MTProto::serializedSize(id);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesGetMessageEditData;
     outputStream << peer;
     outputStream << id;
@@ -582,7 +718,9 @@ MessagesRpcLayer::PendingMessagesMessageEditData *MessagesRpcLayer::getMessageEd
 MessagesRpcLayer::PendingMessagesMessages *MessagesRpcLayer::getMessages(const TLVector<quint32> &id)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << id;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesGetMessages)
+            + MTProto::serializedSize(id);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesGetMessages;
     outputStream << id;
     PendingMessagesMessages *op = new PendingMessagesMessages(this, outputStream.getData());
@@ -593,7 +731,11 @@ MessagesRpcLayer::PendingMessagesMessages *MessagesRpcLayer::getMessages(const T
 MessagesRpcLayer::PendingQuint32Vector *MessagesRpcLayer::getMessagesViews(const TLInputPeer &peer, const TLVector<quint32> &id, bool increment)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << peer << id << increment;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesGetMessagesViews)
+            + MTProto::serializedSize(peer)
+            + MTProto::serializedSize(id)
+            + MTProto::serializedSize(increment);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesGetMessagesViews;
     outputStream << peer;
     outputStream << id;
@@ -606,7 +748,9 @@ MessagesRpcLayer::PendingQuint32Vector *MessagesRpcLayer::getMessagesViews(const
 MessagesRpcLayer::PendingMessagesPeerDialogs *MessagesRpcLayer::getPeerDialogs(const TLVector<TLInputPeer> &peers)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << peers;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesGetPeerDialogs)
+            + MTProto::serializedSize(peers);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesGetPeerDialogs;
     outputStream << peers;
     PendingMessagesPeerDialogs *op = new PendingMessagesPeerDialogs(this, outputStream.getData());
@@ -617,7 +761,9 @@ MessagesRpcLayer::PendingMessagesPeerDialogs *MessagesRpcLayer::getPeerDialogs(c
 MessagesRpcLayer::PendingPeerSettings *MessagesRpcLayer::getPeerSettings(const TLInputPeer &peer)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << peer;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesGetPeerSettings)
+            + MTProto::serializedSize(peer);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesGetPeerSettings;
     outputStream << peer;
     PendingPeerSettings *op = new PendingPeerSettings(this, outputStream.getData());
@@ -628,7 +774,8 @@ MessagesRpcLayer::PendingPeerSettings *MessagesRpcLayer::getPeerSettings(const T
 MessagesRpcLayer::PendingMessagesPeerDialogs *MessagesRpcLayer::getPinnedDialogs()
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesGetPinnedDialogs);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesGetPinnedDialogs;
     PendingMessagesPeerDialogs *op = new PendingMessagesPeerDialogs(this, outputStream.getData());
     processRpcCall(op);
@@ -638,7 +785,10 @@ MessagesRpcLayer::PendingMessagesPeerDialogs *MessagesRpcLayer::getPinnedDialogs
 MessagesRpcLayer::PendingMessagesMessages *MessagesRpcLayer::getRecentLocations(const TLInputPeer &peer, quint32 limit)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << peer << limit;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesGetRecentLocations)
+            + MTProto::serializedSize(peer)
+            + MTProto::serializedSize(limit);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesGetRecentLocations;
     outputStream << peer;
     outputStream << limit;
@@ -650,7 +800,10 @@ MessagesRpcLayer::PendingMessagesMessages *MessagesRpcLayer::getRecentLocations(
 MessagesRpcLayer::PendingMessagesRecentStickers *MessagesRpcLayer::getRecentStickers(quint32 flags, quint32 hash)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << flags << hash;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesGetRecentStickers)
+            + MTProto::serializedSize(flags)
+            + MTProto::serializedSize(hash);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesGetRecentStickers;
     outputStream << flags;
     // (flags & 1 << 0) stands for attached "true" value
@@ -663,7 +816,9 @@ MessagesRpcLayer::PendingMessagesRecentStickers *MessagesRpcLayer::getRecentStic
 MessagesRpcLayer::PendingMessagesSavedGifs *MessagesRpcLayer::getSavedGifs(quint32 hash)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << hash;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesGetSavedGifs)
+            + MTProto::serializedSize(hash);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesGetSavedGifs;
     outputStream << hash;
     PendingMessagesSavedGifs *op = new PendingMessagesSavedGifs(this, outputStream.getData());
@@ -674,7 +829,9 @@ MessagesRpcLayer::PendingMessagesSavedGifs *MessagesRpcLayer::getSavedGifs(quint
 MessagesRpcLayer::PendingMessagesStickerSet *MessagesRpcLayer::getStickerSet(const TLInputStickerSet &stickerset)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << stickerset;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesGetStickerSet)
+            + MTProto::serializedSize(stickerset);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesGetStickerSet;
     outputStream << stickerset;
     PendingMessagesStickerSet *op = new PendingMessagesStickerSet(this, outputStream.getData());
@@ -685,7 +842,14 @@ MessagesRpcLayer::PendingMessagesStickerSet *MessagesRpcLayer::getStickerSet(con
 MessagesRpcLayer::PendingMessagesMessages *MessagesRpcLayer::getUnreadMentions(const TLInputPeer &peer, quint32 offsetId, quint32 addOffset, quint32 limit, quint32 maxId, quint32 minId)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << peer << offsetId << addOffset << limit << maxId << minId;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesGetUnreadMentions)
+            + MTProto::serializedSize(peer)
+            + MTProto::serializedSize(offsetId)
+            + MTProto::serializedSize(addOffset)
+            + MTProto::serializedSize(limit)
+            + MTProto::serializedSize(maxId)
+            + MTProto::serializedSize(minId);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesGetUnreadMentions;
     outputStream << peer;
     outputStream << offsetId;
@@ -701,7 +865,10 @@ MessagesRpcLayer::PendingMessagesMessages *MessagesRpcLayer::getUnreadMentions(c
 MessagesRpcLayer::PendingWebPage *MessagesRpcLayer::getWebPage(const QString &url, quint32 hash)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << url << hash;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesGetWebPage)
+            + MTProto::serializedSize(url)
+            + MTProto::serializedSize(hash);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesGetWebPage;
     outputStream << url;
     outputStream << hash;
@@ -713,7 +880,9 @@ MessagesRpcLayer::PendingWebPage *MessagesRpcLayer::getWebPage(const QString &ur
 MessagesRpcLayer::PendingMessageMedia *MessagesRpcLayer::getWebPagePreview(const QString &message)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << message;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesGetWebPagePreview)
+            + MTProto::serializedSize(message);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesGetWebPagePreview;
     outputStream << message;
     PendingMessageMedia *op = new PendingMessageMedia(this, outputStream.getData());
@@ -724,7 +893,9 @@ MessagesRpcLayer::PendingMessageMedia *MessagesRpcLayer::getWebPagePreview(const
 MessagesRpcLayer::PendingBool *MessagesRpcLayer::hideReportSpam(const TLInputPeer &peer)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << peer;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesHideReportSpam)
+            + MTProto::serializedSize(peer);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesHideReportSpam;
     outputStream << peer;
     PendingBool *op = new PendingBool(this, outputStream.getData());
@@ -735,7 +906,9 @@ MessagesRpcLayer::PendingBool *MessagesRpcLayer::hideReportSpam(const TLInputPee
 MessagesRpcLayer::PendingUpdates *MessagesRpcLayer::importChatInvite(const QString &hash)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << hash;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesImportChatInvite)
+            + MTProto::serializedSize(hash);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesImportChatInvite;
     outputStream << hash;
     PendingUpdates *op = new PendingUpdates(this, outputStream.getData());
@@ -746,7 +919,10 @@ MessagesRpcLayer::PendingUpdates *MessagesRpcLayer::importChatInvite(const QStri
 MessagesRpcLayer::PendingMessagesStickerSetInstallResult *MessagesRpcLayer::installStickerSet(const TLInputStickerSet &stickerset, bool archived)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << stickerset << archived;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesInstallStickerSet)
+            + MTProto::serializedSize(stickerset)
+            + MTProto::serializedSize(archived);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesInstallStickerSet;
     outputStream << stickerset;
     outputStream << archived;
@@ -758,7 +934,9 @@ MessagesRpcLayer::PendingMessagesStickerSetInstallResult *MessagesRpcLayer::inst
 MessagesRpcLayer::PendingUpdates *MessagesRpcLayer::migrateChat(quint32 chatId)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << chatId;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesMigrateChat)
+            + MTProto::serializedSize(chatId);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesMigrateChat;
     outputStream << chatId;
     PendingUpdates *op = new PendingUpdates(this, outputStream.getData());
@@ -769,7 +947,10 @@ MessagesRpcLayer::PendingUpdates *MessagesRpcLayer::migrateChat(quint32 chatId)
 MessagesRpcLayer::PendingBool *MessagesRpcLayer::readEncryptedHistory(const TLInputEncryptedChat &peer, quint32 maxDate)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << peer << maxDate;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesReadEncryptedHistory)
+            + MTProto::serializedSize(peer)
+            + MTProto::serializedSize(maxDate);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesReadEncryptedHistory;
     outputStream << peer;
     outputStream << maxDate;
@@ -781,7 +962,9 @@ MessagesRpcLayer::PendingBool *MessagesRpcLayer::readEncryptedHistory(const TLIn
 MessagesRpcLayer::PendingBool *MessagesRpcLayer::readFeaturedStickers(const TLVector<quint64> &id)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << id;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesReadFeaturedStickers)
+            + MTProto::serializedSize(id);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesReadFeaturedStickers;
     outputStream << id;
     PendingBool *op = new PendingBool(this, outputStream.getData());
@@ -792,7 +975,10 @@ MessagesRpcLayer::PendingBool *MessagesRpcLayer::readFeaturedStickers(const TLVe
 MessagesRpcLayer::PendingMessagesAffectedMessages *MessagesRpcLayer::readHistory(const TLInputPeer &peer, quint32 maxId)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << peer << maxId;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesReadHistory)
+            + MTProto::serializedSize(peer)
+            + MTProto::serializedSize(maxId);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesReadHistory;
     outputStream << peer;
     outputStream << maxId;
@@ -804,7 +990,9 @@ MessagesRpcLayer::PendingMessagesAffectedMessages *MessagesRpcLayer::readHistory
 MessagesRpcLayer::PendingMessagesAffectedHistory *MessagesRpcLayer::readMentions(const TLInputPeer &peer)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << peer;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesReadMentions)
+            + MTProto::serializedSize(peer);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesReadMentions;
     outputStream << peer;
     PendingMessagesAffectedHistory *op = new PendingMessagesAffectedHistory(this, outputStream.getData());
@@ -815,7 +1003,9 @@ MessagesRpcLayer::PendingMessagesAffectedHistory *MessagesRpcLayer::readMentions
 MessagesRpcLayer::PendingMessagesAffectedMessages *MessagesRpcLayer::readMessageContents(const TLVector<quint32> &id)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << id;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesReadMessageContents)
+            + MTProto::serializedSize(id);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesReadMessageContents;
     outputStream << id;
     PendingMessagesAffectedMessages *op = new PendingMessagesAffectedMessages(this, outputStream.getData());
@@ -826,7 +1016,9 @@ MessagesRpcLayer::PendingMessagesAffectedMessages *MessagesRpcLayer::readMessage
 MessagesRpcLayer::PendingReceivedNotifyMessageVector *MessagesRpcLayer::receivedMessages(quint32 maxId)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << maxId;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesReceivedMessages)
+            + MTProto::serializedSize(maxId);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesReceivedMessages;
     outputStream << maxId;
     PendingReceivedNotifyMessageVector *op = new PendingReceivedNotifyMessageVector(this, outputStream.getData());
@@ -837,7 +1029,9 @@ MessagesRpcLayer::PendingReceivedNotifyMessageVector *MessagesRpcLayer::received
 MessagesRpcLayer::PendingQuint64Vector *MessagesRpcLayer::receivedQueue(quint32 maxQts)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << maxQts;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesReceivedQueue)
+            + MTProto::serializedSize(maxQts);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesReceivedQueue;
     outputStream << maxQts;
     PendingQuint64Vector *op = new PendingQuint64Vector(this, outputStream.getData());
@@ -848,7 +1042,10 @@ MessagesRpcLayer::PendingQuint64Vector *MessagesRpcLayer::receivedQueue(quint32
 MessagesRpcLayer::PendingBool *MessagesRpcLayer::reorderPinnedDialogs(quint32 flags, const TLVector<TLInputPeer> &order)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << flags << order;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesReorderPinnedDialogs)
+            + MTProto::serializedSize(flags)
+            + MTProto::serializedSize(order);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesReorderPinnedDialogs;
     outputStream << flags;
     // (flags & 1 << 0) stands for force "true" value
@@ -861,7 +1058,10 @@ MessagesRpcLayer::PendingBool *MessagesRpcLayer::reorderPinnedDialogs(quint32 fl
 MessagesRpcLayer::PendingBool *MessagesRpcLayer::reorderStickerSets(quint32 flags, const TLVector<quint64> &order)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << flags << order;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesReorderStickerSets)
+            + MTProto::serializedSize(flags)
+            + MTProto::serializedSize(order);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesReorderStickerSets;
     outputStream << flags;
     // (flags & 1 << 0) stands for masks "true" value
@@ -874,7 +1074,9 @@ MessagesRpcLayer::PendingBool *MessagesRpcLayer::reorderStickerSets(quint32 flag
 MessagesRpcLayer::PendingBool *MessagesRpcLayer::reportEncryptedSpam(const TLInputEncryptedChat &peer)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << peer;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesReportEncryptedSpam)
+            + MTProto::serializedSize(peer);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesReportEncryptedSpam;
     outputStream << peer;
     PendingBool *op = new PendingBool(this, outputStream.getData());
@@ -885,7 +1087,9 @@ MessagesRpcLayer::PendingBool *MessagesRpcLayer::reportEncryptedSpam(const TLInp
 MessagesRpcLayer::PendingBool *MessagesRpcLayer::reportSpam(const TLInputPeer &peer)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << peer;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesReportSpam)
+            + MTProto::serializedSize(peer);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesReportSpam;
     outputStream << peer;
     PendingBool *op = new PendingBool(this, outputStream.getData());
@@ -896,7 +1100,11 @@ MessagesRpcLayer::PendingBool *MessagesRpcLayer::reportSpam(const TLInputPeer &p
 MessagesRpcLayer::PendingEncryptedChat *MessagesRpcLayer::requestEncryption(const TLInputUser &userId, quint32 randomId, const QByteArray &gA)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << userId << randomId << gA.toHex();
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesRequestEncryption)
+            + MTProto::serializedSize(userId)
+            + MTProto::serializedSize(randomId)
+            + MTProto::serializedSize(gA);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesRequestEncryption;
     outputStream << userId;
     outputStream << randomId;
@@ -909,7 +1117,13 @@ MessagesRpcLayer::PendingEncryptedChat *MessagesRpcLayer::requestEncryption(cons
 MessagesRpcLayer::PendingBool *MessagesRpcLayer::saveDraft(quint32 flags, quint32 replyToMsgId, const TLInputPeer &peer, const QString &message, const TLVector<TLMessageEntity> &entities)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << flags << replyToMsgId << peer << message << entities;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesSaveDraft)
+            + MTProto::serializedSize(flags)
+            + (flags & 1 << 0 ? MTProto::serializedSize(replyToMsgId) : 0u)
+            + MTProto::serializedSize(peer)
+            + MTProto::serializedSize(message)
+            + (flags & 1 << 3 ? MTProto::serializedSize(entities) : 0u);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesSaveDraft;
     outputStream << flags;
     // (flags & 1 << 1) stands for noWebpage "true" value
@@ -929,7 +1143,10 @@ MessagesRpcLayer::PendingBool *MessagesRpcLayer::saveDraft(quint32 flags, quint3
 MessagesRpcLayer::PendingBool *MessagesRpcLayer::saveGif(const TLInputDocument &id, bool unsave)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << id << unsave;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesSaveGif)
+            + MTProto::serializedSize(id)
+            + MTProto::serializedSize(unsave);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesSaveGif;
     outputStream << id;
     outputStream << unsave;
@@ -941,7 +1158,11 @@ MessagesRpcLayer::PendingBool *MessagesRpcLayer::saveGif(const TLInputDocument &
 MessagesRpcLayer::PendingBool *MessagesRpcLayer::saveRecentSticker(quint32 flags, const TLInputDocument &id, bool unsave)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << flags << id << unsave;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesSaveRecentSticker)
+            + MTProto::serializedSize(flags)
+            + MTProto::serializedSize(id)
+            + MTProto::serializedSize(unsave);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesSaveRecentSticker;
     outputStream << flags;
     // (flags & 1 << 0) stands for attached "true" value
@@ -955,7 +1176,20 @@ MessagesRpcLayer::PendingBool *MessagesRpcLayer::saveRecentSticker(quint32 flags
 MessagesRpcLayer::PendingMessagesMessages *MessagesRpcLayer::search(quint32 flags, const TLInputPeer &peer, const QString &q, const TLInputUser &fromId, const TLMessagesFilter &filter, quint32 minDate, quint32 maxDate, quint32 offsetId, quint32 addOffset, quint32 limit, quint32 maxId, quint32 minId)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << flags << peer << q << fromId << filter << minDate << maxDate << offsetId << addOffset << limit << maxId << minId;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesSearch)
+            + MTProto::serializedSize(flags)
+            + MTProto::serializedSize(peer)
+            + MTProto::serializedSize(q)
+            + (flags & 1 << 0 ? MTProto::serializedSize(fromId) : 0u)
+            + MTProto::serializedSize(filter)
+            + MTProto::serializedSize(minDate)
+            + MTProto::serializedSize(maxDate)
+            + MTProto::serializedSize(offsetId)
+            + MTProto::serializedSize(addOffset)
+            + MTProto::serializedSize(limit)
+            + MTProto::serializedSize(maxId)
+            + MTProto::serializedSize(minId);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesSearch;
     outputStream << flags;
     outputStream << peer;
@@ -979,7 +1213,10 @@ MessagesRpcLayer::PendingMessagesMessages *MessagesRpcLayer::search(quint32 flag
 MessagesRpcLayer::PendingMessagesFoundGifs *MessagesRpcLayer::searchGifs(const QString &q, quint32 offset)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << q << offset;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesSearchGifs)
+            + MTProto::serializedSize(q)
+            + MTProto::serializedSize(offset);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesSearchGifs;
     outputStream << q;
     outputStream << offset;
@@ -991,7 +1228,13 @@ MessagesRpcLayer::PendingMessagesFoundGifs *MessagesRpcLayer::searchGifs(const Q
 MessagesRpcLayer::PendingMessagesMessages *MessagesRpcLayer::searchGlobal(const QString &q, quint32 offsetDate, const TLInputPeer &offsetPeer, quint32 offsetId, quint32 limit)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << q << offsetDate << offsetPeer << offsetId << limit;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesSearchGlobal)
+            + MTProto::serializedSize(q)
+            + MTProto::serializedSize(offsetDate)
+            + MTProto::serializedSize(offsetPeer)
+            + MTProto::serializedSize(offsetId)
+            + MTProto::serializedSize(limit);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesSearchGlobal;
     outputStream << q;
     outputStream << offsetDate;
@@ -1006,7 +1249,11 @@ MessagesRpcLayer::PendingMessagesMessages *MessagesRpcLayer::searchGlobal(const
 MessagesRpcLayer::PendingMessagesSentEncryptedMessage *MessagesRpcLayer::sendEncrypted(const TLInputEncryptedChat &peer, quint64 randomId, const QByteArray &data)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << peer << randomId << data.toHex();
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesSendEncrypted)
+            + MTProto::serializedSize(peer)
+            + MTProto::serializedSize(randomId)
+            + MTProto::serializedSize(data);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesSendEncrypted;
     outputStream << peer;
     outputStream << randomId;
@@ -1019,7 +1266,12 @@ MessagesRpcLayer::PendingMessagesSentEncryptedMessage *MessagesRpcLayer::sendEnc
 MessagesRpcLayer::PendingMessagesSentEncryptedMessage *MessagesRpcLayer::sendEncryptedFile(const TLInputEncryptedChat &peer, quint64 randomId, const QByteArray &data, const TLInputEncryptedFile &file)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << peer << randomId << data.toHex() << file;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesSendEncryptedFile)
+            + MTProto::serializedSize(peer)
+            + MTProto::serializedSize(randomId)
+            + MTProto::serializedSize(data)
+            + MTProto::serializedSize(file);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesSendEncryptedFile;
     outputStream << peer;
     outputStream << randomId;
@@ -1033,7 +1285,11 @@ MessagesRpcLayer::PendingMessagesSentEncryptedMessage *MessagesRpcLayer::sendEnc
 MessagesRpcLayer::PendingMessagesSentEncryptedMessage *MessagesRpcLayer::sendEncryptedService(const TLInputEncryptedChat &peer, quint64 randomId, const QByteArray &data)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << peer << randomId << data.toHex();
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesSendEncryptedService)
+            + MTProto::serializedSize(peer)
+            + MTProto::serializedSize(randomId)
+            + MTProto::serializedSize(data);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesSendEncryptedService;
     outputStream << peer;
     outputStream << randomId;
@@ -1046,7 +1302,14 @@ MessagesRpcLayer::PendingMessagesSentEncryptedMessage *MessagesRpcLayer::sendEnc
 MessagesRpcLayer::PendingUpdates *MessagesRpcLayer::sendInlineBotResult(quint32 flags, const TLInputPeer &peer, quint32 replyToMsgId, quint64 randomId, quint64 queryId, const QString &id)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << flags << peer << replyToMsgId << randomId << queryId << id;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesSendInlineBotResult)
+            + MTProto::serializedSize(flags)
+            + MTProto::serializedSize(peer)
+            + (flags & 1 << 0 ? MTProto::serializedSize(replyToMsgId) : 0u)
+            + MTProto::serializedSize(randomId)
+            + MTProto::serializedSize(queryId)
+            + MTProto::serializedSize(id);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesSendInlineBotResult;
     outputStream << flags;
     // (flags & 1 << 5) stands for silent "true" value
@@ -1067,7 +1330,14 @@ MessagesRpcLayer::PendingUpdates *MessagesRpcLayer::sendInlineBotResult(quint32
 MessagesRpcLayer::PendingUpdates *MessagesRpcLayer::sendMedia(quint32 flags, const TLInputPeer &peer, quint32 replyToMsgId, const TLInputMedia &media, quint64 randomId, const TLReplyMarkup &replyMarkup)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << flags << peer << replyToMsgId << media << randomId << replyMarkup;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesSendMedia)
+            + MTProto::serializedSize(flags)
+            + MTProto::serializedSize(peer)
+            + (flags & 1 << 0 ? MTProto::serializedSize(replyToMsgId) : 0u)
+            + MTProto::serializedSize(media)
+            + MTProto::serializedSize(randomId)
+            + (flags & 1 << 2 ? MTProto::serializedSize(replyMarkup) : 0u);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesSendMedia;
     outputStream << flags;
     // (flags & 1 << 5) stands for silent "true" value
@@ -1090,7 +1360,15 @@ MessagesRpcLayer::PendingUpdates *MessagesRpcLayer::sendMedia(quint32 flags, con
 MessagesRpcLayer::PendingUpdates *MessagesRpcLayer::sendMessage(quint32 flags, const TLInputPeer &peer, quint32 replyToMsgId, const QString &message, quint64 randomId, const TLReplyMarkup &replyMarkup, const TLVector<TLMessageEntity> &entities)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << flags << peer << replyToMsgId << message << randomId << replyMarkup << entities;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesSendMessage)
+            + MTProto::serializedSize(flags)
+            + MTProto::serializedSize(peer)
+            + (flags & 1 << 0 ? MTProto::serializedSize(replyToMsgId) : 0u)
+            + MTProto::serializedSize(message)
+            + MTProto::serializedSize(randomId)
+            + (flags & 1 << 2 ? MTProto::serializedSize(replyMarkup) : 0u)
+            + (flags & 1 << 3 ? MTProto::serializedSize(entities) : 0u);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesSendMessage;
     outputStream << flags;
     // (flags & 1 << 1) stands for noWebpage "true" value
@@ -1117,7 +1395,11 @@ MessagesRpcLayer::PendingUpdates *MessagesRpcLayer::sendMessage(quint32 flags, c
 MessagesRpcLayer::PendingUpdates *MessagesRpcLayer::sendScreenshotNotification(const TLInputPeer &peer, quint32 replyToMsgId, quint64 randomId)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << peer << replyToMsgId << randomId;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesSendScreenshotNotification)
+            + MTProto::serializedSize(peer)
+            + MTProto::serializedSize(replyToMsgId)
+            + MTProto::serializedSize(randomId);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesSendScreenshotNotification;
     outputStream << peer;
     outputStream << replyToMsgId;
@@ -1130,7 +1412,13 @@ MessagesRpcLayer::PendingUpdates *MessagesRpcLayer::sendScreenshotNotification(c
 MessagesRpcLayer::PendingBool *MessagesRpcLayer::setBotCallbackAnswer(quint32 flags, quint64 queryId, const QString &message, const QString &url, quint32 cacheTime)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << flags << queryId << message << url << cacheTime;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesSetBotCallbackAnswer)
+            + MTProto::serializedSize(flags)
+            + MTProto::serializedSize(queryId)
+            + (flags & 1 << 0 ? MTProto::serializedSize(message) : 0u)
+            + (flags & 1 << 2 ? MTProto::serializedSize(url) : 0u)
+            + MTProto::serializedSize(cacheTime);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesSetBotCallbackAnswer;
     outputStream << flags;
     // (flags & 1 << 1) stands for alert "true" value
@@ -1150,7 +1438,11 @@ MessagesRpcLayer::PendingBool *MessagesRpcLayer::setBotCallbackAnswer(quint32 fl
 MessagesRpcLayer::PendingBool *MessagesRpcLayer::setBotPrecheckoutResults(quint32 flags, quint64 queryId, const QString &error)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << flags << queryId << error;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesSetBotPrecheckoutResults)
+            + MTProto::serializedSize(flags)
+            + MTProto::serializedSize(queryId)
+            + (flags & 1 << 0 ? MTProto::serializedSize(error) : 0u);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesSetBotPrecheckoutResults;
     outputStream << flags;
     // (flags & 1 << 1) stands for success "true" value
@@ -1166,7 +1458,12 @@ MessagesRpcLayer::PendingBool *MessagesRpcLayer::setBotPrecheckoutResults(quint3
 MessagesRpcLayer::PendingBool *MessagesRpcLayer::setBotShippingResults(quint32 flags, quint64 queryId, const QString &error, const TLVector<TLShippingOption> &shippingOptions)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << flags << queryId << error << shippingOptions;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesSetBotShippingResults)
+            + MTProto::serializedSize(flags)
+            + MTProto::serializedSize(queryId)
+            + (flags & 1 << 0 ? MTProto::serializedSize(error) : 0u)
+            + (flags & 1 << 1 ? MTProto::serializedSize(shippingOptions) : 0u);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesSetBotShippingResults;
     outputStream << flags;
     outputStream << queryId;
@@ -1184,7 +1481,10 @@ MessagesRpcLayer::PendingBool *MessagesRpcLayer::setBotShippingResults(quint32 f
 MessagesRpcLayer::PendingBool *MessagesRpcLayer::setEncryptedTyping(const TLInputEncryptedChat &peer, bool typing)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << peer << typing;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesSetEncryptedTyping)
+            + MTProto::serializedSize(peer)
+            + MTProto::serializedSize(typing);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesSetEncryptedTyping;
     outputStream << peer;
     outputStream << typing;
@@ -1196,7 +1496,13 @@ MessagesRpcLayer::PendingBool *MessagesRpcLayer::setEncryptedTyping(const TLInpu
 MessagesRpcLayer::PendingUpdates *MessagesRpcLayer::setGameScore(quint32 flags, const TLInputPeer &peer, quint32 id, const TLInputUser &userId, quint32 score)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << flags << peer << id << userId << score;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesSetGameScore)
+            + MTProto::serializedSize(flags)
+            + MTProto::serializedSize(peer)
+            + MTProto::serializedSize(id)
+            + MTProto::serializedSize(userId)
+            + MTProto::serializedSize(score);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesSetGameScore;
     outputStream << flags;
     // (flags & 1 << 0) stands for editMessage "true" value
@@ -1213,7 +1519,14 @@ MessagesRpcLayer::PendingUpdates *MessagesRpcLayer::setGameScore(quint32 flags,
 MessagesRpcLayer::PendingBool *MessagesRpcLayer::setInlineBotResults(quint32 flags, quint64 queryId, const TLVector<TLInputBotInlineResult> &results, quint32 cacheTime, const QString &nextOffset, const TLInlineBotSwitchPM &switchPm)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << flags << queryId << results << cacheTime << nextOffset << switchPm;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesSetInlineBotResults)
+            + MTProto::serializedSize(flags)
+            + MTProto::serializedSize(queryId)
+            + MTProto::serializedSize(results)
+            + MTProto::serializedSize(cacheTime)
+            + (flags & 1 << 2 ? MTProto::serializedSize(nextOffset) : 0u)
+            + (flags & 1 << 3 ? MTProto::serializedSize(switchPm) : 0u);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesSetInlineBotResults;
     outputStream << flags;
     // (flags & 1 << 0) stands for gallery "true" value
@@ -1235,7 +1548,12 @@ MessagesRpcLayer::PendingBool *MessagesRpcLayer::setInlineBotResults(quint32 fla
 MessagesRpcLayer::PendingBool *MessagesRpcLayer::setInlineGameScore(quint32 flags, const TLInputBotInlineMessageID &id, const TLInputUser &userId, quint32 score)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << flags << id << userId << score;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesSetInlineGameScore)
+            + MTProto::serializedSize(flags)
+            + MTProto::serializedSize(id)
+            + MTProto::serializedSize(userId)
+            + MTProto::serializedSize(score);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesSetInlineGameScore;
     outputStream << flags;
     // (flags & 1 << 0) stands for editMessage "true" value
@@ -1251,7 +1569,10 @@ MessagesRpcLayer::PendingBool *MessagesRpcLayer::setInlineGameScore(quint32 flag
 MessagesRpcLayer::PendingBool *MessagesRpcLayer::setTyping(const TLInputPeer &peer, const TLSendMessageAction &action)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << peer << action;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesSetTyping)
+            + MTProto::serializedSize(peer)
+            + MTProto::serializedSize(action);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesSetTyping;
     outputStream << peer;
     outputStream << action;
@@ -1263,7 +1584,12 @@ MessagesRpcLayer::PendingBool *MessagesRpcLayer::setTyping(const TLInputPeer &pe
 MessagesRpcLayer::PendingUpdates *MessagesRpcLayer::startBot(const TLInputUser &bot, const TLInputPeer &peer, quint64 randomId, const QString &startParam)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << bot << peer << randomId << startParam;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesStartBot)
+            + MTProto::serializedSize(bot)
+            + MTProto::serializedSize(peer)
+            + MTProto::serializedSize(randomId)
+            + MTProto::serializedSize(startParam);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesStartBot;
     outputStream << bot;
     outputStream << peer;
@@ -1277,7 +1603,10 @@ MessagesRpcLayer::PendingUpdates *MessagesRpcLayer::startBot(const TLInputUser &
 MessagesRpcLayer::PendingUpdates *MessagesRpcLayer::toggleChatAdmins(quint32 chatId, bool enabled)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << chatId << enabled;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesToggleChatAdmins)
+            + MTProto::serializedSize(chatId)
+            + MTProto::serializedSize(enabled);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesToggleChatAdmins;
     outputStream << chatId;
     outputStream << enabled;
@@ -1289,7 +1618,10 @@ MessagesRpcLayer::PendingUpdates *MessagesRpcLayer::toggleChatAdmins(quint32 cha
 MessagesRpcLayer::PendingBool *MessagesRpcLayer::toggleDialogPin(quint32 flags, const TLInputPeer &peer)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << flags << peer;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesToggleDialogPin)
+            + MTProto::serializedSize(flags)
+            + MTProto::serializedSize(peer);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesToggleDialogPin;
     outputStream << flags;
     // (flags & 1 << 0) stands for pinned "true" value
@@ -1302,7 +1634,9 @@ MessagesRpcLayer::PendingBool *MessagesRpcLayer::toggleDialogPin(quint32 flags,
 MessagesRpcLayer::PendingBool *MessagesRpcLayer::uninstallStickerSet(const TLInputStickerSet &stickerset)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << stickerset;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesUninstallStickerSet)
+            + MTProto::serializedSize(stickerset);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesUninstallStickerSet;
     outputStream << stickerset;
     PendingBool *op = new PendingBool(this, outputStream.getData());
@@ -1313,7 +1647,10 @@ MessagesRpcLayer::PendingBool *MessagesRpcLayer::uninstallStickerSet(const TLInp
 MessagesRpcLayer::PendingMessageMedia *MessagesRpcLayer::uploadMedia(const TLInputPeer &peer, const TLInputMedia &media)
 {
     qCDebug(c_clientRpcMessagesCategory) << Q_FUNC_INFO << peer << media;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::MessagesUploadMedia)
+            + MTProto::serializedSize(peer)
+            + MTProto::serializedSize(media);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::MessagesUploadMedia;
     outputStream << peer;
     outputStream << media;
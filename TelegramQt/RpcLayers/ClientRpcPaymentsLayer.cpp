@@ -49,7 +49,9 @@ PaymentsRpcLayer::PaymentsRpcLayer(QObject *parent) :
 PaymentsRpcLayer::PendingBool *PaymentsRpcLayer::clearSavedInfo(quint32 flags)
 {
     qCDebug(c_clientRpcPaymentsCategory) << Q_FUNC_INFO << flags;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::PaymentsClearSavedInfo)
+            + MTProto::serializedSize(flags);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::PaymentsClearSavedInfo;
     outputStream << flags;
     // (flags & 1 << 0) stands for credentials "true" value
@@ -62,7 +64,9 @@ PaymentsRpcLayer::PendingBool *PaymentsRpcLayer::clearSavedInfo(quint32 flags)
 PaymentsRpcLayer::PendingPaymentsPaymentForm *PaymentsRpcLayer::getPaymentForm(quint32 msgId)
 {
     qCDebug(c_clientRpcPaymentsCategory) << Q_FUNC_INFO << msgId;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::PaymentsGetPaymentForm)
+            + MTProto::serializedSize(msgId);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::PaymentsGetPaymentForm;
     outputStream << msgId;
     PendingPaymentsPaymentForm *op = new PendingPaymentsPaymentForm(this, outputStream.getData());
@@ -73,7 +77,9 @@ PaymentsRpcLayer::PendingPaymentsPaymentForm *PaymentsRpcLayer::getPaymentForm(q
 PaymentsRpcLayer::PendingPaymentsPaymentReceipt *PaymentsRpcLayer::getPaymentReceipt(quint32 msgId)
 {
     qCDebug(c_clientRpcPaymentsCategory) << Q_FUNC_INFO << msgId;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::PaymentsGetPaymentReceipt)
+            + MTProto::serializedSize(msgId);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::PaymentsGetPaymentReceipt;
     outputStream << msgId;
     PendingPaymentsPaymentReceipt *op = new PendingPaymentsPaymentReceipt(this, outputStream.getData());
@@ -84,7 +90,8 @@ PaymentsRpcLayer::PendingPaymentsPaymentReceipt *PaymentsRpcLayer::getPaymentRec
 PaymentsRpcLayer::PendingPaymentsSavedInfo *PaymentsRpcLayer::getSavedInfo()
 {
     qCDebug(c_clientRpcPaymentsCategory) << Q_FUNC_INFO;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::PaymentsGetSavedInfo);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::PaymentsGetSavedInfo;
     PendingPaymentsSavedInfo *op = new PendingPaymentsSavedInfo(this, outputStream.getData());
     processRpcCall(op);
@@ -94,7 +101,13 @@ PaymentsRpcLayer::PendingPaymentsSavedInfo *PaymentsRpcLayer::getSavedInfo()
 PaymentsRpcLayer::PendingPaymentsPaymentResult *PaymentsRpcLayer::sendPaymentForm(quint32 flags, quint32 msgId, const QString &requestedInfoId, const QString &shippingOptionId, const TLInputPaymentCredentials &credentials)
 {
     qCDebug(c_clientRpcPaymentsCategory) << Q_FUNC_INFO << flags << msgId << requestedInfoId << shippingOptionId << credentials;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::PaymentsSendPaymentForm)
+            + MTProto::serializedSize(flags)
+            + MTProto::serializedSize(msgId)
+            + (flags & 1 << 0 ? MTProto::serializedSize(requestedInfoId) : 0u)
+            + (flags & 1 << 1 ? MTProto::serializedSize(shippingOptionId) : 0u)
+            + MTProto::serializedSize(credentials);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::PaymentsSendPaymentForm;
     outputStream << flags;
     outputStream << msgId;
@@ -113,7 +126,11 @@ PaymentsRpcLayer::PendingPaymentsPaymentResult *PaymentsRpcLayer::sendPaymentFor
 PaymentsRpcLayer::PendingPaymentsValidatedRequestedInfo *PaymentsRpcLayer::validateRequestedInfo(quint32 flags, quint32 msgId, const TLPaymentRequestedInfo &info)
 {
     qCDebug(c_clientRpcPaymentsCategory) << Q_FUNC_INFO << flags << msgId << info;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::PaymentsValidateRequestedInfo)
+            + MTProto::serializedSize(flags)
+            + MTProto::serializedSize(msgId)
+            + MTProto::serializedSize(info);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::PaymentsValidateRequestedInfo;
     outputStream << flags;
     // (flags & 1 << 0) stands for save "true" value
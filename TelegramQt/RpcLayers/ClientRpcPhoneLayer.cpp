@@ -46,7 +46,11 @@ PhoneRpcLayer::PhoneRpcLayer(QObject *parent) :
 PhoneRpcLayer::PendingPhonePhoneCall *PhoneRpcLayer::acceptCall(const TLInputPhoneCall &peer, const QByteArray &gB, const TLPhoneCallProtocol &protocol)
 {
     qCDebug(c_clientRpcPhoneCategory) << Q_FUNC_INFO << peer << gB.toHex() << protocol;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::PhoneAcceptCall)
+            + MTProto::serializedSize(peer)
+            + MTProto::serializedSize(gB)
+            + MTProto::serializedSize(protocol);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::PhoneAcceptCall;
     outputStream << peer;
     outputStream << gB;
@@ -59,7 +63,12 @@ PhoneRpcLayer::PendingPhonePhoneCall *PhoneRpcLayer::acceptCall(const TLInputPho
 PhoneRpcLayer::PendingPhonePhoneCall *PhoneRpcLayer::confirmCall(const TLInputPhoneCall &peer, const QByteArray &gA, quint64 keyFingerprint, const TLPhoneCallProtocol &protocol)
 {
     qCDebug(c_clientRpcPhoneCategory) << Q_FUNC_INFO << peer << gA.toHex() << keyFingerprint << protocol;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::PhoneConfirmCall)
+            + MTProto::serializedSize(peer)
+            + MTProto::serializedSize(gA)
+            + MTProto::serializedSize(keyFingerprint)
+            + MTProto::serializedSize(protocol);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::PhoneConfirmCall;
     outputStream << peer;
     outputStream << gA;
@@ -73,7 +82,12 @@ PhoneRpcLayer::PendingPhonePhoneCall *PhoneRpcLayer::confirmCall(const TLInputPh
 PhoneRpcLayer::PendingUpdates *PhoneRpcLayer::discardCall(const TLInputPhoneCall &peer, quint32 duration, const TLPhoneCallDiscardReason &reason, quint64 connectionId)
 {
     qCDebug(c_clientRpcPhoneCategory) << Q_FUNC_INFO << peer << duration << reason << connectionId;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::PhoneDiscardCall)
+            + MTProto::serializedSize(peer)
+            + MTProto::serializedSize(duration)
+            + MTProto::serializedSize(reason)
+            + MTProto::serializedSize(connectionId);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::PhoneDiscardCall;
     outputStream << peer;
     outputStream << duration;
@@ -87,7 +101,8 @@ PhoneRpcLayer::PendingUpdates *PhoneRpcLayer::discardCall(const TLInputPhoneCall
 PhoneRpcLayer::PendingDataJSON *PhoneRpcLayer::getCallConfig()
 {
     qCDebug(c_clientRpcPhoneCategory) << Q_FUNC_INFO;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::PhoneGetCallConfig);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::PhoneGetCallConfig;
     PendingDataJSON *op = new PendingDataJSON(this, outputStream.getData());
     processRpcCall(op);
@@ -97,7 +112,9 @@ PhoneRpcLayer::PendingDataJSON *PhoneRpcLayer::getCallConfig()
 PhoneRpcLayer::PendingBool *PhoneRpcLayer::receivedCall(const TLInputPhoneCall &peer)
 {
     qCDebug(c_clientRpcPhoneCategory) << Q_FUNC_INFO << peer;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::PhoneReceivedCall)
+            + MTProto::serializedSize(peer);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::PhoneReceivedCall;
     outputStream << peer;
     PendingBool *op = new PendingBool(this, outputStream.getData());
@@ -108,7 +125,12 @@ PhoneRpcLayer::PendingBool *PhoneRpcLayer::receivedCall(const TLInputPhoneCall &
 PhoneRpcLayer::PendingPhonePhoneCall *PhoneRpcLayer::requestCall(const TLInputUser &userId, quint32 randomId, const QByteArray &gAHash, const TLPhoneCallProtocol &protocol)
 {
     qCDebug(c_clientRpcPhoneCategory) << Q_FUNC_INFO << userId << randomId << gAHash.toHex() << protocol;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::PhoneRequestCall)
+            + MTProto::serializedSize(userId)
+            + MTProto::serializedSize(randomId)
+            + MTProto::serializedSize(gAHash)
+            + MTProto::serializedSize(protocol);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::PhoneRequestCall;
     outputStream << userId;
     outputStream << randomId;
@@ -122,7 +144,10 @@ PhoneRpcLayer::PendingPhonePhoneCall *PhoneRpcLayer::requestCall(const TLInputUs
 PhoneRpcLayer::PendingBool *PhoneRpcLayer::saveCallDebug(const TLInputPhoneCall &peer, const TLDataJSON &debug)
 {
     qCDebug(c_clientRpcPhoneCategory) << Q_FUNC_INFO << peer << debug;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::PhoneSaveCallDebug)
+            + MTProto::serializedSize(peer)
+            + MTProto::serializedSize(debug);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::PhoneSaveCallDebug;
     outputStream << peer;
     outputStream << debug;
@@ -134,7 +159,11 @@ PhoneRpcLayer::PendingBool *PhoneRpcLayer::saveCallDebug(const TLInputPhoneCall
 PhoneRpcLayer::PendingUpdates *PhoneRpcLayer::setCallRating(const TLInputPhoneCall &peer, quint32 rating, const QString &comment)
 {
     qCDebug(c_clientRpcPhoneCategory) << Q_FUNC_INFO << peer << rating << comment;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::PhoneSetCallRating)
+            + MTProto::serializedSize(peer)
+            + MTProto::serializedSize(rating)
+            + MTProto::serializedSize(comment);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::PhoneSetCallRating;
     outputStream << peer;
     outputStream << rating;
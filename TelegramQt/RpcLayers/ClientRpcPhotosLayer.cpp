@@ -45,7 +45,9 @@ PhotosRpcLayer::PhotosRpcLayer(QObject *parent) :
 PhotosRpcLayer::PendingQuint64Vector *PhotosRpcLayer::deletePhotos(const TLVector<TLInputPhoto> &id)
 {
     qCDebug(c_clientRpcPhotosCategory) << Q_FUNC_INFO << id;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::PhotosDeletePhotos)
+            + MTProto::serializedSize(id);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::PhotosDeletePhotos;
     outputStream << id;
     PendingQuint64Vector *op = new PendingQuint64Vector(this, outputStream.getData());
@@ -56,7 +58,12 @@ PhotosRpcLayer::PendingQuint64Vector *PhotosRpcLayer::deletePhotos(const TLVecto
 PhotosRpcLayer::PendingPhotosPhotos *PhotosRpcLayer::getUserPhotos(const TLInputUser &userId, quint32 offset, quint64 maxId, quint32 limit)
 {
     qCDebug(c_clientRpcPhotosCategory) << Q_FUNC_INFO << userId << offset << maxId << limit;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::PhotosGetUserPhotos)
+            + MTProto::serializedSize(userId)
+            + MTProto::serializedSize(offset)
+            + MTProto::serializedSize(maxId)
+            + MTProto::serializedSize(limit);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::PhotosGetUserPhotos;
     outputStream << userId;
     outputStream << offset;
@@ -70,7 +77,9 @@ PhotosRpcLayer::PendingPhotosPhotos *PhotosRpcLayer::getUserPhotos(const TLInput
 PhotosRpcLayer::PendingUserProfilePhoto *PhotosRpcLayer::updateProfilePhoto(const TLInputPhoto &id)
 {
     qCDebug(c_clientRpcPhotosCategory) << Q_FUNC_INFO << id;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::PhotosUpdateProfilePhoto)
+            + MTProto::serializedSize(id);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::PhotosUpdateProfilePhoto;
     outputStream << id;
     PendingUserProfilePhoto *op = new PendingUserProfilePhoto(this, outputStream.getData());
@@ -81,7 +90,9 @@ PhotosRpcLayer::PendingUserProfilePhoto *PhotosRpcLayer::updateProfilePhoto(cons
 PhotosRpcLayer::PendingPhotosPhoto *PhotosRpcLayer::uploadProfilePhoto(const TLInputFile &file)
 {
     qCDebug(c_clientRpcPhotosCategory) << Q_FUNC_INFO << file;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::PhotosUploadProfilePhoto)
+            + MTProto::serializedSize(file);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::PhotosUploadProfilePhoto;
     outputStream << file;
     PendingPhotosPhoto *op = new PendingPhotosPhoto(this, outputStream.getData());
@@ -44,7 +44,10 @@ StickersRpcLayer::StickersRpcLayer(QObject *parent) :
 StickersRpcLayer::PendingMessagesStickerSet *StickersRpcLayer::addStickerToSet(const TLInputStickerSet &stickerset, const TLInputStickerSetItem &sticker)
 {
     qCDebug(c_clientRpcStickersCategory) << Q_FUNC_INFO << stickerset << sticker;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::StickersAddStickerToSet)
+            + MTProto::serializedSize(stickerset)
+            + MTProto::serializedSize(sticker);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::StickersAddStickerToSet;
     outputStream << stickerset;
     outputStream << sticker;
@@ -56,7 +59,10 @@ StickersRpcLayer::PendingMessagesStickerSet *StickersRpcLayer::addStickerToSet(c
 StickersRpcLayer::PendingMessagesStickerSet *StickersRpcLayer::changeStickerPosition(const TLInputDocument &sticker, quint32 position)
 {
     qCDebug(c_clientRpcStickersCategory) << Q_FUNC_INFO << sticker << position;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::StickersChangeStickerPosition)
+            + MTProto::serializedSize(sticker)
+            + MTProto::serializedSize(position);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::StickersChangeStickerPosition;
     outputStream << sticker;
     outputStream << position;
@@ -68,7 +74,13 @@ StickersRpcLayer::PendingMessagesStickerSet *StickersRpcLayer::changeStickerPosi
 StickersRpcLayer::PendingMessagesStickerSet *StickersRpcLayer::createStickerSet(quint32 flags, const TLInputUser &userId, const QString &title, const QString &shortName, const TLVector<TLInputStickerSetItem> &stickers)
 {
     qCDebug(c_clientRpcStickersCategory) << Q_FUNC_INFO << flags << userId << title << shortName << stickers;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::StickersCreateStickerSet)
+            + MTProto::serializedSize(flags)
+            + MTProto::serializedSize(userId)
+            + MTProto::serializedSize(title)
+            + MTProto::serializedSize(shortName)
+            + MTProto::serializedSize(stickers);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::StickersCreateStickerSet;
     outputStream << flags;
     // (flags & 1 << 0) stands for masks "true" value
@@ -84,7 +96,9 @@ StickersRpcLayer::PendingMessagesStickerSet *StickersRpcLayer::createStickerSet(
 StickersRpcLayer::PendingMessagesStickerSet *StickersRpcLayer::removeStickerFromSet(const TLInputDocument &sticker)
 {
     qCDebug(c_clientRpcStickersCategory) << Q_FUNC_INFO << sticker;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::StickersRemoveStickerFromSet)
+            + MTProto::serializedSize(sticker);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::StickersRemoveStickerFromSet;
     outputStream << sticker;
     PendingMessagesStickerSet *op = new PendingMessagesStickerSet(this, outputStream.getData());
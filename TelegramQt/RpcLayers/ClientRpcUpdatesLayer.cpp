@@ -46,7 +46,13 @@ UpdatesRpcLayer::UpdatesRpcLayer(QObject *parent) :
 UpdatesRpcLayer::PendingUpdatesChannelDifference *UpdatesRpcLayer::getChannelDifference(quint32 flags, const TLInputChannel &channel, const TLChannelMessagesFilter &filter, quint32 pts, quint32 limit)
 {
     qCDebug(c_clientRpcUpdatesCategory) << Q_FUNC_INFO << flags << channel << filter << pts << limit;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::UpdatesGetChannelDifference)
+            + MTProto::serializedSize(flags)
+            + MTProto::serializedSize(channel)
+            + MTProto::serializedSize(filter)
+            + MTProto::serializedSize(pts)
+            + MTProto::serializedSize(limit);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::UpdatesGetChannelDifference;
     outputStream << flags;
     // (flags & 1 << 0) stands for force "true" value
@@ -62,7 +68,13 @@ UpdatesRpcLayer::PendingUpdatesChannelDifference *UpdatesRpcLayer::getChannelDif
 UpdatesRpcLayer::PendingUpdatesDifference *UpdatesRpcLayer::getDifference(quint32 flags, quint32 pts, quint32 ptsTotalLimit, quint32 date, quint32 qts)
 {
     qCDebug(c_clientRpcUpdatesCategory) << Q_FUNC_INFO << flags << pts << ptsTotalLimit << date << qts;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::UpdatesGetDifference)
+            + MTProto::serializedSize(flags)
+            + MTProto::serializedSize(pts)
+            + (flags & 1 << 0 ? MTProto::serializedSize(ptsTotalLimit) : 0u)
+            + MTProto::serializedSize(date)
+            + MTProto::serializedSize(qts);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::UpdatesGetDifference;
     outputStream << flags;
     outputStream << pts;
@@ -79,7 +91,8 @@ UpdatesRpcLayer::PendingUpdatesDifference *UpdatesRpcLayer::getDifference(quint3
 UpdatesRpcLayer::PendingUpdatesState *UpdatesRpcLayer::getState()
 {
     qCDebug(c_clientRpcUpdatesCategory) << Q_FUNC_INFO;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::UpdatesGetState);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::UpdatesGetState;
     PendingUpdatesState *op = new PendingUpdatesState(this, outputStream.getData());
     processRpcCall(op);
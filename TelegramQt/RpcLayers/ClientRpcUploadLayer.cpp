@@ -44,7 +44,11 @@ UploadRpcLayer::UploadRpcLayer(QObject *parent) :
 UploadRpcLayer::PendingUploadCdnFile *UploadRpcLayer::getCdnFile(const QByteArray &fileToken, quint32 offset, quint32 limit)
 {
     qCDebug(c_clientRpcUploadCategory) << Q_FUNC_INFO << fileToken.toHex() << offset << limit;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::UploadGetCdnFile)
+            + MTProto::serializedSize(fileToken)
+            + MTProto::serializedSize(offset)
+            + MTProto::serializedSize(limit);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::UploadGetCdnFile;
     outputStream << fileToken;
     outputStream << offset;
@@ -57,7 +61,10 @@ UploadRpcLayer::PendingUploadCdnFile *UploadRpcLayer::getCdnFile(const QByteArra
 UploadRpcLayer::PendingCdnFileHashVector *UploadRpcLayer::getCdnFileHashes(const QByteArray &fileToken, quint32 offset)
 {
     qCDebug(c_clientRpcUploadCategory) << Q_FUNC_INFO << fileToken.toHex() << offset;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::UploadGetCdnFileHashes)
+            + MTProto::serializedSize(fileToken)
+            + MTProto::serializedSize(offset);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::UploadGetCdnFileHashes;
     outputStream << fileToken;
     outputStream << offset;
@@ -69,7 +76,11 @@ UploadRpcLayer::PendingCdnFileHashVector *UploadRpcLayer::getCdnFileHashes(const
 UploadRpcLayer::PendingUploadFile *UploadRpcLayer::getFile(const TLInputFileLocation &location, quint32 offset, quint32 limit)
 {
     qCDebug(c_clientRpcUploadCategory) << Q_FUNC_INFO << location << offset << limit;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::UploadGetFile)
+            + MTProto::serializedSize(location)
+            + MTProto::serializedSize(offset)
+            + MTProto::serializedSize(limit);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::UploadGetFile;
     outputStream << location;
     outputStream << offset;
@@ -82,7 +93,11 @@ UploadRpcLayer::PendingUploadFile *UploadRpcLayer::getFile(const TLInputFileLoca
 UploadRpcLayer::PendingUploadWebFile *UploadRpcLayer::getWebFile(const TLInputWebFileLocation &location, quint32 offset, quint32 limit)
 {
     qCDebug(c_clientRpcUploadCategory) << Q_FUNC_INFO << location << offset << limit;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::UploadGetWebFile)
+            + MTProto::serializedSize(location)
+            + MTProto::serializedSize(offset)
+            + MTProto::serializedSize(limit);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::UploadGetWebFile;
     outputStream << location;
     outputStream << offset;
@@ -95,7 +110,10 @@ UploadRpcLayer::PendingUploadWebFile *UploadRpcLayer::getWebFile(const TLInputWe
 UploadRpcLayer::PendingCdnFileHashVector *UploadRpcLayer::reuploadCdnFile(const QByteArray &fileToken, const QByteArray &requestToken)
 {
     qCDebug(c_clientRpcUploadCategory) << Q_FUNC_INFO << fileToken.toHex() << requestToken.toHex();
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::UploadReuploadCdnFile)
+            + MTProto::serializedSize(fileToken)
+            + MTProto::serializedSize(requestToken);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::UploadReuploadCdnFile;
     outputStream << fileToken;
     outputStream << requestToken;
@@ -107,7 +125,12 @@ UploadRpcLayer::PendingCdnFileHashVector *UploadRpcLayer::reuploadCdnFile(const
 UploadRpcLayer::PendingBool *UploadRpcLayer::saveBigFilePart(quint64 fileId, quint32 filePart, quint32 fileTotalParts, const QByteArray &bytes)
 {
     qCDebug(c_clientRpcUploadCategory) << Q_FUNC_INFO << fileId << filePart << fileTotalParts << bytes.toHex();
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::UploadSaveBigFilePart)
+            + MTProto::serializedSize(fileId)
+            + MTProto::serializedSize(filePart)
+            + MTProto::serializedSize(fileTotalParts)
+            + MTProto::serializedSize(bytes);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::UploadSaveBigFilePart;
     outputStream << fileId;
     outputStream << filePart;
@@ -121,7 +144,11 @@ UploadRpcLayer::PendingBool *UploadRpcLayer::saveBigFilePart(quint64 fileId, qui
 UploadRpcLayer::PendingBool *UploadRpcLayer::saveFilePart(quint64 fileId, quint32 filePart, const QByteArray &bytes)
 {
     qCDebug(c_clientRpcUploadCategory) << Q_FUNC_INFO << fileId << filePart << bytes.toHex();
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::UploadSaveFilePart)
+            + MTProto::serializedSize(fileId)
+            + MTProto::serializedSize(filePart)
+            + MTProto::serializedSize(bytes);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::UploadSaveFilePart;
     outputStream << fileId;
     outputStream << filePart;
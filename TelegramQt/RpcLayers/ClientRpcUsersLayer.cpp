@@ -49,7 +49,9 @@ UsersRpcLayer::UsersRpcLayer(QObject *parent) :
 UsersRpcLayer::PendingUserFull *UsersRpcLayer::getFullUser(const TLInputUser &id)
 {
     qCDebug(c_clientRpcUsersCategory) << Q_FUNC_INFO << id;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::UsersGetFullUser)
+            + MTProto::serializedSize(id);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::UsersGetFullUser;
     outputStream << id;
     PendingUserFull *op = new PendingUserFull(this, outputStream.getData());
@@ -60,7 +62,9 @@ UsersRpcLayer::PendingUserFull *UsersRpcLayer::getFullUser(const TLInputUser &id
 UsersRpcLayer::PendingUserVector *UsersRpcLayer::getUsers(const TLVector<TLInputUser> &id)
 {
     qCDebug(c_clientRpcUsersCategory) << Q_FUNC_INFO << id;
-    MTProto::Stream outputStream(MTProto::Stream::WriteOnly);
+    const quint32 requestSize = MTProto::serializedSize(TLValue::UsersGetUsers)
+            + MTProto::serializedSize(id);
+    MTProto::Stream outputStream(MTProto::Stream::WriteOnly, requestSize);
     outputStream << TLValue::UsersGetUsers;
     outputStream << id;
     PendingUserVector *op = new PendingUserVector(this, outputStream.getData());
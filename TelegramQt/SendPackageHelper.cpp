@@ -16,10 +16,17 @@
  */
 
 #include "SendPackageHelper.hpp"
+
+#include "Connection.hpp"
 #include "Utils.hpp"
 
 namespace Telegram {
 
+ConnectionCounters *BaseMTProtoSendHelper::counters() const
+{
+    return m_connection ? m_connection->counters() : nullptr;
+}
+
 void BaseMTProtoSendHelper::setDeltaTime(const qint32 newDt)
 {
     m_deltaTime = newDt;
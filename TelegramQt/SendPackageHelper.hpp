@@ -25,6 +25,7 @@
 namespace Telegram {
 
 class BaseConnection;
+class ConnectionCounters;
 
 enum class SendMode : quint8 {
     Client,
@@ -38,6 +39,8 @@ public:
     virtual ~BaseMTProtoSendHelper() = default;
     virtual quint64 newMessageId(SendMode mode) = 0;
     BaseConnection *getConnection() const { return m_connection; }
+    // Returns nullptr if the helper has no connection (e.g. in the tests)
+    ConnectionCounters *counters() const;
 
     virtual void sendPacket(const QByteArray &package) = 0;
 
@@ -45,8 +48,6 @@ public:
     void setDeltaTime(const qint32 newDt);
 
     quint64 authId() const { return m_authId; }
-    QByteArray getServerKeyPart() const { return m_authKey.mid(96, 32); }
-    QByteArray getClientKeyPart() const { return m_authKey.mid(88, 32); }
     QByteArray authKey() const { return m_authKey; }
     void setAuthKey(const QByteArray &authKey);
 
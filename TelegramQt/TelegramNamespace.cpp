@@ -150,11 +150,27 @@ Telegram::Peer Namespace::peerFromUserId(quint32 id)
     return Peer::fromUserId(id);
 }
 
+ConnectionStatistics &ConnectionStatistics::operator+=(const ConnectionStatistics &statistics)
+{
+    receivedBytes += statistics.receivedBytes;
+    receivedPackets += statistics.receivedPackets;
+    sentBytes += statistics.sentBytes;
+    sentPackets += statistics.sentPackets;
+    receivedGzipPackedMessages += statistics.receivedGzipPackedMessages;
+    sentGzipPackedMessages += statistics.sentGzipPackedMessages;
+    decryptionFailures += statistics.decryptionFailures;
+    processingTime += statistics.processingTime;
+    for (int i = 0; i < ProcessingTimeBuckets; ++i) {
+        processingTimeHistogram[i] += statistics.processingTimeHistogram[i];
+    }
+    return *this;
+}
+
 void initialize()
 {
     Namespace::registerTypes();
     if (!RandomGenerator::hasInstance()) {
-        static RandomGenerator defaultGenerator;
+        static BufferedRandomGenerator defaultGenerator;
         RandomGenerator::setInstance(&defaultGenerator);
     }
 }
@@ -216,6 +216,33 @@ inline bool DcOption::operator==(const DcOption &option) const
     return (option.id == id) && (option.port == port) && (option.address == address) && (option.flags == flags);
 }
 
+struct TELEGRAMQT_EXPORT ConnectionStatistics
+{
+    // The packet processing time histogram buckets: [0, 16us), [16us, 64us), ..., [16ms, 64ms), [64ms, inf)
+    enum { ProcessingTimeBuckets = 8 };
+    static quint32 processingTimeBucketLimit(int bucket); // The upper bucket limit in microseconds
+
+    ConnectionStatistics &operator+=(const ConnectionStatistics &statistics);
+
+    quint64 receivedBytes = 0;
+    quint64 receivedPackets = 0;
+    quint64 sentBytes = 0;
+    quint64 sentPackets = 0;
+    quint64 receivedGzipPackedMessages = 0;
+    quint64 sentGzipPackedMessages = 0;
+    quint64 decryptionFailures = 0;
+    quint64 processingTime = 0; // The total time of the received packets processing (in microseconds)
+    quint64 processingTimeHistogram[ProcessingTimeBuckets] = { };
+};
+
+inline quint32 ConnectionStatistics::processingTimeBucketLimit(int bucket)
+{
+    if (bucket >= ProcessingTimeBuckets - 1) {
+        return 0xffffffffu;
+    }
+    return 16u << (bucket * 2);
+}
+
 struct TELEGRAMQT_EXPORT Message
 {
     Message();
@@ -75,6 +75,7 @@ SOURCES += \
     CTelegramTransport.cpp \
     CTcpTransport.cpp \
     CClientTcpTransport.cpp \
+    LoopbackTransport.cpp \
     TelegramNamespace.cpp \
     LegacySecretReader.cpp \
     MessagingApi.cpp \
@@ -150,6 +151,7 @@ HEADERS += \
     RpcLayer.hpp \
     Connection.hpp \
     ConnectionError.hpp \
+    ConnectionCounters.hpp \
     RawStream.hpp \
     UniqueLazyPointer.hpp \
     Utils.hpp \
@@ -157,6 +159,7 @@ HEADERS += \
     CTelegramTransport.hpp \
     CTcpTransport.hpp \
     CClientTcpTransport.hpp \
+    LoopbackTransport.hpp \
     TLFunctions.hpp \
     TLTypes.hpp \
     TLNumbers.hpp \
@@ -178,15 +181,18 @@ include(Crypto/crypto.pri)
 include(Operations/operations.pri)
 
 SOURCES += \
+    MTProto/Arena.cpp \
     MTProto/CTelegramStream.cpp \
     MTProto/CTelegramStreamExtraOperators.cpp \
     MTProto/MessageHeader.cpp \
     MTProto/TLValues.cpp \
 
 HEADERS += \
+    MTProto/Arena.hpp \
     MTProto/CTelegramStream.hpp \
     MTProto/CTelegramStreamExtraOperators.hpp \
     MTProto/CTelegramStream_p.hpp \
+    MTProto/LazyVector.hpp \
     MTProto/MessageHeader.hpp \
     MTProto/Stream.hpp \
     MTProto/TLValues.hpp \
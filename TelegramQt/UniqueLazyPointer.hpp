@@ -18,8 +18,16 @@
 #ifndef TELEGRAM_QT_UNIQUE_LAZY_POINTER_HPP
 #define TELEGRAM_QT_UNIQUE_LAZY_POINTER_HPP
 
+#include <QtGlobal>
+
+#include <utility>
+
 namespace Telegram {
 
+// An owning pointer to a value constructed on the first non-const access.
+// A null pointer reads (via the const accessors) and compares as the default value.
+// The pointer can also refer to a value owned by someone else (see setUnownedData()),
+// e.g. by an MTProto::Arena. A copy always owns its value.
 template<typename TL>
 struct UniqueLazyPointer
 {
@@ -29,26 +37,24 @@ struct UniqueLazyPointer
     UniqueLazyPointer(const UniqueLazyPointer &ptr)
     {
         if (ptr.data) {
-            data = new TL(*ptr.data);
+            data = new TL(*ptr.pointer());
         }
     }
     UniqueLazyPointer(UniqueLazyPointer &&ptr)
     {
-        if (ptr.data) {
-            data = ptr.data;
-            ptr.data = nullptr;
-        }
+        data = ptr.data;
+        ptr.data = nullptr;
     }
 
-    ~UniqueLazyPointer() { delete data; }
+    ~UniqueLazyPointer() { clear(); }
 
     UniqueLazyPointer &operator=(const UniqueLazyPointer &ptr)
     {
         if (ptr.data) {
             if (data) {
-                *data = *ptr.data;
+                *pointer() = *ptr.pointer();
             } else {
-                data = new TL(*ptr.data);
+                data = new TL(*ptr.pointer());
             }
         } else {
             clear();
@@ -58,25 +64,61 @@ struct UniqueLazyPointer
 
     UniqueLazyPointer &operator=(UniqueLazyPointer &&ptr)
     {
-        if (ptr.data) {
-            if (data) {
-                delete data;
-            }
+        if (this != &ptr) {
+            clear();
             data = ptr.data;
             ptr.data = nullptr;
+        }
+        return *this;
+    }
+
+    UniqueLazyPointer &operator=(const TL &value)
+    {
+        if (data) {
+            *pointer() = value;
         } else {
-            clear();
+            data = new TL(value);
         }
         return *this;
     }
 
+    UniqueLazyPointer &operator=(TL &&value)
+    {
+        if (data) {
+            *pointer() = std::move(value);
+        } else {
+            data = new TL(std::move(value));
+        }
+        return *this;
+    }
+
+    bool operator==(const UniqueLazyPointer &ptr) const
+    {
+        if (!data && !ptr.data) {
+            return true;
+        }
+        return **this == *ptr;
+    }
+    bool operator!=(const UniqueLazyPointer &ptr) const { return !(*this == ptr); }
+
     constexpr operator bool() const { return data; }
     constexpr bool isNull() const { return !data; }
 
+    bool ownsData() const { return data && !(reinterpret_cast<quintptr>(data) & UnownedTag); }
+
+    // Refers to the value without taking the ownership; the value must outlive the pointer
+    void setUnownedData(TL *unownedData)
+    {
+        Q_ASSERT(!(reinterpret_cast<quintptr>(unownedData) & UnownedTag));
+        clear();
+        if (unownedData) {
+            data = reinterpret_cast<TL *>(reinterpret_cast<quintptr>(unownedData) | UnownedTag);
+        }
+    }
+
     const TL &operator*() const
     {
-        Q_ASSERT(data);
-        return *data;
+        return data ? *pointer() : defaultValue();
     }
 
     TL &operator*()
@@ -84,27 +126,42 @@ struct UniqueLazyPointer
         if (!data) {
             data = new TL;
         }
-        return *data;
+        return *pointer();
     }
     const TL *operator->() const
     {
-        Q_ASSERT(data);
-        return data;
+        return data ? pointer() : &defaultValue();
     }
     TL *operator->()
     {
         if (!data) {
             data = new TL;
         }
-        return data;
+        return pointer();
     }
 
 protected:
+    // The lowest address bit marks the data owned by someone else
+    static constexpr quintptr UnownedTag = 1;
+
     TL *data = nullptr;
 
+    TL *pointer() const
+    {
+        return reinterpret_cast<TL *>(reinterpret_cast<quintptr>(data) & ~UnownedTag);
+    }
+
+    static const TL &defaultValue()
+    {
+        static const TL value;
+        return value;
+    }
+
     void clear()
     {
-        delete data;
+        if (ownsData()) {
+            delete data;
+        }
         data = nullptr;
     }
 };
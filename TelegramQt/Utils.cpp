@@ -20,6 +20,11 @@
 #define ZLIB_CONST
 #include <zlib.h>
 
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define TELEGRAMQT_CRC32_PCLMUL
+#include <immintrin.h>
+#endif
+
 #include <QCryptographicHash>
 #include <QDebug>
 #include <QFileInfo>
@@ -50,53 +55,89 @@ quint64 Utils::greatestCommonOddDivisor(quint64 a, quint64 b)
     return b == 0 ? a : b;
 }
 
-// Yet another copy of some unknown pq-solver algorithm.
-// Links (join lines):
-// https://github.com/DrKLO/Telegram/blob/433f59c5b9ed17543d8e206c83f0bc7c7edb43a6
-// /TMessagesProj/jni/jni.c#L86
-// https://github.com/ex3ndr/telegram-mt/blob/91b1186e567b0484d6f371b8e5c61c425daf867e
-// /src/main/java/org/telegram/mtproto/secure/pq/PQLopatin.java#L35
-// https://github.com/vysheng/tg/blob/1dad2e89933085ea1e3d9fb1becb1907ce5de55f
-// /mtproto-client.c#L296
+// (a * b) mod m without overflow
+static inline quint64 mulMod(quint64 a, quint64 b, quint64 m)
+{
+#ifdef __SIZEOF_INT128__
+    return static_cast<quint64>((static_cast<unsigned __int128>(a) * b) % m);
+#else
+    // Portable double-and-add fallback
+    quint64 result = 0;
+    a %= m;
+    while (b) {
+        if (b & 1) {
+            result = (result >= m - a) ? result - (m - a) : result + a;
+        }
+        a = (a >= m - a) ? a - (m - a) : a + a;
+        b >>= 1;
+    }
+    return result;
+#endif
+}
+
+// SplitMix64; a local state keeps the factorization thread-safe and does not touch the libc rand()
+static inline quint64 nextRandom(quint64 *state)
+{
+    quint64 z = (*state += 0x9e3779b97f4a7c15ull);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+}
+
+// Pollard's rho with Brent's cycle detection (R. P. Brent, "An improved Monte Carlo factorization algorithm").
+// The differences are accumulated into a product, so a GCD is computed once per batch of steps.
 quint64 Utils::findDivider(quint64 number)
 {
-    int it = 0;
-    quint64 g = 0;
-    for (int i = 0; i < 3 || it < 10000; i++) {
-        const quint64 q = ((rand() & 15) + 17) % number;
-        quint64 x = (quint64) rand() % (number - 1) + 1;
-        quint64 y = x;
-        const quint32 lim = 1 << (i + 18);
-        for (quint32 j = 1; j < lim; j++) {
-            ++it;
-            quint64 a = x;
-            quint64 b = x;
-            quint64 c = q;
-            while (b) {
-                if (b & 1) {
-                    c += a;
-                    if (c >= number) {
-                        c -= number;
-                    }
-                }
-                a += a;
-                if (a >= number) {
-                    a -= number;
-                }
-                b >>= 1;
+    if (number < 4) {
+        return 1;
+    }
+    if (!(number & 1)) {
+        return 2;
+    }
+    constexpr int c_attempts = 16;
+    constexpr quint64 c_batchSize = 128;
+    // The expected number of steps is about sqrt(p), i.e. 2^16 for the 32-bit factors of pq
+    constexpr quint64 c_maxCycleLength = 1ull << 26;
+
+    quint64 randomState = number;
+    for (int attempt = 0; attempt < c_attempts; ++attempt) {
+        const quint64 c = nextRandom(&randomState) % (number - 1) + 1;
+        const auto f = [c, number](quint64 value) {
+            quint64 result = mulMod(value, value, number) + c;
+            if ((result >= number) || (result < c)) {
+                result -= number;
             }
-            x = c;
-            const quint64 z = x < y ? number + x - y : x - y;
-            g = greatestCommonOddDivisor(z, number);
-            if (g != 1) {
-                return g;
+            return result;
+        };
+
+        quint64 y = nextRandom(&randomState) % (number - 1) + 1;
+        quint64 x = y;
+        quint64 ys = y;
+        quint64 product = 1;
+        quint64 g = 1;
+        for (quint64 r = 1; (g == 1) && (r <= c_maxCycleLength); r <<= 1) {
+            x = y;
+            for (quint64 i = 0; i < r; ++i) {
+                y = f(y);
             }
-            if (!(j & (j - 1))) {
-                y = x;
+            for (quint64 k = 0; (k < r) && (g == 1); k += c_batchSize) {
+                ys = y;
+                const quint64 steps = qMin(c_batchSize, r - k);
+                for (quint64 i = 0; i < steps; ++i) {
+                    y = f(y);
+                    product = mulMod(product, x > y ? x - y : y - x, number);
+                }
+                g = greatestCommonOddDivisor(product, number);
             }
         }
-
-        if (g > 1 && g < number) {
+        if (g == number) {
+            // The batch has overshot (or the product became zero); replay it step by step
+            do {
+                ys = f(ys);
+                g = greatestCommonOddDivisor(x > ys ? x - ys : ys - x, number);
+            } while (g == 1);
+        }
+        if ((g > 1) && (g < number)) {
             return g;
         }
     }
@@ -213,4 +254,109 @@ QByteArray Utils::unpackGZip(const QByteArray &data)
     return result;
 }
 
+#ifdef TELEGRAMQT_CRC32_PCLMUL
+// CRC32 (IEEE 802.3, the zlib one) folded with carry-less multiplication.
+// See Intel's "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction".
+// The size must be at least 64 bytes and divisible by 16. The crc is the inverted one.
+__attribute__((target("sse4.2,pclmul")))
+static quint32 crc32Pclmul(const quint8 *data, int size, quint32 crc)
+{
+    alignas(16) static const quint64 k1k2[] = { 0x0154442bd4ull, 0x01c6e41596ull };
+    alignas(16) static const quint64 k3k4[] = { 0x01751997d0ull, 0x00ccaa009eull };
+    alignas(16) static const quint64 k5k0[] = { 0x0163cd6124ull, 0x0000000000ull };
+    alignas(16) static const quint64 poly[] = { 0x01db710641ull, 0x01f7011641ull };
+
+    __m128i x0, x1, x2, x3, x4, x5, x6, x7, x8, y5, y6, y7, y8;
+
+    x1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + 0x00));
+    x2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + 0x10));
+    x3 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + 0x20));
+    x4 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + 0x30));
+    x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128(static_cast<int>(crc)));
+    x0 = _mm_load_si128(reinterpret_cast<const __m128i *>(k1k2));
+    data += 64;
+    size -= 64;
+
+    while (size >= 64) {
+        x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x6 = _mm_clmulepi64_si128(x2, x0, 0x00);
+        x7 = _mm_clmulepi64_si128(x3, x0, 0x00);
+        x8 = _mm_clmulepi64_si128(x4, x0, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+        x2 = _mm_clmulepi64_si128(x2, x0, 0x11);
+        x3 = _mm_clmulepi64_si128(x3, x0, 0x11);
+        x4 = _mm_clmulepi64_si128(x4, x0, 0x11);
+        y5 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + 0x00));
+        y6 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + 0x10));
+        y7 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + 0x20));
+        y8 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + 0x30));
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), y5);
+        x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), y6);
+        x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), y7);
+        x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), y8);
+        data += 64;
+        size -= 64;
+    }
+
+    // Fold into 128 bits
+    x0 = _mm_load_si128(reinterpret_cast<const __m128i *>(k3k4));
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x3), x5);
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x4), x5);
+
+    // Fold the remaining 16-byte blocks
+    while (size >= 16) {
+        x2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data));
+        x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+        data += 16;
+        size -= 16;
+    }
+
+    // Fold 128 bits to 64 bits
+    x2 = _mm_clmulepi64_si128(x1, x0, 0x10);
+    x3 = _mm_setr_epi32(~0, 0, ~0, 0);
+    x1 = _mm_srli_si128(x1, 8);
+    x1 = _mm_xor_si128(x1, x2);
+    x0 = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(k5k0));
+    x2 = _mm_srli_si128(x1, 4);
+    x1 = _mm_and_si128(x1, x3);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    // Barrett reduction to 32 bits
+    x0 = _mm_load_si128(reinterpret_cast<const __m128i *>(poly));
+    x2 = _mm_and_si128(x1, x3);
+    x2 = _mm_clmulepi64_si128(x2, x0, 0x10);
+    x2 = _mm_and_si128(x2, x3);
+    x2 = _mm_clmulepi64_si128(x2, x0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    return static_cast<quint32>(_mm_extract_epi32(x1, 1));
+}
+#endif
+
+quint32 Utils::crc32(const char *data, int size, quint32 crc)
+{
+    const quint8 *bytes = reinterpret_cast<const quint8 *>(data);
+#ifdef TELEGRAMQT_CRC32_PCLMUL
+    static const bool hasPclmul = __builtin_cpu_supports("sse4.2") && __builtin_cpu_supports("pclmul");
+    if (hasPclmul && (size >= 64)) {
+        const int foldedSize = size & ~15;
+        crc = ~crc32Pclmul(bytes, foldedSize, ~crc);
+        bytes += foldedSize;
+        size -= foldedSize;
+    }
+#endif
+    // zlib is the portable fallback and processes the tail
+    return static_cast<quint32>(::crc32(crc, bytes, static_cast<uInt>(size)));
+}
+
 } // Telegram
@@ -40,6 +40,7 @@ TELEGRAMQT_INTERNAL_EXPORT QByteArray binaryNumberModExp(const QByteArray &data,
 TELEGRAMQT_INTERNAL_EXPORT QByteArray rsa(const QByteArray &data, const Telegram::RsaKey &key);
 TELEGRAMQT_INTERNAL_EXPORT QByteArray packGZip(const QByteArray &data);
 TELEGRAMQT_INTERNAL_EXPORT QByteArray unpackGZip(const QByteArray &data);
+TELEGRAMQT_INTERNAL_EXPORT quint32 crc32(const char *data, int size, quint32 crc = 0);
 
 constexpr quint32 c_gzipBufferSize = 1024;
 
@@ -24,6 +24,47 @@
 #include <QDebug>
 
 #include <QDateTime>
+#include <QSignalSpy>
+
+class CorkedTransport : public Telegram::Test::Transport
+{
+    Q_OBJECT
+public:
+    using Telegram::Test::Transport::Transport;
+
+    QByteArray pendingData;
+    QVector<QByteArray> writtenData;
+    qint64 unconsumedBytes = 0; // Written, but not sent to the peer yet
+
+    qint64 bufferedBytes() const override
+    {
+        return Telegram::Test::Transport::bufferedBytes() + unconsumedBytes;
+    }
+
+    void consume(qint64 bytes)
+    {
+        unconsumedBytes -= bytes;
+        updateWriteBufferState();
+    }
+
+protected:
+    void sendPacketImplementation(const QByteArray &payload) override
+    {
+        pendingData.append(payload);
+        if (isWriteCoalescingEnabled()) {
+            addPendingWrite(payload.size());
+        } else {
+            flushWritesImplementation();
+        }
+    }
+
+    void flushWritesImplementation() override
+    {
+        writtenData.append(pendingData);
+        unconsumedBytes += pendingData.size();
+        pendingData.clear();
+    }
+};
 
 class tst_CTelegramTransport : public QObject
 {
@@ -34,6 +75,9 @@ public:
 private slots:
     void testNewMessageId();
     void testNewMessageIdExtra();
+    void writeCoalescing();
+    void writeCoalescingByteLimit();
+    void writeWatermarks();
 
 };
 
@@ -102,6 +146,105 @@ void tst_CTelegramTransport::testNewMessageIdExtra()
     }
 }
 
+void tst_CTelegramTransport::writeCoalescing()
+{
+    const QByteArray packet1 = QByteArrayLiteral("pck1");
+    const QByteArray packet2 = QByteArrayLiteral("pck2pck2");
+    const QByteArray packet3 = QByteArrayLiteral("pck3");
+
+    CorkedTransport transport;
+    transport.sendPacket(packet1);
+    QCOMPARE(transport.writtenData.count(), 1);
+    QCOMPARE(transport.writeCoalescingStats().flushes, quint64(0));
+
+    transport.writtenData.clear();
+    transport.setWriteCoalescingEnabled(true);
+    transport.sendPacket(packet1);
+    transport.sendPacket(packet2);
+    transport.sendPacket(packet3);
+    QVERIFY(transport.writtenData.isEmpty());
+
+    // The data is written at the end of the event loop iteration
+    QTRY_COMPARE(transport.writtenData.count(), 1);
+    QCOMPARE(transport.writtenData.first(), packet1 + packet2 + packet3);
+
+    const Telegram::BaseTransport::WriteCoalescingStats stats = transport.writeCoalescingStats();
+    QCOMPARE(stats.flushes, quint64(1));
+    QCOMPARE(stats.packets, quint64(3));
+    QCOMPARE(stats.bytes, quint64(packet1.size() + packet2.size() + packet3.size()));
+    QCOMPARE(stats.lastFlushPackets, 3);
+    QCOMPARE(stats.maxFlushPackets, 3);
+
+    // Disabling flushes the pending data immediately
+    transport.sendPacket(packet1);
+    transport.setWriteCoalescingEnabled(false);
+    QCOMPARE(transport.writtenData.count(), 2);
+    QCOMPARE(transport.writeCoalescingStats().lastFlushPackets, 1);
+}
+
+void tst_CTelegramTransport::writeCoalescingByteLimit()
+{
+    const QByteArray packet = QByteArray(16, 'x');
+
+    CorkedTransport transport;
+    transport.setWriteCoalescingEnabled(true);
+    transport.setWriteCoalescingLimits(packet.size() * 2, 0);
+    transport.sendPacket(packet);
+    QVERIFY(transport.writtenData.isEmpty());
+    transport.sendPacket(packet);
+    // The byte limit is reached and the data is written without waiting for the event loop
+    QCOMPARE(transport.writtenData.count(), 1);
+    transport.sendPacket(packet);
+    QTRY_COMPARE(transport.writtenData.count(), 2);
+    QCOMPARE(transport.writeCoalescingStats().maxFlushPackets, 2);
+    QCOMPARE(transport.writeCoalescingStats().lastFlushPackets, 1);
+}
+
+void tst_CTelegramTransport::writeWatermarks()
+{
+    const QByteArray packet = QByteArray(100, 'x');
+
+    CorkedTransport transport;
+    QSignalSpy fullSpy(&transport, &Telegram::BaseTransport::writeBufferFull);
+    QSignalSpy drainedSpy(&transport, &Telegram::BaseTransport::writeBufferDrained);
+
+    // Disabled by default
+    transport.sendPacket(packet);
+    transport.sendPacket(packet);
+    QCOMPARE(transport.bufferedBytes(), qint64(200));
+    QVERIFY(!transport.isWriteBufferFull());
+    transport.consume(200);
+
+    transport.setWriteWatermarks(250, 100);
+    transport.sendPacket(packet);
+    transport.sendPacket(packet);
+    QCOMPARE(fullSpy.count(), 0);
+    transport.sendPacket(packet);
+    QCOMPARE(fullSpy.count(), 1);
+    QVERIFY(transport.isWriteBufferFull());
+    QCOMPARE(transport.maxBufferedBytes(), qint64(300));
+
+    // No signal repetition above the low watermark
+    transport.sendPacket(packet);
+    transport.consume(150);
+    QCOMPARE(fullSpy.count(), 1);
+    QCOMPARE(drainedSpy.count(), 0);
+    QVERIFY(transport.isWriteBufferFull());
+
+    transport.consume(150);
+    QCOMPARE(drainedSpy.count(), 1);
+    QVERIFY(!transport.isWriteBufferFull());
+
+    // The coalesced data is buffered as well
+    transport.setWriteCoalescingEnabled(true);
+    transport.sendPacket(packet);
+    transport.sendPacket(packet);
+    transport.sendPacket(packet);
+    QCOMPARE(transport.writtenData.count(), 6);
+    QCOMPARE(fullSpy.count(), 2);
+    QCOMPARE(transport.maxBufferedBytes(), qint64(400));
+}
+
 QTEST_MAIN(tst_CTelegramTransport)
 
 #include "tst_CTelegramTransport.moc"
@@ -17,10 +17,14 @@
 
 #include <QObject>
 
-#include "MTProto/Stream_p.hpp"
+#include "MTProto/Arena.hpp"
+#include "MTProto/LazyVector.hpp"
+// The extra operators have to be declared before the vector templates definition
 #include "MTProto/StreamExtraOperators.hpp"
+#include "MTProto/Stream_p.hpp"
 
 #include <QBuffer>
+#include <QMetaEnum>
 #include <QTest>
 #include <QDebug>
 
@@ -202,6 +206,7 @@ private slots:
     void testEncode();
     void benchmarkEncodeTLValuePlacement();
     void benchmarkEncodeTLValueStream();
+    void benchmarkEncodeStream_data();
     void benchmarkEncodeStream();
     void benchmarkEncodePlacement();
     void benchmarkEncodeStream1();
@@ -212,19 +217,33 @@ private slots:
     void benchmarkEncodePlacement2();
     void benchmarkEncodePlacement3();
     void benchmarkEncodePlacement4();
+    void compactTypeMembers();
+    void benchmarkDecodeUpdates_data();
+    void benchmarkDecodeUpdates();
+    void benchmarkDecodePageBlocks_data();
+    void benchmarkDecodePageBlocks();
     void stringsLimitSerialization();
     void shortStringSerialization();
     void longStringSerialization();
     void intSerialization();
     void vectorOfIntsSerialization();
     void vectorDeserializationError();
+    void decodeLimits();
     void pointerVectorSerialization();
     void pointerVectorDeserialization();
     void tlNumbersSerialization();
+    void tlValueNames();
+    void benchmarkTLValueName_data();
+    void benchmarkTLValueName();
     void tlDcOptionDeserialization();
     void recursiveTypeWriteRead();
+    void serializedSizeMatchesEncoding();
+    void skipMatchesEncoding();
+    void lazyVectorDecoding();
+    void arenaDecoding();
     void readError();
     void byteArrays();
+    void byteArraysReference();
     void reqPqData();
 
 };
@@ -307,8 +326,22 @@ void tst_MTProtoStream::benchmarkEncodeTLValueStream()
     }
 }
 
+// The stream backends: a QIODevice (QBuffer) or the contiguous memory
+static void addStreamBackendBenchmarkData()
+{
+    QTest::addColumn<bool>("device");
+    QTest::newRow("QBuffer device") << true;
+    QTest::newRow("Contiguous memory") << false;
+}
+
+void tst_MTProtoStream::benchmarkEncodeStream_data()
+{
+    addStreamBackendBenchmarkData();
+}
+
 void tst_MTProtoStream::benchmarkEncodeStream()
 {
+    QFETCH(bool, device);
     const QStringList dataList = {
         QStringLiteral("1"), QStringLiteral("02"), QStringLiteral("003"), QStringLiteral("0004"),
         QStringLiteral("00005"), QStringLiteral("000006"), QStringLiteral("0000007"), QStringLiteral("00000008")
@@ -316,9 +349,17 @@ void tst_MTProtoStream::benchmarkEncodeStream()
 
     QBENCHMARK {
         for (const QString &s : dataList) {
-            Telegram::MTProto::Stream stream(Telegram::MTProto::Stream::WriteOnly);
-            stream << s;
-            stream.getData();
+            if (device) {
+                QBuffer buffer;
+                buffer.open(QIODevice::WriteOnly);
+                Telegram::MTProto::Stream stream(&buffer);
+                stream << s;
+                buffer.data();
+            } else {
+                Telegram::MTProto::Stream stream(Telegram::MTProto::Stream::WriteOnly);
+                stream << s;
+                stream.getData();
+            }
         }
     }
 }
@@ -421,6 +462,207 @@ void tst_MTProtoStream::benchmarkEncodePlacement4()
     }
 }
 
+static const int c_updatesBenchmarkCount = 1000;
+
+static QByteArray encodeUpdatesBenchmarkPayload()
+{
+    TLUpdates updates;
+    updates.tlType = TLValue::Updates;
+    updates.date = 1500000000;
+    for (int i = 0; i < c_updatesBenchmarkCount; ++i) {
+        TLUpdate update;
+        switch (i % 3) {
+        case 0:
+        {
+            update.tlType = TLValue::UpdateNewMessage;
+            TLMessage &message = update.message;
+            message.tlType = TLValue::Message;
+            message.flags = TLMessage::FromId;
+            message.id = static_cast<quint32>(i);
+            message.fromId = 1000;
+            message.toId.tlType = TLValue::PeerUser;
+            message.toId.userId = 1;
+            message.date = updates.date;
+            message.message = QStringLiteral("Message %1").arg(i);
+            update.pts = static_cast<quint32>(i);
+            update.ptsCount = 1;
+        }
+            break;
+        case 1:
+            update.tlType = TLValue::UpdateUserStatus;
+            update.userId = 1000;
+            update.status.tlType = TLValue::UserStatusOnline;
+            update.status.expires = updates.date + 300;
+            break;
+        default:
+            update.tlType = TLValue::UpdateReadHistoryInbox;
+            update.peer.tlType = TLValue::PeerUser;
+            update.peer.userId = 1000;
+            update.maxId = static_cast<quint32>(i);
+            update.pts = static_cast<quint32>(i);
+            update.ptsCount = 1;
+            break;
+        }
+        updates.updates.append(update);
+    }
+    Telegram::MTProto::Stream stream(Telegram::MTProto::Stream::WriteOnly);
+    stream << updates;
+    return stream.getData();
+}
+
+void tst_MTProtoStream::compactTypeMembers()
+{
+    TLUpdate update;
+    update.message.message = QStringLiteral("Text");
+    // The message member is shared by the new and the edit message constructors
+    update.tlType = TLValue::UpdateEditMessage;
+    QCOMPARE(update.message.message, QStringLiteral("Text"));
+
+    update.tlType = TLValue::UpdateServiceNotification;
+    update.type = QStringLiteral("Type");
+    update.stringMessage = QStringLiteral("Notification");
+    update.media.tlType = TLValue::MessageMediaEmpty;
+    update.entities.append(TLMessageEntity());
+
+    const TLUpdate copy = update;
+    QVERIFY(copy == update);
+
+    Telegram::MTProto::Stream outputStream(Telegram::MTProto::Stream::WriteOnly);
+    outputStream << update;
+    Telegram::MTProto::Stream inputStream(outputStream.getData());
+    TLUpdate decoded;
+    inputStream >> decoded;
+    QVERIFY(!inputStream.error());
+    QCOMPARE(decoded.tlType, TLValue::UpdateServiceNotification);
+    QCOMPARE(decoded.stringMessage, update.stringMessage);
+    QVERIFY(decoded == update);
+
+    // Switch back to a constructor without the shared members
+    decoded.tlType = TLValue::UpdateNewMessage;
+    QVERIFY(decoded.message.message.isEmpty());
+    QVERIFY(decoded.hasMember(TLUpdate::MessageMember));
+    QVERIFY(!decoded.hasMember(TLUpdate::ActionMember));
+    QVERIFY(!decoded.hasMember(TLUpdate::EntitiesMember));
+
+    decoded.tlType = TLValue::UpdateUserTyping;
+    QVERIFY(decoded.hasMember(TLUpdate::ActionMember));
+    QVERIFY(!decoded.hasMember(TLUpdate::MessageMember));
+}
+
+void tst_MTProtoStream::benchmarkDecodeUpdates_data()
+{
+    addStreamBackendBenchmarkData();
+}
+
+void tst_MTProtoStream::benchmarkDecodeUpdates()
+{
+    QFETCH(bool, device);
+    const QByteArray payload = encodeUpdatesBenchmarkPayload();
+    TLUpdates updates;
+    bool error = false;
+    QBENCHMARK {
+        QBuffer buffer;
+        Telegram::MTProto::Stream stream;
+        if (device) {
+            buffer.setData(payload);
+            buffer.open(QIODevice::ReadOnly);
+            stream.setDevice(&buffer);
+        } else {
+            stream.setData(payload);
+        }
+        stream >> updates;
+        error = stream.error() || !stream.atEnd();
+    }
+    QVERIFY(!error);
+    QCOMPARE(updates.updates.count(), c_updatesBenchmarkCount);
+    QCOMPARE(updates.updates.at(0).message.message, QStringLiteral("Message 0"));
+    QCOMPARE(updates.updates.at(1).status.tlType, TLValue::UserStatusOnline);
+    QCOMPARE(updates.updates.at(2).peer.userId, 1000u);
+
+    // The compact layout shares the storage of the constructor-specific members
+    // (the message and the media were both kept inline before)
+    QVERIFY(sizeof(TLUpdate) < sizeof(TLMessage) + sizeof(TLMessageMedia));
+}
+
+static const int c_pageBlocksBenchmarkCount = 200;
+static const int c_pageBlocksBenchmarkTexts = 8;
+
+// A slideshow of paragraphs, each one is a concatenation of bold(italic(plain)) texts
+static TLPageBlock createPageBlocksBenchmarkValue()
+{
+    TLPageBlock slideshow;
+    slideshow.tlType = TLValue::PageBlockSlideshow;
+    slideshow.caption->tlType = TLValue::TextEmpty;
+    for (int i = 0; i < c_pageBlocksBenchmarkCount; ++i) {
+        TLPageBlock *paragraph = new TLPageBlock();
+        paragraph->tlType = TLValue::PageBlockParagraph;
+        paragraph->text->tlType = TLValue::TextConcat;
+        for (int j = 0; j < c_pageBlocksBenchmarkTexts; ++j) {
+            TLRichText *bold = new TLRichText();
+            bold->tlType = TLValue::TextBold;
+            TLRichText &italic = *bold->richText;
+            italic.tlType = TLValue::TextItalic;
+            italic.richText->tlType = TLValue::TextPlain;
+            italic.richText->stringText = QStringLiteral("Paragraph %1 text %2").arg(i).arg(j);
+            paragraph->text->texts.append(bold);
+        }
+        slideshow.pageBlockItemsVector.append(paragraph);
+    }
+    return slideshow;
+}
+
+// Deletes the heap allocated vector items of the value created or decoded without an arena
+static void deletePageBlocksBenchmarkItems(TLPageBlock *slideshow)
+{
+    for (TLPageBlock *paragraph : slideshow->pageBlockItemsVector) {
+        qDeleteAll(paragraph->text->texts);
+        delete paragraph;
+    }
+    slideshow->pageBlockItemsVector.clear();
+}
+
+static QByteArray encodePageBlocksBenchmarkPayload()
+{
+    TLPageBlock slideshow = createPageBlocksBenchmarkValue();
+    Telegram::MTProto::Stream stream(Telegram::MTProto::Stream::WriteOnly);
+    stream << slideshow;
+    deletePageBlocksBenchmarkItems(&slideshow);
+    return stream.getData();
+}
+
+void tst_MTProtoStream::benchmarkDecodePageBlocks_data()
+{
+    QTest::addColumn<bool>("arena");
+    QTest::newRow("Heap") << false;
+    QTest::newRow("Arena") << true;
+}
+
+void tst_MTProtoStream::benchmarkDecodePageBlocks()
+{
+    QFETCH(bool, arena);
+    const QByteArray payload = encodePageBlocksBenchmarkPayload();
+
+    bool error = false;
+    int itemsCount = 0;
+    QBENCHMARK {
+        // The arena must outlive the decoded value
+        Telegram::MTProto::Arena decodeArena;
+        TLPageBlock slideshow;
+        Telegram::MTProto::Stream stream(payload);
+        if (arena) {
+            stream.setArena(&decodeArena);
+        }
+        stream >> slideshow;
+        error = stream.error() || !stream.atEnd();
+        itemsCount = slideshow.pageBlockItemsVector.count();
+        if (!arena) {
+            deletePageBlocksBenchmarkItems(&slideshow);
+        }
+    }
+    QVERIFY(!error);
+    QCOMPARE(itemsCount, c_pageBlocksBenchmarkCount);
+}
+
 void tst_MTProtoStream::shortStringSerialization()
 {
     QList<STestData> data;
@@ -688,6 +930,75 @@ void tst_MTProtoStream::vectorDeserializationError()
     }
 }
 
+void tst_MTProtoStream::decodeLimits()
+{
+    {
+        // A vector of 16M elements with the data of two
+        Telegram::MTProto::Stream output(Telegram::MTProto::Stream::WriteOnly);
+        output << TLValue::Vector;
+        output << quint32(0xffffff);
+        output << quint32(1);
+        output << quint32(2);
+
+        TLVector<quint32> vector = { 3 };
+        Telegram::MTProto::Stream stream(output.getData());
+        stream >> vector;
+        QVERIFY(stream.error());
+        QVERIFY(vector.isEmpty());
+    }
+
+    {
+        // The bytes of the maximum length with the data of three
+        const QByteArray encoded = QByteArray::fromHex("feffffff616263");
+        QByteArray data = QByteArrayLiteral("data");
+        Telegram::MTProto::Stream stream(encoded);
+        stream >> data;
+        QVERIFY(stream.error());
+        QVERIFY(data.isEmpty());
+    }
+
+    const TLVector<quint32> values = { 1, 2, 3 };
+    const QByteArray text = QByteArrayLiteral("text1");
+    Telegram::MTProto::Stream output(Telegram::MTProto::Stream::WriteOnly);
+    output << values;
+    output << text;
+    const QByteArray encoded = output.getData();
+
+    {
+        Telegram::MTProto::Stream stream(encoded);
+        stream.setMaxVectorLength(3);
+        stream.setMaxBytesLength(5);
+        TLVector<quint32> readValues;
+        QByteArray readText;
+        stream >> readValues;
+        stream >> readText;
+        QVERIFY(!stream.error());
+        QCOMPARE(readValues, values);
+        QCOMPARE(readText, text);
+    }
+
+    {
+        Telegram::MTProto::Stream stream(encoded);
+        stream.setMaxVectorLength(2);
+        TLVector<quint32> readValues;
+        stream >> readValues;
+        QVERIFY(stream.error());
+        QVERIFY(readValues.isEmpty());
+    }
+
+    {
+        Telegram::MTProto::Stream stream(encoded);
+        stream.setMaxBytesLength(4);
+        TLVector<quint32> readValues;
+        QByteArray readText;
+        stream >> readValues;
+        QVERIFY(!stream.error());
+        stream >> readText;
+        QVERIFY(stream.error());
+        QVERIFY(readText.isEmpty());
+    }
+}
+
 void tst_MTProtoStream::pointerVectorSerialization()
 {
     TLVector<quint32> values = { 1, 2, 3, 4, 5 };
@@ -797,6 +1108,56 @@ void tst_MTProtoStream::tlNumbersSerialization()
     }
 }
 
+void tst_MTProtoStream::tlValueNames()
+{
+    const QMetaEnum metaEnum = TLValue::staticMetaObject.enumerator(TLValue::staticMetaObject.indexOfEnumerator("Value"));
+    QVERIFY(metaEnum.keyCount() > 0);
+    for (int i = 0; i < metaEnum.keyCount(); ++i) {
+        const TLValue value(static_cast<quint32>(metaEnum.value(i)));
+        QVERIFY(value.isValid());
+        QCOMPARE(value.name(), metaEnum.key(i));
+        QCOMPARE(value.toString(), QString::fromLatin1(metaEnum.key(i)));
+    }
+
+    const TLValue unknown(0x12345678u);
+    QVERIFY(!unknown.isValid());
+    QVERIFY(!unknown.name());
+    QCOMPARE(unknown.toString(), QStringLiteral("12345678"));
+    QVERIFY(!TLValue().name());
+}
+
+void tst_MTProtoStream::benchmarkTLValueName_data()
+{
+    QTest::addColumn<bool>("metaEnum");
+    QTest::newRow("QMetaEnum") << true;
+    QTest::newRow("Names table") << false;
+}
+
+void tst_MTProtoStream::benchmarkTLValueName()
+{
+    QFETCH(bool, metaEnum);
+    const QMetaEnum enumerator = TLValue::staticMetaObject.enumerator(TLValue::staticMetaObject.indexOfEnumerator("Value"));
+    const QVector<TLValue> values = {
+        TLValue::ResPQ,
+        TLValue::MsgContainer,
+        TLValue::MessagesSendMessage,
+        TLValue::UpdatesGetDifference,
+        TLValue::UploadGetFile,
+        TLValue::InvokeWithLayer,
+    };
+    int found = 0;
+    QBENCHMARK {
+        found = 0;
+        for (const TLValue value : values) {
+            const char *name = metaEnum ? enumerator.valueToKey(static_cast<int>(quint32(value))) : value.name();
+            if (name) {
+                ++found;
+            }
+        }
+    }
+    QCOMPARE(found, values.count());
+}
+
 void tst_MTProtoStream::tlDcOptionDeserialization()
 {
     QByteArray dcOptionsData;
@@ -853,6 +1214,220 @@ void tst_MTProtoStream::recursiveTypeWriteRead()
     QCOMPARE(text2.stringText, text.stringText);
 }
 
+template <typename T>
+static quint32 encodedSize(const T &value)
+{
+    Telegram::MTProto::Stream stream(Telegram::MTProto::Stream::WriteOnly);
+    stream << value;
+    return static_cast<quint32>(stream.getData().size());
+}
+
+void tst_MTProtoStream::serializedSizeMatchesEncoding()
+{
+    // The length prefix changes its size at 254 bytes
+    for (int size : { 0, 1, 3, 4, 252, 253, 254, 255, 1000 }) {
+        const QByteArray data(size, 'x');
+        QCOMPARE(Telegram::MTProto::serializedSize(data), encodedSize(data));
+    }
+
+    const QStringList strings = {
+        QString(),
+        QStringLiteral("test"),
+        QString::fromUtf8("\xd1\x82\xd0\xb5\xd1\x81\xd1\x82"),
+        QString::fromUtf8("\xe2\x82\xac\xf0\x9f\x98\x80 smile"),
+        QString(300, QLatin1Char('a')),
+    };
+    for (const QString &string : strings) {
+        QCOMPARE(Telegram::MTProto::serializedSize(string), encodedSize(string));
+    }
+
+    TLRichText plainText;
+    plainText.tlType = TLValue::TextPlain;
+    plainText.stringText = QStringLiteral("plain");
+    TLRichText boldText;
+    boldText.tlType = TLValue::TextBold;
+    *boldText.richText = plainText;
+    TLRichText concatText;
+    concatText.tlType = TLValue::TextConcat;
+    concatText.texts.append(new TLRichText(plainText));
+    concatText.texts.append(new TLRichText(boldText));
+    const quint32 concatTextSize = Telegram::MTProto::serializedSize(concatText);
+    const quint32 concatTextEncodedSize = encodedSize(concatText);
+    qDeleteAll(concatText.texts);
+    QCOMPARE(concatTextSize, concatTextEncodedSize);
+
+    TLDcOption option;
+    option.flags = TLDcOption::Ipv6;
+    option.id = 2;
+    option.ipAddress = QStringLiteral("2001:db8::1");
+    option.port = 443;
+    TLVector<TLDcOption> options = { option, option };
+    QCOMPARE(Telegram::MTProto::serializedSize(options), encodedSize(options));
+}
+
+template <typename T>
+static bool skipMatchesEncodedSize(const T &value)
+{
+    static const quint32 c_tail = 0xdeadbeef;
+    Telegram::MTProto::Stream output(Telegram::MTProto::Stream::WriteOnly);
+    output << value;
+    output << c_tail;
+
+    Telegram::MTProto::Stream input(output.getData());
+    input.skip<T>();
+    quint32 tail = 0;
+    input >> tail;
+    return !input.error() && (tail == c_tail) && input.atEnd();
+}
+
+static TLVector<TLUser> lazyVectorTestUsers()
+{
+    TLVector<TLUser> users;
+    for (quint32 i = 1; i <= 3; ++i) {
+        TLUser user;
+        user.tlType = TLValue::User;
+        user.id = i;
+        user.flags = TLUser::FirstName | TLUser::Username;
+        user.firstName = QStringLiteral("User%1").arg(i);
+        user.username = QString(static_cast<int>(i) * 100, QLatin1Char('u'));
+        if (i == 2) {
+            user.flags |= TLUser::Status;
+            user.status.tlType = TLValue::UserStatusOffline;
+            user.status.wasOnline = 12345;
+        }
+        users.append(user);
+    }
+    return users;
+}
+
+void tst_MTProtoStream::skipMatchesEncoding()
+{
+    QVERIFY(skipMatchesEncodedSize(QByteArray(300, 'x')));
+    QVERIFY(skipMatchesEncodedSize(QStringLiteral("test")));
+    QVERIFY(skipMatchesEncodedSize(lazyVectorTestUsers()));
+
+    TLRichText plainText;
+    plainText.tlType = TLValue::TextPlain;
+    plainText.stringText = QStringLiteral("plain");
+    TLRichText concatText;
+    concatText.tlType = TLValue::TextConcat;
+    concatText.texts.append(new TLRichText(plainText));
+    concatText.texts.append(new TLRichText(plainText));
+    const bool concatTextSkipped = skipMatchesEncodedSize(concatText);
+    qDeleteAll(concatText.texts);
+    QVERIFY(concatTextSkipped);
+
+    TLDcOption option;
+    option.flags = TLDcOption::Ipv6;
+    option.id = 2;
+    option.ipAddress = QStringLiteral("2001:db8::1");
+    option.port = 443;
+    QVERIFY(skipMatchesEncodedSize(TLVector<TLDcOption>({ option, option })));
+
+    // The size of a value of an unknown type can not be determined
+    Telegram::MTProto::Stream output(Telegram::MTProto::Stream::WriteOnly);
+    output << TLValue::TextPlain;
+    output << quint32(0);
+    Telegram::MTProto::Stream input(output.getData());
+    input.skip<TLUser>();
+    QVERIFY(input.error());
+}
+
+void tst_MTProtoStream::lazyVectorDecoding()
+{
+    const TLVector<TLUser> users = lazyVectorTestUsers();
+    Telegram::MTProto::Stream output(Telegram::MTProto::Stream::WriteOnly);
+    output << users;
+    output << quint32(0);
+
+    Telegram::MTProto::Stream input(output.getData());
+    Telegram::MTProto::LazyVector<TLUser> lazyUsers;
+    input >> lazyUsers;
+    QVERIFY(!input.error());
+    QCOMPARE(input.bytesAvailable(), 4);
+    QCOMPARE(lazyUsers.count(), users.count());
+    for (int i = users.count() - 1; i >= 0; --i) {
+        QVERIFY(lazyUsers.at(i) == users.at(i));
+    }
+    QVERIFY(lazyUsers.toVector() == users);
+
+    TLUser user;
+    QVERIFY(!lazyUsers.read(users.count(), &user));
+
+    // A truncated vector is an error and leaves no elements
+    const QByteArray data = output.getData();
+    Telegram::MTProto::Stream truncatedInput(data.left(data.size() - 8));
+    truncatedInput >> lazyUsers;
+    QVERIFY(truncatedInput.error());
+    QVERIFY(lazyUsers.isEmpty());
+
+    // The data of a device stream can not be referenced, so the vector is decoded eagerly
+    QBuffer device;
+    device.setData(data);
+    device.open(QIODevice::ReadOnly);
+    Telegram::MTProto::Stream deviceInput(&device);
+    deviceInput >> lazyUsers;
+    QVERIFY(!deviceInput.error());
+    QCOMPARE(device.bytesAvailable(), qint64(4));
+    QCOMPARE(lazyUsers.count(), users.count());
+    QVERIFY(lazyUsers.at(users.count() - 1) == users.last());
+    QVERIFY(lazyUsers.toVector() == users);
+}
+
+void tst_MTProtoStream::arenaDecoding()
+{
+    const QByteArray payload = encodePageBlocksBenchmarkPayload();
+
+    Telegram::MTProto::Arena arena;
+    TLPageBlock slideshow;
+    Telegram::MTProto::Stream stream(payload);
+    stream.setArena(&arena);
+    QCOMPARE(stream.arena(), &arena);
+    stream >> slideshow;
+    QVERIFY(!stream.error());
+    QVERIFY(stream.atEnd());
+
+    // The caption, the paragraphs and all their texts are allocated in the arena
+    const int expectedObjects = 1 + c_pageBlocksBenchmarkCount * (2 + c_pageBlocksBenchmarkTexts * 3);
+    QCOMPARE(arena.objectCount(), expectedObjects);
+    QVERIFY(arena.contains(slideshow.pageBlockItemsVector.first()));
+    QVERIFY(slideshow.pageBlockItemsVector.arenaItems);
+    QVERIFY(!slideshow.caption.ownsData());
+    QCOMPARE(slideshow.caption->tlType, TLValue::TextEmpty);
+
+    const TLPageBlock *lastParagraph = slideshow.pageBlockItemsVector.last();
+    QCOMPARE(lastParagraph->text->texts.count(), c_pageBlocksBenchmarkTexts);
+    const TLRichText *plain = &*lastParagraph->text->texts.last()->richText->richText;
+    QCOMPARE(plain->tlType, TLValue::TextPlain);
+    QCOMPARE(plain->stringText, QStringLiteral("Paragraph %1 text %2")
+             .arg(c_pageBlocksBenchmarkCount - 1).arg(c_pageBlocksBenchmarkTexts - 1));
+
+    Telegram::MTProto::Stream encoder(Telegram::MTProto::Stream::WriteOnly);
+    encoder << slideshow;
+    QCOMPARE(encoder.getData(), payload);
+
+    // Decoding over the arena items without an arena must not delete them
+    {
+        Telegram::MTProto::Stream heapStream(payload);
+        heapStream >> slideshow;
+        QVERIFY(!heapStream.error());
+        QVERIFY(!slideshow.pageBlockItemsVector.arenaItems);
+        QVERIFY(!arena.contains(slideshow.pageBlockItemsVector.first()));
+        QCOMPARE(arena.objectCount(), expectedObjects);
+        deletePageBlocksBenchmarkItems(&slideshow);
+    }
+
+    // A copy owns its node and stays valid after the arena is cleared
+    const TLRichTextPtr captionCopy = slideshow.caption;
+    QVERIFY(captionCopy.ownsData());
+    QVERIFY(!arena.contains(&*captionCopy));
+    slideshow = TLPageBlock();
+    arena.clear();
+    QCOMPARE(arena.objectCount(), 0);
+    QCOMPARE(arena.blockCount(), 1);
+    QCOMPARE(captionCopy->tlType, TLValue::TextEmpty);
+}
+
 void tst_MTProtoStream::readError()
 {
     {
@@ -913,6 +1488,31 @@ void tst_MTProtoStream::byteArrays()
     QCOMPARE(array2, a2);
 }
 
+void tst_MTProtoStream::byteArraysReference()
+{
+    const QByteArray shortArray = QByteArrayLiteral("array1");
+    const QByteArray longArray(1000, 'x');
+
+    Telegram::MTProto::Stream stream(Telegram::MTProto::Stream::WriteOnly);
+    stream << shortArray;
+    stream << longArray;
+    QVERIFY(!stream.error());
+    const QByteArray output = stream.getData();
+
+    Telegram::MTProto::Stream inputStream(output);
+    inputStream.setBytesReferenceData(true);
+    QByteArray a1;
+    QByteArray a2;
+    inputStream >> a1;
+    inputStream >> a2;
+    QVERIFY(!inputStream.error());
+    QCOMPARE(a1, shortArray);
+    QCOMPARE(a2, longArray);
+    // The decoded arrays point into the input data
+    QVERIFY(a2.constData() > output.constData());
+    QVERIFY(a2.constData() + a2.size() <= output.constData() + output.size());
+}
+
 void tst_MTProtoStream::reqPqData()
 {
     TLNumber128 clientNonce;
@@ -17,15 +17,21 @@
 
 #include <QObject>
 
+#include "ClientRpcLayer.hpp"
+#include "IgnoredMessageNotification.hpp"
+#include "PendingRpcOperation.hpp"
 #include "RandomGenerator.hpp"
 #include "RpcLayer.hpp"
 #include "SendPackageHelper.hpp"
 #include "TelegramNamespace.hpp"
+#include "Utils.hpp"
 #include "CTelegramTransport.hpp"
 #include "../utils/TestTransport.hpp"
 
 #include "MTProto/MessageHeader.hpp"
+#include "MTProto/Stream.hpp"
 
+#include <QCoreApplication>
 #include <QTest>
 #include <QDebug>
 #include <QSignalSpy>
@@ -101,48 +107,26 @@ public:
     quint64 sessionId() const override { return m_sessionId; }
     void setSessionId(quint64 id) { m_sessionId = id; }
 
-    MTProto::Message lastProcessedMessage() const { return m_lastProcessedMessage; }
+    MTProto::Message lastProcessedMessage() const { return m_processedMessages.isEmpty() ? MTProto::Message() : m_processedMessages.last(); }
+    QVector<MTProto::Message> processedMessages() const { return m_processedMessages; }
+    void clearProcessedMessages() { m_processedMessages.clear(); }
 
     bool processMessageHeader(const MTProto::FullMessageHeader &) override { return true; }
-    bool processMTProtoMessage(const MTProto::Message &message) override { m_lastProcessedMessage = message; return false; }
+    bool processMTProtoMessage(const MTProto::Message &message) override { m_processedMessages.append(message); return false; }
 
 protected:
-    Crypto::AesKey getEncryptionAesKey(const QByteArray &messageKey) const final
+    KeyPart encryptionKeyPart() const final
     {
-        return m_mode == Mode::Client ? generateClientToServerAesKey(messageKey) : generateServerToClientAesKey(messageKey);
+        return m_mode == Mode::Client ? ClientKeyPart : ServerKeyPart;
     }
 
-    Crypto::AesKey getDecryptionAesKey(const QByteArray &messageKey) const final
-    {
-        return m_mode == Mode::Client ? generateServerToClientAesKey(messageKey) : generateClientToServerAesKey(messageKey);
-    }
-
-    QByteArray getEncryptionKeyPart() const override;
-    QByteArray getVerificationKeyPart() const override;
-
     Mode m_mode;
     quint64 m_sessionId = 0;
     Transport *m_transport = nullptr;
     MTProtoSendHelper *m_sendHelper = nullptr;
-    MTProto::Message m_lastProcessedMessage;
+    QVector<MTProto::Message> m_processedMessages;
 };
 
-QByteArray RpcLayer::getEncryptionKeyPart() const
-{
-    if (m_mode == Mode::Client) {
-        return m_sendHelper->getClientKeyPart();
-    }
-    return m_sendHelper->getServerKeyPart();
-}
-
-QByteArray RpcLayer::getVerificationKeyPart() const
-{
-    if (m_mode == Mode::Client) {
-        return m_sendHelper->getServerKeyPart();
-    }
-    return m_sendHelper->getClientKeyPart();
-}
-
 class ClientRpcLayer : public RpcLayer
 {
     Q_OBJECT
@@ -153,6 +137,11 @@ public:
     {
         return sendPacket(buffer, SendMode::Client, MessageType::ContentRelatedMessage);
     }
+
+    quint64 sendContainerAsClient(const QVector<const MTProto::Message *> &messages)
+    {
+        return sendContainer(messages, SendMode::Client);
+    }
 };
 
 class ServerRpcLayer : public RpcLayer
@@ -170,6 +159,26 @@ public:
     {
         return sendPacket(buffer, SendMode::ServerInitiative, MessageType::ContentRelatedMessage);
     }
+
+    quint64 sendServicePackageAsServer(const QByteArray &buffer)
+    {
+        return sendPacket(buffer, SendMode::ServerInitiative, MessageType::NotContentRelatedMessage);
+    }
+
+    // Processes the packet and returns the messages of the received container
+    QVector<MTProto::Message> receiveContainer(const QByteArray &packet, quint64 *containerId)
+    {
+        clearProcessedMessages();
+        processPacket(packet);
+        const MTProto::Message container = lastProcessedMessage();
+        if (container.firstValue() != TLValue::MsgContainer) {
+            return { };
+        }
+        *containerId = container.messageId;
+        clearProcessedMessages();
+        processMsgContainer(container.skipTLValue());
+        return processedMessages();
+    }
 };
 
 } // Test
@@ -178,6 +187,34 @@ public:
 
 const QByteArray c_authKey = QByteArrayLiteral("some_auth_key_data_123456789_abcdefghijklmnopqrstuvwxyz");
 
+namespace Telegram {
+
+namespace Test {
+
+// Client::RpcLayer with the session of the test ServerRpcLayer
+class ClientSession
+{
+public:
+    ClientSession() :
+        sendHelper(&transport)
+    {
+        sendHelper.setBaseTimestamp(1537207803787ull);
+        sendHelper.setAuthKey(c_authKey);
+        rpcLayer.setSendHelper(&sendHelper);
+        // Start with a content related message number to skip the initConnection wrapper
+        rpcLayer.setSessionData(123456789ull, 1);
+        rpcLayer.setServerSalt(3720780378715ull);
+    }
+
+    Transport transport;
+    MTProtoSendHelper sendHelper;
+    Client::RpcLayer rpcLayer;
+};
+
+} // Test
+
+} // Telegram
+
 class tst_RpcLayer : public QObject
 {
     Q_OBJECT
@@ -190,6 +227,10 @@ private slots:
     void sendClientRequest();
     void sendServerReply();
     void processServerReply();
+    void processGzipPackedReply();
+    void sendClientContainer();
+    void batchClientRequests();
+    void resendIgnoredContainer();
 
 private:
     Telegram::DeterministicGenerator *m_generator = nullptr;
@@ -270,6 +311,202 @@ void tst_RpcLayer::processServerReply()
     QCOMPARE(m.data, data);
 }
 
-QTEST_APPLESS_MAIN(tst_RpcLayer)
+void tst_RpcLayer::processGzipPackedReply()
+{
+    const QByteArray data(512, 'x');
+    Telegram::MTProto::Stream packedStream(Telegram::MTProto::Stream::WriteOnly);
+    packedStream << Telegram::TLValue::GzipPacked;
+    packedStream << Telegram::Utils::packGZip(data);
+
+    Telegram::Test::ServerRpcLayer serverLayer;
+    QSignalSpy sentPackagesSpy(serverLayer.transport(), &Telegram::Test::Transport::packetSent);
+    serverLayer.sendHelper()->setAuthKey(c_authKey);
+    serverLayer.sendPackageAsServerReply(packedStream.getData());
+    QCOMPARE(sentPackagesSpy.count(), 1);
+
+    // The test send helper has no connection (and so no counters)
+    Telegram::Test::ClientRpcLayer clientLayer;
+    clientLayer.sendHelper()->setAuthKey(c_authKey);
+    QVERIFY(!clientLayer.sendHelper()->counters());
+    clientLayer.processPacket(sentPackagesSpy.takeFirst().first().toByteArray());
+
+    const Telegram::MTProto::Message m = clientLayer.lastProcessedMessage();
+    QCOMPARE(m.data, data);
+}
+
+void tst_RpcLayer::sendClientContainer()
+{
+    Telegram::Test::ClientRpcLayer clientLayer;
+    QSignalSpy sentPackagesSpy(clientLayer.transport(), &Telegram::Test::Transport::packetSent);
+    clientLayer.sendHelper()->setAuthKey(c_authKey);
+
+    QVector<Telegram::MTProto::Message> messages(3);
+    QVector<const Telegram::MTProto::Message *> containerMessages;
+    for (int i = 0; i < messages.count(); ++i) {
+        Telegram::MTProto::Message &message = messages[i];
+        message.messageId = clientLayer.sendHelper()->newMessageId(Telegram::SendMode::Client);
+        message.sequenceNumber = static_cast<quint32>(i * 2 + 1);
+        message.setData(QByteArray(4 * (i + 1), static_cast<char>('a' + i)));
+        containerMessages.append(&message);
+    }
+    const quint64 containerId = clientLayer.sendContainerAsClient(containerMessages);
+    QVERIFY(containerId > messages.last().messageId);
+    QCOMPARE(sentPackagesSpy.count(), 1);
+
+    Telegram::Test::ServerRpcLayer serverLayer;
+    serverLayer.sendHelper()->setAuthKey(c_authKey);
+    serverLayer.processPacket(sentPackagesSpy.takeFirst().first().toByteArray());
+    const Telegram::MTProto::Message container = serverLayer.lastProcessedMessage();
+    QCOMPARE(container.messageId, containerId);
+    QVERIFY(container.firstValue() == Telegram::TLValue::MsgContainer);
+
+    serverLayer.processMsgContainer(container.skipTLValue());
+    const QVector<Telegram::MTProto::Message> processedMessages = serverLayer.processedMessages();
+    QCOMPARE(processedMessages.count(), messages.count() + 1);
+    for (int i = 0; i < messages.count(); ++i) {
+        const Telegram::MTProto::Message &processed = processedMessages.at(i + 1);
+        QCOMPARE(processed.messageId, messages.at(i).messageId);
+        QCOMPARE(processed.sequenceNumber, messages.at(i).sequenceNumber);
+        QCOMPARE(processed.data, messages.at(i).data);
+    }
+}
+
+static QByteArray getRequestData(int index)
+{
+    Telegram::MTProto::Stream stream(Telegram::MTProto::Stream::WriteOnly);
+    stream << Telegram::TLValue::HelpGetConfig;
+    stream << static_cast<quint32>(index);
+    return stream.getData();
+}
+
+void tst_RpcLayer::batchClientRequests()
+{
+    using namespace Telegram;
+    constexpr int c_operationsCount = 3;
+
+    Test::ClientSession client;
+    Test::ServerRpcLayer serverLayer;
+    serverLayer.sendHelper()->setAuthKey(c_authKey);
+    QSignalSpy clientPacketsSpy(&client.transport, &Test::Transport::packetSent);
+    QSignalSpy serverPacketsSpy(serverLayer.transport(), &Test::Transport::packetSent);
+
+    QVector<Client::PendingRpcOperation *> operations;
+    QVector<quint64> messageIds;
+    for (int i = 0; i < c_operationsCount; ++i) {
+        Client::PendingRpcOperation *operation = new Client::PendingRpcOperation(getRequestData(i), &client.rpcLayer);
+        operations.append(operation);
+        messageIds.append(client.rpcLayer.sendRpc(operation));
+    }
+    // The requests are sent in the next event loop iteration
+    QVERIFY(clientPacketsSpy.isEmpty());
+    QCoreApplication::processEvents();
+    QCOMPARE(clientPacketsSpy.count(), 1);
+
+    quint64 containerId = 0;
+    const QVector<MTProto::Message> messages = serverLayer.receiveContainer(clientPacketsSpy.takeFirst().first().toByteArray(),
+                                                                            &containerId);
+    QCOMPARE(messages.count(), c_operationsCount);
+    for (int i = 0; i < c_operationsCount; ++i) {
+        QCOMPARE(messages.at(i).messageId, messageIds.at(i));
+        QCOMPARE(messages.at(i).data, getRequestData(i));
+    }
+
+    // Answer in the reverse order
+    for (int i = c_operationsCount - 1; i >= 0; --i) {
+        MTProto::Stream stream(MTProto::Stream::WriteOnly);
+        stream << TLValue::RpcResult;
+        stream << messageIds.at(i);
+        stream << static_cast<quint32>(0x1000 + i);
+        serverLayer.sendPackageAsServerReply(stream.getData());
+    }
+    QCOMPARE(serverPacketsSpy.count(), c_operationsCount);
+    for (const QList<QVariant> &packetArguments : serverPacketsSpy) {
+        QVERIFY(client.rpcLayer.processPacket(packetArguments.first().toByteArray()));
+    }
+
+    for (int i = 0; i < c_operationsCount; ++i) {
+        Client::PendingRpcOperation *operation = operations.at(i);
+        QVERIFY(operation->isFinished());
+        MTProto::Stream replyStream(operation->replyData());
+        quint32 reply = 0;
+        replyStream >> reply;
+        QCOMPARE(reply, static_cast<quint32>(0x1000 + i));
+    }
+}
+
+void tst_RpcLayer::resendIgnoredContainer()
+{
+    using namespace Telegram;
+
+    Test::ClientSession client;
+    Test::ServerRpcLayer serverLayer;
+    serverLayer.sendHelper()->setAuthKey(c_authKey);
+    QSignalSpy clientPacketsSpy(&client.transport, &Test::Transport::packetSent);
+    QSignalSpy serverPacketsSpy(serverLayer.transport(), &Test::Transport::packetSent);
+
+    // A content related server message to acknowledge
+    MTProto::Stream serverStream(MTProto::Stream::WriteOnly);
+    serverStream << TLValue::MsgsAck;
+    serverStream << TLVector<quint64>();
+    const quint64 serverMessageId = serverLayer.sendPackageAsServerInitiative(serverStream.getData());
+    QVERIFY(client.rpcLayer.processPacket(serverPacketsSpy.takeFirst().first().toByteArray()));
+
+    Client::PendingRpcOperation *operation1 = new Client::PendingRpcOperation(getRequestData(1), &client.rpcLayer);
+    Client::PendingRpcOperation *operation2 = new Client::PendingRpcOperation(getRequestData(2), &client.rpcLayer);
+    QSignalSpy operation1ResentSpy(operation1, &Client::PendingRpcOperation::resent);
+    QSignalSpy operation2ResentSpy(operation2, &Client::PendingRpcOperation::resent);
+    const quint64 messageId1 = client.rpcLayer.sendRpc(operation1);
+    const quint64 messageId2 = client.rpcLayer.sendRpc(operation2);
+    QCoreApplication::processEvents();
+    QCOMPARE(clientPacketsSpy.count(), 1);
+
+    quint64 containerId = 0;
+    QVector<MTProto::Message> messages = serverLayer.receiveContainer(clientPacketsSpy.takeFirst().first().toByteArray(),
+                                                                      &containerId);
+    QCOMPARE(messages.count(), 3);
+    QCOMPARE(messages.at(0).messageId, messageId1);
+    QCOMPARE(messages.at(1).messageId, messageId2);
+    QVERIFY(messages.at(2).firstValue() == TLValue::MsgsAck);
+
+    // Reject the whole container
+    MTProto::IgnoredMessageNotification notification;
+    notification.messageId = containerId;
+    notification.errorCode = MTProto::IgnoredMessageNotification::IncorrectServerSalt;
+    notification.newServerSalt = serverLayer.serverSalt();
+    TLBadMsgNotification tlNotification;
+    QVERIFY(notification.toTlNotification(&tlNotification));
+    MTProto::Stream notificationStream(MTProto::Stream::WriteOnly);
+    notificationStream << tlNotification;
+    serverLayer.sendServicePackageAsServer(notificationStream.getData());
+    QVERIFY(client.rpcLayer.processPacket(serverPacketsSpy.takeFirst().first().toByteArray()));
+
+    QCOMPARE(operation1ResentSpy.count(), 1);
+    QCOMPARE(operation2ResentSpy.count(), 1);
+    const quint64 newMessageId1 = operation1ResentSpy.first().at(1).toULongLong();
+    const quint64 newMessageId2 = operation2ResentSpy.first().at(1).toULongLong();
+    QCOMPARE(operation1ResentSpy.first().at(0).toULongLong(), messageId1);
+    QCOMPARE(operation2ResentSpy.first().at(0).toULongLong(), messageId2);
+
+    QCoreApplication::processEvents();
+    QCOMPARE(clientPacketsSpy.count(), 1);
+    quint64 newContainerId = 0;
+    messages = serverLayer.receiveContainer(clientPacketsSpy.takeFirst().first().toByteArray(), &newContainerId);
+    QVERIFY(newContainerId != containerId);
+    QCOMPARE(messages.count(), 3);
+    QCOMPARE(messages.at(0).messageId, newMessageId1);
+    QCOMPARE(messages.at(0).data, getRequestData(1));
+    QCOMPARE(messages.at(1).messageId, newMessageId2);
+    QCOMPARE(messages.at(1).data, getRequestData(2));
+
+    // The acknowledgement of the ignored container is sent again
+    QVERIFY(messages.at(2).firstValue() == TLValue::MsgsAck);
+    MTProto::Stream ackStream(messages.at(2).skipTLValue().data);
+    TLVector<quint64> acknowledgedIds;
+    ackStream >> acknowledgedIds;
+    QCOMPARE(acknowledgedIds.count(), 1);
+    QCOMPARE(acknowledgedIds.first(), serverMessageId);
+}
+
+QTEST_GUILESS_MAIN(tst_RpcLayer)
 
 #include "tst_RpcLayer.moc"
@@ -30,6 +30,7 @@ private slots:
     void basic();
     void lvalues();
     void rvalues();
+    void values();
 };
 
 struct TestClass
@@ -50,6 +51,8 @@ struct TestClass
         ++destructionCounter;
     }
 
+    bool operator==(const TestClass &other) const { return member == other.member; }
+
     int member = 0;
 
     static int constructionCounter;
@@ -219,6 +222,37 @@ void tst_UniqueLazyPointer::rvalues()
     QCOMPARE(TestClass::destructionCounter, 1);
 }
 
+void tst_UniqueLazyPointer::values()
+{
+    QScopedValueRollback<int> counter1(TestClass::constructionCounter);
+    QScopedValueRollback<int> counter2(TestClass::destructionCounter);
+
+    // A null pointer reads as the default value and is not constructed on the const access
+    const TestClassPtr nullPtr;
+    QCOMPARE((*nullPtr).member, 0);
+    QCOMPARE(nullPtr->member, 0);
+    QVERIFY(nullPtr.isNull());
+
+    // Assignment of a value
+    TestClassPtr ptr1;
+    ptr1 = TestClass(3);
+    QVERIFY(ptr1);
+    QCOMPARE(ptr1->member, 3);
+    const TestClass value(4);
+    ptr1 = value;
+    QCOMPARE(ptr1->member, 4);
+
+    // Comparison by value
+    TestClassPtr ptr2;
+    QVERIFY(ptr2 == nullPtr);
+    QVERIFY(ptr1 != ptr2);
+    ptr2 = value;
+    QVERIFY(ptr1 == ptr2);
+    ptr2->member = 0;
+    QVERIFY(ptr1 != ptr2);
+    QVERIFY(ptr2 == nullPtr);
+}
+
 QTEST_APPLESS_MAIN(tst_UniqueLazyPointer)
 
 #include "tst_UniqueLazyPointer.moc"
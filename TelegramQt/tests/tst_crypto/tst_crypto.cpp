@@ -18,6 +18,7 @@
 #include <QObject>
 #include <QTest>
 
+#include "Crypto/Aes.hpp"
 #include "Crypto/AesCtr.hpp"
 
 class tst_crypto : public QObject
@@ -25,6 +26,8 @@ class tst_crypto : public QObject
     Q_OBJECT
 private slots:
     void aesCtrContext();
+    void aesCtrContextInPlace();
+    void aesIge();
 };
 
 void tst_crypto::aesCtrContext()
@@ -93,6 +96,67 @@ void tst_crypto::aesCtrContext()
     QCOMPARE(words.toHex(), (decrypted31 + decrypted32).toHex());
 }
 
+void tst_crypto::aesCtrContextInPlace()
+{
+    const QByteArray key = QByteArray::fromHex(QByteArrayLiteral("452114b9fbd4a919a27a256821dd1e72"
+                                                                 "13c562f26f94883c4c7449b74fc8fb96"));
+    const QByteArray iv = QByteArray::fromHex(QByteArrayLiteral("d4c0727f2043d69fcc94eb639cc9486a"));
+    const QByteArray dec1 = QByteArray::fromHex(QByteArrayLiteral("c6c021e092aff8f9452114b9fbd4a919"
+                                                                  "a27a256821dd1e7213c562f26f94883c"
+                                                                  "4c7449b74fc8fb96d4c0727f2043d69f"
+                                                                  "cc94eb639cc9486aefefefef39175b65"));
+    const QByteArray enc1 = QByteArray::fromHex(QByteArrayLiteral("03d6cd84351bfb08df7faa6e2c5b727b"
+                                                                  "6db368b1880ce7d6e1ccec708fbe098a"
+                                                                  "cee6e68f6c0358efcaf9e08dfe593f16"
+                                                                  "dd484f07170c583a61b2c3998de93b24"));
+    const QByteArray words = QByteArrayLiteral("word1");
+
+    Telegram::Crypto::AesCtrContext referenceContext;
+    referenceContext.setKey(key);
+    referenceContext.setIVec(iv);
+    Telegram::Crypto::AesCtrContext inPlaceContext = referenceContext;
+
+    QByteArray buffer = dec1;
+    QVERIFY(inPlaceContext.crypt(buffer.data(), buffer.size()));
+    QCOMPARE(buffer.toHex(), enc1.toHex());
+    QCOMPARE(referenceContext.crypt(dec1).toHex(), enc1.toHex());
+    QCOMPARE(inPlaceContext.ivec().toHex(), referenceContext.ivec().toHex());
+    QCOMPARE(inPlaceContext.ecount().toHex(), referenceContext.ecount().toHex());
+
+    // Unaligned tail sizes must keep the stream state in sync
+    buffer = words;
+    QVERIFY(inPlaceContext.crypt(buffer.data(), 3));
+    QVERIFY(inPlaceContext.crypt(buffer.data() + 3, buffer.size() - 3));
+    QCOMPARE(buffer.toHex(), referenceContext.crypt(words).toHex());
+    QCOMPARE(inPlaceContext.num(), referenceContext.num());
+}
+
+void tst_crypto::aesIge()
+{
+    // The reference data is produced by OpenSSL AES_ige_encrypt()
+    QByteArray key(32, Qt::Uninitialized);
+    QByteArray iv(32, Qt::Uninitialized);
+    for (int i = 0; i < key.size(); ++i) {
+        key[i] = static_cast<char>(i);
+        iv[i] = static_cast<char>(0x20 + i);
+    }
+    const QByteArray plain = QByteArray::fromHex(QByteArrayLiteral("0104070a0d101316191c1f2225282b2e3134373a3d404346494c4f5255585b5e"
+                                                                   "6164676a6d707376797c7f8285888b8e9194979a9da0a3a6a9acafb2b5b8bbbe"
+                                                                   "c1c4c7cacdd0d3d6d9dcdfe2e5e8ebee"));
+    const QByteArray encrypted = QByteArray::fromHex(QByteArrayLiteral("be419d312d12b210faf535d11e480de0760fc8ca0703b7459f906812edb78875"
+                                                                       "32c2e6ab93c4df818cb0eea1c188480f255045266f8fb7859ebeb9d2fa8febf9"
+                                                                       "bdd4417b6a84bb127f27fe08af1f8925"));
+    const Telegram::Crypto::AesKey aesKey(key, iv);
+    QCOMPARE(Telegram::Crypto::aesEncrypt(plain, aesKey).toHex(), encrypted.toHex());
+    QCOMPARE(Telegram::Crypto::aesDecrypt(encrypted, aesKey).toHex(), plain.toHex());
+
+    // Every block depends on the previous one, so a single block must match the head of the stream
+    QCOMPARE(Telegram::Crypto::aesEncrypt(plain.left(16), aesKey).toHex(), encrypted.left(16).toHex());
+    QCOMPARE(Telegram::Crypto::aesDecrypt(encrypted.left(48), aesKey).toHex(), plain.left(48).toHex());
+
+    QVERIFY(Telegram::Crypto::aesDecrypt(encrypted.left(20), aesKey).isEmpty());
+}
+
 QTEST_APPLESS_MAIN(tst_crypto)
 
 #include "tst_crypto.moc"
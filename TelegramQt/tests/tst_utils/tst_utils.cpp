@@ -17,6 +17,7 @@
 
 #include <QObject>
 
+#include "BigNumber.hpp"
 #include "Utils.hpp"
 #include "TelegramNamespace.hpp"
 #include "RandomGenerator.hpp"
@@ -25,6 +26,11 @@
 
 #include <QTest>
 #include <QDebug>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QVector>
+
+#include <algorithm>
 
 #include "keys_data.hpp"
 
@@ -46,10 +52,45 @@ private slots:
     void testBuiltInKey();
     void testRsaKeyIsValid();
     void testDeterministicRandom();
+    void testBufferedRandom();
     void testGzipPack();
     void testGzipUnpack();
     void testGzipOnDifferentDataSizes_data();
     void testGzipOnDifferentDataSizes();
+    void testCrc32_data();
+    void testCrc32();
+    void testFindDivider();
+    void benchmarkFindDivider();
+};
+
+// Products of two 31-bit primes like the pq values sent by the servers.
+// The first one is the example from https://core.telegram.org/mtproto/samples-auth_key
+static const quint64 c_pqCorpus[] = {
+    0x17ed48941a08f981ull, // 1229739323 * 1402015859
+    0x2f7fd27dde3affafull, // 1713809417 * 1997121527
+    0x266027ab26293427ull, // 1559837401 * 1772783359
+    0x1bad4307836888f7ull, // 1218182963 * 1637130029
+    0x14c3111b19c5a93bull, // 1161609833 * 1287918083
+    0x2402717917d3ec27ull, // 1516915747 * 1710550573
+    0x1ca7364cf5d91479ull, // 1163201621 * 1774996373
+    0x3121eeae75ada737ull, // 1811274149 * 1954631339
+    0x1f07384c64b1b033ull, // 1111864951 * 2010871589
+    0x2ca244d120f12ae9ull, // 1543138231 * 2084200031
+    0x2385497291f2347bull, // 1476991811 * 1732936297
+    0x1b4e8db6d7ab214full, // 1111127387 * 1770873373
+    0x26920b2cd8f459abull, // 1590663031 * 1747256429
+    0x352c9ac855f87ed9ull, // 1826703409 * 2097553193
+    0x301f631421ba0b2dull, // 1747161707 * 1984704199
+    0x1f4af674cbee2543ull, // 1438817377 * 1567179811
+    0x38da31f2847b4cfbull, // 1911516067 * 2143137481
+    0x11f65ac8b35862fbull, // 1128305891 * 1147137289
+    0x268102ced8dc90dbull, // 1426396483 * 1945112713
+    0x29eca19587cbe559ull, // 1582125373 * 1909435981
+    0x2e1feeb90564a3d1ull, // 1655667373 * 2007430709
+    0x173b91d37bb8acc9ull, // 1244933609 * 1344723937
+    0x20a04e1d9040ce99ull, // 1382114507 * 1700991403
+    0x187e2d5bd78aaa11ull, // 1200776243 * 1469797547
+    0x215738d43fc1acb5ull, // 1240453843 * 1936751959
 };
 
 void tst_utils::initTestCase()
@@ -131,6 +172,20 @@ void tst_utils::testRsaEncryption()
     QVERIFY(privateKey.isPrivate());
     const QByteArray decodedData = Utils::binaryNumberModExp(encodedData, privateKey.modulus, privateKey.secretExponent);
     QCOMPARE(sourceData, decodedData);
+
+    const QSharedPointer<const Utils::BigNumberModulus> modulus = Utils::BigNumberModulus::get(privateKey.modulus);
+    QVERIFY(modulus->isValid());
+    QVERIFY(Utils::BigNumberModulus::get(privateKey.modulus) == modulus);
+    QCOMPARE(modulus->modExp(encodedData, privateKey.secretExponent), decodedData);
+    QCOMPARE(modulus->modExp(sourceData, privateKey.exponent), encodedData);
+
+    // Even and zero moduli are rejected instead of producing a garbage result
+    const QByteArray evenModulus = privateKey.modulus.left(privateKey.modulus.size() - 1) + char(2);
+    const Utils::BigNumberModulus invalidModulus(evenModulus);
+    QVERIFY(!invalidModulus.isValid());
+    QVERIFY(invalidModulus.modExp(sourceData, privateKey.exponent).isEmpty());
+    QVERIFY(!Utils::BigNumberModulus(QByteArray()).isValid());
+    QVERIFY(!Utils::BigNumberModulus(QByteArray(256, char(0))).isValid());
 }
 
 void tst_utils::testRsaKey()
@@ -193,6 +248,28 @@ void tst_utils::testDeterministicRandom()
              );
 }
 
+void tst_utils::testBufferedRandom()
+{
+    BufferedRandomGenerator generator;
+    QByteArray previous;
+    // Cross the buffer boundary a few times with the typical padding sizes
+    for (int i = 0; i < 100; ++i) {
+        const int size = 12 + (i * 37) % 1012;
+        const QByteArray chunk = generator.generate(size);
+        QCOMPARE(chunk.size(), size);
+        QVERIFY(chunk != previous.left(size));
+        previous = chunk;
+    }
+    const QByteArray bigChunk = generator.generate(BufferedRandomGenerator::BufferSize * 2);
+    QCOMPARE(bigChunk.size(), BufferedRandomGenerator::BufferSize * 2);
+    QVERIFY(bigChunk.left(16) != bigChunk.mid(16, 16));
+
+    // The deterministic generator still replaces the default one
+    DeterministicGenerator deterministic;
+    RandomGeneratorSetter generatorKeeper(&deterministic);
+    QCOMPARE(RandomGenerator::instance()->generate<quint32>(), 0xb7cd2516u);
+}
+
 const QByteArray c_gzipPackedData = QByteArray::fromHex(
             QByteArrayLiteral(
                 "1f8b08000000000000034be16c99c300"
@@ -314,6 +391,122 @@ void tst_utils::testGzipOnDifferentDataSizes()
     QCOMPARE(unpacked.size(), dataSizeInt);
 }
 
+void tst_utils::testCrc32_data()
+{
+    QTest::addColumn<uint>("dataSize");
+    QTest::newRow("Empty") << 0u;
+    QTest::newRow("Small") << 15u;
+    QTest::newRow("Less than a fold") << 63u;
+    QTest::newRow("One fold") << 64u;
+    QTest::newRow("Fold and tail") << 64u + 16u + 3u;
+    QTest::newRow("Big") << 4096u;
+    QTest::newRow("Big (not aligned)") << 4096u + 13u;
+}
+
+void tst_utils::testCrc32()
+{
+    QFETCH(uint, dataSize);
+    const int dataSizeInt = static_cast<int>(dataSize);
+
+    const QByteArray checkData = QByteArrayLiteral("123456789");
+    QCOMPARE(Utils::crc32(checkData.constData(), checkData.size()), 0xcbf43926u);
+
+    DeterministicGenerator deterministic;
+    RandomGeneratorSetter generatorKeeper(&deterministic);
+    const QByteArray data = RandomGenerator::instance()->generate(dataSizeInt);
+
+    // Bitwise reference implementation
+    quint32 expected = 0xffffffffu;
+    for (const char c : data) {
+        expected ^= static_cast<quint8>(c);
+        for (int bit = 0; bit < 8; ++bit) {
+            expected = (expected >> 1) ^ (0xedb88320u & (0u - (expected & 1u)));
+        }
+    }
+    expected = ~expected;
+
+    QCOMPARE(Utils::crc32(data.constData(), data.size()), expected);
+
+    // Incremental calculation
+    const int half = dataSizeInt / 2;
+    const quint32 firstHalfCrc = Utils::crc32(data.constData(), half);
+    QCOMPARE(Utils::crc32(data.constData() + half, dataSizeInt - half, firstHalfCrc), expected);
+}
+
+void tst_utils::testFindDivider()
+{
+    for (const quint64 pq : c_pqCorpus) {
+        const quint64 divider = Utils::findDivider(pq);
+        QVERIFY2((divider > 1) && (divider < pq), QByteArray::number(pq).constData());
+        QCOMPARE(pq % divider, 0ull);
+    }
+    QCOMPARE(Utils::findDivider(15), 3ull);
+    QCOMPARE(Utils::findDivider(1000036000099ull) % 1000003ull, 0ull); // 1000003 * 1000033
+    QCOMPARE(Utils::findDivider(1000000007ull), 1ull); // Prime
+}
+
+// Optional file with the pq values recorded from the handshakes with the real servers (e.g. the "PQ:"
+// values of the "telegram.client.dhlayer" debug output) to benchmark instead of c_pqCorpus.
+// The file has a value per line (decimal or 0x-prefixed hex), the lines starting with '#' are ignored.
+static const char *c_pqSamplesEnvironmentVariable = "TELEGRAM_PQ_SAMPLES";
+
+static QVector<quint64> readRecordedPqSamples(const QString &fileName)
+{
+    QVector<quint64> samples;
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        qWarning() << "Unable to open the pq samples file" << fileName;
+        return samples;
+    }
+    while (!file.atEnd()) {
+        const QByteArray line = file.readLine().trimmed();
+        if (line.isEmpty() || line.startsWith('#')) {
+            continue;
+        }
+        bool ok = false;
+        const quint64 pq = line.toULongLong(&ok, 0);
+        if (!ok || (pq < 4)) {
+            qWarning() << "Invalid pq sample" << line;
+            continue;
+        }
+        samples.append(pq);
+    }
+    return samples;
+}
+
+void tst_utils::benchmarkFindDivider()
+{
+    QVector<quint64> samples;
+    if (qEnvironmentVariableIsSet(c_pqSamplesEnvironmentVariable)) {
+        samples = readRecordedPqSamples(QString::fromLocal8Bit(qgetenv(c_pqSamplesEnvironmentVariable)));
+        QVERIFY2(!samples.isEmpty(), "There are no pq values in the samples file");
+    } else {
+        for (const quint64 pq : c_pqCorpus) {
+            samples.append(pq);
+        }
+    }
+    QVector<qint64> latencies;
+    latencies.reserve(samples.count());
+    QBENCHMARK_ONCE {
+        QElapsedTimer timer;
+        for (const quint64 pq : samples) {
+            timer.start();
+            const quint64 divider = Utils::findDivider(pq);
+            latencies.append(timer.nsecsElapsed());
+            QVERIFY(divider > 1);
+        }
+    }
+    std::sort(latencies.begin(), latencies.end());
+    const auto percentile = [&latencies](int p) {
+        return latencies.at(qMin(latencies.count() - 1, latencies.count() * p / 100)) / 1000;
+    };
+    qInfo().nospace() << "findDivider() latency over " << latencies.count() << " pq values (us):"
+                      << " p50 " << percentile(50)
+                      << " p90 " << percentile(90)
+                      << " p99 " << percentile(99)
+                      << " max " << latencies.last() / 1000;
+}
+
 QTEST_APPLESS_MAIN(tst_utils)
 
 #include "tst_utils.moc"
@@ -530,7 +530,15 @@ QString Generator::generateTLTypeDefinition(const TLType &type, bool addSpecSour
 
     const QString constructor = QStringLiteral("%1() = default;\n\n").arg(type.getName());
     const QString constExprSpace = QStringLiteral("constexpr ");
-    if (constExprType) {
+    if (type.isCompact()) {
+        // The union members are constructed and destructed according to the tlType
+        code.append(spacing + QStringLiteral("%1();\n").arg(type.getName()));
+        code.append(spacing + QStringLiteral("%1(const %1 &v);\n").arg(type.getName()));
+        code.append(spacing + QStringLiteral("%1(%1 &&v);\n").arg(type.getName()));
+        code.append(spacing + QStringLiteral("~%1();\n").arg(type.getName()));
+        code.append(spacing + QStringLiteral("%1 &operator=(const %1 &v);\n").arg(type.getName()));
+        code.append(spacing + QStringLiteral("%1 &operator=(%1 &&v);\n\n").arg(type.getName()));
+    } else if (constExprType) {
         code.append(spacing + constExprSpace + constructor);
     } else {
         code.append(spacing + constructor);
@@ -557,6 +565,12 @@ QString Generator::generateTLTypeDefinition(const TLType &type, bool addSpecSour
     code.append(QLatin1Char('\n'));
     const QString members = joinLinesWithPrepend(generateTLTypeMembers(type), spacing, QStringLiteral("\n"));
     code.append(members);
+    if (type.isCompact()) {
+        code.append(QLatin1Char('\n'));
+        code.append(joinLinesWithPrepend(generateTLTypeCompactMemberEnum(type), spacing, QStringLiteral("\n")));
+        code.append(QLatin1String("\nprivate:\n"));
+        code.append(joinLinesWithPrepend(generateTLTypeCompactDeclarations(type), spacing, QStringLiteral("\n")));
+    }
     code.append(QString("};\n\n"));
 
     return code;
@@ -667,6 +681,10 @@ QString Generator::generateTLTypeMethods(const TLType &type)
     stream << "}" << endl;
     stream << endl;
 
+    if (type.isCompact()) {
+        stream << generateTLTypeCompactMethods(type);
+    }
+
     return result;
 }
 
@@ -743,12 +761,23 @@ QStringList Generator::generateTLTypeMemberGetters(const TLType &type)
     return memberGetters;
 }
 
-QStringList Generator::generateTLTypeMembers(const TLType &type)
+static QString memberTypeName(const TLParam &member)
 {
-    QStringList membersCode;
+    if (!member.accessByPointer()) {
+        return member.type();
+    }
+    if (member.isVector()) {
+        return QStringLiteral("%1<%2*>").arg(tlVectorType, member.bareType());
+    }
+    return member.type() + QLatin1String("Ptr");
+}
+
+static QList<TLParam> typeMembersWithData(const TLType &type)
+{
+    QList<TLParam> members;
     QStringList addedMembers;
-    foreach (const TLSubType &subType, type.subTypes) {
-        foreach (const TLParam &member, subType.members) {
+    for (const TLSubType &subType : type.subTypes) {
+        for (const TLParam &member : subType.members) {
             if (addedMembers.contains(member.getAlias())) {
                 continue;
             }
@@ -756,24 +785,290 @@ QStringList Generator::generateTLTypeMembers(const TLType &type)
             if (!member.hasData()) {
                 continue; // No extra data behind the flag
             }
-            if (member.accessByPointer()) {
-                if (member.isVector()) {
-                    membersCode.append(QStringLiteral("%1<%2*> %3;").arg(tlVectorType, member.bareType(), member.getAlias()));
-                } else {
-                    membersCode.append(QStringLiteral("%1Ptr %2;").arg(member.type(), member.getAlias()));
-                }
+            members.append(member);
+        }
+    }
+    return members;
+}
+
+static bool isCompactMember(const TLType &type, const QString &alias)
+{
+    for (const QStringList &slotMembers : type.compactSlots) {
+        if (slotMembers.contains(alias)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static QString compactMemberEnumName(const QString &alias)
+{
+    QString name = alias;
+    name[0] = name.at(0).toUpper();
+    return name + QLatin1String("Member");
+}
+
+QStringList Generator::generateTLTypeMembers(const TLType &type)
+{
+    QStringList membersCode;
+    QHash<QString, QString> memberTypes;
+    for (const TLParam &member : typeMembersWithData(type)) {
+        const QString typeName = memberTypeName(member);
+        memberTypes.insert(member.getAlias(), typeName);
+        if (isCompactMember(type, member.getAlias())) {
+            continue;
+        }
+        if (!member.accessByPointer() && podTypes.contains(member.type())) {
+            const QString initialValue = initTypesValues.at(podTypes.indexOf(member.type()));
+            membersCode.append(QStringLiteral("%1 %2 = %3;").arg(typeName, member.getAlias(), initialValue));
+        } else {
+            membersCode.append(QStringLiteral("%1 %2;").arg(typeName, member.getAlias()));
+        }
+    }
+    if (!type.isCompact()) {
+        membersCode.append(QStringLiteral("%1 %2 = %1::%3;").arg(tlValueName, tlTypeMember, type.subTypes.first().getName()));
+        return membersCode;
+    }
+
+    // union {
+    //     TLMessage message;
+    //     TLUserStatus status;
+    // };
+    // TLCompactValue<TLUpdate> tlType { this, TLValue::UpdateNewMessage };
+    membersCode.append(QStringLiteral("// Only the union members used by the current tlType are constructed"));
+    for (const QStringList &slotMembers : type.compactSlots) {
+        membersCode.append(QStringLiteral("union {"));
+        for (const QString &alias : slotMembers) {
+            membersCode.append(spacing + QStringLiteral("%1 %2;").arg(memberTypes.value(alias), alias));
+        }
+        membersCode.append(QStringLiteral("};"));
+    }
+    membersCode.append(QStringLiteral("TLCompactValue<%1> %2 { this, %3::%4 };").arg(type.getName(), tlTypeMember, tlValueName, type.subTypes.first().getName()));
+    return membersCode;
+}
+
+QStringList Generator::generateTLTypeCompactMemberEnum(const TLType &type)
+{
+    QStringList code;
+    code.append(QStringLiteral("// The union members. Only the members used by the current tlType are constructed,"));
+    code.append(QStringLiteral("// so check the member before the access if the tlType is not known for sure."));
+    code.append(QStringLiteral("enum Member : quint8 {"));
+    code.append(spacing + QStringLiteral("NoMember,"));
+    for (const QStringList &slotMembers : type.compactSlots) {
+        for (const QString &alias : slotMembers) {
+            code.append(spacing + compactMemberEnumName(alias) + QLatin1Char(','));
+        }
+    }
+    code.append(QStringLiteral("};"));
+    code.append(QStringLiteral("bool hasMember(Member member) const;"));
+    return code;
+}
+
+QStringList Generator::generateTLTypeCompactDeclarations(const TLType &type)
+{
+    QStringList code;
+    code.append(QStringLiteral("friend class TLCompactValue<%1>;").arg(type.getName()));
+    code.append(QStringLiteral("enum { SlotCount = %1 };").arg(type.compactSlots.count()));
+    code.append(QStringLiteral("static Member slotMember(quint32 value, int slot);"));
+    code.append(QStringLiteral("void setTlType(TLValue value);"));
+    code.append(QStringLiteral("void constructMember(Member member);"));
+    code.append(QStringLiteral("void copyMember(Member member, const %1 &v);").arg(type.getName()));
+    code.append(QStringLiteral("void moveMember(Member member, %1 &v);").arg(type.getName()));
+    code.append(QStringLiteral("void destroyMember(Member member);"));
+    return code;
+}
+
+QString Generator::generateTLTypeCompactMethods(const TLType &type)
+{
+    const QString typeName = type.getName();
+    QHash<QString, QString> memberTypes;
+    QStringList inlineMembers;
+    QStringList plainInlineMembers;
+    for (const TLParam &member : typeMembersWithData(type)) {
+        memberTypes.insert(member.getAlias(), memberTypeName(member));
+        if (isCompactMember(type, member.getAlias())) {
+            continue;
+        }
+        inlineMembers.append(member.getAlias());
+        if (!member.accessByPointer() && podTypes.contains(member.type())) {
+            plainInlineMembers.append(member.getAlias());
+        }
+    }
+
+    auto forEachSlot = [](const QString &statement) {
+        return QStringLiteral("    for (int slot = 0; slot < SlotCount; ++slot) {\n"
+                              "        %1\n"
+                              "    }\n").arg(statement);
+    };
+
+    QString result;
+    QTextStream stream(&result, QIODevice::WriteOnly);
+
+    stream << typeName << "::" << typeName << "()" << endl;
+    stream << "{" << endl;
+    stream << forEachSlot(QStringLiteral("constructMember(slotMember(tlType, slot));"));
+    stream << "}" << endl;
+    stream << endl;
+
+    const QStringList constructorKinds = { QStringLiteral("const %1 &v"), QStringLiteral("%1 &&v") };
+    for (const QString &kind : constructorKinds) {
+        const bool move = kind.contains(QLatin1String("&&"));
+        stream << typeName << "::" << typeName << "(" << kind.arg(typeName) << ") :" << endl;
+        for (const QString &alias : inlineMembers) {
+            if (move && !plainInlineMembers.contains(alias)) {
+                stream << "    " << alias << "(std::move(v." << alias << "))," << endl;
             } else {
-                if (podTypes.contains(member.type())) {
-                    const QString initialValue = initTypesValues.at(podTypes.indexOf(member.type()));
-                    membersCode.append(QStringLiteral("%1 %2 = %3;").arg(member.type(), member.getAlias(), initialValue));
-                } else {
-                    membersCode.append(QStringLiteral("%1 %2;").arg(member.type(), member.getAlias()));
+                stream << "    " << alias << "(v." << alias << ")," << endl;
+            }
+        }
+        stream << "    " << tlTypeMember << "(this, v." << tlTypeMember << ")" << endl;
+        stream << "{" << endl;
+        stream << forEachSlot(QStringLiteral("%1(slotMember(tlType, slot), v);").arg(move ? QLatin1String("moveMember") : QLatin1String("copyMember")));
+        stream << "}" << endl;
+        stream << endl;
+    }
+
+    stream << typeName << "::~" << typeName << "()" << endl;
+    stream << "{" << endl;
+    stream << forEachSlot(QStringLiteral("destroyMember(slotMember(tlType, slot));"));
+    stream << "}" << endl;
+    stream << endl;
+
+    for (const QString &kind : constructorKinds) {
+        const bool move = kind.contains(QLatin1String("&&"));
+        stream << typeName << " &" << typeName << "::operator=(" << kind.arg(typeName) << ")" << endl;
+        stream << "{" << endl;
+        stream << "    if (this == &v) {" << endl;
+        stream << "        return *this;" << endl;
+        stream << "    }" << endl;
+        stream << forEachSlot(QStringLiteral("destroyMember(slotMember(tlType, slot));"));
+        for (const QString &alias : inlineMembers) {
+            if (move && !plainInlineMembers.contains(alias)) {
+                stream << "    " << alias << " = std::move(v." << alias << ");" << endl;
+            } else {
+                stream << "    " << alias << " = v." << alias << ";" << endl;
+            }
+        }
+        stream << "    " << tlTypeMember << ".setValue(v." << tlTypeMember << ");" << endl;
+        stream << forEachSlot(QStringLiteral("%1(slotMember(tlType, slot), v);").arg(move ? QLatin1String("moveMember") : QLatin1String("copyMember")));
+        stream << "    return *this;" << endl;
+        stream << "}" << endl;
+        stream << endl;
+    }
+
+    // TLUpdate::Member TLUpdate::slotMember(quint32 value, int slot)
+    // {
+    //     switch (value) {
+    //     case TLValue::UpdateNewMessage:
+    //     case TLValue::UpdateEditMessage: {
+    //         static const Member members[SlotCount] = { MessageMember, NoMember };
+    //         return members[slot];
+    //     }
+    //     default:
+    //         return NoMember;
+    //     }
+    // }
+    QStringList layouts;
+    QHash<QString, int> layoutIndices;
+    for (const TLSubType &subType : type.subTypes) {
+        QStringList slotMembers;
+        bool hasMembers = false;
+        for (const QStringList &slot : type.compactSlots) {
+            QString slotMember = QStringLiteral("NoMember");
+            for (const TLParam &member : subType.members) {
+                if (member.hasData() && slot.contains(member.getAlias())) {
+                    slotMember = compactMemberEnumName(member.getAlias());
+                    hasMembers = true;
+                    break;
                 }
             }
+            slotMembers.append(slotMember);
         }
+        if (!hasMembers) {
+            continue;
+        }
+        const QString layout = slotMembers.join(QLatin1String(", "));
+        if (!layouts.contains(layout)) {
+            layouts.append(layout);
+        }
+        layoutIndices.insert(subType.getName(), layouts.indexOf(layout));
     }
-    membersCode.append(QStringLiteral("%1 %2 = %1::%3;").arg(tlValueName, tlTypeMember, type.subTypes.first().getName()));
-    return membersCode;
+
+    stream << typeName << "::Member " << typeName << "::slotMember(quint32 value, int slot)" << endl;
+    stream << "{" << endl;
+    stream << "    switch (value) {" << endl;
+    for (int i = 0; i < layouts.count(); ++i) {
+        QStringList cases;
+        for (const TLSubType &subType : type.subTypes) {
+            if (layoutIndices.value(subType.getName(), -1) == i) {
+                cases.append(QStringLiteral("    case %1::%2:").arg(tlValueName, subType.getName()));
+            }
+        }
+        cases.last().append(QLatin1String(" {"));
+        stream << cases.join(QLatin1Char('\n')) << endl;
+        stream << "        static const Member members[SlotCount] = { " << layouts.at(i) << " };" << endl;
+        stream << "        return members[slot];" << endl;
+        stream << "    }" << endl;
+    }
+    stream << "    default:" << endl;
+    stream << "        return NoMember;" << endl;
+    stream << "    }" << endl;
+    stream << "}" << endl;
+    stream << endl;
+
+    stream << "bool " << typeName << "::hasMember(Member member) const" << endl;
+    stream << "{" << endl;
+    stream << forEachSlot(QStringLiteral("if (slotMember(tlType, slot) == member) {\n"
+                                         "            return true;\n"
+                                         "        }"));
+    stream << "    return false;" << endl;
+    stream << "}" << endl;
+    stream << endl;
+
+    stream << "void " << typeName << "::setTlType(TLValue value)" << endl;
+    stream << "{" << endl;
+    stream << "    // Keep the members shared by the previous and the new constructors" << endl;
+    stream << "    for (int slot = 0; slot < SlotCount; ++slot) {" << endl;
+    stream << "        const Member previousMember = slotMember(tlType, slot);" << endl;
+    stream << "        const Member newMember = slotMember(value, slot);" << endl;
+    stream << "        if (previousMember != newMember) {" << endl;
+    stream << "            destroyMember(previousMember);" << endl;
+    stream << "            constructMember(newMember);" << endl;
+    stream << "        }" << endl;
+    stream << "    }" << endl;
+    stream << "    " << tlTypeMember << ".setValue(value);" << endl;
+    stream << "}" << endl;
+    stream << endl;
+
+    struct MemberFunction {
+        QString signature;
+        QString statement;
+    };
+    const QList<MemberFunction> memberFunctions = {
+        { QStringLiteral("constructMember(Member member)"), QStringLiteral("new (&%1) %2();") },
+        { QStringLiteral("copyMember(Member member, const %1 &v)").arg(typeName), QStringLiteral("new (&%1) %2(v.%1);") },
+        { QStringLiteral("moveMember(Member member, %1 &v)").arg(typeName), QStringLiteral("new (&%1) %2(std::move(v.%1));") },
+        { QStringLiteral("destroyMember(Member member)"), QStringLiteral("%1.~%2();") },
+    };
+    for (const MemberFunction &function : memberFunctions) {
+        stream << "void " << typeName << "::" << function.signature << endl;
+        stream << "{" << endl;
+        stream << "    switch (member) {" << endl;
+        for (const QStringList &slotMembers : type.compactSlots) {
+            for (const QString &alias : slotMembers) {
+                stream << "    case " << compactMemberEnumName(alias) << ":" << endl;
+                stream << "        " << function.statement.arg(alias, memberTypes.value(alias)) << endl;
+                stream << "        break;" << endl;
+            }
+        }
+        stream << "    case NoMember:" << endl;
+        stream << "        break;" << endl;
+        stream << "    }" << endl;
+        stream << "}" << endl;
+        stream << endl;
+    }
+
+    return result;
 }
 
 QString Generator::streamReadImplementationHead(const TypedEntity *type)
@@ -791,7 +1086,7 @@ QString Generator::streamReadImplementationEnd(const QString &argName)
 {
     QString code;
     code.append(QString("%1default:\n%1%1break;\n%1}\n\n").arg(spacing));
-    code.append(QString("%1%2 = result;\n\n%1return *this;\n}\n\n").arg(spacing, argName));
+    code.append(QString("%1%2 = std::move(result);\n\n%1return *this;\n}\n\n").arg(spacing, argName));
     return code;
 }
 
@@ -807,11 +1102,8 @@ QString Generator::streamReadPerTypeImplementation(const TypedEntity *type, cons
             code.append(doubleSpacing + spacing + QString("*this >> result.%1;\n").arg(member.getAlias()));
             code.append(doubleSpacing + QLatin1Literal("}\n"));
         } else {
-            if (member.accessByPointer() && !member.isVector()) {
-                code.append(doubleSpacing + QString("*this >> *result.%1;\n").arg(member.getAlias()));
-            } else {
-                code.append(doubleSpacing + QString("*this >> result.%1;\n").arg(member.getAlias()));
-            }
+            // The pointer members are read via the TLPtr operator to allocate from the stream arena
+            code.append(doubleSpacing + QString("*this >> result.%1;\n").arg(member.getAlias()));
         }
     }
     code.append(QString("%1break;\n").arg(doubleSpacing));
@@ -1052,6 +1344,145 @@ QString Generator::streamWriteVectorTemplate(const QString &type)
     return QString(QLatin1String("template %1 &%1::operator<<(const TLVector<%2> &v);")).arg(streamClassName).arg(type);
 }
 
+QString Generator::serializedSizeImplementationHead(const TypedEntity *type)
+{
+    const QString argName = type->variableName();
+    const QString typeName = type->getName();
+    QString code;
+    code.append(QString("quint32 serializedSize(const %1 &%2)\n{\n").arg(typeName, argName));
+    code.append(QString("%1quint32 size = serializedSize(%2.tlType);\n\n%1switch (%2.tlType) {\n").arg(spacing, argName));
+    return code;
+}
+
+QString Generator::serializedSizeImplementationEnd(const QString &argName)
+{
+    Q_UNUSED(argName)
+    QString code;
+    code.append(QString("%1default:\n%1%1break;\n%1}\n\n").arg(spacing));
+    code.append(spacing + QStringLiteral("return size;\n}\n\n"));
+    return code;
+}
+
+QString Generator::serializedSizePerTypeImplementation(const TypedEntity *type, const TLSubType &subType)
+{
+    // Mirrors streamWritePerTypeImplementationBase()
+    const QString argName = type->variableName();
+    QString code;
+    foreach (const TLParam &member, subType.members) {
+        if (member.dependOnFlag()) {
+            if (member.type() == tlTrueType) {
+                continue;
+            }
+            code.append(doubleSpacing + QString("if (%1.%2 & %3::%4) {\n").arg(argName, member.flagMember, type->getName(), member.flagName()));
+            code.append(doubleSpacing + spacing + QString("size += serializedSize(%1.%2);\n").arg(argName, member.getAlias()));
+            code.append(doubleSpacing + QLatin1Literal("}\n"));
+        } else {
+            if (member.accessByPointer() && !member.isVector()) {
+                code.append(doubleSpacing + QString("size += serializedSize(*%1.%2);\n").arg(argName, member.getAlias()));
+            } else {
+                code.append(doubleSpacing + QString("size += serializedSize(%1.%2);\n").arg(argName, member.getAlias()));
+            }
+        }
+    }
+    code.append(QString("%1break;\n").arg(doubleSpacing));
+    return code;
+}
+
+QString Generator::serializedSizeDeclaration(const TypedEntity *type)
+{
+    // TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLAccountDaysTTL &accountDaysTTLValue);
+    QString result;
+    QTextStream stream(&result);
+    stream << c_internalExportMacro << " quint32 serializedSize(const "
+           << type->getEntityTLType() << " &" << type->variableName() << ");" << endl;
+    return result;
+}
+
+QString Generator::serializedSizeDefinition(const TLType *type)
+{
+    return generateStreamOperatorDefinition(type, serializedSizeImplementationHead, serializedSizePerTypeImplementation, serializedSizeImplementationEnd);
+}
+
+QStringList Generator::skipFlagMembers(const TLSubType &subType)
+{
+    // The flag members which have to be read to know the rest of the value layout
+    QStringList flagMembers;
+    foreach (const TLParam &member, subType.members) {
+        if (member.hasData() && member.dependOnFlag() && !flagMembers.contains(member.flagMember)) {
+            flagMembers.append(member.flagMember);
+        }
+    }
+    return flagMembers;
+}
+
+QString Generator::skipImplementationHead(const TLType *type)
+{
+    QStringList flagMembers;
+    foreach (const TLSubType &subType, type->subTypes) {
+        foreach (const QString &flagMember, skipFlagMembers(subType)) {
+            if (!flagMembers.contains(flagMember)) {
+                flagMembers.append(flagMember);
+            }
+        }
+    }
+    QString code;
+    code.append(QString("%1 &%1::skipValue(%2 *)\n{\n").arg(streamClassName, type->getName()));
+    code.append(QString("%1%2 %3;\n").arg(spacing, tlValueName, tlTypeMember));
+    foreach (const QString &flagMember, flagMembers) {
+        code.append(QString("%1quint32 %2 = 0;\n").arg(spacing, flagMember));
+    }
+    code.append(QString("\n%1*this >> %2;\n\n%1switch (%2) {\n").arg(spacing, tlTypeMember));
+    return code;
+}
+
+QString Generator::skipImplementationEnd(const QString &argName)
+{
+    Q_UNUSED(argName)
+    QString code;
+    code.append(QString("%1default:\n%1%1// The value size is unknown\n%1%1setError(true);\n%1%1break;\n%1}\n\n").arg(spacing));
+    code.append(spacing + QStringLiteral("return *this;\n}\n\n"));
+    return code;
+}
+
+QString Generator::skipPerTypeImplementation(const TypedEntity *type, const TLSubType &subType)
+{
+    // Mirrors streamReadPerTypeImplementation(), but reads only the flag members
+    const QStringList flagMembers = skipFlagMembers(subType);
+    QString code;
+    foreach (const TLParam &member, subType.members) {
+        if (member.dependOnFlag()) {
+            if (member.type() == tlTrueType) {
+                continue;
+            }
+            code.append(doubleSpacing + QString("if (%1 & %2::%3) {\n").arg(member.flagMember, type->getName(), member.flagName()));
+            code.append(doubleSpacing + spacing + QString("skip<%1>();\n").arg(member.type()));
+            code.append(doubleSpacing + QLatin1Literal("}\n"));
+        } else if (flagMembers.contains(member.getAlias())) {
+            code.append(doubleSpacing + QString("*this >> %1;\n").arg(member.getAlias()));
+        } else {
+            code.append(doubleSpacing + QString("skip<%1>();\n").arg(member.type()));
+        }
+    }
+    code.append(QString("%1break;\n").arg(doubleSpacing));
+    return code;
+}
+
+QString Generator::skipDeclaration(const TypedEntity *type)
+{
+    QString result;
+    QTextStream stream(&result);
+    stream << spacing << streamClassName << " &skipValue(" << type->getEntityTLType() << " *);" << endl;
+    return result;
+}
+
+QString Generator::skipDefinition(const TLType *type)
+{
+    return generateStreamOperatorDefinition(type,
+                                            [type](const TypedEntity *) { return skipImplementationHead(type); },
+                                            skipPerTypeImplementation,
+                                            skipImplementationEnd);
+}
+
 QStringList Generator::generateRpcReplyTemplates(const QString &groupName) const
 {
     QString targetPrefix = groupName;
@@ -1373,16 +1804,110 @@ QStringList Generator::serverRpcFactoryIncludes() const
     return result;
 }
 
-QStringList Generator::serverRpcFactoryInitialization() const
+QString Generator::generateServerRpcDispatchTable() const
 {
-    QStringList result;
+    struct DispatchFunction {
+        quint32 id;
+        QString entry;
+    };
+    QVector<DispatchFunction> functions;
     for (const QString &group : functionGroups()) {
-        const QString firstCapital = formatName(group, Generator::FormatOption::UpperCaseFirstLetter);
-        result << QStringLiteral("new %1OperationFactory(),").arg(firstCapital);
+        const QString prefixFirstUpper = formatName(group, FormatOption::UpperCaseFirstLetter);
+        for (const TLMethod &method : m_functions) {
+            if (!method.getName().startsWith(group)) {
+                continue;
+            }
+            // { TLValue::AuthSendCode, &processRpcFunction<AuthRpcOperation, &AuthRpcOperation::processSendCode>,
+            //   AuthOperationFactory::needLocalUser() },
+            const QString entry = QStringLiteral("{ %1::%2%3, &processRpcFunction<%2RpcOperation, &%2RpcOperation::process%3>,\n"
+                                                 "      %2OperationFactory::needLocalUser() },\n")
+                    .arg(tlValueName, prefixFirstUpper, method.nameFromSecondWord());
+            functions.append({ method.predicateId, entry });
+        }
+    }
+
+    int tableSize = 1;
+    while (tableSize < functions.count()) {
+        tableSize *= 2;
     }
+    const int bucketCount = qMax(1, tableSize / 4);
+    QVector<QVector<int>> buckets(bucketCount);
+    for (int i = 0; i < functions.count(); ++i) {
+        buckets[static_cast<int>(rpcDispatchHash(functions.at(i).id, 0) & quint32(bucketCount - 1))].append(i);
+    }
+
+    // Place the largest buckets first while the table has more free slots
+    QVector<int> bucketOrder;
+    for (int i = 0; i < bucketCount; ++i) {
+        bucketOrder.append(i);
+    }
+    std::stable_sort(bucketOrder.begin(), bucketOrder.end(), [&buckets](int b1, int b2) {
+        return buckets.at(b1).count() > buckets.at(b2).count();
+    });
+
+    QVector<int> slots(tableSize, -1);
+    QVector<quint32> seeds(bucketCount, 0);
+    for (int bucket : bucketOrder) {
+        const QVector<int> &items = buckets.at(bucket);
+        if (items.isEmpty()) {
+            continue;
+        }
+        // The table size is not less than the functions count, so a seed always exists
+        for (quint32 seed = 1; ; ++seed) {
+            QVector<int> itemSlots;
+            for (int item : items) {
+                const int slot = static_cast<int>(rpcDispatchHash(functions.at(item).id, seed) & quint32(tableSize - 1));
+                if ((slots.at(slot) >= 0) || itemSlots.contains(slot)) {
+                    break;
+                }
+                itemSlots.append(slot);
+            }
+            if (itemSlots.count() != items.count()) {
+                continue;
+            }
+            for (int i = 0; i < items.count(); ++i) {
+                slots[itemSlots.at(i)] = items.at(i);
+            }
+            seeds[bucket] = seed;
+            break;
+        }
+    }
+
+    QString result;
+    result += QStringLiteral("static const int c_dispatchFunctionCount = %1;\n").arg(functions.count());
+    result += QStringLiteral("static const int c_dispatchTableSize = %1;\n").arg(tableSize);
+    result += QStringLiteral("static const int c_dispatchBucketCount = %1;\n\n").arg(bucketCount);
+
+    result += QStringLiteral("static const quint32 c_dispatchSeeds[c_dispatchBucketCount] = {\n");
+    const int seedsPerLine = 16;
+    for (int i = 0; i < bucketCount; i += seedsPerLine) {
+        QStringList line;
+        for (int j = i; j < qMin(i + seedsPerLine, bucketCount); ++j) {
+            line.append(QString::number(seeds.at(j)) + QLatin1Char(','));
+        }
+        result += spacing + line.join(QLatin1Char(' ')) + QLatin1Char('\n');
+    }
+    result += QStringLiteral("};\n\n");
+
+    result += QStringLiteral("static const RpcFunctionEntry c_dispatchTable[c_dispatchTableSize] = {\n");
+    for (int slot : slots) {
+        if (slot < 0) {
+            result += spacing + QStringLiteral("{ 0, nullptr, false },\n");
+        } else {
+            result += spacing + functions.at(slot).entry;
+        }
+    }
+    result += QStringLiteral("};\n");
     return result;
 }
 
+quint32 Generator::rpcDispatchHash(quint32 function, quint32 seed)
+{
+    // Keep in sync with Telegram::Server::RpcOperationDispatch::hash()
+    const quint32 value = (function ^ seed) * 0x85ebca6bu;
+    return value ^ (value >> 16);
+}
+
 Generator::MethodsCode Generator::generateServerRpcProcessMethods(const QString &groupName) const
 {
     const QString prefixFirstUpper = formatName(groupName, FormatOption::UpperCaseFirstLetter);
@@ -2038,15 +2563,191 @@ bool Generator::loadFromText(const QByteArray &data)
 
 bool Generator::resolveTypes()
 {
+    if (!applySubset()) {
+        return false;
+    }
+
     QMap<QString, TLType> unresolved;
     m_solvedTypes = solveTypes(m_types, &unresolved);
 
     if (!unresolved.isEmpty()) {
         qDebug() << "Unresolved:" << unresolved.count() << unresolved;
     }
+    bakeCompactTypes();
     return unresolved.isEmpty() && !m_solvedTypes.isEmpty();
 }
 
+void Generator::bakeCompactTypes()
+{
+    // Put the constructor-specific members of the compact types to unions, so a value constructs
+    // only the members of its own constructor instead of the members of all of them.
+    for (TLType &type : m_solvedTypes) {
+        type.compactSlots.clear();
+        if (!m_compactTypes.contains(type.getName())) {
+            continue;
+        }
+        QHash<QString, QStringList> memberSubTypes;
+        QStringList structMembers;
+        QStringList otherMembers;
+        for (const TLSubType &subType : type.subTypes) {
+            for (const TLParam &member : subType.members) {
+                if (!member.hasData() || podTypes.contains(member.type())) {
+                    continue; // Cheap to construct inline
+                }
+                if (!memberSubTypes.contains(member.getAlias())) {
+                    if (member.isVector() || nativeTypes.contains(member.type())) {
+                        otherMembers.append(member.getAlias());
+                    } else {
+                        structMembers.append(member.getAlias());
+                    }
+                }
+                memberSubTypes[member.getAlias()].append(subType.getName());
+            }
+        }
+
+        // Place the (usually larger) struct members first to keep them in the same unions
+        for (const QString &alias : structMembers + otherMembers) {
+            const QStringList subTypes = memberSubTypes.value(alias);
+            if (subTypes.count() == type.subTypes.count()) {
+                continue; // The member is used by every constructor
+            }
+            int slot = 0;
+            for (; slot < type.compactSlots.count(); ++slot) {
+                bool sharedSubType = false;
+                for (const QString &slotMember : type.compactSlots.at(slot)) {
+                    for (const QString &subType : subTypes) {
+                        if (memberSubTypes.value(slotMember).contains(subType)) {
+                            sharedSubType = true;
+                            break;
+                        }
+                    }
+                    if (sharedSubType) {
+                        break;
+                    }
+                }
+                if (!sharedSubType) {
+                    break;
+                }
+            }
+            if (slot == type.compactSlots.count()) {
+                type.compactSlots.append(QStringList());
+            }
+            type.compactSlots[slot].append(alias);
+        }
+        qCDebug(c_loggingTypes) << "Compact type" << type.getName() << "unions:" << type.compactSlots;
+    }
+}
+
+bool Generator::applySubset()
+{
+    // Keep only the subset functions and the types reachable from them (and from the root types
+    // of the subset). The types of the MTProto service part of the scheme are always kept.
+    if (m_subset.isEmpty()) {
+        return true;
+    }
+
+    QStringList functionNames;
+    QStringList usedTypes;
+    for (const QString &name : m_subset) {
+        const QString functionName = removeSeparators(name);
+        if (m_functions.contains(functionName)) {
+            functionNames.append(functionName);
+            continue;
+        }
+        const QString typeName = m_types.contains(name) ? name : formatType(name);
+        if (m_types.contains(typeName)) {
+            usedTypes.append(typeName);
+            continue;
+        }
+        qCWarning(c_loggingTypes) << "Subset item" << name << "is neither a function nor a type";
+        return false;
+    }
+
+    int apiTypesGroup = -1;
+    for (int i = 0; i < m_groups.count(); ++i) {
+        if (!m_groups.at(i).isEmpty() && m_types.contains(m_groups.at(i).first())) {
+            apiTypesGroup = i;
+        }
+    }
+    for (int i = 0; i < apiTypesGroup; ++i) {
+        for (const QString &typeName : m_groups.at(i)) {
+            if (m_types.contains(typeName) && !usedTypes.contains(typeName)) {
+                usedTypes.append(typeName);
+            }
+        }
+    }
+
+    const auto addType = [this, &usedTypes](const QString &type) {
+        QString bareType = getTypeOrVectorType(type);
+        if (bareType.endsWith(QLatin1Char('*'))) {
+            bareType.chop(1);
+        }
+        if (m_types.contains(bareType) && !usedTypes.contains(bareType)) {
+            usedTypes.append(bareType);
+        }
+    };
+    const auto addMethodTypes = [&addType](const TLMethod &method) {
+        addType(method.type);
+        for (const TLParam &param : method.params) {
+            addType(param.type());
+        }
+    };
+    for (const QString &functionName : functionNames) {
+        addMethodTypes(m_functions.value(functionName));
+    }
+    for (const Predicate *predicate : m_extraPredicates) {
+        if (predicate->entityType() == QLatin1String("Function")) {
+            addMethodTypes(*static_cast<const TLMethod *>(predicate));
+        }
+    }
+    // The list grows while the members of the used types are processed
+    for (int i = 0; i < usedTypes.count(); ++i) {
+        const TLType type = m_types.value(usedTypes.at(i));
+        for (const TLSubType &subType : type.subTypes) {
+            for (const TLParam &member : subType.members) {
+                addType(member.type());
+            }
+        }
+    }
+
+    for (auto it = m_types.begin(); it != m_types.end(); ) {
+        if (usedTypes.contains(it.key())) {
+            ++it;
+        } else {
+            it = m_types.erase(it);
+        }
+    }
+    for (auto it = m_functions.begin(); it != m_functions.end(); ) {
+        if (functionNames.contains(it.key())) {
+            ++it;
+        } else {
+            it = m_functions.erase(it);
+        }
+    }
+    for (QStringList &group : m_groups) {
+        QStringList keptNames;
+        for (const QString &name : group) {
+            if (m_types.contains(name) || m_functions.contains(name)) {
+                keptNames.append(name);
+            }
+        }
+        group = keptNames;
+    }
+    QStringList functionGroups;
+    for (const QString &groupName : m_functionGroups) {
+        for (const QString &functionName : functionNames) {
+            if (functionName.startsWith(groupName)) {
+                functionGroups.append(groupName);
+                break;
+            }
+        }
+    }
+    m_functionGroups = functionGroups;
+
+    qCDebug(c_loggingTypes) << "Subset:" << m_functions.count() << "functions," << m_types.count() << "types";
+    return true;
+}
+
 void Generator::generate()
 {
     typesDefinitions.clear();
@@ -2056,6 +2757,10 @@ void Generator::generate()
     codeStreamWriteDeclarations.clear();
     codeStreamWriteDefinitions.clear();
     codeStreamWriteTemplateInstancing.clear();
+    codeSerializedSizeDeclarations.clear();
+    codeSerializedSizeDefinitions.clear();
+    codeStreamSkipDeclarations.clear();
+    codeStreamSkipDefinitions.clear();
     codeRpcProcessDeclarations.clear();
     codeRpcProcessDefinitions.clear();
     codeRpcProcessSwitchCases.clear();
@@ -2187,6 +2892,10 @@ void Generator::generate()
             codeStreamExtraWriteDeclarations.append(streamWriteFreeOperatorDeclaration(&type));
             codeStreamExtraWriteDefinitions .append(streamWriteFreeOperatorDefinition(&type));
         }
+        codeSerializedSizeDeclarations.append(serializedSizeDeclaration(&type));
+        codeSerializedSizeDefinitions.append(serializedSizeDefinition(&type));
+        codeStreamSkipDeclarations.append(skipDeclaration(&type));
+        codeStreamSkipDefinitions.append(skipDefinition(&type));
 
         codeDebugWriteDeclarations.append(generateDebugWriteOperatorDeclaration(&type));
         codeDebugWriteDefinitions .append(generateDebugWriteOperatorDefinition(&type));
@@ -2241,6 +2950,35 @@ QStringList Generator::generateTLValues() const
     return result;
 }
 
+QStringList Generator::generateTLValueNames() const
+{
+    QVector<const Predicate *> predicates;
+    for (const TLType &type : m_types) {
+        for (const TLSubType &subType : type.subTypes) {
+            predicates.append(&subType);
+        }
+    }
+    for (const TLMethod &method : m_functions) {
+        predicates.append(&method);
+    }
+    for (const Predicate *predicate : m_extraPredicates) {
+        predicates.append(predicate);
+    }
+    // Sorted by the value for the binary search in TLValue::name()
+    std::sort(predicates.begin(), predicates.end(), [](const Predicate *p1, const Predicate *p2) {
+        return p1->predicateId < p2->predicateId;
+    });
+
+    QStringList result;
+    for (const Predicate *predicate : predicates) {
+        // { 0x05162463, "ResPQ" },
+        result.append(QStringLiteral("{ 0x%1, \"%2\" },\n")
+                      .arg(predicate->predicateId, 8, 0x10, QLatin1Char('0'))
+                      .arg(predicate->nameFirstCapital()));
+    }
+    return result;
+}
+
 void Generator::dumpReadData() const
 {
     qDebug() << "\n" << Q_FUNC_INFO;
@@ -2319,11 +3057,28 @@ Generator::MethodsCode Generator::generateClientFunctions(const QString &prefix)
 
         // qCDebug(c_clientRpcAuthCategory) << Q_FUNC_INFO << phoneNumber << smsType << apiId << apiHash << langCode;
         definitionCode += spacing + QStringLiteral("qCDebug(c_clientRpc%1Category)%2;\n").arg(prefixFirstUpper, joinLinesWithPrepend(debugArguments, QStringLiteral(" << ")));
+        // The request size is known in advance, so the stream allocates the buffer only once
+        QStringList sizeParts = { QStringLiteral("%1serializedSize(%2::%3)").arg(tlNamespacePrefix, tlValueName,
+                                                                                   formatName(method.getName(), FormatOption::UpperCaseFirstLetter)) };
+        foreach (const TLParam &param, method.params) {
+            if (param.dependOnFlag()) {
+                if (param.type() == tlTrueType) {
+                    continue;
+                }
+                sizeParts.append(QStringLiteral("(%1 & 1 << %2 ? %3serializedSize(%4) : 0u)")
+                                 .arg(param.flagMember).arg(param.flagBit).arg(tlNamespacePrefix, param.getAlias()));
+            } else {
+                sizeParts.append(QStringLiteral("%1serializedSize(%2)").arg(tlNamespacePrefix, param.getAlias()));
+            }
+        }
+        definitionCode += spacing + QLatin1String("const quint32 requestSize = ")
+                + sizeParts.join(QLatin1Char('\n') + doubleSpacing + spacing + QLatin1String("+ "))
+                + QLatin1String(";\n");
         definitionCode += spacing
                 + tlNamespacePrefix + streamClassName
                 + QLatin1String(" outputStream(")
                 + tlNamespacePrefix + streamClassName
-                + QLatin1String("::WriteOnly);\n");
+                + QLatin1String("::WriteOnly, requestSize);\n");
         definitionCode += spacing + QString("outputStream << %1::%2;\n").arg(tlValueName, formatName(method.getName(), FormatOption::UpperCaseFirstLetter));
 
         foreach (const TLParam &param, method.params) {
@@ -2477,6 +3232,16 @@ void Generator::setAddSpecSources(bool addSources)
     m_addSpecSources = addSources;
 }
 
+void Generator::setCompactTypes(const QStringList &typeNames)
+{
+    m_compactTypes = typeNames;
+}
+
+void Generator::setSubset(const QStringList &names)
+{
+    m_subset = names;
+}
+
 QStringList Generator::getWords(const QString &input)
 {
     if (input.isEmpty()) {
@@ -131,6 +131,11 @@ struct TLType : public TypedEntity {
     bool isSelfReferenced() const { return m_selfReferenced; }
     void setSelfReferenced(const bool referenced) { m_selfReferenced = referenced; }
 
+    // The members (aliases) sharing the storage in a compact type, one list per union.
+    // The members of a union are never used by the same constructor.
+    QList<QStringList> compactSlots;
+    bool isCompact() const { return !compactSlots.isEmpty(); }
+
 protected:
     bool m_selfReferenced = false;
 };
@@ -178,6 +183,7 @@ public:
     bool resolveTypes();
     void generate();
     QStringList generateTLValues() const;
+    QStringList generateTLValueNames() const;
 
     void dumpReadData() const;
     void dumpSolvedTypes() const;
@@ -216,6 +222,14 @@ public:
 
     void setAddSpecSources(bool addSources);
 
+    // The (fat union) types to generate with the constructor-specific members in a tagged union.
+    // Must be set before resolveTypes().
+    QStringList compactTypes() const { return m_compactTypes; }
+    void setCompactTypes(const QStringList &typeNames);
+
+    QStringList subset() const { return m_subset; }
+    void setSubset(const QStringList &names);
+
     static QStringList getWords(const QString &input);
     static QString removeWord(QString input, QString word);
     static QString generateTLValuesDefinition(const Predicate *predicate);
@@ -225,6 +239,9 @@ public:
     static QStringList generateTLTypeMemberFlags(const TLType &type);
     static QStringList generateTLTypeMemberGetters(const TLType &type);
     static QStringList generateTLTypeMembers(const TLType &type);
+    static QStringList generateTLTypeCompactMemberEnum(const TLType &type);
+    static QStringList generateTLTypeCompactDeclarations(const TLType &type);
+    static QString generateTLTypeCompactMethods(const TLType &type);
 
     static QString streamReadImplementationHead(const TypedEntity *type);
     static QString streamReadImplementationEnd(const QString &argName);
@@ -264,6 +281,19 @@ public:
     static QString streamWriteVectorTemplate(const QString &type);
     static QString streamWriteFreeVectorTemplate(const QString &type);
 
+    static QString serializedSizeImplementationHead(const TypedEntity *type);
+    static QString serializedSizeImplementationEnd(const QString &argName);
+    static QString serializedSizePerTypeImplementation(const TypedEntity *type, const TLSubType &subType);
+    static QString serializedSizeDeclaration(const TypedEntity *type);
+    static QString serializedSizeDefinition(const TLType *type);
+
+    static QStringList skipFlagMembers(const TLSubType &subType);
+    static QString skipImplementationHead(const TLType *type);
+    static QString skipImplementationEnd(const QString &argName);
+    static QString skipPerTypeImplementation(const TypedEntity *type, const TLSubType &subType);
+    static QString skipDeclaration(const TypedEntity *type);
+    static QString skipDefinition(const TLType *type);
+
     QStringList generateRpcReplyTemplates(const QString &groupName) const;
 
     static QString generateDebugWriteOperatorDeclaration(const TLType *type);
@@ -284,7 +314,8 @@ public:
     QStringList generateTypeFlagsToString() const;
 
     QStringList serverRpcFactoryIncludes() const;
-    QStringList serverRpcFactoryInitialization() const;
+    QString generateServerRpcDispatchTable() const;
+    static quint32 rpcDispatchHash(quint32 function, quint32 seed);
     MethodsCode generateServerRpcProcessMethods(const QString &groupName) const;
     QStringList generateServerRpcMembers(const QString &groupName) const;
     QStringList generateServerMethodForRpcFunction(const QString &groupName) const;
@@ -298,6 +329,8 @@ public:
     static QList<TLType> solveTypes(QMap<QString, TLType> types, QMap<QString, TLType> *unresolved = nullptr);
 
     void getUsedAndVectorTypes(QStringList &usedTypes, QStringList &vectors) const;
+    void bakeCompactTypes();
+    bool applySubset();
 
     QString tlStructCode;
     QString tlPtrsCode;
@@ -312,6 +345,10 @@ public:
     QString codeStreamExtraReadDeclarations;
     QString codeStreamExtraWriteDeclarations;
     QString codeStreamExtraWriteDefinitions;
+    QString codeSerializedSizeDeclarations;
+    QString codeSerializedSizeDefinitions;
+    QString codeStreamSkipDeclarations;
+    QString codeStreamSkipDefinitions;
     QString codeConnectionDeclarations;
     QString codeConnectionDefinitions;
     QString codeRpcProcessDeclarations;
@@ -332,6 +369,8 @@ private:
     QVector<QStringList> m_groups;
     bool m_addSpecSources;
     QStringList m_functionGroups;
+    QStringList m_compactTypes;
+    QStringList m_subset;
 };
 
 Q_DECLARE_METATYPE(Generator::FormatOptions)
@@ -48,6 +48,8 @@ enum SchemaFormat {
 static bool s_dryRun = false;
 static bool s_dump = true;
 static bool s_addSpecSources = false;
+static QStringList s_compactTypes;
+static QStringList s_subset;
 
 static const QByteArray c_textLayerMarker = QByteArrayLiteral("// LAYER ");
 
@@ -55,6 +57,24 @@ static QString s_inputDir;
 static QString s_outputDir;
 static QString s_author;
 
+// The subset is either a comma-separated list or a file with one name per line
+static QStringList readSubset(const QString &value)
+{
+    QFile subsetFile(value);
+    if (!subsetFile.open(QIODevice::ReadOnly)) {
+        return value.split(QLatin1Char(','), QString::SkipEmptyParts);
+    }
+    QStringList result;
+    const QStringList lines = QString::fromUtf8(subsetFile.readAll()).split(QLatin1Char('\n'));
+    for (const QString &line : lines) {
+        const QString name = line.section(QLatin1String("//"), 0, 0).trimmed();
+        if (!name.isEmpty()) {
+            result.append(name);
+        }
+    }
+    return result;
+}
+
 QString calcVarName(const QString &var)
 {
     QStringList words = Generator::getWords(var);
@@ -518,6 +538,8 @@ StatusCode generate(SchemaFormat format, const QString &specFileName)
 
     Generator generator;
     generator.setAddSpecSources(s_addSpecSources);
+    generator.setCompactTypes(s_compactTypes);
+    generator.setSubset(s_subset);
 
     bool success = true;
 
@@ -567,6 +589,11 @@ StatusCode generate(SchemaFormat format, const QString &specFileName)
         const QString codeOfTLValues = Generator::joinLinesWithPrepend(generator.generateTLValues(), Generator::doubleSpacing);
         fileValues.replace("TLValues", codeOfTLValues, 8);
     }
+    {
+        OutputFile fileValues("MTProto/TLValues.cpp");
+        const QString codeOfNames = Generator::joinLinesWithPrepend(generator.generateTLValueNames(), Generator::spacing);
+        fileValues.replace("TLValue names", codeOfNames, 4);
+    }
     {
         OutputFile fileValues("MTProto/TLTypes.hpp");
         QString completeTlCode = generator.tlStructCode
@@ -591,6 +618,10 @@ StatusCode generate(SchemaFormat format, const QString &specFileName)
         fileTelegramStreamHeader.replace("write operators", generator.codeStreamWriteDeclarations, 4);
         fileTelegramStreamSource.replace("write operators implementation", generator.codeStreamWriteDefinitions);
         fileTelegramStreamSource.replace("vector write templates instancing", generator.codeStreamWriteTemplateInstancing);
+        fileTelegramStreamHeader.replace("serialized size functions", generator.codeSerializedSizeDeclarations);
+        fileTelegramStreamSource.replace("serialized size implementation", generator.codeSerializedSizeDefinitions);
+        fileTelegramStreamHeader.replace("skip methods", generator.codeStreamSkipDeclarations, 4);
+        fileTelegramStreamSource.replace("skip implementation", generator.codeStreamSkipDefinitions);
         fileTelegramStreamExtraOperatorsHeader.replace("write operators", generator.codeStreamExtraWriteDeclarations);
         fileTelegramStreamExtraOperatorsSource.replace("write operators implementation", generator.codeStreamExtraWriteDefinitions);
     }
@@ -739,14 +770,11 @@ StatusCode generate(SchemaFormat format, const QString &specFileName)
         }
 
         {
-            const int initIndentation = 8;
-            OutputFile sourceFile("../server/TelegramServer.cpp");
+            OutputFile sourceFile("../server/RpcOperationDispatch.cpp");
             QString includes = Generator::joinLinesWithPrepend(generator.serverRpcFactoryIncludes(),
                                                                QString(), QStringLiteral("\n"));
-            QString initialization = Generator::joinLinesWithPrepend(generator.serverRpcFactoryInitialization(),
-                                                                     QString(initIndentation, QLatin1Char(' ')), QStringLiteral("\n"));
             sourceFile.replace("RPC Operation Factory includes", includes);
-            sourceFile.replace("RPC Operation Factory initialization", initialization, initIndentation);
+            sourceFile.replace("RPC dispatch table", generator.generateServerRpcDispatchTable());
         }
     }
 
@@ -758,7 +786,9 @@ StatusCode generate(SchemaFormat format, const QString &specFileName)
      generator --generate-from-text %{sourceDir}/generator/scheme-45.tl -I %{sourceDir}/TelegramQt
      generator --fetch-text https://raw.githubusercontent.com/telegramdesktop/tdesktop/bccd80187489a5a1e94d1adb7de7c72275a62f1a/Telegram/Resources/scheme.tl
      // 72, commit bccd80187489a5a1e94d1adb7de7c72275a62f1a
-     generator --generate-from-text scheme-72.tl -I %{sourceDir}/TelegramQt
+     generator --generate-from-text scheme-72.tl -I %{sourceDir}/TelegramQt --compact-types TLUpdate
+     // Sources with only the listed functions (see --subset), written out of the tree
+     generator --generate-from-text scheme-72.tl -I %{sourceDir}/TelegramQt -O subset --subset messages.getDialogs,updates.getState
 
  */
 
@@ -790,6 +820,19 @@ int main(int argc, char *argv[])
     QCommandLineOption addSpecSourcesOption(QStringLiteral("add-spec-sources"));
     parser.addOption(addSpecSourcesOption);
 
+    QCommandLineOption compactTypesOption(QStringLiteral("compact-types"),
+                                          QStringLiteral("Comma-separated list of the types to generate with the constructor-specific members in unions"));
+    compactTypesOption.setValueName(QStringLiteral("types"));
+    parser.addOption(compactTypesOption);
+
+    QCommandLineOption subsetOption(QStringLiteral("subset"),
+                                    QStringLiteral("Generate only the given RPC functions and the types reachable from them. "
+                                                   "The value is a comma-separated list or a file with one name per line "
+                                                   "(e.g. messages.getDialogs); type names (e.g. Updates) are added as extra roots. "
+                                                   "Requires an output directory other than the input one"));
+    subsetOption.setValueName(QStringLiteral("functions"));
+    parser.addOption(subsetOption);
+
     QCommandLineOption fetchTextOption(QStringLiteral("fetch-text"));
     fetchTextOption.setValueName(QStringLiteral("url"));
     parser.addOption(fetchTextOption);
@@ -818,6 +861,10 @@ int main(int argc, char *argv[])
     s_dryRun = parser.isSet(dryRunOption);
     s_dump = parser.isSet(dumpOption);
     s_addSpecSources = parser.isSet(addSpecSourcesOption);
+    s_compactTypes = parser.value(compactTypesOption).split(QLatin1Char(','), QString::SkipEmptyParts);
+    if (parser.isSet(subsetOption)) {
+        s_subset = readSubset(parser.value(subsetOption));
+    }
     s_inputDir = parser.value(inputDirOption);
     if (s_inputDir.isEmpty()) {
         s_inputDir = QStringLiteral("./");
@@ -830,6 +877,11 @@ int main(int argc, char *argv[])
     } else if (!s_outputDir.endsWith(QLatin1Char('/'))) {
         s_outputDir.append(QLatin1Char('/'));
     }
+    if (!s_subset.isEmpty() && !s_dryRun && (QDir(s_outputDir) == QDir(s_inputDir))) {
+        // The hand-written library code depends on the full scheme
+        qWarning() << "The subset sources must not replace the input ones, use a separate output directory";
+        return InvalidArgument;
+    }
 
     QString specFileName;
     if (!parser.positionalArguments().isEmpty()) {
@@ -226,6 +226,11 @@ private slots:
     void predicateForCrc_data();
     void predicateForCrc();
     void checkStreamReadOperator();
+    void checkSerializedSize();
+    void checkSkip();
+    void compactTypeMembers();
+    void serverRpcDispatchTable();
+    void schemeSubset();
     void generatedTlType_data();
     void generatedTlType();
 };
@@ -523,7 +528,7 @@ void tst_Generator::checkStreamReadOperator()
             "        break;\n"
             "    }\n"
             "\n"
-            "    postAddressValue = result;\n"
+            "    postAddressValue = std::move(result);\n"
             "\n"
             "    return *this;\n"
             "}\n"
@@ -554,7 +559,7 @@ void tst_Generator::checkStreamReadOperator()
             "        break;\n"
             "    }\n"
             "\n"
-            "    paymentRequestedInfoValue = result;\n"
+            "    paymentRequestedInfoValue = std::move(result);\n"
             "\n"
             "    return *this;\n"
             "}\n"
@@ -575,6 +580,377 @@ void tst_Generator::checkStreamReadOperator()
     QCOMPARE(generator.codeStreamReadDefinitions.toLatin1(), definitionsCode);
 }
 
+void tst_Generator::checkSerializedSize()
+{
+    QByteArray sources =
+            "\n"
+            "postAddress#1e8caaeb"
+            " street_line1:string"
+            " street_line2:string"
+            " city:string state:string"
+            " country_iso2:string"
+            " post_code:string = PostAddress;"
+            "\n"
+            "paymentRequestedInfo#909c3f94 flags:#"
+            " name:flags.0?string"
+            " phone:flags.1?string"
+            " email:flags.2?string"
+            " shipping_address:flags.3?PostAddress"
+            " = PaymentRequestedInfo;";
+
+    QByteArray declarationsCode =
+            "TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLPostAddress &postAddressValue);\n"
+            "TELEGRAMQT_INTERNAL_EXPORT quint32 serializedSize(const TLPaymentRequestedInfo &paymentRequestedInfoValue);\n";
+
+    QByteArray definitionsCode =
+            "quint32 serializedSize(const TLPostAddress &postAddressValue)\n"
+            "{\n"
+            "    quint32 size = serializedSize(postAddressValue.tlType);\n"
+            "\n"
+            "    switch (postAddressValue.tlType) {\n"
+            "    case TLValue::PostAddress:\n"
+            "        size += serializedSize(postAddressValue.streetLine1);\n"
+            "        size += serializedSize(postAddressValue.streetLine2);\n"
+            "        size += serializedSize(postAddressValue.city);\n"
+            "        size += serializedSize(postAddressValue.state);\n"
+            "        size += serializedSize(postAddressValue.countryIso2);\n"
+            "        size += serializedSize(postAddressValue.postCode);\n"
+            "        break;\n"
+            "    default:\n"
+            "        break;\n"
+            "    }\n"
+            "\n"
+            "    return size;\n"
+            "}\n"
+            "\n"
+            "quint32 serializedSize(const TLPaymentRequestedInfo &paymentRequestedInfoValue)\n"
+            "{\n"
+            "    quint32 size = serializedSize(paymentRequestedInfoValue.tlType);\n"
+            "\n"
+            "    switch (paymentRequestedInfoValue.tlType) {\n"
+            "    case TLValue::PaymentRequestedInfo:\n"
+            "        size += serializedSize(paymentRequestedInfoValue.flags);\n"
+            "        if (paymentRequestedInfoValue.flags & TLPaymentRequestedInfo::Name) {\n"
+            "            size += serializedSize(paymentRequestedInfoValue.name);\n"
+            "        }\n"
+            "        if (paymentRequestedInfoValue.flags & TLPaymentRequestedInfo::Phone) {\n"
+            "            size += serializedSize(paymentRequestedInfoValue.phone);\n"
+            "        }\n"
+            "        if (paymentRequestedInfoValue.flags & TLPaymentRequestedInfo::Email) {\n"
+            "            size += serializedSize(paymentRequestedInfoValue.email);\n"
+            "        }\n"
+            "        if (paymentRequestedInfoValue.flags & TLPaymentRequestedInfo::ShippingAddress) {\n"
+            "            size += serializedSize(paymentRequestedInfoValue.shippingAddress);\n"
+            "        }\n"
+            "        break;\n"
+            "    default:\n"
+            "        break;\n"
+            "    }\n"
+            "\n"
+            "    return size;\n"
+            "}\n"
+            "\n";
+
+    const QByteArray textData = c_typesSection + sources;
+
+    Generator generator;
+    QVERIFY(generator.loadFromText(textData));
+    QVERIFY(generator.resolveTypes());
+    generator.generate();
+
+    QCOMPARE(generator.codeSerializedSizeDeclarations.toLatin1(), declarationsCode);
+    QCOMPARE(generator.codeSerializedSizeDefinitions.toLatin1(), definitionsCode);
+}
+
+void tst_Generator::checkSkip()
+{
+    QByteArray sources =
+            "\n"
+            "postAddress#1e8caaeb"
+            " street_line1:string"
+            " street_line2:string"
+            " city:string state:string"
+            " country_iso2:string"
+            " post_code:string = PostAddress;"
+            "\n"
+            "paymentRequestedInfo#909c3f94 flags:#"
+            " name:flags.0?string"
+            " phone:flags.1?string"
+            " email:flags.2?string"
+            " shipping_address:flags.3?PostAddress"
+            " = PaymentRequestedInfo;";
+
+    QByteArray declarationsCode =
+            "    Stream &skipValue(TLPostAddress *);\n"
+            "    Stream &skipValue(TLPaymentRequestedInfo *);\n";
+
+    QByteArray definitionsCode =
+            "Stream &Stream::skipValue(TLPostAddress *)\n"
+            "{\n"
+            "    TLValue tlType;\n"
+            "\n"
+            "    *this >> tlType;\n"
+            "\n"
+            "    switch (tlType) {\n"
+            "    case TLValue::PostAddress:\n"
+            "        skip<QString>();\n"
+            "        skip<QString>();\n"
+            "        skip<QString>();\n"
+            "        skip<QString>();\n"
+            "        skip<QString>();\n"
+            "        skip<QString>();\n"
+            "        break;\n"
+            "    default:\n"
+            "        // The value size is unknown\n"
+            "        setError(true);\n"
+            "        break;\n"
+            "    }\n"
+            "\n"
+            "    return *this;\n"
+            "}\n"
+            "\n"
+            "Stream &Stream::skipValue(TLPaymentRequestedInfo *)\n"
+            "{\n"
+            "    TLValue tlType;\n"
+            "    quint32 flags = 0;\n"
+            "\n"
+            "    *this >> tlType;\n"
+            "\n"
+            "    switch (tlType) {\n"
+            "    case TLValue::PaymentRequestedInfo:\n"
+            "        *this >> flags;\n"
+            "        if (flags & TLPaymentRequestedInfo::Name) {\n"
+            "            skip<QString>();\n"
+            "        }\n"
+            "        if (flags & TLPaymentRequestedInfo::Phone) {\n"
+            "            skip<QString>();\n"
+            "        }\n"
+            "        if (flags & TLPaymentRequestedInfo::Email) {\n"
+            "            skip<QString>();\n"
+            "        }\n"
+            "        if (flags & TLPaymentRequestedInfo::ShippingAddress) {\n"
+            "            skip<TLPostAddress>();\n"
+            "        }\n"
+            "        break;\n"
+            "    default:\n"
+            "        // The value size is unknown\n"
+            "        setError(true);\n"
+            "        break;\n"
+            "    }\n"
+            "\n"
+            "    return *this;\n"
+            "}\n"
+            "\n";
+
+    const QByteArray textData = c_typesSection + sources;
+
+    Generator generator;
+    QVERIFY(generator.loadFromText(textData));
+    QVERIFY(generator.resolveTypes());
+    generator.generate();
+
+    QCOMPARE(generator.codeStreamSkipDeclarations.toLatin1(), declarationsCode);
+    QCOMPARE(generator.codeStreamSkipDefinitions.toLatin1(), definitionsCode);
+}
+
+void tst_Generator::compactTypeMembers()
+{
+    QByteArray sources =
+            "\n"
+            "postAddress#1e8caaeb"
+            " street_line1:string"
+            " street_line2:string"
+            " city:string state:string"
+            " country_iso2:string"
+            " post_code:string = PostAddress;"
+            "\n"
+            "paymentRequestedInfo#909c3f94 flags:#"
+            " name:flags.0?string"
+            " phone:flags.1?string"
+            " email:flags.2?string"
+            " shipping_address:flags.3?PostAddress"
+            " = PaymentRequestedInfo;"
+            "\n"
+            "updateBotShippingQuery#e0cdc940"
+            " query_id:long"
+            " user_id:int"
+            " payload:bytes"
+            " shipping_address:PostAddress = Update;"
+            "\n"
+            "updateBotPrecheckoutQuery#5d2f3aa9 flags:#"
+            " query_id:long"
+            " user_id:int"
+            " payload:bytes"
+            " info:flags.0?PaymentRequestedInfo"
+            " shipping_option_id:flags.1?string"
+            " currency:string"
+            " total_amount:long = Update;";
+
+    const QByteArray textData = c_typesSection + sources;
+
+    {
+        // The regular layout
+        Generator generator;
+        QVERIFY(generator.loadFromText(textData));
+        QVERIFY(generator.resolveTypes());
+        const QStringList structMembers = Generator::generateTLTypeMembers(getSolvedType(generator, QStringLiteral("Update")));
+        QVERIFY(structMembers.contains(QStringLiteral("TLPostAddress shippingAddress;")));
+        QVERIFY(structMembers.contains(QStringLiteral("TLPaymentRequestedInfo info;")));
+    }
+
+    Generator generator;
+    generator.setCompactTypes({ QStringLiteral("TLUpdate") });
+    QVERIFY(generator.loadFromText(textData));
+    QVERIFY(generator.resolveTypes());
+    const TLType updateType = getSolvedType(generator, QStringLiteral("Update"));
+    const QList<QStringList> expectedSlots = {
+        { QStringLiteral("shippingAddress"), QStringLiteral("info") },
+        { QStringLiteral("shippingOptionId") },
+        { QStringLiteral("currency") },
+    };
+    QCOMPARE(updateType.compactSlots, expectedSlots);
+
+    const QStringList structMembers = Generator::generateTLTypeMembers(updateType);
+    static const QStringList checkList = {
+        QStringLiteral("quint64 queryId = 0;"),
+        QStringLiteral("quint32 userId = 0;"),
+        QStringLiteral("QByteArray payload;"), // Used by every constructor
+        QStringLiteral("union {"),
+        QStringLiteral("    TLPostAddress shippingAddress;"),
+        QStringLiteral("    TLPaymentRequestedInfo info;"),
+        QStringLiteral("    QString currency;"),
+        QStringLiteral("TLCompactValue<TLUpdate> tlType { this, TLValue::UpdateBotShippingQuery };"),
+    };
+    for (const QString &mustHaveMember : checkList) {
+        if (!structMembers.contains(mustHaveMember)) {
+            qDebug().noquote() << "Generated members:" << structMembers;
+            QString message = QStringLiteral("The member \"%1\" is missing in the generated compact struct.").arg(mustHaveMember);
+            QFAIL(message.toUtf8().constData());
+        }
+    }
+    QVERIFY(!structMembers.contains(QStringLiteral("TLPostAddress shippingAddress;")));
+    // Only the compact type members are placed to unions
+    const QStringList infoMembers = Generator::generateTLTypeMembers(getSolvedType(generator, QStringLiteral("PaymentRequestedInfo")));
+    QVERIFY(infoMembers.contains(QStringLiteral("TLPostAddress shippingAddress;")));
+    QVERIFY(infoMembers.contains(QStringLiteral("TLValue tlType = TLValue::PaymentRequestedInfo;")));
+
+    const QString definition = Generator::generateTLTypeDefinition(updateType, /* addSpecSources */ false);
+    QVERIFY(definition.contains(QStringLiteral("    TLUpdate(const TLUpdate &v);\n")));
+    QVERIFY(definition.contains(QStringLiteral("    enum { SlotCount = 3 };\n")));
+    QVERIFY(definition.contains(QStringLiteral("    bool hasMember(Member member) const;\n\nprivate:\n")));
+
+    const QString methods = Generator::generateTLTypeMethods(updateType);
+    QVERIFY(methods.contains(QStringLiteral("    case TLValue::UpdateBotShippingQuery: {\n"
+                                            "        static const Member members[SlotCount] = { ShippingAddressMember, NoMember, NoMember };\n")));
+    QVERIFY(methods.contains(QStringLiteral("    case TLValue::UpdateBotPrecheckoutQuery: {\n"
+                                            "        static const Member members[SlotCount] = { InfoMember, ShippingOptionIdMember, CurrencyMember };\n")));
+    QVERIFY(methods.contains(QStringLiteral("    case InfoMember:\n"
+                                            "        new (&info) TLPaymentRequestedInfo(v.info);\n")));
+    QVERIFY(methods.contains(QStringLiteral("    case CurrencyMember:\n"
+                                            "        currency.~QString();\n")));
+}
+
+void tst_Generator::serverRpcDispatchTable()
+{
+    const QStringList types = {
+        QStringLiteral("boolFalse#bc799737 = Bool;"),
+        QStringLiteral("boolTrue#997275b5 = Bool;"),
+        QStringLiteral("nearestDc#8e1a1775 country:string this_dc:int nearest_dc:int = NearestDc;"),
+    };
+    const QStringList functions = {
+        QStringLiteral("account.deleteAccount#418d4e0b reason:string = Bool;"),
+        QStringLiteral("account.resetNotifySettings#db7e1747 = Bool;"),
+        QStringLiteral("auth.logOut#5717da40 = Bool;"),
+        QStringLiteral("auth.resetAuthorizations#9fab0d1a = Bool;"),
+        QStringLiteral("contacts.resetSaved#879537f1 = Bool;"),
+        QStringLiteral("help.getNearestDc#1fb33026 = NearestDc;"),
+    };
+    Generator generator;
+    QVERIFY(generator.loadFromText(generateTextSpec(types, functions)));
+    QVERIFY(generator.resolveTypes());
+    const QString code = generator.generateServerRpcDispatchTable();
+    QVERIFY(code.contains(QStringLiteral("static const int c_dispatchFunctionCount = 6;\n")));
+    QVERIFY(code.contains(QStringLiteral("static const int c_dispatchTableSize = 8;\n")));
+    QVERIFY(code.contains(QStringLiteral("static const int c_dispatchBucketCount = 2;\n")));
+    QVERIFY(code.contains(QStringLiteral(
+                              "    { TLValue::AuthLogOut, &processRpcFunction<AuthRpcOperation, &AuthRpcOperation::processLogOut>,\n"
+                              "      AuthOperationFactory::needLocalUser() },\n")));
+
+    const QString seedsStart = QStringLiteral("c_dispatchSeeds[c_dispatchBucketCount] = {\n");
+    const int seedsIndex = code.indexOf(seedsStart) + seedsStart.size();
+    const QStringList seedsText = code.mid(seedsIndex, code.indexOf(QLatin1String("};"), seedsIndex) - seedsIndex)
+            .split(QLatin1Char(','), QString::SkipEmptyParts);
+    QVector<quint32> seeds;
+    for (const QString &seed : seedsText) {
+        if (!seed.trimmed().isEmpty()) {
+            seeds.append(seed.trimmed().toUInt());
+        }
+    }
+    QCOMPARE(seeds.count(), 2);
+
+    const QString tableStart = QStringLiteral("c_dispatchTable[c_dispatchTableSize] = {\n");
+    const QString tableCode = code.mid(code.indexOf(tableStart) + tableStart.size());
+    QStringList slots = tableCode.split(QStringLiteral("    {"), QString::SkipEmptyParts);
+    QCOMPARE(slots.count(), 8);
+
+    // Each function is found in its own slot with the seed of its bucket
+    for (const TLMethod &method : generator.functions()) {
+        const quint32 bucket = Generator::rpcDispatchHash(method.predicateId, 0) & quint32(seeds.count() - 1);
+        const quint32 slot = Generator::rpcDispatchHash(method.predicateId, seeds.at(bucket)) & quint32(slots.count() - 1);
+        const QString processMethod = QStringLiteral("::process%1>").arg(method.nameFromSecondWord());
+        QVERIFY2(slots.at(static_cast<int>(slot)).contains(processMethod), qPrintable(method.getName()));
+    }
+}
+
+void tst_Generator::schemeSubset()
+{
+    const QByteArray serviceSources = generateTextSpec({
+        QStringLiteral("destroy_auth_key_ok#f660e1d4 = DestroyAuthKeyRes;"),
+    });
+    const QByteArray apiSources = generateTextSpec({
+        QStringLiteral("boolFalse#bc799737 = Bool;"),
+        QStringLiteral("boolTrue#997275b5 = Bool;"),
+        QStringLiteral("inputPeerEmpty#7f3b18ea = InputPeer;"),
+        QStringLiteral("inputPeerSelf#7da07ec9 = InputPeer;"),
+        QStringLiteral("peerUser#9db1bc6d user_id:int = Peer;"),
+        QStringLiteral("dialog#66ffba14 peer:Peer top_message:int = Dialog;"),
+        QStringLiteral("messages.dialogs#15ba6c40 dialogs:Vector<Dialog> = messages.Dialogs;"),
+        QStringLiteral("nearestDc#8e1a1775 country:string this_dc:int nearest_dc:int = NearestDc;"),
+        QStringLiteral("updatesTooLong#e317af7e = Updates;"),
+    }, {
+        QStringLiteral("messages.getDialogs#191ba9c5 offset_peer:InputPeer limit:int = messages.Dialogs;"),
+        QStringLiteral("messages.setTyping#a3825e50 peer:InputPeer = Bool;"),
+        QStringLiteral("help.getNearestDc#1fb33026 = NearestDc;"),
+    });
+    const QByteArray textData = serviceSources + apiSources;
+
+    Generator generator;
+    generator.setSubset({ QStringLiteral("messages.getDialogs"), QStringLiteral("Updates") });
+    QVERIFY(generator.loadFromText(textData));
+    QVERIFY(generator.resolveTypes());
+
+    QCOMPARE(QStringList(generator.functions().keys()), QStringList({ QStringLiteral("messagesGetDialogs") }));
+    QCOMPARE(generator.functionGroups(), QStringList({ QStringLiteral("messages") }));
+    const QStringList types = generator.types().keys();
+    // The function types (including the vector and member types), the extra root and the service types
+    for (const QString &typeName : { "TLDestroyAuthKeyRes", "TLDialog", "TLInputPeer", "TLMessagesDialogs", "TLPeer", "TLUpdates" }) {
+        QVERIFY2(types.contains(QLatin1String(typeName)), typeName);
+    }
+    QVERIFY(!types.contains(QStringLiteral("TLNearestDc")));
+    QVERIFY(!types.contains(QStringLiteral("TLBool")));
+    QCOMPARE(types.count(), 6);
+
+    const QString values = generator.generateTLValues().join(QString());
+    QVERIFY(values.contains(QStringLiteral("MessagesGetDialogs = 0x191ba9c5,\n")));
+    QVERIFY(!values.contains(QStringLiteral("HelpGetNearestDc")));
+    QVERIFY(!values.contains(QStringLiteral("NearestDc = ")));
+
+    Generator invalidSubsetGenerator;
+    invalidSubsetGenerator.setSubset({ QStringLiteral("messages.getUnknown") });
+    QVERIFY(invalidSubsetGenerator.loadFromText(textData));
+    QVERIFY(!invalidSubsetGenerator.resolveTypes());
+}
+
 void tst_Generator::generatedTlType_data()
 {
     QTest::addColumn<QByteArray>("textSpec");
@@ -7,6 +7,7 @@
 #include <QLoggingCategory>
 #include <QMetaMethod>
 #include <QTcpSocket>
+#include <QtEndian>
 
 Q_LOGGING_CATEGORY(c_loggingServerTcpTransport, "telegram.server.transport.tcp", QtWarningMsg)
 
@@ -56,7 +57,15 @@ bool TcpTransport::startObfuscatedSession()
     // The client sends its encryption key in plain text
     setCryptoKeysSourceData(encryptionSourceData, DirectIsReadReversedIsWrite);
     QByteArray content1 = plainData + m_socket->read(8);
-    m_readAesContext->crypt(content1);
+    // Decrypt the header in place to advance the read context state and get the protocol id
+    m_readAesContext->crypt(content1.data(), content1.size());
+    const quint32 protocolId = qFromLittleEndian<quint32>(reinterpret_cast<const uchar *>(content1.constData()) + 56);
+    const SessionType framing = framingFromProtocolIdentifier(protocolId);
+    if (framing == Unknown) {
+        qCWarning(c_loggingServerTcpTransport()) << Q_FUNC_INFO << "Unknown protocol id" << hex << showbase << protocolId;
+        return false;
+    }
+    setFraming(framing);
     return true;
 }
 
@@ -65,16 +74,37 @@ void TcpTransport::readEvent()
     if (Q_LIKELY(m_sessionType != Unknown)) {
         return;
     }
-    char sessionSign;
-    m_socket->getChar(&sessionSign);
-    if (sessionSign == char(0xef)) {
+    uchar header[8];
+    const qint64 headerSize = m_socket->peek(reinterpret_cast<char *>(header), sizeof(header));
+    if (headerSize < 1) {
+        return;
+    }
+    if (header[0] == 0xef) {
+        m_socket->read(1);
         setSessionType(Abridged);
+    } else if (headerSize < static_cast<qint64>(sizeof(header))) {
+        qCDebug(c_loggingServerTcpTransport()) << Q_FUNC_INFO << "Not enough data to detect the session type";
+        return;
     } else {
-        m_socket->ungetChar(sessionSign);
-        if (startObfuscatedSession()) {
+        const SessionType framing = framingFromProtocolIdentifier(qFromLittleEndian<quint32>(header));
+        const quint32 secondWord = qFromLittleEndian<quint32>(header + 4);
+        if ((framing == Intermediate) || (framing == PaddedIntermediate)) {
+            m_socket->read(4);
+            setSessionType(framing);
+        } else if (secondWord == 0) {
+            // Obfuscated sessions never start with zero second word,
+            // while it is the first packet number of a FullSize session.
+            setSessionType(FullSize);
+        } else if (m_socket->bytesAvailable() < 64) {
+            qCDebug(c_loggingServerTcpTransport()) << Q_FUNC_INFO << "Not enough data to start the obfuscated session";
+            return;
+        } else if (startObfuscatedSession()) {
             setSessionType(Obfuscated);
         } else {
-            qCCritical(c_loggingServerTcpTransport()) << Q_FUNC_INFO << "Invalid data";
+            qCWarning(c_loggingServerTcpTransport()) << Q_FUNC_INFO << remoteAddress() << "Invalid session header";
+            setError(QAbstractSocket::UnknownSocketError, QLatin1String("Invalid session header"));
+            disconnectFromHost();
+            return;
         }
     }
     qCDebug(c_loggingServerTcpTransport()) << Q_FUNC_INFO << remoteAddress() << "Session type:" << m_sessionType;
@@ -42,6 +42,11 @@ void LocalCluster::setListenAddress(const QHostAddress &address)
     m_listenAddress = address;
 }
 
+void LocalCluster::setLoopbackTransportEnabled(bool enabled)
+{
+    m_loopbackTransportEnabled = enabled;
+}
+
 void LocalCluster::setServerConfiguration(const DcConfiguration &config)
 {
     m_serverConfiguration = config;
@@ -91,6 +96,7 @@ bool LocalCluster::start()
         server->setServerConfiguration(m_serverConfiguration);
         server->setDcOption(dc);
         server->setListenAddress(m_listenAddress);
+        server->setLoopbackTransportEnabled(m_loopbackTransportEnabled);
         server->setServerPrivateRsaKey(m_key);
         server->setMessageService(m_messageService);
         server->setAuthorizationProvider(m_authProvider);
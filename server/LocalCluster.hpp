@@ -57,6 +57,10 @@ public:
 
     void setListenAddress(const QHostAddress &address);
 
+    // See Server::setLoopbackTransportEnabled()
+    bool isLoopbackTransportEnabled() const { return m_loopbackTransportEnabled; }
+    void setLoopbackTransportEnabled(bool enabled);
+
     DcConfiguration serverConfiguration() { return m_serverConfiguration; }
     void setServerConfiguration(const DcConfiguration &config);
 
@@ -83,6 +87,7 @@ protected:
     RsaKey m_key;
     MessageService *m_messageService = nullptr;
     Authorization::Provider *m_authProvider = nullptr;
+    bool m_loopbackTransportEnabled = false;
 };
 
 } // Server namespace
@@ -39,11 +39,6 @@ BaseDhLayer *RemoteClientConnection::dhLayer() const
     return m_dhLayer;
 }
 
-void RemoteClientConnection::setRpcFactories(const QVector<RpcOperationFactory *> &rpcFactories)
-{
-    rpcLayer()->setRpcFactories(rpcFactories);
-}
-
 LocalServerApi *RemoteClientConnection::api() const
 {
     return rpcLayer()->api();
@@ -68,7 +63,7 @@ void RemoteClientConnection::sendKeyError()
 {
     static const ConnectionError keyError(ConnectionError::InvalidAuthKey);
     static const QByteArray errorPackage = keyError.toByteArray();
-    m_transport->sendPacket(errorPackage);
+    sendPacket(errorPackage);
 }
 
 bool RemoteClientConnection::processAuthKey(quint64 authKeyId)
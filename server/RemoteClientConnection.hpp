@@ -12,7 +12,6 @@ namespace Server {
 
 class LocalServerApi;
 class RpcLayer;
-class RpcOperationFactory;
 class Session;
 
 class RemoteClientConnection : public BaseConnection
@@ -24,8 +23,6 @@ public:
     RpcLayer *rpcLayer() const;
     BaseDhLayer *dhLayer() const;
 
-    void setRpcFactories(const QVector<RpcOperationFactory*> &rpcFactories);
-
     LocalServerApi *api() const;
     void setServerApi(Telegram::Server::LocalServerApi *api);
 
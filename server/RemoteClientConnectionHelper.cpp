@@ -51,7 +51,7 @@ quint64 MTProtoSendHelper::newMessageId(SendMode mode)
 
 void MTProtoSendHelper::sendPacket(const QByteArray &package)
 {
-    return m_connection->transport()->sendPacket(package);
+    m_connection->sendPacket(package);
 }
 
 RemoteClientConnection *MTProtoSendHelper::getRemoteClientConnection() const
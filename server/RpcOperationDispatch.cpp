@@ -0,0 +1,568 @@
+/*
+   Copyright (C) 2019 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+#include "RpcOperationDispatch.hpp"
+
+#include "RpcOperationFactory_p.hpp"
+
+// Generated RPC Operation Factory includes
+#include "AccountOperationFactory.hpp"
+#include "AuthOperationFactory.hpp"
+#include "BotsOperationFactory.hpp"
+#include "ChannelsOperationFactory.hpp"
+#include "ContactsOperationFactory.hpp"
+#include "HelpOperationFactory.hpp"
+#include "LangpackOperationFactory.hpp"
+#include "MessagesOperationFactory.hpp"
+#include "PaymentsOperationFactory.hpp"
+#include "PhoneOperationFactory.hpp"
+#include "PhotosOperationFactory.hpp"
+#include "StickersOperationFactory.hpp"
+#include "UpdatesOperationFactory.hpp"
+#include "UploadOperationFactory.hpp"
+#include "UsersOperationFactory.hpp"
+// End of generated RPC Operation Factory includes
+
+namespace Telegram {
+
+namespace Server {
+
+// Generated RPC dispatch table
+static const int c_dispatchFunctionCount = 234;
+static const int c_dispatchTableSize = 256;
+static const int c_dispatchBucketCount = 64;
+
+static const quint32 c_dispatchSeeds[c_dispatchBucketCount] = {
+    18, 16, 5, 16, 3, 2, 2, 1, 37, 7, 0, 8, 32, 22, 2, 1,
+    27, 9, 5, 6, 23, 5, 1, 15, 23, 22, 2, 24, 8, 38, 4, 58,
+    16, 3, 62, 6, 6, 5, 14, 7, 4, 20, 38, 162, 5, 29, 13, 9,
+    89, 99, 10, 20, 33, 14, 221, 102, 40, 20, 69, 155, 331, 5, 36, 66,
+};
+
+static const RpcFunctionEntry c_dispatchTable[c_dispatchTableSize] = {
+    { TLValue::AuthCancelCode, &processRpcFunction<AuthRpcOperation, &AuthRpcOperation::processCancelCode>,
+      AuthOperationFactory::needLocalUser() },
+    { TLValue::AccountUpdateProfile, &processRpcFunction<AccountRpcOperation, &AccountRpcOperation::processUpdateProfile>,
+      AccountOperationFactory::needLocalUser() },
+    { TLValue::HelpSetBotUpdatesStatus, &processRpcFunction<HelpRpcOperation, &HelpRpcOperation::processSetBotUpdatesStatus>,
+      HelpOperationFactory::needLocalUser() },
+    { TLValue::ChannelsUpdatePinnedMessage, &processRpcFunction<ChannelsRpcOperation, &ChannelsRpcOperation::processUpdatePinnedMessage>,
+      ChannelsOperationFactory::needLocalUser() },
+    { TLValue::ContactsResetSaved, &processRpcFunction<ContactsRpcOperation, &ContactsRpcOperation::processResetSaved>,
+      ContactsOperationFactory::needLocalUser() },
+    { TLValue::ChannelsUpdateUsername, &processRpcFunction<ChannelsRpcOperation, &ChannelsRpcOperation::processUpdateUsername>,
+      ChannelsOperationFactory::needLocalUser() },
+    { TLValue::MessagesGetDhConfig, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processGetDhConfig>,
+      MessagesOperationFactory::needLocalUser() },
+    { 0, nullptr, false },
+    { TLValue::LangpackGetLanguages, &processRpcFunction<LangpackRpcOperation, &LangpackRpcOperation::processGetLanguages>,
+      LangpackOperationFactory::needLocalUser() },
+    { TLValue::ChannelsGetAdminedPublicChannels, &processRpcFunction<ChannelsRpcOperation, &ChannelsRpcOperation::processGetAdminedPublicChannels>,
+      ChannelsOperationFactory::needLocalUser() },
+    { TLValue::MessagesClearRecentStickers, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processClearRecentStickers>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::PhotosUpdateProfilePhoto, &processRpcFunction<PhotosRpcOperation, &PhotosRpcOperation::processUpdateProfilePhoto>,
+      PhotosOperationFactory::needLocalUser() },
+    { TLValue::MessagesDeleteHistory, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processDeleteHistory>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::MessagesSaveDraft, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processSaveDraft>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::LangpackGetDifference, &processRpcFunction<LangpackRpcOperation, &LangpackRpcOperation::processGetDifference>,
+      LangpackOperationFactory::needLocalUser() },
+    { TLValue::AccountUnregisterDevice, &processRpcFunction<AccountRpcOperation, &AccountRpcOperation::processUnregisterDevice>,
+      AccountOperationFactory::needLocalUser() },
+    { TLValue::LangpackGetStrings, &processRpcFunction<LangpackRpcOperation, &LangpackRpcOperation::processGetStrings>,
+      LangpackOperationFactory::needLocalUser() },
+    { TLValue::MessagesGetWebPage, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processGetWebPage>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::AuthResendCode, &processRpcFunction<AuthRpcOperation, &AuthRpcOperation::processResendCode>,
+      AuthOperationFactory::needLocalUser() },
+    { TLValue::MessagesReadHistory, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processReadHistory>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::AccountUpdatePasswordSettings, &processRpcFunction<AccountRpcOperation, &AccountRpcOperation::processUpdatePasswordSettings>,
+      AccountOperationFactory::needLocalUser() },
+    { TLValue::MessagesGetDialogs, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processGetDialogs>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::AccountChangePhone, &processRpcFunction<AccountRpcOperation, &AccountRpcOperation::processChangePhone>,
+      AccountOperationFactory::needLocalUser() },
+    { TLValue::ChannelsToggleInvites, &processRpcFunction<ChannelsRpcOperation, &ChannelsRpcOperation::processToggleInvites>,
+      ChannelsOperationFactory::needLocalUser() },
+    { TLValue::AuthRecoverPassword, &processRpcFunction<AuthRpcOperation, &AuthRpcOperation::processRecoverPassword>,
+      AuthOperationFactory::needLocalUser() },
+    { TLValue::ChannelsDeleteHistory, &processRpcFunction<ChannelsRpcOperation, &ChannelsRpcOperation::processDeleteHistory>,
+      ChannelsOperationFactory::needLocalUser() },
+    { TLValue::MessagesInstallStickerSet, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processInstallStickerSet>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::MessagesSetTyping, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processSetTyping>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::MessagesGetArchivedStickers, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processGetArchivedStickers>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::ContactsBlock, &processRpcFunction<ContactsRpcOperation, &ContactsRpcOperation::processBlock>,
+      ContactsOperationFactory::needLocalUser() },
+    { TLValue::MessagesSaveGif, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processSaveGif>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::HelpGetRecentMeUrls, &processRpcFunction<HelpRpcOperation, &HelpRpcOperation::processGetRecentMeUrls>,
+      HelpOperationFactory::needLocalUser() },
+    { TLValue::HelpSaveAppLog, &processRpcFunction<HelpRpcOperation, &HelpRpcOperation::processSaveAppLog>,
+      HelpOperationFactory::needLocalUser() },
+    { TLValue::MessagesGetAttachedStickers, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processGetAttachedStickers>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::MessagesGetRecentStickers, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processGetRecentStickers>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::ChannelsInviteToChannel, &processRpcFunction<ChannelsRpcOperation, &ChannelsRpcOperation::processInviteToChannel>,
+      ChannelsOperationFactory::needLocalUser() },
+    { TLValue::UsersGetFullUser, &processRpcFunction<UsersRpcOperation, &UsersRpcOperation::processGetFullUser>,
+      UsersOperationFactory::needLocalUser() },
+    { TLValue::MessagesReadFeaturedStickers, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processReadFeaturedStickers>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::MessagesSearch, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processSearch>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::MessagesReadEncryptedHistory, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processReadEncryptedHistory>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::MessagesReorderStickerSets, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processReorderStickerSets>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::MessagesGetAllChats, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processGetAllChats>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::MessagesCheckChatInvite, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processCheckChatInvite>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::ChannelsEditBanned, &processRpcFunction<ChannelsRpcOperation, &ChannelsRpcOperation::processEditBanned>,
+      ChannelsOperationFactory::needLocalUser() },
+    { TLValue::AccountUpdateStatus, &processRpcFunction<AccountRpcOperation, &AccountRpcOperation::processUpdateStatus>,
+      AccountOperationFactory::needLocalUser() },
+    { TLValue::MessagesReportSpam, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processReportSpam>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::MessagesForwardMessages, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processForwardMessages>,
+      MessagesOperationFactory::needLocalUser() },
+    { 0, nullptr, false },
+    { 0, nullptr, false },
+    { TLValue::MessagesEditChatPhoto, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processEditChatPhoto>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::PaymentsGetPaymentReceipt, &processRpcFunction<PaymentsRpcOperation, &PaymentsRpcOperation::processGetPaymentReceipt>,
+      PaymentsOperationFactory::needLocalUser() },
+    { TLValue::AuthImportAuthorization, &processRpcFunction<AuthRpcOperation, &AuthRpcOperation::processImportAuthorization>,
+      AuthOperationFactory::needLocalUser() },
+    { TLValue::MessagesGetUnreadMentions, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processGetUnreadMentions>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::HelpGetInviteText, &processRpcFunction<HelpRpcOperation, &HelpRpcOperation::processGetInviteText>,
+      HelpOperationFactory::needLocalUser() },
+    { TLValue::MessagesGetInlineGameHighScores, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processGetInlineGameHighScores>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::AccountUpdateDeviceLocked, &processRpcFunction<AccountRpcOperation, &AccountRpcOperation::processUpdateDeviceLocked>,
+      AccountOperationFactory::needLocalUser() },
+    { TLValue::MessagesSaveRecentSticker, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processSaveRecentSticker>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::PaymentsValidateRequestedInfo, &processRpcFunction<PaymentsRpcOperation, &PaymentsRpcOperation::processValidateRequestedInfo>,
+      PaymentsOperationFactory::needLocalUser() },
+    { 0, nullptr, false },
+    { TLValue::MessagesGetMessagesViews, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processGetMessagesViews>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::UploadGetFile, &processRpcFunction<UploadRpcOperation, &UploadRpcOperation::processGetFile>,
+      UploadOperationFactory::needLocalUser() },
+    { TLValue::ChannelsDeleteChannel, &processRpcFunction<ChannelsRpcOperation, &ChannelsRpcOperation::processDeleteChannel>,
+      ChannelsOperationFactory::needLocalUser() },
+    { TLValue::MessagesMigrateChat, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processMigrateChat>,
+      MessagesOperationFactory::needLocalUser() },
+    { 0, nullptr, false },
+    { TLValue::MessagesGetPeerSettings, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processGetPeerSettings>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::ChannelsEditAdmin, &processRpcFunction<ChannelsRpcOperation, &ChannelsRpcOperation::processEditAdmin>,
+      ChannelsOperationFactory::needLocalUser() },
+    { TLValue::PaymentsGetSavedInfo, &processRpcFunction<PaymentsRpcOperation, &PaymentsRpcOperation::processGetSavedInfo>,
+      PaymentsOperationFactory::needLocalUser() },
+    { TLValue::MessagesGetMaskStickers, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processGetMaskStickers>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::UpdatesGetState, &processRpcFunction<UpdatesRpcOperation, &UpdatesRpcOperation::processGetState>,
+      UpdatesOperationFactory::needLocalUser() },
+    { TLValue::ContactsResetTopPeerRating, &processRpcFunction<ContactsRpcOperation, &ContactsRpcOperation::processResetTopPeerRating>,
+      ContactsOperationFactory::needLocalUser() },
+    { TLValue::ChannelsGetChannels, &processRpcFunction<ChannelsRpcOperation, &ChannelsRpcOperation::processGetChannels>,
+      ChannelsOperationFactory::needLocalUser() },
+    { TLValue::MessagesRequestEncryption, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processRequestEncryption>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::ChannelsReportSpam, &processRpcFunction<ChannelsRpcOperation, &ChannelsRpcOperation::processReportSpam>,
+      ChannelsOperationFactory::needLocalUser() },
+    { TLValue::ChannelsJoinChannel, &processRpcFunction<ChannelsRpcOperation, &ChannelsRpcOperation::processJoinChannel>,
+      ChannelsOperationFactory::needLocalUser() },
+    { TLValue::PhotosUploadProfilePhoto, &processRpcFunction<PhotosRpcOperation, &PhotosRpcOperation::processUploadProfilePhoto>,
+      PhotosOperationFactory::needLocalUser() },
+    { TLValue::MessagesSendEncryptedService, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processSendEncryptedService>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::UploadGetCdnFileHashes, &processRpcFunction<UploadRpcOperation, &UploadRpcOperation::processGetCdnFileHashes>,
+      UploadOperationFactory::needLocalUser() },
+    { TLValue::AuthCheckPassword, &processRpcFunction<AuthRpcOperation, &AuthRpcOperation::processCheckPassword>,
+      AuthOperationFactory::needLocalUser() },
+    { TLValue::UploadReuploadCdnFile, &processRpcFunction<UploadRpcOperation, &UploadRpcOperation::processReuploadCdnFile>,
+      UploadOperationFactory::needLocalUser() },
+    { TLValue::MessagesDeleteMessages, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processDeleteMessages>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::MessagesEditMessage, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processEditMessage>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::MessagesToggleDialogPin, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processToggleDialogPin>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::AuthBindTempAuthKey, &processRpcFunction<AuthRpcOperation, &AuthRpcOperation::processBindTempAuthKey>,
+      AuthOperationFactory::needLocalUser() },
+    { TLValue::ChannelsEditTitle, &processRpcFunction<ChannelsRpcOperation, &ChannelsRpcOperation::processEditTitle>,
+      ChannelsOperationFactory::needLocalUser() },
+    { TLValue::AuthSendInvites, &processRpcFunction<AuthRpcOperation, &AuthRpcOperation::processSendInvites>,
+      AuthOperationFactory::needLocalUser() },
+    { TLValue::HelpGetTermsOfService, &processRpcFunction<HelpRpcOperation, &HelpRpcOperation::processGetTermsOfService>,
+      HelpOperationFactory::needLocalUser() },
+    { 0, nullptr, false },
+    { 0, nullptr, false },
+    { 0, nullptr, false },
+    { TLValue::MessagesGetStickerSet, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processGetStickerSet>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::ChannelsTogglePreHistoryHidden, &processRpcFunction<ChannelsRpcOperation, &ChannelsRpcOperation::processTogglePreHistoryHidden>,
+      ChannelsOperationFactory::needLocalUser() },
+    { TLValue::BotsAnswerWebhookJSONQuery, &processRpcFunction<BotsRpcOperation, &BotsRpcOperation::processAnswerWebhookJSONQuery>,
+      BotsOperationFactory::needLocalUser() },
+    { TLValue::AccountSetAccountTTL, &processRpcFunction<AccountRpcOperation, &AccountRpcOperation::processSetAccountTTL>,
+      AccountOperationFactory::needLocalUser() },
+    { TLValue::MessagesGetRecentLocations, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processGetRecentLocations>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::MessagesSetInlineGameScore, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processSetInlineGameScore>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::MessagesGetAllStickers, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processGetAllStickers>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::StickersCreateStickerSet, &processRpcFunction<StickersRpcOperation, &StickersRpcOperation::processCreateStickerSet>,
+      StickersOperationFactory::needLocalUser() },
+    { TLValue::MessagesSendEncryptedFile, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processSendEncryptedFile>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::MessagesSendScreenshotNotification, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processSendScreenshotNotification>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::MessagesExportChatInvite, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processExportChatInvite>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::UsersGetUsers, &processRpcFunction<UsersRpcOperation, &UsersRpcOperation::processGetUsers>,
+      UsersOperationFactory::needLocalUser() },
+    { 0, nullptr, false },
+    { TLValue::ChannelsSetStickers, &processRpcFunction<ChannelsRpcOperation, &ChannelsRpcOperation::processSetStickers>,
+      ChannelsOperationFactory::needLocalUser() },
+    { TLValue::PaymentsGetPaymentForm, &processRpcFunction<PaymentsRpcOperation, &PaymentsRpcOperation::processGetPaymentForm>,
+      PaymentsOperationFactory::needLocalUser() },
+    { TLValue::UploadSaveFilePart, &processRpcFunction<UploadRpcOperation, &UploadRpcOperation::processSaveFilePart>,
+      UploadOperationFactory::needLocalUser() },
+    { TLValue::ChannelsGetParticipants, &processRpcFunction<ChannelsRpcOperation, &ChannelsRpcOperation::processGetParticipants>,
+      ChannelsOperationFactory::needLocalUser() },
+    { TLValue::MessagesUninstallStickerSet, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processUninstallStickerSet>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::PhoneSaveCallDebug, &processRpcFunction<PhoneRpcOperation, &PhoneRpcOperation::processSaveCallDebug>,
+      PhoneOperationFactory::needLocalUser() },
+    { TLValue::AuthSignUp, &processRpcFunction<AuthRpcOperation, &AuthRpcOperation::processSignUp>,
+      AuthOperationFactory::needLocalUser() },
+    { TLValue::PhoneAcceptCall, &processRpcFunction<PhoneRpcOperation, &PhoneRpcOperation::processAcceptCall>,
+      PhoneOperationFactory::needLocalUser() },
+    { TLValue::MessagesCreateChat, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processCreateChat>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::MessagesGetAllDrafts, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processGetAllDrafts>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::ContactsGetTopPeers, &processRpcFunction<ContactsRpcOperation, &ContactsRpcOperation::processGetTopPeers>,
+      ContactsOperationFactory::needLocalUser() },
+    { TLValue::ContactsSearch, &processRpcFunction<ContactsRpcOperation, &ContactsRpcOperation::processSearch>,
+      ContactsOperationFactory::needLocalUser() },
+    { TLValue::MessagesGetHistory, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processGetHistory>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::HelpGetCdnConfig, &processRpcFunction<HelpRpcOperation, &HelpRpcOperation::processGetCdnConfig>,
+      HelpOperationFactory::needLocalUser() },
+    { 0, nullptr, false },
+    { TLValue::ChannelsCheckUsername, &processRpcFunction<ChannelsRpcOperation, &ChannelsRpcOperation::processCheckUsername>,
+      ChannelsOperationFactory::needLocalUser() },
+    { TLValue::UpdatesGetDifference, &processRpcFunction<UpdatesRpcOperation, &UpdatesRpcOperation::processGetDifference>,
+      UpdatesOperationFactory::needLocalUser() },
+    { TLValue::ChannelsCreateChannel, &processRpcFunction<ChannelsRpcOperation, &ChannelsRpcOperation::processCreateChannel>,
+      ChannelsOperationFactory::needLocalUser() },
+    { TLValue::ContactsDeleteContact, &processRpcFunction<ContactsRpcOperation, &ContactsRpcOperation::processDeleteContact>,
+      ContactsOperationFactory::needLocalUser() },
+    { TLValue::AccountSendConfirmPhoneCode, &processRpcFunction<AccountRpcOperation, &AccountRpcOperation::processSendConfirmPhoneCode>,
+      AccountOperationFactory::needLocalUser() },
+    { TLValue::MessagesDeleteChatUser, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processDeleteChatUser>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::MessagesGetMessageEditData, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processGetMessageEditData>,
+      MessagesOperationFactory::needLocalUser() },
+    { 0, nullptr, false },
+    { TLValue::UploadGetCdnFile, &processRpcFunction<UploadRpcOperation, &UploadRpcOperation::processGetCdnFile>,
+      UploadOperationFactory::needLocalUser() },
+    { TLValue::MessagesSendMedia, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processSendMedia>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::ContactsUnblock, &processRpcFunction<ContactsRpcOperation, &ContactsRpcOperation::processUnblock>,
+      ContactsOperationFactory::needLocalUser() },
+    { TLValue::PhotosDeletePhotos, &processRpcFunction<PhotosRpcOperation, &PhotosRpcOperation::processDeletePhotos>,
+      PhotosOperationFactory::needLocalUser() },
+    { TLValue::ChannelsDeleteUserHistory, &processRpcFunction<ChannelsRpcOperation, &ChannelsRpcOperation::processDeleteUserHistory>,
+      ChannelsOperationFactory::needLocalUser() },
+    { TLValue::MessagesGetChats, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processGetChats>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::ChannelsDeleteMessages, &processRpcFunction<ChannelsRpcOperation, &ChannelsRpcOperation::processDeleteMessages>,
+      ChannelsOperationFactory::needLocalUser() },
+    { TLValue::MessagesDiscardEncryption, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processDiscardEncryption>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::ContactsGetStatuses, &processRpcFunction<ContactsRpcOperation, &ContactsRpcOperation::processGetStatuses>,
+      ContactsOperationFactory::needLocalUser() },
+    { TLValue::PhoneConfirmCall, &processRpcFunction<PhoneRpcOperation, &PhoneRpcOperation::processConfirmCall>,
+      PhoneOperationFactory::needLocalUser() },
+    { TLValue::MessagesReadMessageContents, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processReadMessageContents>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::StickersAddStickerToSet, &processRpcFunction<StickersRpcOperation, &StickersRpcOperation::processAddStickerToSet>,
+      StickersOperationFactory::needLocalUser() },
+    { 0, nullptr, false },
+    { TLValue::MessagesGetPeerDialogs, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processGetPeerDialogs>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::UploadSaveBigFilePart, &processRpcFunction<UploadRpcOperation, &UploadRpcOperation::processSaveBigFilePart>,
+      UploadOperationFactory::needLocalUser() },
+    { TLValue::MessagesEditChatAdmin, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processEditChatAdmin>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::ContactsGetContacts, &processRpcFunction<ContactsRpcOperation, &ContactsRpcOperation::processGetContacts>,
+      ContactsOperationFactory::needLocalUser() },
+    { TLValue::PaymentsClearSavedInfo, &processRpcFunction<PaymentsRpcOperation, &PaymentsRpcOperation::processClearSavedInfo>,
+      PaymentsOperationFactory::needLocalUser() },
+    { TLValue::MessagesImportChatInvite, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processImportChatInvite>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::StickersRemoveStickerFromSet, &processRpcFunction<StickersRpcOperation, &StickersRpcOperation::processRemoveStickerFromSet>,
+      StickersOperationFactory::needLocalUser() },
+    { TLValue::ChannelsEditAbout, &processRpcFunction<ChannelsRpcOperation, &ChannelsRpcOperation::processEditAbout>,
+      ChannelsOperationFactory::needLocalUser() },
+    { TLValue::ChannelsGetParticipant, &processRpcFunction<ChannelsRpcOperation, &ChannelsRpcOperation::processGetParticipant>,
+      ChannelsOperationFactory::needLocalUser() },
+    { TLValue::AccountResetNotifySettings, &processRpcFunction<AccountRpcOperation, &AccountRpcOperation::processResetNotifySettings>,
+      AccountOperationFactory::needLocalUser() },
+    { TLValue::MessagesSendInlineBotResult, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processSendInlineBotResult>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::MessagesStartBot, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processStartBot>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::MessagesSendEncrypted, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processSendEncrypted>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::ContactsImportContacts, &processRpcFunction<ContactsRpcOperation, &ContactsRpcOperation::processImportContacts>,
+      ContactsOperationFactory::needLocalUser() },
+    { TLValue::ChannelsGetMessages, &processRpcFunction<ChannelsRpcOperation, &ChannelsRpcOperation::processGetMessages>,
+      ChannelsOperationFactory::needLocalUser() },
+    { TLValue::ChannelsReadHistory, &processRpcFunction<ChannelsRpcOperation, &ChannelsRpcOperation::processReadHistory>,
+      ChannelsOperationFactory::needLocalUser() },
+    { TLValue::UploadGetWebFile, &processRpcFunction<UploadRpcOperation, &UploadRpcOperation::processGetWebFile>,
+      UploadOperationFactory::needLocalUser() },
+    { TLValue::AccountCheckUsername, &processRpcFunction<AccountRpcOperation, &AccountRpcOperation::processCheckUsername>,
+      AccountOperationFactory::needLocalUser() },
+    { TLValue::MessagesEditInlineBotMessage, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processEditInlineBotMessage>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::MessagesReadMentions, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processReadMentions>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::ContactsImportCard, &processRpcFunction<ContactsRpcOperation, &ContactsRpcOperation::processImportCard>,
+      ContactsOperationFactory::needLocalUser() },
+    { TLValue::AccountSetPrivacy, &processRpcFunction<AccountRpcOperation, &AccountRpcOperation::processSetPrivacy>,
+      AccountOperationFactory::needLocalUser() },
+    { TLValue::MessagesToggleChatAdmins, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processToggleChatAdmins>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::MessagesReceivedQueue, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processReceivedQueue>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::MessagesForwardMessage, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processForwardMessage>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::PhotosGetUserPhotos, &processRpcFunction<PhotosRpcOperation, &PhotosRpcOperation::processGetUserPhotos>,
+      PhotosOperationFactory::needLocalUser() },
+    { TLValue::HelpGetAppUpdate, &processRpcFunction<HelpRpcOperation, &HelpRpcOperation::processGetAppUpdate>,
+      HelpOperationFactory::needLocalUser() },
+    { TLValue::ContactsExportCard, &processRpcFunction<ContactsRpcOperation, &ContactsRpcOperation::processExportCard>,
+      ContactsOperationFactory::needLocalUser() },
+    { TLValue::AuthImportBotAuthorization, &processRpcFunction<AuthRpcOperation, &AuthRpcOperation::processImportBotAuthorization>,
+      AuthOperationFactory::needLocalUser() },
+    { TLValue::MessagesGetFeaturedStickers, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processGetFeaturedStickers>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::MessagesGetPinnedDialogs, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processGetPinnedDialogs>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::AccountGetPassword, &processRpcFunction<AccountRpcOperation, &AccountRpcOperation::processGetPassword>,
+      AccountOperationFactory::needLocalUser() },
+    { TLValue::ChannelsExportInvite, &processRpcFunction<ChannelsRpcOperation, &ChannelsRpcOperation::processExportInvite>,
+      ChannelsOperationFactory::needLocalUser() },
+    { TLValue::AuthSignIn, &processRpcFunction<AuthRpcOperation, &AuthRpcOperation::processSignIn>,
+      AuthOperationFactory::needLocalUser() },
+    { TLValue::PhoneSetCallRating, &processRpcFunction<PhoneRpcOperation, &PhoneRpcOperation::processSetCallRating>,
+      PhoneOperationFactory::needLocalUser() },
+    { TLValue::ChannelsEditPhoto, &processRpcFunction<ChannelsRpcOperation, &ChannelsRpcOperation::processEditPhoto>,
+      ChannelsOperationFactory::needLocalUser() },
+    { TLValue::LangpackGetLangPack, &processRpcFunction<LangpackRpcOperation, &LangpackRpcOperation::processGetLangPack>,
+      LangpackOperationFactory::needLocalUser() },
+    { TLValue::AccountRegisterDevice, &processRpcFunction<AccountRpcOperation, &AccountRpcOperation::processRegisterDevice>,
+      AccountOperationFactory::needLocalUser() },
+    { TLValue::ChannelsExportMessageLink, &processRpcFunction<ChannelsRpcOperation, &ChannelsRpcOperation::processExportMessageLink>,
+      ChannelsOperationFactory::needLocalUser() },
+    { TLValue::AccountGetPasswordSettings, &processRpcFunction<AccountRpcOperation, &AccountRpcOperation::processGetPasswordSettings>,
+      AccountOperationFactory::needLocalUser() },
+    { 0, nullptr, false },
+    { TLValue::PhoneReceivedCall, &processRpcFunction<PhoneRpcOperation, &PhoneRpcOperation::processReceivedCall>,
+      PhoneOperationFactory::needLocalUser() },
+    { TLValue::AccountGetWallPapers, &processRpcFunction<AccountRpcOperation, &AccountRpcOperation::processGetWallPapers>,
+      AccountOperationFactory::needLocalUser() },
+    { TLValue::ChannelsGetFullChannel, &processRpcFunction<ChannelsRpcOperation, &ChannelsRpcOperation::processGetFullChannel>,
+      ChannelsOperationFactory::needLocalUser() },
+    { TLValue::HelpGetAppChangelog, &processRpcFunction<HelpRpcOperation, &HelpRpcOperation::processGetAppChangelog>,
+      HelpOperationFactory::needLocalUser() },
+    { TLValue::AccountUpdateUsername, &processRpcFunction<AccountRpcOperation, &AccountRpcOperation::processUpdateUsername>,
+      AccountOperationFactory::needLocalUser() },
+    { TLValue::AuthResetAuthorizations, &processRpcFunction<AuthRpcOperation, &AuthRpcOperation::processResetAuthorizations>,
+      AuthOperationFactory::needLocalUser() },
+    { TLValue::AccountUpdateNotifySettings, &processRpcFunction<AccountRpcOperation, &AccountRpcOperation::processUpdateNotifySettings>,
+      AccountOperationFactory::needLocalUser() },
+    { TLValue::PaymentsSendPaymentForm, &processRpcFunction<PaymentsRpcOperation, &PaymentsRpcOperation::processSendPaymentForm>,
+      PaymentsOperationFactory::needLocalUser() },
+    { TLValue::MessagesSetInlineBotResults, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processSetInlineBotResults>,
+      MessagesOperationFactory::needLocalUser() },
+    { 0, nullptr, false },
+    { TLValue::AuthCheckPhone, &processRpcFunction<AuthRpcOperation, &AuthRpcOperation::processCheckPhone>,
+      AuthOperationFactory::needLocalUser() },
+    { TLValue::AuthDropTempAuthKeys, &processRpcFunction<AuthRpcOperation, &AuthRpcOperation::processDropTempAuthKeys>,
+      AuthOperationFactory::needLocalUser() },
+    { 0, nullptr, false },
+    { TLValue::AccountGetTmpPassword, &processRpcFunction<AccountRpcOperation, &AccountRpcOperation::processGetTmpPassword>,
+      AccountOperationFactory::needLocalUser() },
+    { TLValue::MessagesHideReportSpam, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processHideReportSpam>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::MessagesReportEncryptedSpam, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processReportEncryptedSpam>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::MessagesGetMessages, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processGetMessages>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::MessagesEditChatTitle, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processEditChatTitle>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::AccountGetNotifySettings, &processRpcFunction<AccountRpcOperation, &AccountRpcOperation::processGetNotifySettings>,
+      AccountOperationFactory::needLocalUser() },
+    { TLValue::ChannelsGetAdminLog, &processRpcFunction<ChannelsRpcOperation, &ChannelsRpcOperation::processGetAdminLog>,
+      ChannelsOperationFactory::needLocalUser() },
+    { TLValue::AuthLogOut, &processRpcFunction<AuthRpcOperation, &AuthRpcOperation::processLogOut>,
+      AuthOperationFactory::needLocalUser() },
+    { TLValue::ChannelsReadMessageContents, &processRpcFunction<ChannelsRpcOperation, &ChannelsRpcOperation::processReadMessageContents>,
+      ChannelsOperationFactory::needLocalUser() },
+    { TLValue::AccountGetPrivacy, &processRpcFunction<AccountRpcOperation, &AccountRpcOperation::processGetPrivacy>,
+      AccountOperationFactory::needLocalUser() },
+    { TLValue::MessagesAcceptEncryption, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processAcceptEncryption>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::ChannelsToggleSignatures, &processRpcFunction<ChannelsRpcOperation, &ChannelsRpcOperation::processToggleSignatures>,
+      ChannelsOperationFactory::needLocalUser() },
+    { TLValue::MessagesSetBotShippingResults, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processSetBotShippingResults>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::AccountGetAuthorizations, &processRpcFunction<AccountRpcOperation, &AccountRpcOperation::processGetAuthorizations>,
+      AccountOperationFactory::needLocalUser() },
+    { TLValue::MessagesReorderPinnedDialogs, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processReorderPinnedDialogs>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::MessagesGetGameHighScores, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processGetGameHighScores>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::MessagesSetBotCallbackAnswer, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processSetBotCallbackAnswer>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::StickersChangeStickerPosition, &processRpcFunction<StickersRpcOperation, &StickersRpcOperation::processChangeStickerPosition>,
+      StickersOperationFactory::needLocalUser() },
+    { 0, nullptr, false },
+    { 0, nullptr, false },
+    { TLValue::MessagesGetDocumentByHash, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processGetDocumentByHash>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::MessagesGetWebPagePreview, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processGetWebPagePreview>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::MessagesGetFullChat, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processGetFullChat>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::MessagesReceivedMessages, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processReceivedMessages>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::AccountConfirmPhone, &processRpcFunction<AccountRpcOperation, &AccountRpcOperation::processConfirmPhone>,
+      AccountOperationFactory::needLocalUser() },
+    { TLValue::MessagesGetCommonChats, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processGetCommonChats>,
+      MessagesOperationFactory::needLocalUser() },
+    { 0, nullptr, false },
+    { TLValue::ContactsDeleteContacts, &processRpcFunction<ContactsRpcOperation, &ContactsRpcOperation::processDeleteContacts>,
+      ContactsOperationFactory::needLocalUser() },
+    { TLValue::MessagesGetFavedStickers, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processGetFavedStickers>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::MessagesUploadMedia, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processUploadMedia>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::MessagesFaveSticker, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processFaveSticker>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::MessagesSearchGlobal, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processSearchGlobal>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::PhoneGetCallConfig, &processRpcFunction<PhoneRpcOperation, &PhoneRpcOperation::processGetCallConfig>,
+      PhoneOperationFactory::needLocalUser() },
+    { TLValue::HelpGetNearestDc, &processRpcFunction<HelpRpcOperation, &HelpRpcOperation::processGetNearestDc>,
+      HelpOperationFactory::needLocalUser() },
+    { TLValue::PhoneDiscardCall, &processRpcFunction<PhoneRpcOperation, &PhoneRpcOperation::processDiscardCall>,
+      PhoneOperationFactory::needLocalUser() },
+    { TLValue::MessagesSendMessage, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processSendMessage>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::MessagesSetGameScore, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processSetGameScore>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::ContactsGetBlocked, &processRpcFunction<ContactsRpcOperation, &ContactsRpcOperation::processGetBlocked>,
+      ContactsOperationFactory::needLocalUser() },
+    { TLValue::AccountResetAuthorization, &processRpcFunction<AccountRpcOperation, &AccountRpcOperation::processResetAuthorization>,
+      AccountOperationFactory::needLocalUser() },
+    { TLValue::AuthExportAuthorization, &processRpcFunction<AuthRpcOperation, &AuthRpcOperation::processExportAuthorization>,
+      AuthOperationFactory::needLocalUser() },
+    { TLValue::MessagesGetSavedGifs, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processGetSavedGifs>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::AuthSendCode, &processRpcFunction<AuthRpcOperation, &AuthRpcOperation::processSendCode>,
+      AuthOperationFactory::needLocalUser() },
+    { TLValue::AccountGetAccountTTL, &processRpcFunction<AccountRpcOperation, &AccountRpcOperation::processGetAccountTTL>,
+      AccountOperationFactory::needLocalUser() },
+    { TLValue::ContactsResolveUsername, &processRpcFunction<ContactsRpcOperation, &ContactsRpcOperation::processResolveUsername>,
+      ContactsOperationFactory::needLocalUser() },
+    { TLValue::AuthRequestPasswordRecovery, &processRpcFunction<AuthRpcOperation, &AuthRpcOperation::processRequestPasswordRecovery>,
+      AuthOperationFactory::needLocalUser() },
+    { TLValue::MessagesGetBotCallbackAnswer, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processGetBotCallbackAnswer>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::MessagesSearchGifs, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processSearchGifs>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::MessagesSetEncryptedTyping, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processSetEncryptedTyping>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::UpdatesGetChannelDifference, &processRpcFunction<UpdatesRpcOperation, &UpdatesRpcOperation::processGetChannelDifference>,
+      UpdatesOperationFactory::needLocalUser() },
+    { TLValue::MessagesAddChatUser, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processAddChatUser>,
+      MessagesOperationFactory::needLocalUser() },
+    { 0, nullptr, false },
+    { 0, nullptr, false },
+    { TLValue::HelpGetSupport, &processRpcFunction<HelpRpcOperation, &HelpRpcOperation::processGetSupport>,
+      HelpOperationFactory::needLocalUser() },
+    { TLValue::AccountReportPeer, &processRpcFunction<AccountRpcOperation, &AccountRpcOperation::processReportPeer>,
+      AccountOperationFactory::needLocalUser() },
+    { TLValue::MessagesGetInlineBotResults, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processGetInlineBotResults>,
+      MessagesOperationFactory::needLocalUser() },
+    { 0, nullptr, false },
+    { TLValue::PhoneRequestCall, &processRpcFunction<PhoneRpcOperation, &PhoneRpcOperation::processRequestCall>,
+      PhoneOperationFactory::needLocalUser() },
+    { TLValue::MessagesSetBotPrecheckoutResults, &processRpcFunction<MessagesRpcOperation, &MessagesRpcOperation::processSetBotPrecheckoutResults>,
+      MessagesOperationFactory::needLocalUser() },
+    { TLValue::BotsSendCustomRequest, &processRpcFunction<BotsRpcOperation, &BotsRpcOperation::processSendCustomRequest>,
+      BotsOperationFactory::needLocalUser() },
+    { TLValue::AccountDeleteAccount, &processRpcFunction<AccountRpcOperation, &AccountRpcOperation::processDeleteAccount>,
+      AccountOperationFactory::needLocalUser() },
+    { 0, nullptr, false },
+    { TLValue::HelpGetConfig, &processRpcFunction<HelpRpcOperation, &HelpRpcOperation::processGetConfig>,
+      HelpOperationFactory::needLocalUser() },
+    { TLValue::AccountSendChangePhoneCode, &processRpcFunction<AccountRpcOperation, &AccountRpcOperation::processSendChangePhoneCode>,
+      AccountOperationFactory::needLocalUser() },
+    { TLValue::ChannelsLeaveChannel, &processRpcFunction<ChannelsRpcOperation, &ChannelsRpcOperation::processLeaveChannel>,
+      ChannelsOperationFactory::needLocalUser() },
+};
+// End of generated RPC dispatch table
+
+const RpcFunctionEntry *RpcOperationDispatch::find(TLValue function)
+{
+    const quint32 bucket = hash(function, 0) & quint32(c_dispatchBucketCount - 1);
+    const quint32 slot = hash(function, c_dispatchSeeds[bucket]) & quint32(c_dispatchTableSize - 1);
+    const RpcFunctionEntry *entry = &c_dispatchTable[slot];
+    if (!entry->process || (entry->function != function)) {
+        return nullptr;
+    }
+    return entry;
+}
+
+int RpcOperationDispatch::functionCount()
+{
+    return c_dispatchFunctionCount;
+}
+
+} // Server namespace
+
+} // Telegram namespace
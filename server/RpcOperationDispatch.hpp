@@ -0,0 +1,66 @@
+/*
+   Copyright (C) 2019 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+#ifndef TELEGRAM_SERVER_RPC_OPERATION_DISPATCH_HPP
+#define TELEGRAM_SERVER_RPC_OPERATION_DISPATCH_HPP
+
+#include "MTProto/TLValues.hpp"
+
+namespace Telegram {
+
+namespace Server {
+
+class RpcLayer;
+class RpcOperation;
+class RpcProcessingContext;
+
+struct RpcFunctionEntry
+{
+    using ProcessFunction = RpcOperation *(*)(RpcLayer *layer, RpcProcessingContext &context);
+
+    quint32 function;
+    ProcessFunction process;
+    bool needLocalUser;
+};
+
+// A perfect hash table of the RPC functions generated from the scheme.
+// The bucket of a function selects the seed which gives the function a unique slot in the table,
+// so a lookup takes two hash computations and one comparison.
+class RpcOperationDispatch
+{
+public:
+    static const RpcFunctionEntry *find(TLValue function);
+    static int functionCount();
+
+    // Keep in sync with the generator (Generator::rpcDispatchHash())
+    static constexpr quint32 hash(quint32 function, quint32 seed)
+    {
+        return mix((function ^ seed) * 0x85ebca6bu);
+    }
+
+protected:
+    static constexpr quint32 mix(quint32 value)
+    {
+        return value ^ (value >> 16);
+    }
+};
+
+} // Server namespace
+
+} // Telegram namespace
+
+#endif // TELEGRAM_SERVER_RPC_OPERATION_DISPATCH_HPP
@@ -17,7 +17,10 @@ public:
     virtual ~RpcOperationFactory() = default;
 
     virtual RpcOperation *processRpcCall(RpcLayer *layer, RpcProcessingContext &context) = 0;
-    virtual bool needLocalUser() const { return true; }
+
+    // Hidden in the factories of the functions available before the sign in.
+    // Resolved at compile time for the RpcOperationDispatch table.
+    static constexpr bool needLocalUser() { return true; }
 };
 
 } // Server namespace
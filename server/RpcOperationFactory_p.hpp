@@ -13,13 +13,9 @@ namespace Telegram {
 namespace Server {
 
 template <typename T>
-RpcOperation *processRpcCallImpl(RpcLayer *layer, RpcProcessingContext &context)
+RpcOperation *createRpcOperation(RpcLayer *layer, RpcProcessingContext &context,
+                                 bool (T::*method)(RpcProcessingContext &))
 {
-    bool (T::* const method)(RpcProcessingContext &) = T::getMethodForRpcFunction(context.readCode());
-    if (!method) {
-        return nullptr;
-    }
-    qDebug() << "processRpcCallImpl:" << context.readCode().toString() << "with messageId" << context.messageId();
     T *operation = new T(layer);
     bool fetchResult = (operation->*method)(context);
     RpcOperation *result = operation;
@@ -34,6 +30,23 @@ RpcOperation *processRpcCallImpl(RpcLayer *layer, RpcProcessingContext &context)
     return result;
 }
 
+template <typename T>
+RpcOperation *processRpcCallImpl(RpcLayer *layer, RpcProcessingContext &context)
+{
+    bool (T::* const method)(RpcProcessingContext &) = T::getMethodForRpcFunction(context.readCode());
+    if (!method) {
+        return nullptr;
+    }
+    return createRpcOperation<T>(layer, context, method);
+}
+
+// The processing method is bound at compile time, so the RpcOperationDispatch entry is a plain function pointer
+template <typename T, bool (T::*Method)(RpcProcessingContext &)>
+RpcOperation *processRpcFunction(RpcLayer *layer, RpcProcessingContext &context)
+{
+    return createRpcOperation<T>(layer, context, Method);
+}
+
 } // Server namespace
 
 } // Telegram namespace
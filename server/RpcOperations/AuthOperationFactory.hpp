@@ -116,7 +116,7 @@ class AuthOperationFactory : public RpcOperationFactory
 {
 public:
     RpcOperation *processRpcCall(RpcLayer *layer, RpcProcessingContext &context) override;
-    bool needLocalUser() const override { return false; }
+    static constexpr bool needLocalUser() { return false; }
 };
 
 } // Server namespace
@@ -92,7 +92,7 @@ class HelpOperationFactory : public RpcOperationFactory
 {
 public:
     RpcOperation *processRpcCall(RpcLayer *layer, RpcProcessingContext &context) override;
-    bool needLocalUser() const override { return false; }
+    static constexpr bool needLocalUser() { return false; }
 };
 
 } // Server namespace
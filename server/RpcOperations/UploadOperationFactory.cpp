@@ -33,6 +33,7 @@
 #include "MTProto/StreamExtraOperators.hpp"
 #include "FunctionStreamOperators.hpp"
 
+#include <QFileDevice>
 #include <QLoggingCategory>
 
 Q_LOGGING_CATEGORY(c_serverUploadRpcCategory, "telegram.server.rpc.upload", QtWarningMsg)
@@ -175,10 +176,33 @@ void UploadRpcOperation::runGetFile()
     result.tlType = TLValue::UploadFile;
     result.type.tlType = TLValue::StorageFilePng;
     result.mtime = descriptor.date;
-    result.bytes = file->read(arguments.limit);
+
+    // Reference the mapped file data (if the file can be mapped) instead of reading a copy of the chunk,
+    // so the stream copies the data straight into the preallocated reply buffer
+    const int bytesToRead = static_cast<int>(qBound<qint64>(0, file->bytesAvailable(), arguments.limit));
+    QFileDevice *fileDevice = qobject_cast<QFileDevice *>(file);
+    uchar *mappedData = fileDevice ? fileDevice->map(arguments.offset, bytesToRead) : nullptr;
+    if (mappedData) {
+        result.bytes = QByteArray::fromRawData(reinterpret_cast<const char *>(mappedData), bytesToRead);
+    } else {
+        result.bytes = file->read(bytesToRead);
+    }
+
+    MTProto::Stream output(MTProto::Stream::WriteOnly, 4 + 8 + MTProto::serializedSize(result));
+    RpcLayer::writeRpcResultHeader(&output, messageId());
+    output << result;
+    result.bytes.clear();
+    if (mappedData) {
+        fileDevice->unmap(mappedData);
+    }
     api()->mediaService()->endReadFile(file);
 
-    sendRpcReply(result);
+    if (output.error()) {
+        qCWarning(c_serverUploadRpcCategory) << CALL_INFO << "Unable to write the file data";
+        sendRpcError(RpcError::UnknownReason);
+        return;
+    }
+    layer()->sendRpcResult(this, output.getData());
 }
 
 void UploadRpcOperation::runGetWebFile()
@@ -80,7 +80,7 @@ class UploadOperationFactory : public RpcOperationFactory
 {
 public:
     RpcOperation *processRpcCall(RpcLayer *layer, RpcProcessingContext &context) override;
-    bool needLocalUser() const override { return false; }
+    static constexpr bool needLocalUser() { return false; }
 };
 
 } // Server namespace
@@ -18,10 +18,12 @@
 #include "ServerDhLayer.hpp"
 
 #include "MTProto/Stream.hpp"
+#include "BigNumber.hpp"
 #include "CTelegramTransport.hpp"
 #include "Debug_p.hpp"
 #include "RandomGenerator.hpp"
 #include "SendPackageHelper.hpp"
+#include "ServerDhWorker.hpp"
 #include "Utils.hpp"
 
 #include <QDateTime>
@@ -30,17 +32,6 @@
 
 Q_LOGGING_CATEGORY(c_serverDhLayerCategory, "telegram.server.dhlayer", QtInfoMsg)
 
-static const QByteArray c_hardcodedDhPrime =
-        QByteArray::fromHex(QByteArrayLiteral(
-                                "c71caeb9c6b1c9048e6c522f70f13f73980d40238e3e21c14934d037563d930f"
-                                "48198a0aa7c14058229493d22530f4dbfa336f6e0ac925139543aed44cce7c37"
-                                "20fd51f69458705ac68cd4fe6b6b13abdc9746512969328454f18faf8c595f64"
-                                "2477fe96bb2a941d5bcd1d4ac8cc49880708fa9b378e3c4f3a9060bee67cf9a4"
-                                "a4a695811051907e162753b56b0f6b410dba74d8a84b2a14b3144e0ef1284754"
-                                "fd17ed950d5965b4b9dd46582db1178d169c6bc465b0d6ff9ca3928fef5b9ae4"
-                                "e418fc15e83ebea0f87fa9ff5eed70050ded2849f47bf959d956850ce929851f"
-                                "0d8115f635b105ee2e4e15d04b2454bf6f4fadf034b10403119cd8e3b92fcc5b"));
-
 namespace Telegram {
 
 namespace Server {
@@ -127,7 +118,28 @@ bool DhLayer::processRequestDHParams(const QByteArray &data)
 
     qCDebug(c_serverDhLayerCategory) << Q_FUNC_INFO << "encrypted:" << encryptedPackage.toHex();
 
-    QByteArray decryptedPackage = Utils::binaryNumberModExp(encryptedPackage, m_rsaKey.modulus, m_rsaKey.secretExponent);
+    // The RSA decryption is a 2048-bit modular exponentiation with the secret exponent
+    const RsaKey key = m_rsaKey;
+    startTask([encryptedPackage, key]() {
+        return Utils::BigNumberModulus::get(key.modulus)->modExp(encryptedPackage, key.secretExponent);
+    }, [this](const QByteArray &decryptedPackage) {
+        if (decryptedPackage.isEmpty()) {
+            qCWarning(c_serverDhLayerCategory) << Q_FUNC_INFO << "Unable to decrypt the DH params request";
+            setState(State::Failed);
+            return;
+        }
+        if (!processRequestDHParamsInnerData(decryptedPackage)) {
+            setState(State::Failed);
+            return;
+        }
+        acceptDhParams();
+    });
+    return true;
+}
+
+bool DhLayer::processRequestDHParamsInnerData(const QByteArray &decryptedData)
+{
+    QByteArray decryptedPackage = decryptedData;
     constexpr int c_innerPackageSize = 255;
     if (decryptedPackage.size() < c_innerPackageSize) {
 #if QT_VERSION >= QT_VERSION_CHECK(5, 7, 0)
@@ -195,29 +207,23 @@ bool DhLayer::processRequestDHParams(const QByteArray &data)
 bool DhLayer::acceptDhParams()
 {
     qCDebug(c_serverDhLayerCategory) << Q_FUNC_INFO;
-    m_g = 7;
-    m_dhPrime.resize(256);
-    RandomGenerator::instance()->generate(&m_dhPrime);
-    m_dhPrime = c_hardcodedDhPrime;
-
-    //    if ((m_g < 2) || (m_g > 7)) {
-    //        qCDebug(c_serverDhLayerCategory) << "Error: 'g' number is out of acceptable range [2-7].";
-    //        return nullptr;
-    //    }
-
-    //    if (m_dhPrime.length() != 2048 / 8) {
-    //        qCDebug(c_serverDhLayerCategory) << "Error: dhPrime number length is not correct." << m_dhPrime.length() << 2048 / 8;
-    //        return nullptr;
-    //    }
-
-    //    if (!(m_dhPrime.at(0) & 128)) {
-    //        qCDebug(c_serverDhLayerCategory) << "Error: dhPrime is too small.";
-    //        return nullptr;
-    //    }
+    m_g = DhKeyPool::g();
+    m_dhPrime = DhKeyPool::dhPrime();
 
     // #5 Server computes random 2048-bit number a (using a sufficient amount of entropy)
-    m_a.resize(256);
-    RandomGenerator::instance()->generate(&m_a);
+    // The pairs of a and g_a are precomputed in the DH thread pool.
+    ++m_pendingTasks;
+    DhKeyPool::instance()->requestPair(this, [this](const DhKeyPair &pair) {
+        --m_pendingTasks;
+        sendServerDhParams(pair);
+    });
+    return true;
+}
+
+bool DhLayer::sendServerDhParams(const DhKeyPair &pair)
+{
+    m_a = pair.a;
+    m_gA = pair.gA;
 
     // IMPORTANT: Apart from the conditions on the Diffie-Hellman prime dh_prime and generator g,
     // both sides are to check that g, g_a and g_b are greater than 1 and less than dh_prime - 1.
@@ -227,8 +233,6 @@ bool DhLayer::acceptDhParams()
     qCDebug(c_serverDhLayerCategory) << "m_b" << m_a;
 #endif
 
-    m_gA = Utils::binaryNumberModExp(intToBytes(m_g), m_dhPrime, m_a);
-
     const QByteArray innerData = [this](){
         QByteArray data;
         MTProto::Stream stream(&data, /* write */ true);
@@ -261,7 +265,9 @@ bool DhLayer::acceptDhParams()
     outputStream << m_clientNonce;
     outputStream << m_serverNonce;
     outputStream << encryptedAnswer;
-    return sendReplyPackage(output);
+    sendReplyPackage(output);
+    setState(State::DhRepliedOK);
+    return true;
 }
 
 bool DhLayer::declineDhParams()
@@ -313,7 +319,23 @@ bool DhLayer::processSetClientDHParams(const QByteArray &data)
     QByteArray gB;
     encryptedInputStream >> gB;
 
-    const QByteArray newAuthKey = Utils::binaryNumberModExp(gB, m_dhPrime, m_a);
+    const QByteArray dhPrime = m_dhPrime;
+    const QByteArray a = m_a;
+    startTask([gB, dhPrime, a]() {
+        return Utils::BigNumberModulus::get(dhPrime)->modExp(gB, a);
+    }, [this](const QByteArray &newAuthKey) {
+        if (newAuthKey.isEmpty()) {
+            qCWarning(c_serverDhLayerCategory) << Q_FUNC_INFO << "Unable to compute the auth key";
+            setState(State::Failed);
+            return;
+        }
+        acceptAuthKey(newAuthKey);
+    });
+    return true;
+}
+
+void DhLayer::acceptAuthKey(const QByteArray &newAuthKey)
+{
     const QByteArray newAuthKeySha = Utils::sha1(newAuthKey);
 
     // answerDcGenOk
@@ -340,7 +362,19 @@ bool DhLayer::processSetClientDHParams(const QByteArray &data)
     }
     m_sendHelper->setAuthKey(newAuthKey);
     setServerSalt(m_serverNonce.parts[0] ^ m_newNonce.parts[0]);
-    return true;
+    setState(State::HasKey);
+}
+
+void DhLayer::startTask(const std::function<QByteArray()> &function,
+                        const std::function<void(const QByteArray &result)> &callback)
+{
+    ++m_pendingTasks;
+    DhTask *task = new DhTask(function);
+    connect(task, &DhTask::finished, this, [this, callback](const QByteArray &result) {
+        --m_pendingTasks;
+        callback(result);
+    });
+    DhKeyPool::threadPool()->start(task);
 }
 
 quint64 DhLayer::sendReplyPackage(const QByteArray &payload)
@@ -352,6 +386,12 @@ void DhLayer::processReceivedPacket(const QByteArray &payload)
 {
     const TLValue v = TLValue::firstFromArray(payload);
     qCInfo(c_serverDhLayerCategory) << this << __func__ << v.toString();
+    if (m_pendingTasks) {
+        qCWarning(c_serverDhLayerCategory) << this << __func__ << "Unexpected packet" << v.toString()
+                                           << "while the previous one is being processed";
+        setState(State::Failed);
+        return;
+    }
     switch (v) {
     case TLValue::ReqPq:
         if (!processRequestPQ(payload)) {
@@ -366,15 +406,13 @@ void DhLayer::processReceivedPacket(const QByteArray &payload)
             setState(State::Failed);
             return;
         }
-        acceptDhParams();
-        setState(State::DhRepliedOK);
+        // The reply is sent once the client data is decrypted in the DH thread pool
         break;
     case TLValue::SetClientDHParams:
         if (!processSetClientDHParams(payload)) {
             setState(State::Failed);
             return;
         }
-        setState(State::HasKey);
         break;
     default:
         break;
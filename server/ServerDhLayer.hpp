@@ -20,10 +20,14 @@
 
 #include "DhLayer.hpp"
 
+#include <functional>
+
 namespace Telegram {
 
 namespace Server {
 
+struct DhKeyPair;
+
 class DhLayer : public Telegram::BaseDhLayer
 {
     Q_OBJECT
@@ -34,16 +38,24 @@ public:
     bool processRequestPQ(const QByteArray &data);
     bool sendResultPQ();
     bool processRequestDHParams(const QByteArray &data);
+    bool processRequestDHParamsInnerData(const QByteArray &decryptedData);
     bool acceptDhParams();
+    bool sendServerDhParams(const DhKeyPair &pair);
     bool declineDhParams();
     bool processSetClientDHParams(const QByteArray &data);
+    void acceptAuthKey(const QByteArray &newAuthKey);
 
     quint64 sendReplyPackage(const QByteArray &payload);
 
 protected:
     void processReceivedPacket(const QByteArray &payload) override;
 
+    // Runs the function in the DH thread pool and calls the callback in this object thread
+    void startTask(const std::function<QByteArray()> &function,
+                   const std::function<void(const QByteArray &result)> &callback);
+
     QByteArray m_a;
+    int m_pendingTasks = 0;
 };
 
 } // Server namespace
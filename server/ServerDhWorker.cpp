@@ -0,0 +1,205 @@
+/*
+   Copyright (C) 2018 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+#include "ServerDhWorker.hpp"
+
+#include "BigNumber.hpp"
+#include "DhLayer.hpp"
+#include "RandomGenerator.hpp"
+#include "Utils.hpp"
+
+#include <QLoggingCategory>
+#include <QThreadPool>
+
+Q_LOGGING_CATEGORY(c_serverDhWorkerCategory, "telegram.server.dhworker", QtWarningMsg)
+
+static const QByteArray c_hardcodedDhPrime =
+        QByteArray::fromHex(QByteArrayLiteral(
+                                "c71caeb9c6b1c9048e6c522f70f13f73980d40238e3e21c14934d037563d930f"
+                                "48198a0aa7c14058229493d22530f4dbfa336f6e0ac925139543aed44cce7c37"
+                                "20fd51f69458705ac68cd4fe6b6b13abdc9746512969328454f18faf8c595f64"
+                                "2477fe96bb2a941d5bcd1d4ac8cc49880708fa9b378e3c4f3a9060bee67cf9a4"
+                                "a4a695811051907e162753b56b0f6b410dba74d8a84b2a14b3144e0ef1284754"
+                                "fd17ed950d5965b4b9dd46582db1178d169c6bc465b0d6ff9ca3928fef5b9ae4"
+                                "e418fc15e83ebea0f87fa9ff5eed70050ded2849f47bf959d956850ce929851f"
+                                "0d8115f635b105ee2e4e15d04b2454bf6f4fadf034b10403119cd8e3b92fcc5b"));
+
+static const quint32 c_hardcodedDhG = 7;
+
+namespace Telegram {
+
+namespace Server {
+
+Q_GLOBAL_STATIC(DhKeyPool, s_dhKeyPool)
+Q_GLOBAL_STATIC(QThreadPool, s_dhThreadPool)
+
+DhTask::DhTask(const Function &function) :
+    QObject(),
+    QRunnable(),
+    m_function(function)
+{
+    // The task object lives in the thread where it was created and is deleted there
+    setAutoDelete(false);
+}
+
+void DhTask::run()
+{
+    emit finished(m_function());
+    deleteLater();
+}
+
+class DhKeyPairTask : public QRunnable
+{
+public:
+    explicit DhKeyPairTask(const QByteArray &secret) :
+        m_secret(secret)
+    {
+    }
+
+    void run() override
+    {
+        DhKeyPair pair;
+        pair.a = m_secret;
+        pair.gA = DhKeyPool::computePublicKey(m_secret);
+        // The pool can be already destroyed on the application exit
+        if (DhKeyPool *pool = s_dhKeyPool()) {
+            pool->addPair(pair);
+        }
+    }
+
+protected:
+    QByteArray m_secret;
+};
+
+DhKeyPool *DhKeyPool::instance()
+{
+    return s_dhKeyPool();
+}
+
+quint32 DhKeyPool::g()
+{
+    return c_hardcodedDhG;
+}
+
+QByteArray DhKeyPool::dhPrime()
+{
+    return c_hardcodedDhPrime;
+}
+
+QThreadPool *DhKeyPool::threadPool()
+{
+    return s_dhThreadPool();
+}
+
+int DhKeyPool::capacity() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_capacity;
+}
+
+void DhKeyPool::setCapacity(int capacity)
+{
+    QMutexLocker locker(&m_mutex);
+    m_capacity = capacity;
+    if (m_pairs.count() > capacity) {
+        m_pairs.resize(qMax(0, capacity));
+    }
+}
+
+int DhKeyPool::availablePairs() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_pairs.count();
+}
+
+bool DhKeyPool::takePair(DhKeyPair *pair)
+{
+    QMutexLocker locker(&m_mutex);
+    if (m_pairs.isEmpty()) {
+        return false;
+    }
+    *pair = m_pairs.takeLast();
+    return true;
+}
+
+void DhKeyPool::refill()
+{
+    int missingPairs = 0;
+    {
+        QMutexLocker locker(&m_mutex);
+        missingPairs = m_capacity - m_pairs.count() - m_pendingPairs;
+        if (missingPairs <= 0) {
+            return;
+        }
+        m_pendingPairs += missingPairs;
+    }
+    qCDebug(c_serverDhWorkerCategory) << __func__ << "Schedule" << missingPairs << "new pairs";
+    // The secrets are generated in the caller thread as the RandomGenerator instance is not thread-safe
+    for (int i = 0; i < missingPairs; ++i) {
+        threadPool()->start(new DhKeyPairTask(generateSecret()));
+    }
+}
+
+void DhKeyPool::requestPair(QObject *context, const std::function<void (const DhKeyPair &)> &callback)
+{
+    DhKeyPair pair;
+    if (takePair(&pair)) {
+        refill();
+        callback(pair);
+        return;
+    }
+    qCDebug(c_serverDhWorkerCategory) << __func__ << "The pool is empty";
+    const QByteArray secret = generateSecret();
+    DhTask *task = new DhTask([secret]() {
+        return computePublicKey(secret);
+    });
+    QObject::connect(task, &DhTask::finished, context, [secret, callback](const QByteArray &publicKey) {
+        DhKeyPair newPair;
+        newPair.a = secret;
+        newPair.gA = publicKey;
+        callback(newPair);
+    });
+    threadPool()->start(task);
+    refill();
+}
+
+QByteArray DhKeyPool::generateSecret()
+{
+    // Random 2048-bit number a (using a sufficient amount of entropy)
+    QByteArray secret(256, Qt::Uninitialized);
+    RandomGenerator::instance()->generate(&secret);
+    return secret;
+}
+
+QByteArray DhKeyPool::computePublicKey(const QByteArray &secret)
+{
+    static const QSharedPointer<const Utils::BigNumberModulus> dhPrime = Utils::BigNumberModulus::get(c_hardcodedDhPrime);
+    return dhPrime->modExp(BaseDhLayer::intToBytes(c_hardcodedDhG), secret);
+}
+
+void DhKeyPool::addPair(const DhKeyPair &pair)
+{
+    QMutexLocker locker(&m_mutex);
+    --m_pendingPairs;
+    if (m_pairs.count() < m_capacity) {
+        m_pairs.append(pair);
+    }
+}
+
+} // Server namespace
+
+} // Telegram namespace
@@ -0,0 +1,98 @@
+/*
+   Copyright (C) 2018 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+#ifndef TELEGRAM_SERVER_DH_WORKER_HPP
+#define TELEGRAM_SERVER_DH_WORKER_HPP
+
+#include <QMutex>
+#include <QObject>
+#include <QRunnable>
+#include <QVector>
+
+#include <functional>
+
+QT_FORWARD_DECLARE_CLASS(QThreadPool)
+
+namespace Telegram {
+
+namespace Server {
+
+// Runs a heavy (modular exponentiation) function in the DH thread pool.
+// The finished() signal is emitted from the worker thread, so the receivers
+// get it queued in their own thread and are safely disconnected on destruction.
+class DhTask : public QObject, public QRunnable
+{
+    Q_OBJECT
+public:
+    using Function = std::function<QByteArray()>;
+
+    explicit DhTask(const Function &function);
+    void run() override;
+
+signals:
+    void finished(const QByteArray &result);
+
+protected:
+    Function m_function;
+};
+
+struct DhKeyPair
+{
+    QByteArray a;
+    QByteArray gA;
+};
+
+// A pool of precomputed (a, g_a) pairs for the server DH prime.
+// The pairs are refilled in the background, so a handshake only has to compute g_b^a.
+class DhKeyPool
+{
+public:
+    static DhKeyPool *instance();
+
+    static quint32 g();
+    static QByteArray dhPrime();
+    static QThreadPool *threadPool();
+
+    int capacity() const;
+    void setCapacity(int capacity);
+    int availablePairs() const;
+
+    bool takePair(DhKeyPair *pair);
+    void refill();
+
+    // Takes a pair from the pool or schedules the computation of a new pair.
+    // The callback is invoked in the context thread.
+    void requestPair(QObject *context, const std::function<void(const DhKeyPair &pair)> &callback);
+
+    static QByteArray generateSecret();
+    static QByteArray computePublicKey(const QByteArray &secret);
+
+protected:
+    friend class DhKeyPairTask;
+    void addPair(const DhKeyPair &pair);
+
+    mutable QMutex m_mutex;
+    QVector<DhKeyPair> m_pairs;
+    int m_capacity = 16;
+    int m_pendingPairs = 0;
+};
+
+} // Server namespace
+
+} // Telegram namespace
+
+#endif // TELEGRAM_SERVER_DH_WORKER_HPP
@@ -1,5 +1,7 @@
 #include "ServerRpcLayer.hpp"
 
+#include "Connection.hpp"
+#include "CTelegramTransport.hpp"
 #include "Debug_p.hpp"
 #include "FunctionStreamOperators.hpp"
 #include "IgnoredMessageNotification.hpp"
@@ -9,7 +11,7 @@
 #include "MTProto/StreamExtraOperators.hpp"
 #include "RemoteClientConnectionHelper.hpp"
 #include "RpcError.hpp"
-#include "RpcOperationFactory.hpp"
+#include "RpcOperationDispatch.hpp"
 #include "RpcProcessingContext.hpp"
 #include "SendPackageHelper.hpp"
 #include "ServerRpcOperation.hpp"
@@ -47,6 +49,14 @@ namespace Telegram {
 
 namespace Server {
 
+// The bulk output requests deferred for a slow consumer. Other (interactive) requests are always served.
+static const QVector<TLValue> c_lowPriorityRpcList =
+{
+    TLValue::UploadGetFile,
+    TLValue::UploadGetWebFile,
+    TLValue::UploadGetCdnFile,
+};
+
 static const QVector<TLValue> c_unregisteredUserAllowedRpcList =
 {
     TLValue::HelpGetConfig,
@@ -119,15 +129,10 @@ void RpcLayer::setSession(Session *session)
     m_session = session;
 }
 
-void RpcLayer::setRpcFactories(const QVector<RpcOperationFactory *> &rpcFactories)
-{
-    m_operationFactories = rpcFactories;
-}
-
 bool RpcLayer::processMTProtoMessage(const MTProto::Message &message)
 {
     TLValue requestValue = message.firstValue();
-    qCInfo(c_serverRpcLayerCategory) << CALL_INFO << requestValue.toString();
+    qCInfo(c_serverRpcLayerCategory) << CALL_INFO << requestValue;
 
     switch (requestValue) {
     case TLValue::InitConnection:
@@ -162,36 +167,91 @@ bool RpcLayer::processMTProtoMessage(const MTProto::Message &message)
     context.inputStream() >> requestValue;
     context.setReadCode(requestValue);
     if (!isAuthorized() && !c_unregisteredUserAllowedRpcList.contains(requestValue)) {
-        qCInfo(c_serverRpcLayerCategory) << CALL_INFO << "block" << requestValue.toString()
+        qCInfo(c_serverRpcLayerCategory) << CALL_INFO << "block" << requestValue
                                          << "for unauthorized connection" << getHelper()->authId();
         RpcError error(RpcError::Reason::AuthKeyUnregistered);
         return sendRpcError(error, context.messageId());
     }
 
-    RpcOperation *op = nullptr;
-    LocalUser *localUser = getUser();
-    for (RpcOperationFactory *f : m_operationFactories) {
-        if (f->needLocalUser() && !localUser) {
-            // Skip
-            continue;
-        }
-        op = f->processRpcCall(this, context);
-        if (op) {
-            break;
-        }
+    const RpcFunctionEntry *function = RpcOperationDispatch::find(requestValue);
+    if (!function) {
+        qCWarning(c_serverRpcLayerCategory) << Q_FUNC_INFO << requestValue << "is not processed!";
+        return false;
     }
+    if (function->needLocalUser && !getUser()) {
+        qCWarning(c_serverRpcLayerCategory) << Q_FUNC_INFO << requestValue << "is not processed (no local user)";
+        return false;
+    }
+    qCDebug(c_serverRpcLayerCategory) << CALL_INFO << "process" << requestValue
+                                      << "with messageId" << context.messageId();
+    RpcOperation *op = function->process(this, context);
     if (!op) {
-        qCWarning(c_serverRpcLayerCategory) << Q_FUNC_INFO << requestValue.toString() << "is not processed!";
+        qCWarning(c_serverRpcLayerCategory) << Q_FUNC_INFO << requestValue << "is not processed!";
         return false;
     }
 
     if (!op->isFinished()) {
-        op->startLater();
+        const bool isLowPriority = c_lowPriorityRpcList.contains(requestValue);
+        if (isLowPriority && (isSendQueueFull() || !m_deferredOperations.isEmpty())) {
+            // Do not produce more bulk replies for a slow consumer
+            deferOperation(op);
+        } else {
+            op->startLater();
+        }
         op->deleteOnFinished();
     }
     return true;
 }
 
+bool RpcLayer::isSendQueueFull() const
+{
+    const BaseConnection *connection = getHelper()->getConnection();
+    return connection->transport() && connection->transport()->isWriteBufferFull();
+}
+
+void RpcLayer::deferOperation(RpcOperation *operation)
+{
+    qCDebug(c_serverRpcLayerCategory) << CALL_INFO << "defer" << operation
+                                      << "until the send queue is drained";
+    m_deferredOperations.append(operation);
+    BaseTransport *transport = getHelper()->getConnection()->transport();
+    connect(transport, &BaseTransport::writeBufferDrained,
+            this, &RpcLayer::startDeferredOperations, Qt::UniqueConnection);
+}
+
+void RpcLayer::startDeferredOperations()
+{
+    const BaseTransport *transport = getHelper()->getConnection()->transport();
+    if (!transport || (transport->state() != QAbstractSocket::ConnectedState)) {
+        // The buffer is also drained on disconnect
+        dropDeferredOperations();
+        return;
+    }
+    // Start the operations one by one to let the buffer fill up again
+    while (!m_deferredOperations.isEmpty() && !isSendQueueFull()) {
+        RpcOperation *operation = m_deferredOperations.takeFirst();
+        if (operation) {
+            operation->start();
+        }
+    }
+}
+
+void RpcLayer::dropDeferredOperations()
+{
+    for (RpcOperation *operation : m_deferredOperations) {
+        if (operation) {
+            operation->deleteLater();
+        }
+    }
+    m_deferredOperations.clear();
+}
+
+void RpcLayer::onConnectionLost(const QVariantHash &details)
+{
+    BaseRpcLayer::onConnectionLost(details);
+    dropDeferredOperations();
+}
+
 bool RpcLayer::processMessageAck(const MTProto::Message &message)
 {
     MTProto::Stream stream(message.data);
@@ -308,9 +368,9 @@ quint64 RpcLayer::sendRpcReply(const QByteArray &reply, quint64 messageId)
     qCDebug(c_serverRpcDumpPackageCategory) << "Server: Answer for message" << messageId;
     qCDebug(c_serverRpcDumpPackageCategory).noquote() << "Server: RPC Reply bytes:" << reply.size() << reply.toHex();
 #endif
-    RawStream output(RawStream::WriteOnly);
-    output << TLValue::RpcResult;
-    output << messageId;
+    // RpcResult, messageId and the reply (the packed reply is smaller)
+    RawStream output(RawStream::WriteOnly, static_cast<quint32>(4 + 8 + reply.size()));
+    writeRpcResultHeader(&output, messageId);
     if (reply.size() > 128) { // Telegram spec says it should be 255, but we need to lower the limit to pack DcConfig
         const QByteArray innerData = Utils::packGZip(reply);
         if (innerData.size() + 8 < reply.size()) {
@@ -318,7 +378,10 @@ quint64 RpcLayer::sendRpcReply(const QByteArray &reply, quint64 messageId)
             innerStream << TLValue::GzipPacked;
             innerStream << innerData;
             output.writeBytes(innerStream.getData());
-            qCDebug(c_serverRpcDumpPackageCategory) << gzipPackMessage() << messageId << TLValue::firstFromArray(reply).toString();
+            if (ConnectionCounters *counters = getHelper()->counters()) {
+                counters->addSentGzipPackedMessage();
+            }
+            qCDebug(c_serverRpcDumpPackageCategory) << gzipPackMessage() << messageId << TLValue::firstFromArray(reply);
         } else {
             qCDebug(c_serverRpcDumpPackageCategory) << "Server: It makes no sense to gzip the answer for message" << messageId;
             output.writeBytes(reply);
@@ -337,7 +400,25 @@ bool RpcLayer::sendRpcMessage(const QByteArray &message)
 
 bool RpcLayer::sendRpcReply(RpcOperation *operation, const QByteArray &replyData)
 {
-    const quint64 operationReplyId = sendRpcReply(replyData, operation->messageId());
+    return trackOperationReply(operation, sendRpcReply(replyData, operation->messageId()));
+}
+
+void RpcLayer::writeRpcResultHeader(RawStream *output, quint64 messageId)
+{
+    *output << TLValue::RpcResult;
+    *output << messageId;
+}
+
+bool RpcLayer::sendRpcResult(RpcOperation *operation, const QByteArray &rpcResult)
+{
+    qCDebug(c_serverRpcDumpPackageCategory) << Q_FUNC_INFO << "rpc_result of" << rpcResult.size()
+                                            << "bytes for message id" << operation->messageId();
+    const quint64 replyMessageId = sendPacket(rpcResult, SendMode::ServerReply, MessageType::ContentRelatedMessage);
+    return trackOperationReply(operation, replyMessageId);
+}
+
+bool RpcLayer::trackOperationReply(RpcOperation *operation, quint64 operationReplyId)
+{
     if (!operationReplyId) {
         qCWarning(c_serverRpcLayerCategory) << "Unable to send RPC reply for" << operation
                                             << "op messageId:" << operation->messageId();
@@ -409,16 +490,6 @@ bool RpcLayer::processMessageHeader(const MTProto::FullMessageHeader &header)
     return true;
 }
 
-QByteArray RpcLayer::getEncryptionKeyPart() const
-{
-    return m_sendHelper->getServerKeyPart();
-}
-
-QByteArray RpcLayer::getVerificationKeyPart() const
-{
-    return m_sendHelper->getClientKeyPart();
-}
-
 MTProtoSendHelper *RpcLayer::getHelper() const
 {
     return static_cast<MTProtoSendHelper *>(m_sendHelper);
@@ -4,6 +4,7 @@
 #include "RpcLayer.hpp"
 
 #include <QHash>
+#include <QPointer>
 #include <QStack>
 #include <QVector>
 
@@ -14,13 +15,13 @@ struct TLUpdates;
 
 namespace Telegram {
 
+class RawStream;
 class RpcError;
 
 namespace Server {
 
 class MTProtoSendHelper;
 class RpcOperation;
-class RpcOperationFactory;
 
 class LocalUser;
 class LocalServerApi;
@@ -43,13 +44,16 @@ public:
     Session *session() const;
     void setSession(Session *session);
 
-    void setRpcFactories(const QVector<RpcOperationFactory*> &rpcFactories);
-
     bool processMTProtoMessage(const MTProto::Message &message) override;
     bool processMessageAck(const MTProto::Message &message);
 
     void sendUpdates(const TLUpdates &updates);
 
+    void onConnectionLost(const QVariantHash &details) override;
+
+    // True if the transport write buffer reached the high watermark
+    bool isSendQueueFull() const;
+
     // Low level
     bool processInitConnection(const MTProto::Message &message);
     bool processInvokeWithLayer(const MTProto::Message &message);
@@ -60,26 +64,32 @@ public:
     bool sendRpcMessage(const QByteArray &message);
     bool sendRpcReply(RpcOperation *operation, const QByteArray &replyData);
 
+    // The rpc_result can be written by the operation as a whole to let it put the reply data straight
+    // into the output buffer. Such results are sent as is (without the gzip packing).
+    static void writeRpcResultHeader(RawStream *output, quint64 messageId);
+    bool sendRpcResult(RpcOperation *operation, const QByteArray &rpcResult);
+
     static const char *gzipPackMessage();
 
     quint32 activeLayerNumber() const;
 
 protected:
     bool processMessageHeader(const MTProto::FullMessageHeader &header) override;
-    Crypto::AesKey getDecryptionAesKey(const QByteArray &messageKey) const final { return generateClientToServerAesKey(messageKey); }
-    Crypto::AesKey getEncryptionAesKey(const QByteArray &messageKey) const final { return generateServerToClientAesKey(messageKey); }
-
-    QByteArray getEncryptionKeyPart() const final;
-    QByteArray getVerificationKeyPart() const final;
+    KeyPart encryptionKeyPart() const final { return ServerKeyPart; }
 
     MTProtoSendHelper *getHelper() const;
+    bool trackOperationReply(RpcOperation *operation, quint64 replyMessageId);
+
+    void deferOperation(RpcOperation *operation);
+    void startDeferredOperations();
+    void dropDeferredOperations();
 
     Session *m_session = nullptr;
     LocalServerApi *m_api = nullptr;
     QStack<quint32> m_invokeWithLayer;
 
-    QVector<RpcOperationFactory*> m_operationFactories;
     QHash<quint64, RpcOperation *> m_operationsToConfirm; // messageId to operation
+    QVector<QPointer<RpcOperation>> m_deferredOperations; // Started once the send queue is drained
 };
 
 } // Server namespace
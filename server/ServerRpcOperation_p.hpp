@@ -14,7 +14,7 @@ namespace Server {
 template<typename TLType>
 bool RpcOperation::sendRpcReply(const TLType &reply)
 {
-    MTProto::Stream output(MTProto::Stream::WriteOnly);
+    MTProto::Stream output(MTProto::Stream::WriteOnly, MTProto::serializedSize(reply));
     output << reply;
 #ifdef DEVELOPER_BUILD
     qDebug() << this << reply;
@@ -4,12 +4,16 @@
 #include "AuthService.hpp"
 #include "CServerTcpTransport.hpp"
 #include "Debug_p.hpp"
+#include "LoopbackTransport.hpp"
 #include "MediaService.hpp"
 #include "MessageService.hpp"
+#include "PendingOperation.hpp"
 #include "RandomGenerator.hpp"
 #include "RemoteClientConnection.hpp"
 #include "RemoteServerConnection.hpp"
+#include "RpcError.hpp"
 #include "ServerDhLayer.hpp"
+#include "ServerDhWorker.hpp"
 #include "ServerMessageData.hpp"
 #include "ServerRpcLayer.hpp"
 #include "ServerUtils.hpp"
@@ -17,24 +21,6 @@
 #include "TelegramServerUser.hpp"
 #include "GroupChat.hpp"
 
-// Generated RPC Operation Factory includes
-#include "AccountOperationFactory.hpp"
-#include "AuthOperationFactory.hpp"
-#include "BotsOperationFactory.hpp"
-#include "ChannelsOperationFactory.hpp"
-#include "ContactsOperationFactory.hpp"
-#include "HelpOperationFactory.hpp"
-#include "LangpackOperationFactory.hpp"
-#include "MessagesOperationFactory.hpp"
-#include "PaymentsOperationFactory.hpp"
-#include "PhoneOperationFactory.hpp"
-#include "PhotosOperationFactory.hpp"
-#include "StickersOperationFactory.hpp"
-#include "UpdatesOperationFactory.hpp"
-#include "UploadOperationFactory.hpp"
-#include "UsersOperationFactory.hpp"
-// End of generated RPC Operation Factory includes
-
 #include <QLoggingCategory>
 #include <QTcpServer>
 #include <QTcpSocket>
@@ -57,25 +43,6 @@ Server::Server(QObject *parent) :
     m_mediaService = new MediaService(this);
     m_mediaServiceIface = m_mediaService;
 
-    m_rpcOperationFactories = {
-        // Generated RPC Operation Factory initialization
-        new AccountOperationFactory(),
-        new AuthOperationFactory(),
-        new BotsOperationFactory(),
-        new ChannelsOperationFactory(),
-        new ContactsOperationFactory(),
-        new HelpOperationFactory(),
-        new LangpackOperationFactory(),
-        new MessagesOperationFactory(),
-        new PaymentsOperationFactory(),
-        new PhoneOperationFactory(),
-        new PhotosOperationFactory(),
-        new StickersOperationFactory(),
-        new UpdatesOperationFactory(),
-        new UploadOperationFactory(),
-        new UsersOperationFactory(),
-        // End of generated RPC Operation Factory initialization
-    };
     m_serverSocket = new QTcpServer(this);
     connect(m_serverSocket, &QTcpServer::newConnection, this, &Server::onNewConnection);
 }
@@ -85,7 +52,6 @@ Server::~Server()
     qDeleteAll(m_authorizedUsers);
     qDeleteAll(m_sessions);
     qDeleteAll(m_users);
-    qDeleteAll(m_rpcOperationFactories);
 }
 
 void Server::setListenAddress(const QHostAddress &address)
@@ -106,6 +72,40 @@ void Server::setServerPrivateRsaKey(const Telegram::RsaKey &key)
     m_key = key;
 }
 
+void Server::setWriteCoalescingEnabled(bool enabled)
+{
+    m_writeCoalescingEnabled = enabled;
+}
+
+void Server::setWriteWatermarks(qint64 high, qint64 low)
+{
+    m_writeHighWatermark = high;
+    m_writeLowWatermark = low;
+}
+
+qint64 Server::bufferedBytes() const
+{
+    qint64 result = 0;
+    for (const RemoteClientConnection *client : m_activeConnections) {
+        result += client->transport()->bufferedBytes();
+    }
+    return result;
+}
+
+ConnectionStatistics Server::statistics() const
+{
+    ConnectionStatistics result;
+    for (const RemoteClientConnection *client : m_activeConnections) {
+        result += client->statistics();
+    }
+    return result;
+}
+
+void Server::setLoopbackTransportEnabled(bool enabled)
+{
+    m_loopbackTransportEnabled = enabled;
+}
+
 bool Server::start()
 {
     if (!m_dcOption.id) {
@@ -123,6 +123,21 @@ bool Server::start()
                                                               << " ("  << m_serverSocket->serverError() << ")";
         return false;
     }
+    if (m_loopbackTransportEnabled) {
+        if (!m_loopbackListener) {
+            m_loopbackListener = new LoopbackListener(this);
+            connect(m_loopbackListener, &LoopbackListener::newConnection, this, &Server::onNewLoopbackConnection);
+        }
+        if (!m_loopbackListener->listen(m_dcOption.address, m_dcOption.port)) {
+            qCCritical(loggingCategoryServer).noquote().nospace() << "Unable to listen loopback "
+                                                                  << m_dcOption.address << ":" << m_dcOption.port;
+            m_serverSocket->close();
+            return false;
+        }
+    }
+    // Warm up the DH key material for the incoming connections
+    DhKeyPool::instance()->refill();
+
     qCInfo(loggingCategoryServer).nospace().noquote() << "Start server (DC " << m_dcOption.id << ") "
                                                       << m_dcOption.address << ":" << m_dcOption.port
                                                       << " (listening " << m_serverSocket->serverAddress().toString()
@@ -138,6 +153,9 @@ void Server::stop()
     if (m_serverSocket) {
         m_serverSocket->close();
     }
+    if (m_loopbackListener) {
+        m_loopbackListener->close();
+    }
 
     // Connections removed from the set on disconnected.
     // Copy connections to a variable to iterate over a constant container instead of
@@ -195,6 +213,19 @@ void Server::onNewConnection()
     }
     TcpTransport *transport = new TcpTransport(socket, this);
     socket->setParent(transport);
+    addClientConnection(transport);
+}
+
+void Server::onNewLoopbackConnection(LoopbackTransport *transport)
+{
+    transport->setParent(this);
+    addClientConnection(transport);
+}
+
+void Server::addClientConnection(BaseTransport *transport)
+{
+    transport->setWriteCoalescingEnabled(m_writeCoalescingEnabled);
+    transport->setWriteWatermarks(m_writeHighWatermark, m_writeLowWatermark);
     RemoteClientConnection *client = new RemoteClientConnection(this);
     const QString address = transport->remoteAddress();
     qCInfo(loggingCategoryServer) << CALL_INFO << client;
@@ -203,7 +234,6 @@ void Server::onNewConnection()
     client->setServerRsaKey(m_key);
     client->setTransport(transport);
     client->setServerApi(this);
-    client->setRpcFactories(m_rpcOperationFactories);
 
     m_activeConnections.insert(client);
 }
@@ -1017,6 +1047,7 @@ bool Server::bakeUpdate(TLUpdate *update, const UpdateNotification &notification
             return false;
         }
 
+        Q_ASSERT(update->hasMember(TLUpdate::MessageMember));
         Utils::setupTLMessage(&update->message, messageData, notification.messageId, recipient);
         update->pts = notification.pts;
         update->ptsCount = 1;
@@ -1044,11 +1075,13 @@ bool Server::bakeUpdate(TLUpdate *update, const UpdateNotification &notification
             update->chatId = notification.dialogPeer.id();
             break;
         case Peer::Channel:
-            // Invalid peer
-            break;
+            // There is no typing update for channels
+            qCWarning(lcServerUpdates) << CALL_INFO << "unexpected message action peer" << notification.dialogPeer;
+            return false;
         }
         update->userId = notification.fromId;
         // Note: action depends on Layer. Process this to support different layers.
+        Q_ASSERT(update->hasMember(TLUpdate::ActionMember));
         update->action = Telegram::Utils::toTL(notification.messageAction);
     }
         break;
@@ -1186,11 +1219,21 @@ void Server::queueUpdates(const QVector<UpdateNotification> &notifications)
             break;
         }
 
+        // Typing and online status are transient; they are not worth to be queued for a slow consumer
+        const bool isLowPriority = (notification.type == UpdateNotification::Type::MessageAction)
+                || (notification.type == UpdateNotification::Type::UpdateUserStatus);
+
         for (Session *session : recipient->activeSessions()) {
             if (session == notification.excludeSession) {
                 continue;
             }
-            session->getConnection()->rpcLayer()->sendUpdates(updates);
+            RpcLayer *rpcLayer = session->getConnection()->rpcLayer();
+            if (isLowPriority && rpcLayer->isSendQueueFull()) {
+                qCDebug(lcServerUpdates) << CALL_INFO << "Drop a low priority update for session"
+                                         << session->id() << "(the send queue is full)";
+                continue;
+            }
+            rpcLayer->sendUpdates(updates);
         }
     }
 }
@@ -19,6 +19,10 @@ QT_FORWARD_DECLARE_CLASS(QTimer)
 
 namespace Telegram {
 
+class BaseTransport;
+class LoopbackListener;
+class LoopbackTransport;
+
 namespace Server {
 
 namespace Authorization {
@@ -35,7 +39,6 @@ class AbstractServerConnection;
 class AbstractUser;
 class LocalGroupChat;
 class PostBox;
-class RpcOperationFactory;
 
 class Server : public QObject, public LocalServerApi
 {
@@ -49,6 +52,26 @@ public:
 
     void setServerPrivateRsaKey(const Telegram::RsaKey &key);
 
+    // Applied to the client connections accepted after the call
+    bool isWriteCoalescingEnabled() const { return m_writeCoalescingEnabled; }
+    void setWriteCoalescingEnabled(bool enabled);
+
+    // Send-side backpressure limits applied to the client connections accepted after the call.
+    // Disabled (0) by default. See BaseTransport::setWriteWatermarks()
+    qint64 writeHighWatermark() const { return m_writeHighWatermark; }
+    qint64 writeLowWatermark() const { return m_writeLowWatermark; }
+    void setWriteWatermarks(qint64 high, qint64 low);
+
+    // The total number of bytes buffered for all client connections
+    qint64 bufferedBytes() const;
+    // The sum of the active client connections counters; see BaseConnection::statistics() for the per-connection data
+    ConnectionStatistics statistics() const;
+
+    // Accept in-process (LoopbackTransport) client connections on the DC address and port
+    // in addition to the TCP ones. Applied on start().
+    bool isLoopbackTransportEnabled() const { return m_loopbackTransportEnabled; }
+    void setLoopbackTransportEnabled(bool enabled);
+
     bool start();
     void stop();
     void loadData();
@@ -145,9 +168,11 @@ public slots:
 
 protected slots:
     void onNewConnection();
+    void onNewLoopbackConnection(LoopbackTransport *transport);
 
 protected:
     Session *addSession(quint64 sessionId);
+    void addClientConnection(BaseTransport *transport);
 
     void onClientConnectionStatusChanged();
     void onUserSessionStatusChanged(LocalUser *user, Session *session);
@@ -163,15 +188,19 @@ protected:
 
 private:
     QTcpServer *m_serverSocket;
+    LoopbackListener *m_loopbackListener = nullptr;
     QHostAddress m_listenAddress;
     DcOption m_dcOption;
     Telegram::RsaKey m_key;
 
     QSet<RemoteClientConnection*> m_activeConnections;
     QSet<AbstractServerConnection*> m_remoteServers;
-    QVector<RpcOperationFactory*> m_rpcOperationFactories;
     DcConfiguration m_dcConfiguration;
     quint32 m_localGroupId = 0;
+    bool m_writeCoalescingEnabled = false;
+    bool m_loopbackTransportEnabled = false;
+    qint64 m_writeHighWatermark = 0;
+    qint64 m_writeLowWatermark = 0;
 
     // Session data
     QHash<quint32, QByteArray> m_exportedAuthorizations; // userId to auth bytes
@@ -4,11 +4,13 @@ SOURCES += $$PWD/LocalCluster.cpp
 SOURCES += $$PWD/MediaService.cpp
 SOURCES += $$PWD/MessageService.cpp
 SOURCES += $$PWD/ServerDhLayer.cpp
+SOURCES += $$PWD/ServerDhWorker.cpp
 SOURCES += $$PWD/ServerMessageData.cpp
 SOURCES += $$PWD/ServerRpcLayer.cpp
 SOURCES += $$PWD/ServerRpcOperation.cpp
 SOURCES += $$PWD/ServerUtils.cpp
 SOURCES += $$PWD/Session.cpp
+SOURCES += $$PWD/RpcOperationDispatch.cpp
 SOURCES += $$PWD/RpcOperationFactory.cpp
 SOURCES += $$PWD/RpcProcessingContext.cpp
 SOURCES += $$PWD/TelegramServer.cpp
@@ -28,12 +30,14 @@ HEADERS += $$PWD/MediaService.hpp
 HEADERS += $$PWD/MessageService.hpp
 HEADERS += $$PWD/ServerApi.hpp
 HEADERS += $$PWD/ServerDhLayer.hpp
+HEADERS += $$PWD/ServerDhWorker.hpp
 HEADERS += $$PWD/ServerNamespace.hpp
 HEADERS += $$PWD/ServerMessageData.hpp
 HEADERS += $$PWD/ServerRpcLayer.hpp
 HEADERS += $$PWD/ServerRpcOperation.hpp
 HEADERS += $$PWD/ServerUtils.hpp
 HEADERS += $$PWD/Session.hpp
+HEADERS += $$PWD/RpcOperationDispatch.hpp
 HEADERS += $$PWD/RpcOperationFactory.hpp
 HEADERS += $$PWD/RpcOperationFactory_p.hpp
 HEADERS += $$PWD/RpcProcessingContext.hpp
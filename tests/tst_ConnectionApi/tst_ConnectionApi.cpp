@@ -36,6 +36,7 @@
 #include "CTcpTransport.hpp"
 #include "CTelegramTransport.hpp"
 #include "DcConfiguration.hpp"
+#include "LoopbackTransport.hpp"
 
 #ifdef TEST_PRIVATE_API
 #include "ConnectionApi_p.hpp"
@@ -44,16 +45,22 @@
 // Server
 #include "TelegramServer.hpp"
 #include "RemoteClientConnection.hpp"
+#include "RpcOperationDispatch.hpp"
 #include "TelegramServerUser.hpp"
 #include "ServerRpcLayer.hpp"
 #include "Session.hpp"
 #include "LocalCluster.hpp"
+#include "ServerDhWorker.hpp"
 
 #include <QTest>
 #include <QSignalSpy>
+#include <QPointer>
 #include <QDebug>
+#include <QElapsedTimer>
 #include <QRegularExpression>
 
+#include <algorithm>
+
 #include "keys_data.hpp"
 #include "TestAuthProvider.hpp"
 #include "TestClientUtils.hpp"
@@ -123,7 +130,12 @@ private slots:
 #ifdef TEST_PRIVATE_API
     void connectToServer_data();
     void connectToServer();
+    void benchmarkHandshakes_data();
+    void benchmarkHandshakes();
+    void loopbackDisconnectAfterReply();
 #endif
+    void rpcDispatch();
+    void benchmarkRpcDispatch();
     void testClientConnection_data();
     void testClientConnection();
     void registrationAuthError();
@@ -168,6 +180,24 @@ void tst_ConnectionApi::connectToServer_data()
     QTest::newRow("Abridged (dc1)")
             << Client::Settings::SessionType::Abridged
             << opt;
+    QTest::newRow("Intermediate (dc1)")
+            << Client::Settings::SessionType::Intermediate
+            << opt;
+    QTest::newRow("PaddedIntermediate (dc1)")
+            << Client::Settings::SessionType::PaddedIntermediate
+            << opt;
+    QTest::newRow("FullSize (dc1)")
+            << Client::Settings::SessionType::FullSize
+            << opt;
+    QTest::newRow("ObfuscatedIntermediate (dc1)")
+            << Client::Settings::SessionType::ObfuscatedIntermediate
+            << opt;
+    QTest::newRow("ObfuscatedPaddedIntermediate (dc1)")
+            << Client::Settings::SessionType::ObfuscatedPaddedIntermediate
+            << opt;
+    QTest::newRow("Loopback (dc1)")
+            << Client::Settings::SessionType::Loopback
+            << opt;
 
 }
 
@@ -186,6 +216,7 @@ void tst_ConnectionApi::connectToServer()
     cluster.setAuthorizationProvider(&authProvider);
     cluster.setServerPrivateRsaKey(privateKey);
     cluster.setServerConfiguration(c_customDcConfiguration);
+    cluster.setLoopbackTransportEnabled(true);
     QVERIFY(cluster.start());
 
     Test::Client client;
@@ -200,8 +231,159 @@ void tst_ConnectionApi::connectToServer()
     PendingOperation *connectOperation = privateApi->connectToServer({ clientDcOption });
     TRY_VERIFY(connectOperation->isFinished());
 }
+
+void tst_ConnectionApi::benchmarkHandshakes_data()
+{
+    QTest::addColumn<int>("keyPoolCapacity");
+    QTest::newRow("With key pool") << Server::DhKeyPool::instance()->capacity();
+    QTest::newRow("Without key pool") << 0;
+}
+
+void tst_ConnectionApi::benchmarkHandshakes()
+{
+    QFETCH(int, keyPoolCapacity);
+    constexpr int c_clientsCount = 32;
+
+    const RsaKey publicKey = RsaKey::fromFile(TestKeyData::publicKeyFileName());
+    QVERIFY2(publicKey.isValid(), "Unable to read public RSA key");
+    const RsaKey privateKey = RsaKey::fromFile(TestKeyData::privateKeyFileName());
+    QVERIFY2(privateKey.isPrivate(), "Unable to read private RSA key");
+
+    Server::DhKeyPool *keyPool = Server::DhKeyPool::instance();
+    // Restore the pool capacity for the next tests even if the benchmark fails
+    struct KeyPoolCapacityRestorer {
+        ~KeyPoolCapacityRestorer() { pool->setCapacity(capacity); }
+        Server::DhKeyPool *pool;
+        int capacity;
+    } capacityRestorer { keyPool, keyPool->capacity() };
+    keyPool->setCapacity(keyPoolCapacity);
+
+    Test::AuthProvider authProvider;
+    Telegram::Server::LocalCluster cluster;
+    cluster.setAuthorizationProvider(&authProvider);
+    cluster.setServerPrivateRsaKey(privateKey);
+    cluster.setServerConfiguration(c_customDcConfiguration);
+    cluster.setLoopbackTransportEnabled(true);
+    QVERIFY(cluster.start());
+    TRY_COMPARE(keyPool->availablePairs(), keyPoolCapacity);
+
+    const DcOption clientDcOption = c_localDcOptions.first();
+    qint64 elapsed = 0;
+
+    // A reconnection storm: all clients do the DH handshake at once
+    QBENCHMARK_ONCE {
+        // The clients are deleted with the parent even if the benchmark fails
+        QObject clientsParent;
+        QVector<PendingOperation *> operations;
+        QElapsedTimer timer;
+        timer.start();
+        for (int i = 0; i < c_clientsCount; ++i) {
+            Test::Client *client = new Test::Client(&clientsParent);
+            client->settings()->setPreferedSessionType(Client::Settings::SessionType::Loopback);
+            QVERIFY(client->settings()->setServerConfiguration({clientDcOption}));
+            QVERIFY(client->settings()->setServerRsaKey(publicKey));
+            Client::ConnectionApiPrivate *privateApi = Client::ConnectionApiPrivate::get(client->connectionApi());
+            operations.append(privateApi->connectToServer({ clientDcOption }));
+        }
+        TRY_VERIFY(std::all_of(operations.cbegin(), operations.cend(), [](PendingOperation *operation) {
+            return operation->isFinished();
+        }));
+        elapsed = timer.elapsed();
+        for (PendingOperation *operation : operations) {
+            QVERIFY(operation->isSucceeded());
+        }
+    }
+
+    qInfo().nospace() << c_clientsCount << " handshakes in " << elapsed << " ms ("
+                      << (elapsed ? c_clientsCount * 1000.0 / elapsed : 0.0) << " handshakes/sec)";
+}
+
+void tst_ConnectionApi::loopbackDisconnectAfterReply()
+{
+    const QString address = QStringLiteral("127.0.0.50");
+    const quint16 port = 11441;
+    LoopbackListener listener;
+    QVERIFY(listener.listen(address, port));
+    QPointer<LoopbackTransport> serverTransport;
+    connect(&listener, &LoopbackListener::newConnection, this, [&serverTransport](LoopbackTransport *transport) {
+        serverTransport = transport;
+    });
+
+    LoopbackTransport clientTransport;
+    QSignalSpy receivedSpy(&clientTransport, &BaseTransport::packetReceived);
+    clientTransport.connectToHost(address, port);
+    TRY_COMPARE(clientTransport.state(), QAbstractSocket::ConnectedState);
+    QVERIFY(serverTransport);
+
+    // The server sends the last reply and closes the connection right away
+    const QByteArray reply = QByteArrayLiteral("reply");
+    serverTransport->sendPacket(reply);
+    serverTransport->disconnectFromHost();
+    QCOMPARE(clientTransport.state(), QAbstractSocket::ConnectedState);
+
+    // The reply is delivered before the disconnection
+    TRY_COMPARE(clientTransport.state(), QAbstractSocket::UnconnectedState);
+    QCOMPARE(receivedSpy.count(), 1);
+    QCOMPARE(receivedSpy.first().first().toByteArray(), reply);
+    QCOMPARE(clientTransport.error(), QAbstractSocket::RemoteHostClosedError);
+}
 #endif
 
+static const QVector<TLValue> c_dispatchBenchmarkFunctions = {
+    TLValue::AuthSendCode,
+    TLValue::AuthSignIn,
+    TLValue::AccountUpdateStatus,
+    TLValue::ChannelsGetMessages,
+    TLValue::ContactsGetContacts,
+    TLValue::HelpGetConfig,
+    TLValue::MessagesGetDialogs,
+    TLValue::MessagesGetHistory,
+    TLValue::MessagesSendMessage,
+    TLValue::PhotosGetUserPhotos,
+    TLValue::UpdatesGetState,
+    TLValue::UpdatesGetDifference,
+    TLValue::UploadGetFile,
+    TLValue::UsersGetFullUser,
+};
+
+void tst_ConnectionApi::rpcDispatch()
+{
+    QVERIFY(Server::RpcOperationDispatch::functionCount() > c_dispatchBenchmarkFunctions.count());
+    for (const TLValue function : c_dispatchBenchmarkFunctions) {
+        const Server::RpcFunctionEntry *entry = Server::RpcOperationDispatch::find(function);
+        QVERIFY2(entry, qPrintable(function.toString()));
+        QCOMPARE(entry->function, quint32(function));
+        QVERIFY(entry->process);
+    }
+    // The functions available before the sign in
+    QVERIFY(!Server::RpcOperationDispatch::find(TLValue::AuthSendCode)->needLocalUser);
+    QVERIFY(!Server::RpcOperationDispatch::find(TLValue::HelpGetConfig)->needLocalUser);
+    QVERIFY(Server::RpcOperationDispatch::find(TLValue::MessagesGetDialogs)->needLocalUser);
+
+    // Not an RPC operation
+    QVERIFY(!Server::RpcOperationDispatch::find(TLValue::Ping));
+    QVERIFY(!Server::RpcOperationDispatch::find(TLValue::MsgContainer));
+    QVERIFY(!Server::RpcOperationDispatch::find(TLValue::Message));
+    QVERIFY(!Server::RpcOperationDispatch::find(TLValue(0)));
+}
+
+void tst_ConnectionApi::benchmarkRpcDispatch()
+{
+    constexpr int c_lookupsCount = 1000;
+    int found = 0;
+    QBENCHMARK {
+        found = 0;
+        for (int i = 0; i < c_lookupsCount; ++i) {
+            for (const TLValue function : c_dispatchBenchmarkFunctions) {
+                if (Server::RpcOperationDispatch::find(function)) {
+                    ++found;
+                }
+            }
+        }
+    }
+    QCOMPARE(found, c_lookupsCount * c_dispatchBenchmarkFunctions.count());
+}
+
 void tst_ConnectionApi::testClientConnection_data()
 {
     QTest::addColumn<Telegram::Client::Settings::SessionType>("sessionType");
@@ -256,6 +438,12 @@ void tst_ConnectionApi::testClientConnection_data()
             << opt
             << c_dontWaitForPhoneRequest;
 
+    QTest::newRow("Loopback with migration")
+            << Client::Settings::SessionType::Loopback
+            << userOnDc2
+            << opt
+            << c_dontWaitForPhoneRequest;
+
     opt.id = 0;
     QTest::newRow("Migration from unknown dc (with password)")
             << Client::Settings::SessionType::Obfuscated
@@ -289,6 +477,7 @@ void tst_ConnectionApi::testClientConnection()
     cluster.setAuthorizationProvider(&authProvider);
     cluster.setServerPrivateRsaKey(privateKey);
     cluster.setServerConfiguration(c_customDcConfiguration);
+    cluster.setLoopbackTransportEnabled(true);
     QVERIFY(cluster.start());
 
     Server::AbstractServerApi *server = cluster.getServerApiInstance(userData.dcId);
@@ -386,6 +575,21 @@ void tst_ConnectionApi::testClientConnection()
     QCOMPARE(client.accountStorage()->dcInfo().id, server->dcId());
     QCOMPARE(client.accountStorage()->dcInfo().id, userData.dcId);
     QVERIFY(client.contactsApi()->selfUserId());
+
+    const ConnectionStatistics clientStatistics = connectionApi->statistics();
+    QVERIFY(clientStatistics.sentPackets > 0);
+    QVERIFY(clientStatistics.receivedPackets > 0);
+    QVERIFY(clientStatistics.sentBytes > clientStatistics.sentPackets);
+    QCOMPARE(clientStatistics.decryptionFailures, quint64(0));
+    quint64 processedPackets = 0;
+    for (quint64 bucketPackets : clientStatistics.processingTimeHistogram) {
+        processedPackets += bucketPackets;
+    }
+    QCOMPARE(processedPackets, clientStatistics.receivedPackets);
+
+    const ConnectionStatistics serverStatistics = cluster.getServerInstance(userData.dcId)->statistics();
+    QVERIFY(serverStatistics.receivedPackets > 0);
+    QVERIFY(serverStatistics.sentBytes > 0);
 }
 
 void tst_ConnectionApi::registrationAuthError()